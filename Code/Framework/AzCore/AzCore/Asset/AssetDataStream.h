@@ -69,6 +69,8 @@ namespace AZ::Data
         void Close() override;
 
         const char* GetFilename() const override { return m_filePath.c_str(); }
+        //! The data is only available in place once it's fully loaded.
+        const void* GetContiguousData() const override { return IsFullyLoaded() ? m_buffer : nullptr; }
 
         AZStd::chrono::milliseconds GetStreamingDeadline() const { return m_curDeadline; }
         AZ::IO::IStreamerTypes::Priority GetStreamingPriority() const { return m_curPriority; }
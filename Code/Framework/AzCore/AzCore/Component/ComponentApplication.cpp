@@ -23,6 +23,7 @@
 
 #include <AzCore/Memory/OverrunDetectionAllocator.h>
 #include <AzCore/Memory/AllocatorManager.h>
+#include <AzCore/Memory/FrameArenaAllocator.h>
 #include <AzCore/Memory/MallocSchema.h>
 
 #include <AzCore/NativeUI/NativeUIRequests.h>
@@ -453,6 +454,7 @@ namespace AZ
         // Initializes the OSAllocator and SystemAllocator as soon as possible
         CreateOSAllocator();
         CreateSystemAllocator();
+        CreateFrameArenaAllocator();
 
         // Now that the Allocators are initialized, the Command Line parameters can be parsed
         m_commandLine.Parse(m_argC, m_argV);
@@ -620,6 +622,7 @@ namespace AZ
         // to use supplied startupParameters and descriptor parameters this time
         CreateOSAllocator();
         CreateSystemAllocator();
+        CreateFrameArenaAllocator();
 
 #if !defined(_RELEASE)
         m_budgetTracker.Init();
@@ -795,6 +798,13 @@ namespace AZ
 
     void ComponentApplication::DestroyAllocator()
     {
+        if (m_isFrameArenaAllocatorOwner)
+        {
+            static_cast<FrameArenaAllocator&>(AllocatorInstance<FrameArenaAllocator>::GetAllocator()).ResetFrame();
+            AllocatorInstance<FrameArenaAllocator>::Destroy();
+            m_isFrameArenaAllocatorOwner = false;
+        }
+
         // kill the system allocator if we created it
         if (m_isSystemAllocatorOwner)
         {
@@ -926,11 +936,66 @@ namespace AZ
         allocatorManager.FinalizeConfiguration();
     }
 
+    void ComponentApplication::CreateFrameArenaAllocator()
+    {
+        // The frame arena doesn't reserve any memory until it's used, so it's always available for transient per frame
+        // data. It's reset at the start of every tick.
+        if (!AllocatorInstance<FrameArenaAllocator>::IsReady())
+        {
+            AllocatorInstance<FrameArenaAllocator>::Create();
+            m_isFrameArenaAllocatorOwner = true;
+        }
+    }
+
+    bool ComponentApplication::LoadSettingsRegistrySnapshot(SettingsRegistryInterface& registry,
+        const SettingsRegistryInterface::Specializations& specializations, SettingsRegistrySnapshotInfo& snapshotInfo)
+    {
+        // The snapshot is only accepted if it was created from the same starting state, which includes the command line.
+        snapshotInfo = {};
+        if (!registry.Get(snapshotInfo.m_path.Native(), SettingsRegistryMergeUtils::SnapshotPathKey) || snapshotInfo.m_path.empty())
+        {
+            return false;
+        }
+        snapshotInfo.m_registry = azrtti_cast<SettingsRegistryImpl*>(&registry);
+        if (snapshotInfo.m_registry == nullptr)
+        {
+            return false;
+        }
+
+        size_t contextKey = snapshotInfo.m_registry->CalculateHash();
+        for (size_t i = 0; i < specializations.GetCount(); ++i)
+        {
+            AZStd::hash_combine(contextKey, specializations.GetSpecialization(i));
+        }
+        snapshotInfo.m_contextKey = aznumeric_cast<u64>(contextKey);
+        return snapshotInfo.m_registry->LoadSnapshot(snapshotInfo.m_path.Native(), snapshotInfo.m_contextKey);
+    }
+
+    void ComponentApplication::WriteSettingsRegistrySnapshot(const SettingsRegistrySnapshotInfo& snapshotInfo)
+    {
+        if (snapshotInfo.m_registry != nullptr)
+        {
+            snapshotInfo.m_registry->WriteSnapshot(snapshotInfo.m_path.Native(), snapshotInfo.m_contextKey);
+        }
+    }
+
     void ComponentApplication::MergeSettingsToRegistry(SettingsRegistryInterface& registry)
     {
         SettingsRegistryInterface::Specializations specializations;
         SetSettingsRegistrySpecializations(specializations);
 
+        // If a snapshot has been configured, try to load the settings from it instead of merging all the settings files.
+        SettingsRegistrySnapshotInfo snapshotInfo;
+        if (LoadSettingsRegistrySnapshot(registry, specializations, snapshotInfo))
+        {
+#if defined(AZ_DEBUG_BUILD) || defined(AZ_PROFILE_BUILD)
+            // The command line always has the final say, including over the settings stored in the snapshot.
+            SettingsRegistryMergeUtils::MergeSettingsToRegistry_CommandLine(registry, m_commandLine, true);
+#endif
+            SettingsRegistryMergeUtils::MergeSettingsToRegistry_AddRuntimeFilePaths(registry);
+            return;
+        }
+
         AZStd::vector<char> scratchBuffer;
 #if defined(AZ_DEBUG_BUILD) || defined(AZ_PROFILE_BUILD)
         // In development builds apply the o3de registry and the command line to allow early overrides. This will
@@ -975,6 +1040,8 @@ namespace AZ
 #endif
         // Update the Runtime file paths in case the "{BootstrapSettingsRootKey}/assets" key was overriden by a setting registry
         SettingsRegistryMergeUtils::MergeSettingsToRegistry_AddRuntimeFilePaths(registry);
+
+        WriteSettingsRegistrySnapshot(snapshotInfo);
     }
 
     void ComponentApplication::SetSettingsRegistrySpecializations(SettingsRegistryInterface::Specializations& specializations)
@@ -1417,6 +1484,13 @@ namespace AZ
     {
         AZ_PROFILE_SCOPE(System, "Component application simulation tick");
 
+        // Transient per frame allocations the tick thread made during the previous tick are no longer in use. Other threads
+        // may still be using theirs, so they end their frames themselves.
+        if (AllocatorInstance<FrameArenaAllocator>::IsReady())
+        {
+            static_cast<FrameArenaAllocator&>(AllocatorInstance<FrameArenaAllocator>::GetAllocator()).ResetThreadFrame();
+        }
+
         {
             AZ_PROFILE_SCOPE(AzCore, "ComponentApplication::Tick:ExecuteQueuedEvents");
             TickBus::ExecuteQueuedEvents();
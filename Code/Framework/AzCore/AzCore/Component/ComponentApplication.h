@@ -37,6 +37,7 @@ namespace AZ
     class IConsole;
     class Module;
     class ModuleManager;
+    class SettingsRegistryImpl;
     class TimeSystem;
 }
 namespace AZ::Debug
@@ -322,8 +323,25 @@ namespace AZ
         /// Create the system allocator using the data in the m_descriptor
         void        CreateSystemAllocator();
 
+        /// Create the frame arena allocator for transient per frame data if it doesn't exist yet
+        void        CreateFrameArenaAllocator();
+
         virtual void MergeSettingsToRegistry(SettingsRegistryInterface& registry);
 
+        //! Information needed to write the merged Settings Registry to a snapshot after a snapshot couldn't be used.
+        struct SettingsRegistrySnapshotInfo
+        {
+            AZ::IO::FixedMaxPath m_path;
+            SettingsRegistryImpl* m_registry{ nullptr };
+            u64 m_contextKey{ 0 };
+        };
+        //! Tries to load the merged settings from the snapshot set with SettingsRegistryMergeUtils::SnapshotPathKey, if any.
+        //! Returns true if the snapshot was loaded, in which case the command line still needs to be applied on top of it.
+        //! Otherwise the settings need to be merged as usual, after which WriteSettingsRegistrySnapshot stores them.
+        bool LoadSettingsRegistrySnapshot(SettingsRegistryInterface& registry,
+            const SettingsRegistryInterface::Specializations& specializations, SettingsRegistrySnapshotInfo& snapshotInfo);
+        void WriteSettingsRegistrySnapshot(const SettingsRegistrySnapshotInfo& snapshotInfo);
+
         //! Sets the specializations that will be used when loading the Settings Registry. Extend this in derived
         //! application classes to specialize settings for those applications.
         virtual void SetSettingsRegistrySpecializations(SettingsRegistryInterface::Specializations& specializations);
@@ -372,6 +390,7 @@ namespace AZ
         bool                                        m_isStarted{ false };
         bool                                        m_isSystemAllocatorOwner{ false };
         bool                                        m_isOSAllocatorOwner{ false };
+        bool                                        m_isFrameArenaAllocatorOwner{ false };
         bool                                        m_ownsConsole{};
         void*                                       m_fixedMemoryBlock{ nullptr }; //!< Pointer to the memory block allocator, so we can free it OnDestroy.
         IAllocatorAllocate*                         m_osAllocator{ nullptr };
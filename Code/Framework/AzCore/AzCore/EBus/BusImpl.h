@@ -820,6 +820,9 @@ namespace AZ
         }
 
 #undef EBUS_DO_ROUTING
+#undef EBUS_DO_SOLE_HANDLER_DISPATCH
+#undef EBUS_DO_SOLE_HANDLER_DISPATCH_RESULT
+#undef EBUS_DO_SOLE_HANDLER_DISPATCH_IMPL
 
         template <class Bus, class Traits>
         template <class Function, class ... InputArgs>
@@ -831,13 +834,11 @@ namespace AZ
             auto& context = Bus::GetOrCreateContext(false);
             if (context.m_queue.IsActive())
             {
-                AZStd::scoped_lock<decltype(context.m_queue.m_messagesMutex)> messageLock(context.m_queue.m_messagesMutex);
-                context.m_queue.m_messages.push(typename Bus::QueuePolicy::BusMessageCall(
+                context.m_queue.m_messages.Push(
                     [func = AZStd::forward<Function>(func), args...]() mutable
                 {
                     AZStd::invoke(AZStd::forward<Function>(func), AZStd::forward<InputArgs>(args)...);
-                },
-                    typename Traits::AllocatorType()));
+                });
             }
             else
             {
@@ -26,6 +26,7 @@
 #include <AzCore/std/typetraits/is_same.h>
 
 #include <AzCore/std/utils.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/scoped_lock.h>
 #include <AzCore/std/parallel/shared_mutex.h>
 
@@ -198,6 +199,16 @@ namespace AZ
         */
         static constexpr bool LocklessDispatch = false;
 
+        /**
+        * Determines whether broadcasts call the handler directly when exactly one handler is connected.
+        * The handler is cached when handlers connect or disconnect, so broadcasts skip locking, iterating
+        * over the handlers and tracking the callstack. As a result, GetCurrentBusId and IsInDispatch don't
+        * report these broadcasts. Routers disable the fast path while they are connected.
+        * Requires #LocklessDispatch, because the same restrictions on connecting and disconnecting apply.
+        * By default, broadcasts always use the standard dispatch.
+        */
+        static constexpr bool EnableSoleHandlerDispatch = false;
+
         /**
          * Specifies where EBus data is stored.
          * This drives how many instances of this EBus exist at runtime.
@@ -528,6 +539,8 @@ namespace AZ
             "When you use EBusAddressPolicy::Single or EBusAddressPolicy::ById there is no need to define BusIdOrderCompare!");
         static_assert((BusTraits::AddressPolicy != EBusAddressPolicy::ByIdAndOrdered || !AZStd::is_same<BusIdOrderCompare, NullBusIdCompare>::value),
             "When you use EBusAddressPolicy::ByIdAndOrdered you must define BusIdOrderCompare (ex. using BusIdOrderCompare = AZStd::less<BusIdType>)");
+        static_assert((!BusTraits::EnableSoleHandlerDispatch || BusTraits::LocklessDispatch),
+            "EnableSoleHandlerDispatch skips the dispatch lock, so it can only be used on buses with LocklessDispatch!");
         /// @endcond
         /// //////////////////////////////////////////////////////////////////////////
 
@@ -555,6 +568,12 @@ namespace AZ
          * @param handler The handler to disconnect from the EBus address.
          */
         static void DisconnectInternal(Context& context, HandlerNode& handler);
+
+        /**
+         * Updates the cached handler used by EBusTraits::EnableSoleHandlerDispatch.
+         * Only call this if the context mutex is held already.
+         */
+        static void UpdateSoleHandler(Context& context);
         /// @endcond
 
         /**
@@ -659,6 +678,8 @@ namespace AZ
             ContextMutexType        m_contextMutex;  ///< Mutex to control access when modifying the context
             QueuePolicy             m_queue;
             RouterPolicy            m_routing;
+            AZStd::atomic<Interface*> m_soleHandler{ nullptr }; ///< The only connected handler, only set when EBusTraits::EnableSoleHandlerDispatch is true
+            size_t                  m_handlerCount = 0;  ///< Number of connected handlers, only tracked when EBusTraits::EnableSoleHandlerDispatch is true
 
             Context();
             Context(EBusEnvironment* environment);
@@ -1016,6 +1037,11 @@ AZ_PUSH_DISABLE_WARNING(4127, "-Wunknown-warning-option")
 
         // Do the actual connection
         context.m_buses.Connect(handler, id);
+        if constexpr (Traits::EnableSoleHandlerDispatch)
+        {
+            ++context.m_handlerCount;
+            UpdateSoleHandler(context);
+        }
 
         BusPtr ptr;
         if constexpr (EBus::HasId)
@@ -1067,6 +1093,11 @@ AZ_PUSH_DISABLE_WARNING(4127, "-Wunknown-warning-option")
 
         // Do the actual disconnection
         context.m_buses.Disconnect(handler);
+        if constexpr (Traits::EnableSoleHandlerDispatch)
+        {
+            --context.m_handlerCount;
+            UpdateSoleHandler(context);
+        }
 
         if (callstack)
         {
@@ -1078,6 +1109,24 @@ AZ_PUSH_DISABLE_WARNING(4127, "-Wunknown-warning-option")
 
 AZ_POP_DISABLE_WARNING
 
+    //=========================================================================
+    // UpdateSoleHandler
+    //=========================================================================
+    template<class Interface, class Traits>
+    inline void EBus<Interface, Traits>::UpdateSoleHandler(Context& context)
+    {
+        Interface* soleHandler = nullptr;
+        if (context.m_handlerCount == 1)
+        {
+            BaseImpl::EnumerateHandlers([&soleHandler](Interface* handler)
+            {
+                soleHandler = handler;
+                return false;
+            });
+        }
+        context.m_soleHandler.store(soleHandler, AZStd::memory_order_release);
+    }
+
     //=========================================================================
     // GetTotalNumOfEventHandlers
     //=========================================================================
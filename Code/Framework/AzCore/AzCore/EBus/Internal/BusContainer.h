@@ -80,6 +80,27 @@ namespace AZ
         }                                                                                       \
     } while(false)
 
+// Calls the sole handler directly when the bus uses EBusTraits::EnableSoleHandlerDispatch, exactly one handler
+// is connected and there are no routers. Needs to be done before the dispatch lock is taken.
+#define EBUS_DO_SOLE_HANDLER_DISPATCH_IMPL(contextParam, call)                                                \
+    do {                                                                                                    \
+        if constexpr (Traits::EnableSoleHandlerDispatch) {                                                  \
+            auto& local_context = (contextParam);                                                           \
+            if (!local_context.m_routing.m_routers.size()) {                                                \
+                if (Interface* soleHandler = local_context.m_soleHandler.load(AZStd::memory_order_acquire)) { \
+                    Traits::EventProcessingPolicy::call;                                                    \
+                    return;                                                                                 \
+                }                                                                                           \
+            }                                                                                               \
+        }                                                                                                   \
+    } while(false)
+
+#define EBUS_DO_SOLE_HANDLER_DISPATCH(contextParam) \
+    EBUS_DO_SOLE_HANDLER_DISPATCH_IMPL(contextParam, Call(AZStd::forward<Function>(func), soleHandler, AZStd::forward<ArgsT>(args)...))
+
+#define EBUS_DO_SOLE_HANDLER_DISPATCH_RESULT(contextParam) \
+    EBUS_DO_SOLE_HANDLER_DISPATCH_IMPL(contextParam, CallResult(results, AZStd::forward<Function>(func), soleHandler, AZStd::forward<ArgsT>(args)...))
+
         // Default impl, used when there are multiple addresses and multiple handlers
         template <typename Interface, typename Traits, EBusAddressPolicy addressPolicy = Traits::AddressPolicy, EBusHandlerPolicy handlerPolicy = Traits::HandlerPolicy>
         struct EBusContainer
@@ -377,6 +398,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_DO_SOLE_HANDLER_DISPATCH(*context);
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
@@ -423,6 +445,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_DO_SOLE_HANDLER_DISPATCH_RESULT(*context);
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
@@ -469,6 +492,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_DO_SOLE_HANDLER_DISPATCH(*context);
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
                         EBUS_DO_ROUTING(*context, nullptr, false, true);
 
@@ -527,6 +551,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_DO_SOLE_HANDLER_DISPATCH_RESULT(*context);
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
                         EBUS_DO_ROUTING(*context, nullptr, false, true);
 
@@ -937,6 +962,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_DO_SOLE_HANDLER_DISPATCH(*context);
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
@@ -975,6 +1001,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_DO_SOLE_HANDLER_DISPATCH_RESULT(*context);
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
@@ -1013,6 +1040,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_DO_SOLE_HANDLER_DISPATCH(*context);
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
                         EBUS_DO_ROUTING(*context, nullptr, false, true);
 
@@ -1069,6 +1097,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_DO_SOLE_HANDLER_DISPATCH_RESULT(*context);
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
                         EBUS_DO_ROUTING(*context, nullptr, false, true);
 
@@ -1336,6 +1365,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_DO_SOLE_HANDLER_DISPATCH(*context);
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
@@ -1371,6 +1401,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_DO_SOLE_HANDLER_DISPATCH_RESULT(*context);
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
@@ -1406,6 +1437,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_DO_SOLE_HANDLER_DISPATCH(*context);
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
                         EBUS_DO_ROUTING(*context, nullptr, false, true);
 
@@ -1427,6 +1459,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_DO_SOLE_HANDLER_DISPATCH_RESULT(*context);
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
                         EBUS_DO_ROUTING(*context, nullptr, false, true);
 
@@ -1530,6 +1563,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_DO_SOLE_HANDLER_DISPATCH(*context);
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
@@ -1546,6 +1580,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_DO_SOLE_HANDLER_DISPATCH_RESULT(*context);
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
@@ -1562,6 +1597,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_DO_SOLE_HANDLER_DISPATCH(*context);
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
@@ -1578,6 +1614,7 @@ namespace AZ
                 {
                     if (auto* context = Bus::GetContext())
                     {
+                        EBUS_DO_SOLE_HANDLER_DISPATCH_RESULT(*context);
                         typename Bus::Context::DispatchLockGuard lock(context->m_contextMutex);
                         EBUS_DO_ROUTING(*context, nullptr, false, false);
 
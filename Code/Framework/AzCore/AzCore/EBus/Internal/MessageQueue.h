@@ -0,0 +1,313 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/typetraits/decay.h>
+#include <AzCore/std/utils.h>
+
+namespace AZ
+{
+    namespace Internal
+    {
+        /**
+         * Multiple producer, single consumer queue for the queued functions of an EBus.
+         * Queueing a function is lock-free: the function is stored in an arena and linked into the queue with a single
+         * compare-and-swap. The arena consists of blocks of memory that are recycled once all the functions stored in them
+         * have been executed, so queueing usually doesn't allocate. A lock is only taken when a producer needs to move to a
+         * new block.
+         * Executing takes all functions that have been queued so far at once, so functions queued while executing are
+         * executed on the next call. This makes it safe to execute from multiple threads or from within a queued function.
+         */
+        template <class Allocator, class MutexType>
+        class EBusMessageQueue
+        {
+        public:
+            //! Size of a single block in the arena.
+            static constexpr size_t BlockSize = 16 * 1024;
+            //! Functions larger than this, or with a stricter alignment than Alignment, are allocated individually.
+            static constexpr size_t MaxBlockMessageSize = BlockSize / 8;
+            static constexpr size_t Alignment = 16;
+
+            EBusMessageQueue() = default;
+            EBusMessageQueue(const EBusMessageQueue&) = delete;
+            EBusMessageQueue& operator=(const EBusMessageQueue&) = delete;
+            ~EBusMessageQueue();
+
+            //! Adds a function to the queue. Can be called from any thread.
+            template <class Function>
+            void Push(Function&& function);
+
+            //! Calls all functions that were queued before this call in the order they were queued. Returns the number of
+            //! functions that were called.
+            size_t Execute();
+
+            //! Removes all queued functions without calling them.
+            void Clear();
+
+            //! Returns the number of functions currently in the queue.
+            size_t Count() const { return m_count.load(AZStd::memory_order_relaxed); }
+
+            //! Returns the number of blocks that have been allocated for the arena.
+            size_t GetBlockCount() const { return m_blockCount; }
+
+        private:
+            struct Block;
+
+            struct Message
+            {
+                Message* m_next{ nullptr };
+                //! The block the message is stored in or null if it was allocated individually.
+                Block* m_block{ nullptr };
+                void (*m_invoke)(Message&) { nullptr };
+                //! Destroys the message and frees its memory if it was allocated individually.
+                void (*m_destroy)(Message&) { nullptr };
+            };
+
+            template <class Function>
+            struct FunctionMessage
+                : public Message
+            {
+                template <class F>
+                explicit FunctionMessage(F&& function)
+                    : m_function(AZStd::forward<F>(function))
+                {
+                    this->m_invoke = &Invoke;
+                    this->m_destroy = &Destroy;
+                }
+
+                static void Invoke(Message& message)
+                {
+                    static_cast<FunctionMessage&>(message).m_function();
+                }
+
+                static void Destroy(Message& message)
+                {
+                    const bool isInBlock = message.m_block != nullptr;
+                    static_cast<FunctionMessage&>(message).~FunctionMessage();
+                    if (!isInBlock)
+                    {
+                        Allocator().deallocate(&message, sizeof(FunctionMessage), alignof(FunctionMessage));
+                    }
+                }
+
+                Function m_function;
+            };
+
+            struct alignas(Alignment) Block
+            {
+                char* GetData() { return reinterpret_cast<char*>(this + 1); }
+
+                //! Number of bytes handed out to producers. Can grow beyond BlockSize when producers race for the last space.
+                AZStd::atomic<size_t> m_used{ 0 };
+                //! Number of messages in the block that haven't been destroyed yet, including producers in the process of
+                //! adding a message.
+                AZStd::atomic<size_t> m_live{ 0 };
+                Block* m_nextBlock{ nullptr };
+                Block* m_nextSpare{ nullptr };
+                bool m_isSpare{ false };
+            };
+
+            template <class Function>
+            void* AllocateMessage(Block*& block);
+            void* AllocateFromBlock(size_t size, Block*& block);
+            void ReleaseMessage(Message* message);
+            //! Moves the block to the spare list if it's no longer current and all its messages have been released.
+            //! m_blockMutex needs to be locked.
+            void TryRecycleBlock(Block* block);
+            //! Takes all queued messages and returns them in the order they were queued.
+            Message* TakeAll();
+
+            AZStd::atomic<Message*> m_head{ nullptr };
+            AZStd::atomic<Block*> m_currentBlock{ nullptr };
+            AZStd::atomic<size_t> m_count{ 0 };
+
+            MutexType m_blockMutex; ///< Guards the block lists and changes to m_currentBlock.
+            Block* m_blocks{ nullptr };
+            Block* m_spareBlocks{ nullptr };
+            size_t m_blockCount{ 0 };
+        };
+
+        template <class Allocator, class MutexType>
+        EBusMessageQueue<Allocator, MutexType>::~EBusMessageQueue()
+        {
+            Clear();
+
+            Allocator allocator;
+            Block* block = m_blocks;
+            while (block)
+            {
+                Block* next = block->m_nextBlock;
+                block->~Block();
+                allocator.deallocate(block, sizeof(Block) + BlockSize, alignof(Block));
+                block = next;
+            }
+        }
+
+        template <class Allocator, class MutexType>
+        template <class Function>
+        void EBusMessageQueue<Allocator, MutexType>::Push(Function&& function)
+        {
+            using MessageType = FunctionMessage<AZStd::decay_t<Function>>;
+
+            Block* block = nullptr;
+            void* memory = AllocateMessage<MessageType>(block);
+            MessageType* message = new (memory) MessageType(AZStd::forward<Function>(function));
+            message->m_block = block;
+
+            // Count before linking so the consumer never sees more messages than have been counted.
+            m_count.fetch_add(1, AZStd::memory_order_relaxed);
+            Message* head = m_head.load(AZStd::memory_order_relaxed);
+            do
+            {
+                message->m_next = head;
+            } while (!m_head.compare_exchange_weak(head, message, AZStd::memory_order_release, AZStd::memory_order_relaxed));
+        }
+
+        template <class Allocator, class MutexType>
+        size_t EBusMessageQueue<Allocator, MutexType>::Execute()
+        {
+            size_t executed = 0;
+            Message* message = TakeAll();
+            while (message)
+            {
+                Message* next = message->m_next;
+                message->m_invoke(*message);
+                ReleaseMessage(message);
+                message = next;
+                ++executed;
+            }
+            return executed;
+        }
+
+        template <class Allocator, class MutexType>
+        void EBusMessageQueue<Allocator, MutexType>::Clear()
+        {
+            Message* message = TakeAll();
+            while (message)
+            {
+                Message* next = message->m_next;
+                ReleaseMessage(message);
+                message = next;
+            }
+        }
+
+        template <class Allocator, class MutexType>
+        template <class Function>
+        void* EBusMessageQueue<Allocator, MutexType>::AllocateMessage(Block*& block)
+        {
+            constexpr size_t size = AZ_SIZE_ALIGN_UP(sizeof(Function), Alignment);
+            if constexpr (size <= MaxBlockMessageSize && alignof(Function) <= Alignment)
+            {
+                return AllocateFromBlock(size, block);
+            }
+            else
+            {
+                block = nullptr;
+                return Allocator().allocate(sizeof(Function), alignof(Function));
+            }
+        }
+
+        template <class Allocator, class MutexType>
+        void* EBusMessageQueue<Allocator, MutexType>::AllocateFromBlock(size_t size, Block*& block)
+        {
+            while (true)
+            {
+                block = m_currentBlock.load();
+                if (block)
+                {
+                    // Register as a user of the block before claiming space so it can't be recycled while in use. If the block
+                    // was replaced in the meantime, it may already be on its way to the spare list, so back off.
+                    block->m_live.fetch_add(1);
+                    if (m_currentBlock.load() == block)
+                    {
+                        size_t offset = block->m_used.fetch_add(size, AZStd::memory_order_relaxed);
+                        if (offset + size <= BlockSize)
+                        {
+                            return block->GetData() + offset;
+                        }
+                    }
+                    block->m_live.fetch_sub(1);
+                }
+
+                // The block is full or there's no block yet, so move to a new one. Only the first producer that gets here
+                // replaces the block, others will pick up the new block on their next attempt.
+                AZStd::scoped_lock lock(m_blockMutex);
+                if (m_currentBlock.load() == block)
+                {
+                    Block* newBlock = m_spareBlocks;
+                    if (newBlock)
+                    {
+                        m_spareBlocks = newBlock->m_nextSpare;
+                        newBlock->m_isSpare = false;
+                    }
+                    else
+                    {
+                        void* memory = Allocator().allocate(sizeof(Block) + BlockSize, alignof(Block));
+                        newBlock = new (memory) Block;
+                        newBlock->m_nextBlock = m_blocks;
+                        m_blocks = newBlock;
+                        ++m_blockCount;
+                    }
+                    m_currentBlock.store(newBlock);
+                }
+                if (block)
+                {
+                    TryRecycleBlock(block);
+                }
+            }
+        }
+
+        template <class Allocator, class MutexType>
+        void EBusMessageQueue<Allocator, MutexType>::ReleaseMessage(Message* message)
+        {
+            Block* block = message->m_block;
+            message->m_destroy(*message);
+            if (block && block->m_live.fetch_sub(1) == 1 && m_currentBlock.load() != block)
+            {
+                AZStd::scoped_lock lock(m_blockMutex);
+                TryRecycleBlock(block);
+            }
+        }
+
+        template <class Allocator, class MutexType>
+        void EBusMessageQueue<Allocator, MutexType>::TryRecycleBlock(Block* block)
+        {
+            if (!block->m_isSpare && m_currentBlock.load() != block && block->m_live.load() == 0)
+            {
+                block->m_used.store(0, AZStd::memory_order_relaxed);
+                block->m_isSpare = true;
+                block->m_nextSpare = m_spareBlocks;
+                m_spareBlocks = block;
+            }
+        }
+
+        template <class Allocator, class MutexType>
+        auto EBusMessageQueue<Allocator, MutexType>::TakeAll() -> Message*
+        {
+            Message* message = m_head.exchange(nullptr, AZStd::memory_order_acquire);
+
+            // Messages are linked newest first, so reverse the list to execute them in the order they were queued.
+            Message* ordered = nullptr;
+            size_t count = 0;
+            while (message)
+            {
+                Message* next = message->m_next;
+                message->m_next = ordered;
+                ordered = message;
+                message = next;
+                ++count;
+            }
+            m_count.fetch_sub(count, AZStd::memory_order_relaxed);
+            return ordered;
+        }
+    } // namespace Internal
+} // namespace AZ
@@ -14,6 +14,7 @@
  */
 
 // Includes for the event queue.
+#include <AzCore/EBus/Internal/MessageQueue.h>
 #include <AzCore/std/functional.h>
 #include <AzCore/std/function/invoke.h>
 #include <AzCore/std/containers/queue.h>
@@ -238,49 +239,31 @@ namespace AZ
     {
         typedef AZStd::function<void()> BusMessageCall;
 
-        typedef AZStd::deque<BusMessageCall, typename Bus::AllocatorType> DequeType;
-        typedef AZStd::queue<BusMessageCall, DequeType > MessageQueueType;
+        typedef AZ::Internal::EBusMessageQueue<typename Bus::AllocatorType, MutexType> MessageQueueType;
 
         EBusQueuePolicy() = default;
 
-        bool                        m_isActive = Bus::Traits::EventQueueingActiveByDefault;
-        MessageQueueType            m_messages;
-        MutexType                   m_messagesMutex;        ///< Used to control access to the m_messages. Make sure you never interlock with the EBus mutex. Otherwise, a deadlock can occur.
+        AZStd::atomic_bool          m_isActive{ Bus::Traits::EventQueueingActiveByDefault };
+        MessageQueueType            m_messages;             ///< Lock-free for queueing. The MutexType is only used when the queue needs more memory.
 
         void Execute()
         {
             AZ_Warning("System", m_isActive, "You are calling execute queued functions on a bus which has not activated its function queuing! Call YourBus::AllowFunctionQueuing(true)!");
 
-            MessageQueueType localMessages;
-
-            // Swap the current list of queue functions with a local instance
-            {
-                AZStd::scoped_lock lock(m_messagesMutex);
-                AZStd::swap(localMessages, m_messages);
-            }
-
-            // Execute the queue functions safely now that are owned by the function
-            while (!localMessages.empty())
-            {
-                const BusMessageCall& localMessage = localMessages.front();
-                localMessage();
-                localMessages.pop();
-            }
+            m_messages.Execute();
         }
 
         void Clear()
         {
-            AZStd::lock_guard<MutexType> lock(m_messagesMutex);
-            m_messages = {};
+            m_messages.Clear();
         }
 
         void SetActive(bool isActive)
         {
-            AZStd::lock_guard<MutexType> lock(m_messagesMutex);
             m_isActive = isActive;
             if (!m_isActive)
             {
-                m_messages = {};
+                m_messages.Clear();
             }
         };
 
@@ -291,8 +274,7 @@ namespace AZ
 
         size_t Count()
         {
-            AZStd::lock_guard<MutexType> lock(m_messagesMutex);
-            return m_messages.size();
+            return m_messages.Count();
         }
     };
 
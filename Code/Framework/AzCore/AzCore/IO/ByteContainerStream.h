@@ -51,6 +51,7 @@ namespace AZ
             SizeType    Read(SizeType bytes, void* oBuffer) override;
             SizeType    Write(SizeType bytes, const void* iBuffer) override;
             SizeType    WriteFromStream(SizeType bytes, GenericStream* inputStream) override;
+            const void* GetContiguousData() const override                       { return m_buffer->data(); }
             template<typename T>
             inline SizeType Write(const T* iBuffer)
             {
@@ -28,6 +28,7 @@ namespace AZ
             m_conflictResolution = rhs.m_conflictResolution;
             m_isCompressed = rhs.m_isCompressed;
             m_isSharedPak = rhs.m_isSharedPak;
+            m_seekPoints = AZStd::move(rhs.m_seekPoints);
 
             return *this;
         }
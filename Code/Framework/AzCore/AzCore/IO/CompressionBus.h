@@ -9,8 +9,10 @@
 
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/IO/Streamer/RequestPath.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/functional.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/string/string_view.h>
 
@@ -31,6 +33,18 @@ namespace AZ
             UseArchiveOnly
         };
 
+        //! Position in a compressed file from which decompression can start without decompressing any of the preceding data.
+        struct CompressionSeekPoint
+        {
+            //! Offset from the start of the compressed data.
+            size_t m_compressedOffset = 0;
+            //! Offset in the decompressed data the seek point corresponds to.
+            size_t m_uncompressedOffset = 0;
+        };
+        //! Seek points sorted by offset. The first seek point is at the start of the file and the last one marks the end of the
+        //! compressed data, so the data between two consecutive seek points can be decompressed independently.
+        using CompressionSeekPoints = AZStd::vector<CompressionSeekPoint>;
+
         struct CompressionInfo;
         using DecompressionFunc = AZStd::function<bool(const CompressionInfo& info, const void* compressed, size_t compressedSize, void* uncompressed, size_t uncompressedBufferSize)>;
 
@@ -61,6 +75,9 @@ namespace AZ
             bool m_isCompressed = false;
             //! Whether or not the pak file is used in multiple location or reads can be done exclusively.
             bool m_isSharedPak = false; 
+            //! Optional seek points in the compressed data. If available, reading part of the file only requires decompressing
+            //! the data between the seek points surrounding the requested range.
+            AZStd::shared_ptr<const CompressionSeekPoints> m_seekPoints;
         };
 
         class Compression
@@ -51,6 +51,10 @@ namespace AZ::IO
         virtual OpenMode    GetModeFlags() const { return OpenMode(); }
         virtual bool        ReOpen() { return true; }
         virtual void        Close() {}
+        //! Returns the start of the stream's data if the entire stream is available in contiguous memory, otherwise null.
+        //! Readers can use this to access data in place instead of copying it out with Read. The returned memory is valid for
+        //! GetLength() bytes for as long as the stream is open.
+        virtual const void* GetContiguousData() const { return nullptr; }
 
         static inline constexpr size_t StreamToStreamCopyBufferSize = 256;
 
@@ -135,6 +139,7 @@ namespace AZ::IO
         SizeType    Write(SizeType bytes, const void* iBuffer) override;
         SizeType    WriteFromStream(SizeType bytes, GenericStream* inputStream) override;
         virtual const void* GetData() const { return m_buffer; }
+        const void* GetContiguousData() const override { return m_buffer; }
         SizeType    GetCurPos() const override { return m_curOffset; }
         SizeType    GetLength() const override { return m_curLen; }
 
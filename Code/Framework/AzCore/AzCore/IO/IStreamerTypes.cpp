@@ -72,6 +72,16 @@ namespace AZ::IO::IStreamerTypes
         }
     }
 
+    bool DefaultRequestMemoryAllocator::AcceptsMappedViews() const
+    {
+        return m_acceptsMappedViews;
+    }
+
+    void DefaultRequestMemoryAllocator::SetAcceptsMappedViews(bool accept)
+    {
+        m_acceptsMappedViews = accept;
+    }
+
     int DefaultRequestMemoryAllocator::GetNumLocks() const
     {
         return m_lockCounter;
@@ -127,6 +127,11 @@ namespace AZ::IO::IStreamerTypes
         //! Releases memory previously allocated by Allocate.
         //! @param address The address previously provided by Allocate.
         virtual void Release(void* address) = 0;
+        //! Whether or not the requests using this allocator accept a read-only view into a memory mapped file instead of a copy
+        //! of the data. If the stream stack supports mapped views, Allocate is only called if the file can't be mapped. A mapped
+        //! view stays valid for as long as the request is alive and must not be written to. Claiming the memory of a request
+        //! that holds a mapped view will copy the data into memory from Allocate.
+        virtual bool AcceptsMappedViews() const { return false; }
     };
 
     //! Default memory allocator for file requests. This allocator is a wrapper around the standard memory allocator and can be used
@@ -145,6 +150,10 @@ namespace AZ::IO::IStreamerTypes
 
         RequestMemoryAllocatorResult Allocate(u64 minimalSize, u64 recommendeSize, size_t alignment) override;
         void Release(void* address) override;
+        bool AcceptsMappedViews() const override;
+
+        //! Allow requests using this allocator to receive views into memory mapped files. See RequestMemoryAllocator::AcceptsMappedViews.
+        void SetAcceptsMappedViews(bool accept);
 
         int GetNumLocks() const;
 
@@ -152,6 +161,7 @@ namespace AZ::IO::IStreamerTypes
         AZStd::atomic_int m_lockCounter{ 0 };
         AZStd::atomic_int m_allocationCounter{ 0 };
         AZ::IAllocatorAllocate& m_allocator;
+        bool m_acceptsMappedViews{ false };
     };
 
     // The following alignment functions are put here until they're available in AzCore's math library.
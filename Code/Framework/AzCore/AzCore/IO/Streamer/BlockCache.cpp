@@ -48,7 +48,8 @@ namespace AZ
             }
 
             auto stackEntry = AZStd::make_shared<BlockCache>(
-                cacheSize, aznumeric_cast<AZ::u32>(blockSize), aznumeric_cast<AZ::u32>(hardware.m_maxPhysicalSectorSize), false);
+                cacheSize, aznumeric_cast<AZ::u32>(blockSize), aznumeric_cast<AZ::u32>(hardware.m_maxPhysicalSectorSize), false,
+                m_readAheadBlocks, m_maxBlockSizeMultiplier);
             stackEntry->SetNext(AZStd::move(parent));
             return stackEntry;
         }
@@ -64,14 +65,17 @@ namespace AZ
                     ->Value("SizeAlignment", BlockSize::SizeAlignment);
 
                 serializeContext->Class<BlockCacheConfig, IStreamerStackConfig>()
-                    ->Version(1)
+                    ->Version(2)
                     ->Field("CacheSizeMib", &BlockCacheConfig::m_cacheSizeMib)
-                    ->Field("BlockSize", &BlockCacheConfig::m_blockSize);
+                    ->Field("BlockSize", &BlockCacheConfig::m_blockSize)
+                    ->Field("ReadAheadBlocks", &BlockCacheConfig::m_readAheadBlocks)
+                    ->Field("MaxBlockSizeMultiplier", &BlockCacheConfig::m_maxBlockSizeMultiplier);
             }
         }
 
         static constexpr char CacheHitRateName[] = "Cache hit rate";
         static constexpr char CacheableName[] = "Cacheable";
+        static constexpr char ReadAheadName[] = "Read-ahead blocks";
 
         void BlockCache::Section::Prefix(const Section& section)
         {
@@ -101,9 +105,11 @@ namespace AZ
             m_blockOffset = 0; // Two merged sections do not support caching.
         }
         
-        BlockCache::BlockCache(u64 cacheSize, u32 blockSize, u32 alignment, bool onlyEpilogWrites)
+        BlockCache::BlockCache(u64 cacheSize, u32 blockSize, u32 alignment, bool onlyEpilogWrites,
+            u32 readAheadBlocks, u32 maxBlockSizeMultiplier)
             : StreamStackEntry("Block cache")
             , m_alignment(alignment)
+            , m_readAheadBlocks(readAheadBlocks)
             , m_onlyEpilogWrites(onlyEpilogWrites)
         {
             AZ_Assert(IStreamerTypes::IsPowerOf2(alignment), "Alignment needs to be a power of 2.");
@@ -116,6 +122,13 @@ namespace AZ
             {
                 m_onlyEpilogWrites = true;
             }
+
+            // Spans are aligned to their size inside the cache, so limit the span to a power of two that leaves room for at least
+            // two spans in the cache.
+            while (m_maxBlockSpan * 2 <= maxBlockSizeMultiplier && m_maxBlockSpan * 4 <= m_numBlocks)
+            {
+                m_maxBlockSpan *= 2;
+            }
             
             m_cache = reinterpret_cast<u8*>(AZ::AllocatorInstance<AZ::SystemAllocator>::Get().Allocate(
                 m_cacheSize, alignment, 0, "AZ::IO::Streamer BlockCache", __FILE__, __LINE__));
@@ -123,6 +136,8 @@ namespace AZ
             m_cachedOffsets = AZStd::unique_ptr<u64[]>(new u64[m_numBlocks]);
             m_blockLastTouched = AZStd::unique_ptr<TimePoint[]>(new TimePoint[m_numBlocks]);
             m_inFlightRequests = AZStd::unique_ptr<FileRequest*[]>(new FileRequest*[m_numBlocks]);
+            m_blockSpans = AZStd::unique_ptr<u32[]>(new u32[m_numBlocks]);
+            m_accessPatterns.reserve(s_maxTrackedFiles);
             
             ResetCache();
         }
@@ -275,9 +290,10 @@ namespace AZ
             Section epilog;
 
             auto& data = AZStd::get<FileRequest::ReadData>(request->GetCommand());
+            FileAccessPattern& accessPattern = UpdateAccessPattern(data.m_path, data.m_offset, data.m_size);
 
             if (!SplitRequest(prolog, main, epilog, data.m_path, fileLength, data.m_offset, data.m_size,
-                reinterpret_cast<u8*>(data.m_output)))
+                reinterpret_cast<u8*>(data.m_output), accessPattern.m_blockSpan))
             {
                 m_context->MarkRequestAsCompleted(request);
                 return;
@@ -328,9 +344,6 @@ namespace AZ
                     // epilog are allowed to write.
                     bool readFromCache = (ServiceFromCache(request, prolog, data.m_path, data.m_sharedRead) == CacheResult::ReadFromCache);
                     fullyCached = readFromCache && fullyCached;
-
-                    m_hitRateStat.PushSample(readFromCache ? 1.0 : 0.0);
-                    Statistic::PlotImmediate(m_name, CacheHitRateName, m_hitRateStat.GetMostRecentSample());
                 }
             }
 
@@ -348,11 +361,11 @@ namespace AZ
             {
                 bool readFromCache = (ServiceFromCache(request, epilog, data.m_path, data.m_sharedRead) == CacheResult::ReadFromCache);
                 fullyCached = readFromCache && fullyCached;
-
-                m_hitRateStat.PushSample(readFromCache ? 1.0 : 0.0);
-                Statistic::PlotImmediate(m_name, CacheHitRateName, m_hitRateStat.GetMostRecentSample());
             }
 
+            // Queue the read-ahead after the reads for the request so those aren't delayed by blocks that are needed later.
+            ReadAhead(accessPattern, fileLength, data.m_sharedRead);
+
             if (fullyCached)
             {
                 request->SetStatus(IStreamerTypes::RequestStatus::Completed);
@@ -366,14 +379,22 @@ namespace AZ
             {
                 if (m_cachedPaths[i] == filePath)
                 {
-                    ResetCacheEntry(i);
+                    ResetCacheSpan(i);
                 }
             }
+
+            auto it = AZStd::find_if(m_accessPatterns.begin(), m_accessPatterns.end(),
+                [&filePath](const FileAccessPattern& pattern) { return pattern.m_path == filePath; });
+            if (it != m_accessPatterns.end())
+            {
+                m_accessPatterns.erase(it);
+            }
         }
 
         void BlockCache::FlushEntireCache()
         {
             ResetCache();
+            m_accessPatterns.clear();
         }
 
         void BlockCache::CollectStatistics(AZStd::vector<Statistic>& statistics) const
@@ -381,6 +402,7 @@ namespace AZ
             statistics.push_back(Statistic::CreatePercentage(m_name, CacheHitRateName, CalculateHitRatePercentage()));
             statistics.push_back(Statistic::CreatePercentage(m_name, CacheableName, CalculateCacheableRatePercentage()));
             statistics.push_back(Statistic::CreateInteger(m_name, "Available slots", CalculateAvailableRequestSlots()));
+            statistics.push_back(Statistic::CreateInteger(m_name, ReadAheadName, aznumeric_caster(m_numReadAheadBlocks)));
 
             StreamStackEntry::CollectStatistics(statistics);
         }
@@ -401,11 +423,35 @@ namespace AZ
                 aznumeric_cast<s32>(m_delayedSections.size());
         }
 
+        const AZ::Statistics::RunningStatistic& BlockCache::GetHitRateStatistic() const
+        {
+            return m_hitRateStat;
+        }
+
+        const AZ::Statistics::RunningStatistic& BlockCache::GetCacheableStatistic() const
+        {
+            return m_cacheableStat;
+        }
+
+        u64 BlockCache::GetNumReadAheadBlocks() const
+        {
+            return m_numReadAheadBlocks;
+        }
+
+        void BlockCache::ResetStatistics()
+        {
+            m_hitRateStat.Reset();
+            m_cacheableStat.Reset();
+            m_numReadAheadBlocks = 0;
+        }
+
         BlockCache::CacheResult BlockCache::ReadFromCache(FileRequest* request, Section& section, const RequestPath& filePath)
         {
-            u32 cacheLocation = FindInCache(filePath, section.m_readOffset);
+            u64 offsetInSpan = 0;
+            u32 cacheLocation = FindInCache(filePath, section.m_readOffset, section.m_blockSpan, offsetInSpan);
             if (cacheLocation != s_fileNotCached)
             {
+                section.m_blockOffset += offsetInSpan;
                 return ReadFromCache(request, section, cacheLocation);
             }
             else
@@ -440,19 +486,26 @@ namespace AZ
         {
             AZ_Assert(m_next, "ServiceFromCache in BlockCache was called when the cache doesn't have a way to read files.");
 
-            u32 cacheLocation = FindInCache(filePath, section.m_readOffset);
+            // A section that was delayed already has a wait assigned to it. The lookup for those has already been recorded when
+            // the section was first serviced.
+            const bool recordLookup = (section.m_wait == nullptr);
+            u64 offsetInSpan = 0;
+            u32 cacheLocation = FindInCache(filePath, section.m_readOffset, section.m_blockSpan, offsetInSpan);
             if (cacheLocation == s_fileNotCached)
             {
-                m_hitRateStat.PushSample(0.0);
-                Statistic::PlotImmediate(m_name, CacheHitRateName, m_hitRateStat.GetMostRecentSample());
+                if (recordLookup)
+                {
+                    m_hitRateStat.PushSample(0.0);
+                    Statistic::PlotImmediate(m_name, CacheHitRateName, m_hitRateStat.GetMostRecentSample());
+                }
 
                 section.m_parent = request;
-                cacheLocation = RecycleOldestBlock(filePath, section.m_readOffset);
+                cacheLocation = RecycleOldestBlock(filePath, section.m_readOffset, section.m_blockSpan);
                 if (cacheLocation != s_fileNotCached)
                 {
                     FileRequest* readRequest = m_context->GetNewInternalRequest();
-                    readRequest->CreateRead(request, GetCacheBlockData(cacheLocation), m_blockSize, filePath, section.m_readOffset,
-                        section.m_readSize, sharedRead);
+                    readRequest->CreateRead(request, GetCacheBlockData(cacheLocation), section.m_blockSpan * m_blockSize, filePath,
+                        section.m_readOffset, section.m_readSize, sharedRead);
                     readRequest->SetCompletionCallback([this](FileRequest& request)
                         {
                             AZ_PROFILE_FUNCTION(AzCore);
@@ -496,9 +549,13 @@ namespace AZ
                     section.m_wait = nullptr;
                 }
 
-                m_hitRateStat.PushSample(1.0);
-                Statistic::PlotImmediate(m_name, CacheHitRateName, m_hitRateStat.GetMostRecentSample());
+                if (recordLookup)
+                {
+                    m_hitRateStat.PushSample(1.0);
+                    Statistic::PlotImmediate(m_name, CacheHitRateName, m_hitRateStat.GetMostRecentSample());
+                }
 
+                section.m_blockOffset += offsetInSpan;
                 return ReadFromCache(request, section, cacheLocation);
             }
         }
@@ -524,7 +581,8 @@ namespace AZ
                     section.m_wait = nullptr;
                 }
 
-                if (requestWasSuccessful)
+                // Sections for blocks that are read ahead don't have an output as there's no request for the data yet.
+                if (requestWasSuccessful && section.m_output)
                 {
                     memcpy(section.m_output, GetCacheBlockData(cacheBlockIndex) + section.m_blockOffset, section.m_copySize);
                 }
@@ -537,7 +595,7 @@ namespace AZ
             }
             else
             {
-                ResetCacheEntry(cacheBlockIndex);
+                ResetCacheSpan(cacheBlockIndex);
             }
             AZ_Assert(m_numInFlightRequests > 0, "Clearing out an in-flight request, but there shouldn't be any in flight according to records.");
             m_numInFlightRequests--;
@@ -546,19 +604,23 @@ namespace AZ
 
         bool BlockCache::SplitRequest(Section& prolog, Section& main, Section& epilog,
             [[maybe_unused]] const RequestPath& filePath, u64 fileLength,
-            u64 offset, u64 size, u8* buffer) const
+            u64 offset, u64 size, u8* buffer, u32 blockSpan) const
         {
             AZ_Assert(offset + size <= fileLength, "File at path '%s' is being read past the end of the file.", filePath.GetRelativePath());
 
+            const u64 blockSize = aznumeric_cast<u64>(blockSpan) * m_blockSize;
+            prolog.m_blockSpan = blockSpan;
+            epilog.m_blockSpan = blockSpan;
+
             //
             // Prolog
             // This looks at the request and sees if there's anything in front of the file that should be cached. This also
             // deals with the situation where the entire file request fits inside the cache which could mean there's data
             // left after the file as well that could be cached.
             //
-            u64 roundedOffsetStart = AZ_SIZE_ALIGN_DOWN(offset, aznumeric_cast<u64>(m_blockSize));
+            u64 roundedOffsetStart = AZ_SIZE_ALIGN_DOWN(offset, blockSize);
             
-            u64 blockReadSizeStart = AZStd::min(fileLength - roundedOffsetStart, aznumeric_cast<u64>(m_blockSize));
+            u64 blockReadSizeStart = AZStd::min(fileLength - roundedOffsetStart, blockSize);
             // Check if the request is on the left edge of the cache block, which means there's nothing in front of it
             // that could be cached.
             if (roundedOffsetStart == offset)
@@ -620,9 +682,9 @@ namespace AZ
             // Since the prolog already takes care of the situation where the file fits entirely in the cache the epilog is
             // much simpler as it only has to look at the case where there is more file after the request to read for caching.
             //
-            u64 roundedOffsetEnd = AZ_SIZE_ALIGN_DOWN(offset + size, aznumeric_cast<u64>(m_blockSize));
+            u64 roundedOffsetEnd = AZ_SIZE_ALIGN_DOWN(offset + size, blockSize);
             u64 copySize = offset + size - roundedOffsetEnd;
-            u64 blockReadSizeEnd = m_blockSize;
+            u64 blockReadSizeEnd = blockSize;
             if ((roundedOffsetEnd + blockReadSizeEnd) > fileLength)
             {
                 blockReadSizeEnd = fileLength - roundedOffsetEnd;
@@ -653,7 +715,7 @@ namespace AZ
             {
                 size -= epilog.m_copySize;
             }
-            AZ_Assert(IStreamerTypes::IsAlignedTo(adjustedOffset, m_blockSize),
+            AZ_Assert(IStreamerTypes::IsAlignedTo(adjustedOffset, blockSize),
                 "The adjustments made by the prolog should guarantee the offset is aligned to a cache block.");
             if (size != 0)
             {
@@ -666,6 +728,119 @@ namespace AZ
             return true;
         }
 
+        BlockCache::FileAccessPattern& BlockCache::UpdateAccessPattern(const RequestPath& filePath, u64 offset, u64 size)
+        {
+            m_accessCounter++;
+
+            auto it = AZStd::find_if(m_accessPatterns.begin(), m_accessPatterns.end(),
+                [&filePath](const FileAccessPattern& pattern) { return pattern.m_path == filePath; });
+            FileAccessPattern* pattern;
+            if (it != m_accessPatterns.end())
+            {
+                pattern = &(*it);
+                if (offset == pattern->m_nextOffset)
+                {
+                    pattern->m_sequentialReadCount++;
+                }
+                else
+                {
+                    pattern->m_sequentialReadCount = 0;
+                    pattern->m_readAheadEnd = 0;
+                }
+                // Weigh recent requests more heavily so the block size follows changes in how the file is read.
+                pattern->m_averageRequestSize = (pattern->m_averageRequestSize * 3 + size) / 4;
+            }
+            else
+            {
+                if (m_accessPatterns.size() < s_maxTrackedFiles)
+                {
+                    pattern = &m_accessPatterns.emplace_back();
+                }
+                else
+                {
+                    // Replace the file that hasn't been read from for the longest time.
+                    pattern = &m_accessPatterns[0];
+                    for (FileAccessPattern& candidate : m_accessPatterns)
+                    {
+                        if (candidate.m_lastAccess < pattern->m_lastAccess)
+                        {
+                            pattern = &candidate;
+                        }
+                    }
+                    *pattern = FileAccessPattern{};
+                }
+                pattern->m_path = filePath;
+                pattern->m_averageRequestSize = size;
+            }
+
+            pattern->m_nextOffset = offset + size;
+            pattern->m_lastAccess = m_accessCounter;
+
+            // Use the smallest span that fits a typical request for this file. Files that are read in small pieces keep small blocks
+            // so random reads don't read more than needed, while files that are read in large pieces cache more of the data around
+            // the request with the same number of reads.
+            u32 blockSpan = 1;
+            while (blockSpan < m_maxBlockSpan && aznumeric_cast<u64>(blockSpan) * m_blockSize < pattern->m_averageRequestSize)
+            {
+                blockSpan *= 2;
+            }
+            pattern->m_blockSpan = blockSpan;
+
+            return *pattern;
+        }
+
+        void BlockCache::ReadAhead(FileAccessPattern& pattern, u64 fileLength, bool sharedRead)
+        {
+            if (m_readAheadBlocks == 0 || pattern.m_sequentialReadCount < s_sequentialReadThreshold)
+            {
+                return;
+            }
+
+            // Start at the block after the one that contains the end of the last request, as that block has already been requested
+            // if the request didn't end at the edge of a block.
+            const u64 blockSize = aznumeric_cast<u64>(pattern.m_blockSpan) * m_blockSize;
+            const u64 firstBlockOffset = AZ_SIZE_ALIGN_UP(pattern.m_nextOffset, blockSize);
+            const u64 endOffset = AZStd::min(firstBlockOffset + m_readAheadBlocks * blockSize, fileLength);
+            u64 offset = AZStd::max(firstBlockOffset, AZ_SIZE_ALIGN_UP(pattern.m_readAheadEnd, blockSize));
+
+            // Only use slots that are not needed by requests that are already waiting.
+            while (offset < endOffset && m_delayedSections.empty() && CalculateAvailableRequestSlots() > 0)
+            {
+                u64 offsetInSpan = 0;
+                if (FindInCache(pattern.m_path, offset, pattern.m_blockSpan, offsetInSpan) == s_fileNotCached)
+                {
+                    u32 cacheLocation = RecycleOldestBlock(pattern.m_path, offset, pattern.m_blockSpan);
+                    if (cacheLocation == s_fileNotCached)
+                    {
+                        break;
+                    }
+
+                    Section section;
+                    section.m_readOffset = offset;
+                    section.m_readSize = AZStd::min(fileLength - offset, blockSize);
+                    section.m_cacheBlockIndex = cacheLocation;
+                    section.m_blockSpan = pattern.m_blockSpan;
+
+                    FileRequest* readRequest = m_context->GetNewInternalRequest();
+                    readRequest->CreateRead(nullptr, GetCacheBlockData(cacheLocation), blockSize, pattern.m_path, section.m_readOffset,
+                        section.m_readSize, sharedRead);
+                    readRequest->SetCompletionCallback([this](FileRequest& request)
+                        {
+                            AZ_PROFILE_FUNCTION(AzCore);
+                            CompleteRead(request);
+                        });
+                    m_inFlightRequests[cacheLocation] = readRequest;
+                    m_numInFlightRequests++;
+                    m_numReadAheadBlocks++;
+
+                    m_pendingRequests.emplace(readRequest, section);
+                    m_next->QueueRequest(readRequest);
+                }
+                offset += blockSize;
+            }
+            pattern.m_readAheadEnd = offset;
+        }
+
         u8* BlockCache::GetCacheBlockData(u32 index)
         {
             AZ_Assert(index < m_numBlocks, "Index for touch a cache entry in the BlockCache is out of bounds.");
@@ -675,28 +850,75 @@ namespace AZ
         void BlockCache::TouchBlock(u32 index)
         {
             AZ_Assert(index < m_numBlocks, "Index for touch a cache entry in the BlockCache is out of bounds.");
-            m_blockLastTouched[index] = AZStd::chrono::high_resolution_clock::now();
+            const TimePoint now = AZStd::chrono::high_resolution_clock::now();
+            const u32 end = index + m_blockSpans[index];
+            for (u32 i = index; i < end; ++i)
+            {
+                m_blockLastTouched[i] = now;
+            }
         }
 
-        u32 BlockCache::RecycleOldestBlock(const RequestPath& filePath, u64 offset)
+        u32 BlockCache::RecycleOldestBlock(const RequestPath& filePath, u64 offset, u32 blockSpan)
         {
-            AZ_Assert((offset & (m_blockSize - 1)) == 0, "The offset used to recycle a block cache needs to be a multiple of the block size.");
+            AZ_Assert((offset & (aznumeric_cast<u64>(blockSpan) * m_blockSize - 1)) == 0,
+                "The offset used to recycle a block cache needs to be a multiple of the block size.");
+
+            // Spans are aligned to their size. A span can only overlap with a span of a different size if one contains the other,
+            // so the age of a candidate span is the age of the most recently touched block inside it and the candidate is in flight
+            // if any of the spans its blocks belong to are in flight.
+            auto getLastTouched = [this, blockSpan](u32 index)
+            {
+                TimePoint lastTouched = m_blockLastTouched[index];
+                for (u32 i = index + 1; i < index + blockSpan; ++i)
+                {
+                    lastTouched = AZStd::max(lastTouched, m_blockLastTouched[i]);
+                }
+                return lastTouched;
+            };
+            auto isInFlight = [this, blockSpan](u32 index)
+            {
+                for (u32 i = index; i < index + blockSpan; ++i)
+                {
+                    if (IsCacheBlockInFlight(GetFirstBlockOfSpan(i)))
+                    {
+                        return true;
+                    }
+                }
+                return false;
+            };
 
             // Find the oldest cache block.
-            TimePoint oldest = m_blockLastTouched[0];
+            const u32 lastIndex = m_numBlocks - blockSpan;
+            TimePoint oldest = getLastTouched(0);
             u32 oldestIndex = 0;
-            for (u32 i = 1; i < m_numBlocks; ++i)
+            for (u32 i = blockSpan; i <= lastIndex; i += blockSpan)
             {
-                if (m_blockLastTouched[i] < oldest && !m_inFlightRequests[i])
+                TimePoint lastTouched = getLastTouched(i);
+                if (lastTouched < oldest && !isInFlight(i))
                 {
-                    oldest = m_blockLastTouched[i];
+                    oldest = lastTouched;
                     oldestIndex = i;
                 }
             }
 
-            if (!IsCacheBlockInFlight(oldestIndex))
+            if (!isInFlight(oldestIndex))
             {
-                // Recycle the block.
+                // Recycle the block, including any spans that overlap with it.
+                for (u32 i = oldestIndex; i < oldestIndex + blockSpan; ++i)
+                {
+                    if (m_blockSpans[i] != 1)
+                    {
+                        ResetCacheSpan(GetFirstBlockOfSpan(i));
+                    }
+                    else
+                    {
+                        ResetCacheEntry(i);
+                    }
+                }
+                for (u32 i = oldestIndex; i < oldestIndex + blockSpan; ++i)
+                {
+                    m_blockSpans[i] = blockSpan;
+                }
                 m_cachedPaths[oldestIndex] = filePath;
                 m_cachedOffsets[oldestIndex] = offset;
                 TouchBlock(oldestIndex);
@@ -708,20 +930,33 @@ namespace AZ
             }
         }
 
-        u32 BlockCache::FindInCache(const RequestPath& filePath, u64 offset) const
+        u32 BlockCache::FindInCache(const RequestPath& filePath, u64 offset, u32 blockSpan, u64& offsetInSpan) const
         {
-            AZ_Assert((offset & (m_blockSize - 1)) == 0, "The offset used to find a block in the block cache needs to be a multiple of the block size.");
+            AZ_Assert((offset & (aznumeric_cast<u64>(blockSpan) * m_blockSize - 1)) == 0,
+                "The offset used to find a block in the block cache needs to be a multiple of the block size.");
+            // Only the first block of a span holds the path and offset, so any span that was read with an equal or larger block
+            // span and fully covers the requested range can be used.
+            const u64 requestEnd = offset + aznumeric_cast<u64>(blockSpan) * m_blockSize;
             for (u32 i = 0; i < m_numBlocks; ++i)
             {
-                if (m_cachedPaths[i] == filePath && m_cachedOffsets[i] == offset)
+                if (m_cachedPaths[i] == filePath && m_cachedOffsets[i] <= offset &&
+                    requestEnd <= m_cachedOffsets[i] + aznumeric_cast<u64>(m_blockSpans[i]) * m_blockSize)
                 {
+                    offsetInSpan = offset - m_cachedOffsets[i];
                     return i;
                 }
             }
 
+            offsetInSpan = 0;
             return s_fileNotCached;
         }
 
+        u32 BlockCache::GetFirstBlockOfSpan(u32 index) const
+        {
+            AZ_Assert(index < m_numBlocks, "Index for finding the start of a span in the BlockCache is out of bounds.");
+            return index & ~(m_blockSpans[index] - 1);
+        }
+
         bool BlockCache::IsCacheBlockInFlight(u32 index) const
         {
             AZ_Assert(index < m_numBlocks, "Index for checking if a cache block is in flight is out of bounds.");
@@ -736,6 +971,17 @@ namespace AZ
             m_cachedOffsets[index] = 0;
             m_blockLastTouched[index] = TimePoint::min();
             m_inFlightRequests[index] = nullptr;
+            m_blockSpans[index] = 1;
+        }
+
+        void BlockCache::ResetCacheSpan(u32 index)
+        {
+            AZ_Assert(index == GetFirstBlockOfSpan(index), "Resetting a span in the BlockCache has to start at the first block of the span.");
+            const u32 end = index + m_blockSpans[index];
+            for (u32 i = index; i < end; ++i)
+            {
+                ResetCacheEntry(i);
+            }
         }
 
         void BlockCache::ResetCache()
@@ -17,6 +17,7 @@
 #include <AzCore/std/chrono/clocks.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 
 namespace AZ
@@ -50,13 +51,20 @@ namespace AZ
             u32 m_cacheSizeMib{ 8 };
             //! The size of the individual blocks inside the cache.
             BlockSize m_blockSize{ BlockSize::MemoryAlignment };
+            //! The number of blocks that are read ahead of a file that's being read sequentially. Set to 0 to disable read-ahead.
+            u32 m_readAheadBlocks{ 0 };
+            //! The largest multiple of the block size a single file can use as its block size. The block size for a file is picked
+            //! based on the size of the requests for that file, so files that are read in large pieces use fewer but larger blocks.
+            //! Set to 1 to use the same block size for all files.
+            u32 m_maxBlockSizeMultiplier{ 1 };
         };
 
         class BlockCache
             : public StreamStackEntry
         {
         public:
-            BlockCache(u64 cacheSize, u32 blockSize, u32 alignment, bool onlyEpilogWrites);
+            BlockCache(u64 cacheSize, u32 blockSize, u32 alignment, bool onlyEpilogWrites,
+                u32 readAheadBlocks = 0, u32 maxBlockSizeMultiplier = 1);
             BlockCache(BlockCache&& rhs) = delete;
             BlockCache(const BlockCache& rhs) = delete;
             ~BlockCache() override;
@@ -82,8 +90,21 @@ namespace AZ
             double CalculateCacheableRatePercentage() const;
             s32 CalculateAvailableRequestSlots() const;
 
+            //! Statistic with a sample for every lookup of a cache block, 1.0 if the block was found in the cache and 0.0 if it had to be read.
+            const AZ::Statistics::RunningStatistic& GetHitRateStatistic() const;
+            //! Statistic with a sample for every read request, 1.0 if (part of) the request could use the cache and 0.0 if it's passed through.
+            const AZ::Statistics::RunningStatistic& GetCacheableStatistic() const;
+            //! The number of blocks that were read ahead because a file was detected to be read sequentially.
+            u64 GetNumReadAheadBlocks() const;
+            //! Clears the hit rate, cacheable and read-ahead statistics, for instance at the start of a level load.
+            void ResetStatistics();
+
         protected:
             static constexpr u32 s_fileNotCached = static_cast<u32>(-1);
+            //! The number of files for which the access pattern is tracked.
+            static constexpr size_t s_maxTrackedFiles = 16;
+            //! The number of consecutive reads that need to start where the previous read ended before a file is considered to be read sequentially.
+            static constexpr u32 s_sequentialReadThreshold = 2;
 
             enum class CacheResult
             {
@@ -103,12 +124,25 @@ namespace AZ
                 u64 m_blockOffset{ 0 }; //!< Offset into the cache block to start copying from.
                 u64 m_copySize{ 0 }; //!< Number of bytes to copy from cache.
                 u32 m_cacheBlockIndex{ s_fileNotCached }; //!< If assigned, the index of the cache block assigned to this section.
+                u32 m_blockSpan{ 1 }; //!< The number of consecutive cache blocks that are used as a single block for this section.
                 bool m_used{ false }; //!< Whether or not this section is used in further processing.
 
                 // Add the provided section in front of this one.
                 void Prefix(const Section& section);
             };
 
+            //! Information about the recent reads of a file, used to detect sequential reads and to pick a block size for the file.
+            struct FileAccessPattern
+            {
+                RequestPath m_path;
+                u64 m_nextOffset{ 0 }; //!< The offset the next read starts at if the file is read sequentially.
+                u64 m_averageRequestSize{ 0 }; //!< Moving average of the size of the read requests for the file.
+                u64 m_readAheadEnd{ 0 }; //!< The offset up to which blocks have been read ahead.
+                u64 m_lastAccess{ 0 }; //!< Value of m_accessCounter when the file was last read from.
+                u32 m_sequentialReadCount{ 0 }; //!< The number of consecutive reads that started where the previous read ended.
+                u32 m_blockSpan{ 1 }; //!< The number of consecutive cache blocks used as a single block for this file.
+            };
+
             using TimePoint = AZStd::chrono::system_clock::time_point;
 
             void ReadFile(FileRequest* request, FileRequest::ReadData& data);
@@ -118,14 +152,21 @@ namespace AZ
             CacheResult ServiceFromCache(FileRequest* request, Section& section, const RequestPath& filePath, bool sharedRead);
             void CompleteRead(FileRequest& request);
             bool SplitRequest(Section& prolog, Section& main, Section& epilog, const RequestPath& filePath, u64 fileLength,
-                u64 offset, u64 size, u8* buffer) const;
+                u64 offset, u64 size, u8* buffer, u32 blockSpan) const;
+
+            FileAccessPattern& UpdateAccessPattern(const RequestPath& filePath, u64 offset, u64 size);
+            void ReadAhead(FileAccessPattern& pattern, u64 fileLength, bool sharedRead);
 
             u8* GetCacheBlockData(u32 index);
             void TouchBlock(u32 index);
-            AZ::u32 RecycleOldestBlock(const RequestPath& filePath, u64 offset);
-            u32 FindInCache(const RequestPath& filePath, u64 offset) const;
+            AZ::u32 RecycleOldestBlock(const RequestPath& filePath, u64 offset, u32 blockSpan);
+            //! Finds the cache block that holds the data for the block span at the given offset. The returned block may be the
+            //! start of a larger span, in which case offsetInSpan is set to the distance from the start of that span.
+            u32 FindInCache(const RequestPath& filePath, u64 offset, u32 blockSpan, u64& offsetInSpan) const;
+            u32 GetFirstBlockOfSpan(u32 index) const;
             bool IsCacheBlockInFlight(u32 index) const;
             void ResetCacheEntry(u32 index);
+            void ResetCacheSpan(u32 index);
             void ResetCache();
 
             //! Map of the file requests that are being processed and the sections of the parent requests they'll complete.
@@ -150,7 +191,19 @@ namespace AZ
             AZStd::unique_ptr<TimePoint[]> m_blockLastTouched; // Array of m_numBlocks size.
             //! The file request that's currently read data into the cache block. If null, the block has been read.
             AZStd::unique_ptr<FileRequest*[]> m_inFlightRequests; // Array of m_numbBlocks size.
-            
+            //! The number of cache blocks in the span the cache block is part of. The file path, offset and in-flight request are
+            //! only stored in the first block of a span.
+            AZStd::unique_ptr<u32[]> m_blockSpans; // Array of m_numBlocks size.
+
+            //! The access patterns of the most recently read files.
+            AZStd::vector<FileAccessPattern> m_accessPatterns;
+            u64 m_accessCounter{ 0 };
+            u64 m_numReadAheadBlocks{ 0 };
+            //! The number of blocks to read ahead of a sequentially read file.
+            u32 m_readAheadBlocks;
+            //! The largest number of cache blocks a file can combine into a single block.
+            u32 m_maxBlockSpan{ 1 };
+
             //! The number of requests waiting for meta data to be retrieved.
             s32 m_numMetaDataRetrievalInProgress{ 0 };
             //! Whether or not only the epilog ever writes to the cache.
@@ -58,7 +58,8 @@ namespace AZ
         {
             if (m_allocator != nullptr)
             {
-                if (m_output != nullptr)
+                // Memory from a mapped view is released together with the view.
+                if (m_output != nullptr && !m_mappedView)
                 {
                     m_allocator->Release(m_output);
                 }
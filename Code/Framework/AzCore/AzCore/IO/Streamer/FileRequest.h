@@ -87,6 +87,9 @@ namespace AZ
                 u64 m_size; //!< The number of bytes to read from the file.
                 IStreamerTypes::Priority m_priority; //!< Priority used for ordering requests. This is used when requests have the same deadline.
                 IStreamerTypes::MemoryType m_memoryType; //!< The type of memory provided by the allocator if used.
+                //! If set, m_output points into this read-only view of a memory mapped file instead of memory from m_allocator.
+                //! The view keeps the mapping alive for as long as the request exists.
+                AZStd::shared_ptr<const void> m_mappedView;
             };
 
             //! Request to read data. This is a translated request and holds an absolute path and has been
@@ -17,6 +17,8 @@
 #include <AzCore/Jobs/JobManager.h>
 #include <AzCore/Math/MathUtils.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/typetraits/decay.h>
@@ -208,7 +210,7 @@ namespace AZ
                     auto data = AZStd::get_if<FileRequest::CompressedReadData>(&compressedRequest->GetCommand());
                     AZ_Assert(data, "Compressed request in the decompression queue in FullFileDecompressor didn't contain compression read data.");
 
-                    size_t bytesToDecompress = data->m_compressionInfo.m_compressedSize;
+                    size_t bytesToDecompress = GetReadRange(*data).m_compressedSize;
                     auto decompressionDuration = AZStd::chrono::microseconds(
                         aznumeric_cast<u64>((bytesToDecompress * totalDecompressionDuration) / totalBytesDecompressed));
                     auto timeInProcessing = now - m_processingJobs[i].m_jobStartTime;
@@ -259,7 +261,7 @@ namespace AZ
                 FileRequest* compressedRequest = m_readRequests[i]->GetParent();
                 auto data = AZStd::get_if<FileRequest::CompressedReadData>(&compressedRequest->GetCommand());
                 
-                size_t bytesToDecompress = data->m_compressionInfo.m_compressedSize;
+                size_t bytesToDecompress = GetReadRange(*data).m_compressedSize;
                 auto decompressionDuration = AZStd::chrono::microseconds(
                     aznumeric_cast<u64>((bytesToDecompress * totalDecompressionDuration) / totalBytesDecompressed));
                 smallestDecompressionDuration = AZStd::min(smallestDecompressionDuration, decompressionDuration);
@@ -296,7 +298,7 @@ namespace AZ
             if (data)
             {
                 AZStd::chrono::microseconds processingTime = decompressionDelay;
-                size_t bytesToDecompress = data->m_compressionInfo.m_compressedSize;
+                size_t bytesToDecompress = GetReadRange(*data).m_compressedSize;
                 processingTime += AZStd::chrono::microseconds(
                     aznumeric_cast<u64>((bytesToDecompress * totalDecompressionDurationUs) / totalBytesDecompressed));
                 
@@ -345,6 +347,41 @@ namespace AZ
                 m_numRunningJobs == 0;
         }
 
+        auto FullFileDecompressor::GetReadRange(const FileRequest::CompressedReadData& data) -> ReadRange
+        {
+            const CompressionInfo& info = data.m_compressionInfo;
+            ReadRange range;
+            range.m_compressedOffset = info.m_offset;
+            range.m_compressedSize = info.m_compressedSize;
+            range.m_uncompressedSize = info.m_uncompressedSize;
+
+            if (info.m_seekPoints && info.m_seekPoints->size() > 1)
+            {
+                const CompressionSeekPoints& seekPoints = *info.m_seekPoints;
+                // The first part to decompress starts at the last seek point at or before the read offset and the last part ends
+                // at the first seek point at or after the end of the read.
+                auto first = AZStd::upper_bound(seekPoints.begin(), seekPoints.end() - 1, data.m_readOffset,
+                    [](u64 offset, const CompressionSeekPoint& seekPoint) { return offset < seekPoint.m_uncompressedOffset; });
+                first = first != seekPoints.begin() ? first - 1 : first;
+                auto last = AZStd::lower_bound(first + 1, seekPoints.end() - 1, data.m_readOffset + data.m_readSize,
+                    [](const CompressionSeekPoint& seekPoint, u64 offset) { return seekPoint.m_uncompressedOffset < offset; });
+
+                range.m_compressedOffset = info.m_offset + first->m_compressedOffset;
+                range.m_compressedSize = last->m_compressedOffset - first->m_compressedOffset;
+                range.m_uncompressedOffset = first->m_uncompressedOffset;
+                range.m_uncompressedSize = last->m_uncompressedOffset - first->m_uncompressedOffset;
+                range.m_firstSeekPoint = AZStd::distance(seekPoints.begin(), first);
+                range.m_lastSeekPoint = AZStd::distance(seekPoints.begin(), last);
+            }
+            return range;
+        }
+
+        size_t FullFileDecompressor::GetReadBufferSize(const ReadRange& range) const
+        {
+            size_t offsetAdjustment = range.m_compressedOffset - AZ_SIZE_ALIGN_DOWN(range.m_compressedOffset, aznumeric_cast<size_t>(m_alignment));
+            return AZ_SIZE_ALIGN_UP((range.m_compressedSize + offsetAdjustment), aznumeric_cast<size_t>(m_alignment));
+        }
+
         void FullFileDecompressor::PrepareReadRequest(FileRequest* request, FileRequest::ReadRequestData& data)
         {
             CompressionInfo info;
@@ -497,18 +534,21 @@ namespace AZ
                     CompressionInfo& info = data->m_compressionInfo;
                     AZ_Assert(info.m_decompressor, "FullFileDecompressor is planning to a queue a request for reading but couldn't find a decompressor.");
 
+                    // Only the part of the file that's needed for the request is read if the file has seek points.
+                    ReadRange range = GetReadRange(*data);
+
                     // The buffer is aligned down but the offset is not corrected. If the offset was adjusted it would mean the same data is read
                     // multiple times and negates the block cache's ability to detect these cases. By still adjusting it means that the reads between
                     // the BlockCache's prolog and epilog are read into aligned buffers.
-                    size_t offsetAdjustment = info.m_offset - AZ_SIZE_ALIGN_DOWN(info.m_offset, aznumeric_cast<size_t>(m_alignment));
-                    size_t bufferSize = AZ_SIZE_ALIGN_UP((info.m_compressedSize + offsetAdjustment), aznumeric_cast<size_t>(m_alignment));
+                    size_t offsetAdjustment = range.m_compressedOffset - AZ_SIZE_ALIGN_DOWN(range.m_compressedOffset, aznumeric_cast<size_t>(m_alignment));
+                    size_t bufferSize = GetReadBufferSize(range);
                     m_readBuffers[i] = reinterpret_cast<Buffer>(AZ::AllocatorInstance<AZ::SystemAllocator>::Get().Allocate(
                         bufferSize, m_alignment, 0, "AZ::IO::Streamer FullFileDecompressor", __FILE__, __LINE__));
                     m_memoryUsage += bufferSize;
 
                     FileRequest* archiveReadRequest = m_context->GetNewInternalRequest();
                     archiveReadRequest->CreateRead(compressedReadRequest, m_readBuffers[i] + offsetAdjustment, bufferSize, info.m_archiveFilename,
-                        info.m_offset, info.m_compressedSize, info.m_isSharedPak);
+                        range.m_compressedOffset, range.m_compressedSize, info.m_isSharedPak);
                     archiveReadRequest->SetCompletionCallback(
                         [this, readSlot = i](FileRequest& request)
                         {
@@ -553,9 +593,7 @@ namespace AZ
             {
                 auto data = AZStd::get_if<FileRequest::CompressedReadData>(&compressedRequest->GetCommand());
                 AZ_Assert(data, "Compressed request in FullFileDecompressor that finished unsuccessfully didn't contain compression read data.");
-                CompressionInfo& info = data->m_compressionInfo;
-                size_t offsetAdjustment = info.m_offset - AZ_SIZE_ALIGN_DOWN(info.m_offset, aznumeric_cast<size_t>(m_alignment));
-                size_t bufferSize = AZ_SIZE_ALIGN_UP((info.m_compressedSize + offsetAdjustment), aznumeric_cast<size_t>(m_alignment));
+                size_t bufferSize = GetReadBufferSize(GetReadRange(*data));
                 m_memoryUsage -= bufferSize;
 
                 if (m_readBuffers[readSlot] != nullptr)
@@ -616,23 +654,24 @@ namespace AZ
                     AZ_Assert(data, "Compressed request in FullFileDecompressor that's starting decompression didn't contain compression read data.");
                     AZ_Assert(data->m_compressionInfo.m_decompressor, "FullFileDecompressor is queuing a decompression job but couldn't find a decompressor.");
 
-                    info.m_alignmentOffset = aznumeric_caster(data->m_compressionInfo.m_offset -
-                        AZ_SIZE_ALIGN_DOWN(data->m_compressionInfo.m_offset, aznumeric_cast<size_t>(m_alignment)));
+                    ReadRange range = GetReadRange(*data);
+                    info.m_alignmentOffset = aznumeric_caster(range.m_compressedOffset -
+                        AZ_SIZE_ALIGN_DOWN(range.m_compressedOffset, aznumeric_cast<size_t>(m_alignment)));
 
                     if (data->m_readOffset == 0 && data->m_readSize == data->m_compressionInfo.m_uncompressedSize)
                     {
                         auto job = [this, &info]()
                         {
-                            FullDecompression(m_context, info);
+                            FullDecompression(m_context, *m_decompressionJobManager, info);
                         };
                         decompressionJob = AZ::CreateJobFunction(job, true, m_decompressionjobContext.get());
                     }
                     else
                     {
-                        m_memoryUsage += data->m_compressionInfo.m_uncompressedSize;
+                        m_memoryUsage += range.m_uncompressedSize;
                         auto job = [this, &info]()
                         {
-                            PartialDecompression(m_context, info);
+                            PartialDecompression(m_context, *m_decompressionJobManager, info);
                         };
                         decompressionJob = AZ::CreateJobFunction(job, true, m_decompressionjobContext.get());
                     }
@@ -668,20 +707,19 @@ namespace AZ
             AZ_Assert(compressedRequest, "A wait request attached to FullFileDecompressor was completed but didn't have a parent compressed request.");
             auto data = AZStd::get_if<FileRequest::CompressedReadData>(&compressedRequest->GetCommand());
             AZ_Assert(data, "Compressed request in FullFileDecompressor that completed decompression didn't contain compression read data.");
-            CompressionInfo& info = data->m_compressionInfo;
-            size_t offsetAdjustment = info.m_offset - AZ_SIZE_ALIGN_DOWN(info.m_offset, aznumeric_cast<size_t>(m_alignment));
-            size_t bufferSize = AZ_SIZE_ALIGN_UP((info.m_compressedSize + offsetAdjustment), aznumeric_cast<size_t>(m_alignment));
+            ReadRange range = GetReadRange(*data);
+            size_t bufferSize = GetReadBufferSize(range);
             m_memoryUsage -= bufferSize;
             if (data->m_readOffset != 0 || data->m_readSize != data->m_compressionInfo.m_uncompressedSize)
             {
-                m_memoryUsage -= data->m_compressionInfo.m_uncompressedSize;
+                m_memoryUsage -= range.m_uncompressedSize;
             }
 
             m_decompressionJobDelayMicroSec.PushEntry(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(
                 jobInfo.m_jobStartTime - jobInfo.m_queueStartTime).count());
             m_decompressionDurationMicroSec.PushEntry(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(
                 endTime - jobInfo.m_jobStartTime).count());
-            m_bytesDecompressed.PushEntry(data->m_compressionInfo.m_compressedSize);
+            m_bytesDecompressed.PushEntry(range.m_compressedSize);
 
             AZ::AllocatorInstance<AZ::SystemAllocator>::Get().DeAllocate(jobInfo.m_compressedData, bufferSize, m_alignment);
             jobInfo.m_compressedData = nullptr;
@@ -690,7 +728,7 @@ namespace AZ
             return;
         }
 
-        void FullFileDecompressor::FullDecompression(StreamerContext* context, DecompressionInformation& info)
+        void FullFileDecompressor::FullDecompression(StreamerContext* context, JobManager& jobManager, DecompressionInformation& info)
         {
             info.m_jobStartTime = AZStd::chrono::high_resolution_clock::now();
 
@@ -707,15 +745,15 @@ namespace AZ
                 "FullFileDecompressor is doing a full decompression, but the target buffer size (%llu) doesn't match the decompressed size (%zu).",
                 request->m_readSize, compressionInfo.m_uncompressedSize);
             
-            bool success = compressionInfo.m_decompressor(compressionInfo, info.m_compressedData + info.m_alignmentOffset,
-                compressionInfo.m_compressedSize, request->m_output, compressionInfo.m_uncompressedSize);
+            bool success = DecompressRange(jobManager, compressionInfo, GetReadRange(*request), info.m_compressedData + info.m_alignmentOffset,
+                reinterpret_cast<u8*>(request->m_output));
             info.m_waitRequest->SetStatus(success ? IStreamerTypes::RequestStatus::Completed : IStreamerTypes::RequestStatus::Failed);
             
             context->MarkRequestAsCompleted(info.m_waitRequest);
             context->WakeUpSchedulingThread();
         }
 
-        void FullFileDecompressor::PartialDecompression(StreamerContext* context, DecompressionInformation& info)
+        void FullFileDecompressor::PartialDecompression(StreamerContext* context, JobManager& jobManager, DecompressionInformation& info)
         {
             info.m_jobStartTime = AZStd::chrono::high_resolution_clock::now();
 
@@ -726,15 +764,62 @@ namespace AZ
             CompressionInfo& compressionInfo = request->m_compressionInfo;
             AZ_Assert(compressionInfo.m_decompressor, "Partial decompressor job started, but there's no decompressor callback assigned.");
 
-            AZStd::unique_ptr<u8[]> decompressionBuffer = AZStd::unique_ptr<u8[]>(new u8[compressionInfo.m_uncompressedSize]);
-            bool success = compressionInfo.m_decompressor(compressionInfo, info.m_compressedData + info.m_alignmentOffset,
-                compressionInfo.m_compressedSize, decompressionBuffer.get(), compressionInfo.m_uncompressedSize);
+            ReadRange range = GetReadRange(*request);
+            AZStd::unique_ptr<u8[]> decompressionBuffer = AZStd::unique_ptr<u8[]>(new u8[range.m_uncompressedSize]);
+            bool success = DecompressRange(jobManager, compressionInfo, range, info.m_compressedData + info.m_alignmentOffset,
+                decompressionBuffer.get());
             info.m_waitRequest->SetStatus(success ? IStreamerTypes::RequestStatus::Completed : IStreamerTypes::RequestStatus::Failed);
             
-            memcpy(request->m_output, decompressionBuffer.get() + request->m_readOffset, request->m_readSize);
+            memcpy(request->m_output, decompressionBuffer.get() + (request->m_readOffset - range.m_uncompressedOffset), request->m_readSize);
 
             context->MarkRequestAsCompleted(info.m_waitRequest);
             context->WakeUpSchedulingThread();
         }
+
+        bool FullFileDecompressor::DecompressRange(JobManager& jobManager, const CompressionInfo& compressionInfo, const ReadRange& range,
+            const u8* compressed, u8* uncompressed)
+        {
+            if (range.m_lastSeekPoint - range.m_firstSeekPoint < 2)
+            {
+                return compressionInfo.m_decompressor(compressionInfo, compressed, range.m_compressedSize,
+                    uncompressed, range.m_uncompressedSize);
+            }
+
+            const CompressionSeekPoints& seekPoints = *compressionInfo.m_seekPoints;
+            const CompressionSeekPoint& start = seekPoints[range.m_firstSeekPoint];
+            AZStd::atomic_bool success{ true };
+            auto decompressPart = [&compressionInfo, &seekPoints, &start, &success, compressed, uncompressed](size_t index)
+            {
+                const CompressionSeekPoint& begin = seekPoints[index];
+                const CompressionSeekPoint& end = seekPoints[index + 1];
+                if (!compressionInfo.m_decompressor(compressionInfo,
+                    compressed + (begin.m_compressedOffset - start.m_compressedOffset), end.m_compressedOffset - begin.m_compressedOffset,
+                    uncompressed + (begin.m_uncompressedOffset - start.m_uncompressedOffset), end.m_uncompressedOffset - begin.m_uncompressedOffset))
+                {
+                    success = false;
+                }
+            };
+
+            // The parts between seek points are independent, so decompress all but the last one as child jobs and the last one
+            // on this thread while the children are running.
+            Job* currentJob = jobManager.GetCurrentJob();
+            for (size_t i = range.m_firstSeekPoint; i < range.m_lastSeekPoint - 1; ++i)
+            {
+                if (currentJob)
+                {
+                    currentJob->StartAsChild(AZ::CreateJobFunction([&decompressPart, i]() { decompressPart(i); }, true, currentJob->GetContext()));
+                }
+                else
+                {
+                    decompressPart(i);
+                }
+            }
+            decompressPart(range.m_lastSeekPoint - 1);
+            if (currentJob)
+            {
+                currentJob->WaitForChildren();
+            }
+            return success;
+        }
     } // namespace IO
 } // namespace AZ
@@ -49,6 +49,9 @@ namespace AZ
         //! Finally, the lack of an upper limit also means that the duration of the decompression job
         //! can vary largely so a dedicated job system is used to decompress on to avoid blocking
         //! the main job system from working.
+        //! Files that provide seek points are the exception. For these only the data between the seek
+        //! points surrounding the requested range is read and decompressed, and the parts between the
+        //! seek points are decompressed in parallel.
         class FullFileDecompressor
             : public StreamStackEntry
         {
@@ -87,8 +90,25 @@ namespace AZ
                 u32 m_alignmentOffset{ 0 };
             };
 
+            //! The part of a compressed file that needs to be read and decompressed to serve a request.
+            struct ReadRange
+            {
+                //! Offset in the archive at which the compressed data starts.
+                size_t m_compressedOffset{ 0 };
+                size_t m_compressedSize{ 0 };
+                //! Offset in the decompressed file at which the decompressed data starts.
+                size_t m_uncompressedOffset{ 0 };
+                size_t m_uncompressedSize{ 0 };
+                //! Indices of the seek points at the start and end of the range. Both are zero if there are no seek points.
+                size_t m_firstSeekPoint{ 0 };
+                size_t m_lastSeekPoint{ 0 };
+            };
+
             bool IsIdle() const;
 
+            static ReadRange GetReadRange(const FileRequest::CompressedReadData& data);
+            size_t GetReadBufferSize(const ReadRange& range) const;
+
             void PrepareReadRequest(FileRequest* request, FileRequest::ReadRequestData& data);
             void PrepareDedicatedCache(FileRequest* request, const RequestPath& path);
             void FileExistsCheck(FileRequest* checkRequest);
@@ -101,8 +121,10 @@ namespace AZ
             bool StartDecompressions();
             void FinishDecompression(FileRequest* waitRequest, u32 jobSlot);
             
-            static void FullDecompression(StreamerContext* context, DecompressionInformation& info);
-            static void PartialDecompression(StreamerContext* context, DecompressionInformation& info);
+            static void FullDecompression(StreamerContext* context, JobManager& jobManager, DecompressionInformation& info);
+            static void PartialDecompression(StreamerContext* context, JobManager& jobManager, DecompressionInformation& info);
+            static bool DecompressRange(JobManager& jobManager, const CompressionInfo& compressionInfo, const ReadRange& range,
+                const u8* compressed, u8* uncompressed);
 
             AZStd::deque<FileRequest*> m_pendingReads;
             AZStd::deque<FileRequest*> m_pendingFileExistChecks;
@@ -9,13 +9,15 @@
 #include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/IO/Streamer/Scheduler.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/containers/deque.h>
 #include <AzCore/std/sort.h>
 
 namespace AZ::IO
 {
-#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
     static constexpr char SchedulerName[] = "Scheduler";
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
     static constexpr char ImmediateReadsName[] = "Immediate reads";
 #endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
 
@@ -126,6 +128,8 @@ namespace AZ::IO
         statistics.push_back(Statistic::CreateFloat(SchedulerName, "Processing speed (avg. mbps)", m_processingSpeedStat.CalculateAverage()));
         statistics.push_back(Statistic::CreatePercentage(SchedulerName, ImmediateReadsName, m_immediateReadsPercentageStat.GetAverage()));
 #endif
+        statistics.push_back(Statistic::CreateInteger(SchedulerName, "Coalesced bytes", aznumeric_cast<s64>(m_coalescedBytes)));
+        statistics.push_back(Statistic::CreateInteger(SchedulerName, "Seeks avoided", aznumeric_cast<s64>(m_seeksAvoided)));
         m_context.CollectStatistics(statistics);
         m_threadData.m_streamStack->CollectStatistics(statistics);
     }
@@ -228,31 +232,23 @@ namespace AZ::IO
                 auto parentReadRequest = next->GetCommandFromChain<FileRequest::ReadRequestData>();
                 AZ_Assert(parentReadRequest != nullptr, "The issued read request can't be found for the (compressed) read command.");
                 
-                size_t size = parentReadRequest->m_size;
-                if (parentReadRequest->m_output == nullptr)
+                // Allocation for requests that accept mapped views is left to the stack entry that maps the file. That entry
+                // allocates from the request's allocator if the file can't be mapped.
+                const bool deferAllocation = AZStd::is_same_v<Command, FileRequest::ReadData> &&
+                    m_stackStatus.m_supportsMappedViews && parentReadRequest->m_allocator != nullptr &&
+                    parentReadRequest->m_allocator->AcceptsMappedViews();
+                if (parentReadRequest->m_output == nullptr && !deferAllocation)
                 {
-                    AZ_Assert(parentReadRequest->m_allocator,
-                        "The read request was issued without a memory allocator or valid output address.");
-                    u64 recommendedSize = size;
-                    if constexpr (AZStd::is_same_v<Command, FileRequest::ReadData>)
-                    {
-                        recommendedSize = m_recommendations.CalculateRecommendedMemorySize(size, parentReadRequest->m_offset);
-                    }
-                    IStreamerTypes::RequestMemoryAllocatorResult allocation =
-                        parentReadRequest->m_allocator->Allocate(size, recommendedSize, m_recommendations.m_memoryAlignment);
-                    if (allocation.m_address == nullptr || allocation.m_size < parentReadRequest->m_size)
+                    if (!Thread_AllocateReadOutput(*parentReadRequest, AZStd::is_same_v<Command, FileRequest::ReadData>))
                     {
                         next->SetStatus(IStreamerTypes::RequestStatus::Failed);
                         m_context.MarkRequestAsCompleted(next);
                         return;
                     }
-                    parentReadRequest->m_output = allocation.m_address;
-                    parentReadRequest->m_outputSize = allocation.m_size;
-                    parentReadRequest->m_memoryType = allocation.m_type;
                     if constexpr (AZStd::is_same_v<Command, FileRequest::ReadData>)
                     {
                         args.m_output = parentReadRequest->m_output;
-                        args.m_outputSize = allocation.m_size;
+                        args.m_outputSize = parentReadRequest->m_outputSize;
                     }
                     else if constexpr (AZStd::is_same_v<Command, FileRequest::CompressedReadData>)
                     {
@@ -267,12 +263,18 @@ namespace AZ::IO
                 }
 #endif
                 
+                FileRequest* queuedRequest = next;
                 if constexpr (AZStd::is_same_v<Command, FileRequest::ReadData>)
                 {
-                    m_threadData.m_lastFilePath = args.m_path;
-                    m_threadData.m_lastFileOffset = args.m_offset + args.m_size;
+                    if (!deferAllocation)
+                    {
+                        queuedRequest = Thread_CoalesceReads(next, args);
+                    }
+                    auto& queuedRead = AZStd::get<FileRequest::ReadData>(queuedRequest->GetCommand());
+                    m_threadData.m_lastFilePath = queuedRead.m_path;
+                    m_threadData.m_lastFileOffset = queuedRead.m_offset + queuedRead.m_size;
 #if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
-                    m_processingSize += args.m_size;
+                    m_processingSize += queuedRead.m_size;
 #endif
                 }
                 else if constexpr (AZStd::is_same_v<Command, FileRequest::CompressedReadData>)
@@ -284,9 +286,9 @@ namespace AZ::IO
                     m_processingSize += info.m_uncompressedSize;
 #endif
                 }
-                AZ_PROFILE_INTERVAL_START_COLORED(AzCore, next, ProfilerColor,
+                AZ_PROFILE_INTERVAL_START_COLORED(AzCore, queuedRequest, ProfilerColor,
                     "Streamer queued %zu: %s", next->GetCommand().index(), parentReadRequest->m_path.GetRelativePath());
-                m_threadData.m_streamStack->QueueRequest(next);
+                m_threadData.m_streamStack->QueueRequest(queuedRequest);
             }
             else if constexpr (AZStd::is_same_v<Command, FileRequest::CancelData>)
             {
@@ -315,6 +317,119 @@ namespace AZ::IO
         }, next->GetCommand());
     }
 
+    bool Scheduler::Thread_AllocateReadOutput(FileRequest::ReadRequestData& readRequest, bool isUncompressedRead)
+    {
+        AZ_Assert(readRequest.m_allocator, "The read request was issued without a memory allocator or valid output address.");
+        u64 recommendedSize = readRequest.m_size;
+        if (isUncompressedRead)
+        {
+            recommendedSize = m_recommendations.CalculateRecommendedMemorySize(readRequest.m_size, readRequest.m_offset);
+        }
+        IStreamerTypes::RequestMemoryAllocatorResult allocation =
+            readRequest.m_allocator->Allocate(readRequest.m_size, recommendedSize, m_recommendations.m_memoryAlignment);
+        if (allocation.m_address == nullptr || allocation.m_size < readRequest.m_size)
+        {
+            return false;
+        }
+        readRequest.m_output = allocation.m_address;
+        readRequest.m_outputSize = allocation.m_size;
+        readRequest.m_memoryType = allocation.m_type;
+        return true;
+    }
+
+    FileRequest* Scheduler::Thread_CoalesceReads(FileRequest* request, FileRequest::ReadData& data)
+    {
+        // After scheduling, reads in the active file are ordered by offset, so any reads that can be combined are at the front of the queue.
+        const u64 start = data.m_offset;
+        u64 end = data.m_offset + data.m_size;
+        size_t count = 0;
+        for (FileRequest* candidate : m_context.GetPreparedRequests())
+        {
+            auto candidateData = AZStd::get_if<FileRequest::ReadData>(&candidate->GetCommand());
+            if (candidateData == nullptr || candidateData->m_path != data.m_path || candidateData->m_sharedRead != data.m_sharedRead ||
+                candidateData->m_offset < start || candidateData->m_offset > end + MaxCoalesceGap)
+            {
+                break;
+            }
+            const u64 candidateEnd = AZStd::max(end, candidateData->m_offset + candidateData->m_size);
+            if (candidateEnd - start > m_recommendations.m_granularity)
+            {
+                break;
+            }
+            if (candidateData->m_output == nullptr)
+            {
+                auto candidateReadRequest = candidate->GetCommandFromChain<FileRequest::ReadRequestData>();
+                if (candidateReadRequest == nullptr || candidateReadRequest->m_allocator == nullptr ||
+                    (m_stackStatus.m_supportsMappedViews && candidateReadRequest->m_allocator->AcceptsMappedViews()) ||
+                    !Thread_AllocateReadOutput(*candidateReadRequest, true))
+                {
+                    break;
+                }
+                candidateData->m_output = candidateReadRequest->m_output;
+                candidateData->m_outputSize = candidateReadRequest->m_outputSize;
+            }
+            end = candidateEnd;
+            ++count;
+        }
+
+        if (count == 0)
+        {
+            return request;
+        }
+
+        AZStd::vector<FileRequest*> reads;
+        reads.reserve(count + 1);
+        reads.push_back(request);
+        for (size_t i = 0; i < count; ++i)
+        {
+            FileRequest* read = m_context.PopPreparedRequest();
+            read->SetStatus(IStreamerTypes::RequestStatus::Processing);
+            reads.push_back(read);
+
+            m_coalescedBytes += AZStd::get<FileRequest::ReadData>(read->GetCommand()).m_size;
+        }
+        m_seeksAvoided += count;
+
+        const u64 size = end - start;
+        const size_t alignment = aznumeric_cast<size_t>(m_recommendations.m_memoryAlignment);
+        u8* buffer = reinterpret_cast<u8*>(AZ::AllocatorInstance<AZ::SystemAllocator>::Get().Allocate(
+            size, alignment, 0, "AZ::IO::Streamer Scheduler", __FILE__, __LINE__));
+
+        // The combined read refers to the path stored with the record of the combined reads, which stays at the same address until
+        // the combined read completes.
+        m_threadData.m_coalescedReads.emplace_back();
+        CoalescedRead& coalesced = m_threadData.m_coalescedReads.back();
+        coalesced.m_path = data.m_path;
+        coalesced.m_reads = AZStd::move(reads);
+        FileRequest* combinedRead = m_context.GetNewInternalRequest();
+        coalesced.m_combinedRead = combinedRead;
+        combinedRead->CreateRead(nullptr, buffer, size, coalesced.m_path, start, size, data.m_sharedRead);
+        combinedRead->SetCompletionCallback([this, buffer, start, size, alignment](FileRequest& combined)
+        {
+            auto& coalescedReads = m_threadData.m_coalescedReads;
+            auto coalescedIt = AZStd::find_if(coalescedReads.begin(), coalescedReads.end(),
+                [&combined](const CoalescedRead& coalesced) { return coalesced.m_combinedRead == &combined; });
+            AZ_Assert(coalescedIt != coalescedReads.end(), "A combined read completed that the Scheduler doesn't have a record of.");
+
+            // Scatter the combined data back to the original reads that haven't been canceled, which completes them with the
+            // status of the combined read.
+            IStreamerTypes::RequestStatus status = combined.GetStatus();
+            for (FileRequest* read : coalescedIt->m_reads)
+            {
+                if (status == IStreamerTypes::RequestStatus::Completed)
+                {
+                    auto& readData = AZStd::get<FileRequest::ReadData>(read->GetCommand());
+                    memcpy(readData.m_output, buffer + (readData.m_offset - start), readData.m_size);
+                }
+                read->SetStatus(status);
+                m_context.MarkRequestAsCompleted(read);
+            }
+            coalescedReads.erase(coalescedIt);
+            AZ::AllocatorInstance<AZ::SystemAllocator>::Get().DeAllocate(buffer, size, alignment);
+        });
+        return combinedRead;
+    }
+
     bool Scheduler::Thread_ExecuteRequests()
     {
         AZ_PROFILE_FUNCTION(AzCore);
@@ -411,6 +526,26 @@ namespace AZ::IO
                 ++pendingIt;
             }
         }
+
+        // Reads that have been combined into a single read are completed right away. The combined read is left to finish as it
+        // may still serve other reads, but it will no longer write to the output of the canceled reads.
+        for (CoalescedRead& coalesced : m_threadData.m_coalescedReads)
+        {
+            auto readIt = coalesced.m_reads.begin();
+            while (readIt != coalesced.m_reads.end())
+            {
+                if ((*readIt)->WorksOn(data.m_target))
+                {
+                    (*readIt)->SetStatus(IStreamerTypes::RequestStatus::Canceled);
+                    m_context.MarkRequestAsCompleted(*readIt);
+                    readIt = coalesced.m_reads.erase(readIt);
+                }
+                else
+                {
+                    ++readIt;
+                }
+            }
+        }
         
         m_threadData.m_streamStack->QueueRequest(request);
     }
@@ -436,6 +571,23 @@ namespace AZ::IO
             }
         }
 
+        // Reads that have been combined are already in flight, but still update them so the new deadline and priority are
+        // reported consistently.
+        for (CoalescedRead& coalesced : m_threadData.m_coalescedReads)
+        {
+            for (FileRequest* read : coalesced.m_reads)
+            {
+                if (read->WorksOn(data.m_target))
+                {
+                    if (auto readRequest = read->GetCommandFromChain<FileRequest::ReadRequestData>(); readRequest != nullptr)
+                    {
+                        readRequest->m_deadline = data.m_newDeadline;
+                        readRequest->m_priority = data.m_newPriority;
+                    }
+                }
+            }
+        }
+
         request->SetStatus(IStreamerTypes::RequestStatus::Completed);
         m_context.MarkRequestAsCompleted(request);
     }
@@ -481,7 +633,7 @@ namespace AZ::IO
             // Let the one with the highest priority go first.
             if (firstRead->m_priority != secondRead->m_priority)
             {
-                return firstRead->m_priority < secondRead->m_priority ? Order::FirstRequest : Order::SecondRequest;
+                return firstRead->m_priority > secondRead->m_priority ? Order::FirstRequest : Order::SecondRequest;
             }
 
             // If neither has started and have the same priority, prefer to start the closest deadline.
@@ -492,49 +644,53 @@ namespace AZ::IO
         if (firstInPanic) { return Order::FirstRequest; }
         if (secondInPanic) { return Order::SecondRequest; }
 
-        // Both are not in panic so base the order on the number of IO steps (opening files, seeking, etc.) are needed.
-        auto sameFile = [this](auto&& args)
+        // Both are not in panic so let the request with the highest priority go first. Within the same priority the order is based
+        // on the number of IO steps (opening files, seeking, etc.) that are needed.
+        if (firstRead->m_priority != secondRead->m_priority)
+        {
+            return firstRead->m_priority > secondRead->m_priority ? Order::FirstRequest : Order::SecondRequest;
+        }
+
+        struct FileLocation
+        {
+            const RequestPath* m_path{ nullptr };
+            u64 m_offset{ 0 };
+        };
+        auto location = [](auto&& args) -> FileLocation
         {
             using Command = AZStd::decay_t<decltype(args)>;
             if constexpr (AZStd::is_same_v<Command, FileRequest::ReadData>)
             {
-                return m_threadData.m_lastFilePath == args.m_path;
+                return FileLocation{ &args.m_path, args.m_offset };
             }
             else if constexpr (AZStd::is_same_v<Command, FileRequest::CompressedReadData>)
             {
-                return m_threadData.m_lastFilePath == args.m_compressionInfo.m_archiveFilename;
+                return FileLocation{ &args.m_compressionInfo.m_archiveFilename, args.m_compressionInfo.m_offset };
             }
             else
             {
-                return false;
+                return FileLocation{};
             }
         };
-        bool firstInSameFile = AZStd::visit(sameFile, first->GetCommand());
-        bool secondInSameFile = AZStd::visit(sameFile, second->GetCommand());
-        // If both request are in the active file, prefer to pick the file that's closest to the last read.
+        FileLocation firstLocation = AZStd::visit(location, first->GetCommand());
+        FileLocation secondLocation = AZStd::visit(location, second->GetCommand());
+        bool firstInSameFile = firstLocation.m_path && *firstLocation.m_path == m_threadData.m_lastFilePath;
+        bool secondInSameFile = secondLocation.m_path && *secondLocation.m_path == m_threadData.m_lastFilePath;
+        // If both request are in the active file, continue the sweep through the file. Reads that are ahead of the last read are
+        // done first in increasing order, after which the reads that were skipped over are picked up on the next sweep.
         if (firstInSameFile && secondInSameFile)
         {
-            auto offset = [](auto&& args) -> s64
+            bool firstAhead = firstLocation.m_offset >= m_threadData.m_lastFileOffset;
+            bool secondAhead = secondLocation.m_offset >= m_threadData.m_lastFileOffset;
+            if (firstAhead != secondAhead)
             {
-                using Command = AZStd::decay_t<decltype(args)>;
-                if constexpr (AZStd::is_same_v<Command, FileRequest::ReadData>)
-                {
-                    return aznumeric_caster(args.m_offset);
-                }
-                else if constexpr (AZStd::is_same_v<Command, FileRequest::CompressedReadData>)
-                {
-                    return aznumeric_caster(args.m_compressionInfo.m_offset);
-                }
-                else
-                {
-                    return std::numeric_limits<s64>::max();
-                }
-            };
-            s64 firstReadOffset = AZStd::visit(offset, first->GetCommand());
-            s64 secondReadOffset = AZStd::visit(offset, second->GetCommand());
-            s64 firstSeekDistance = abs(aznumeric_cast<s64>(m_threadData.m_lastFileOffset) - firstReadOffset);
-            s64 secondSeekDistance = abs(aznumeric_cast<s64>(m_threadData.m_lastFileOffset) - secondReadOffset);
-            return firstSeekDistance <= secondSeekDistance ? Order::FirstRequest : Order::SecondRequest;
+                return firstAhead ? Order::FirstRequest : Order::SecondRequest;
+            }
+            if (firstLocation.m_offset != secondLocation.m_offset)
+            {
+                return firstLocation.m_offset < secondLocation.m_offset ? Order::FirstRequest : Order::SecondRequest;
+            }
+            return Order::Equal;
         }
 
         // Prefer to continue in the same file so prioritize the request that's in the same file
@@ -542,7 +698,8 @@ namespace AZ::IO
         if (secondInSameFile) { return Order::SecondRequest; }
 
         // If both requests need to open a new file, keep them in the same order as there's no information available
-        // to indicate which request would be able to load faster or more efficiently.
+        // to indicate which request would be able to load faster or more efficiently. Keeping the original order also
+        // guarantees that a file can't be starved by reads for other files.
         return Order::Equal;
     }
 
@@ -13,6 +13,7 @@
 #include <AzCore/IO/Streamer/StreamerConfiguration.h>
 #include <AzCore/IO/Streamer/StreamerContext.h>
 #include <AzCore/IO/Streamer/StreamStackEntry.h>
+#include <AzCore/std/containers/list.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/mutex.h>
@@ -55,6 +56,9 @@ namespace AZ::IO
 
     private:
         inline static constexpr u32 ProfilerColor = 0x0080ffff; //!< A lite shade of blue. (See https://www.color-hex.com/color/0080ff).
+        //! The largest gap between two reads in the same file for which the reads are still combined into a single read. The data
+        //! in the gap is read and discarded as that's cheaper than issuing a separate read.
+        inline static constexpr u64 MaxCoalesceGap = 4_kib;
 
         void Thread_MainLoop();
         void Thread_QueueNextRequest();
@@ -63,6 +67,10 @@ namespace AZ::IO
         void Thread_ProcessTillIdle();
         void Thread_ProcessCancelRequest(FileRequest* request, FileRequest::CancelData& data);
         void Thread_ProcessRescheduleRequest(FileRequest* request, FileRequest::RescheduleData& data);
+        bool Thread_AllocateReadOutput(FileRequest::ReadRequestData& readRequest, bool isUncompressedRead);
+        //! Combines the read with reads in the same file that are next in line and are close enough to be read in one go. Returns
+        //! the request to queue, which is either the provided request or a new request that covers all combined reads.
+        FileRequest* Thread_CoalesceReads(FileRequest* request, FileRequest::ReadData& data);
         
         enum class Order
         {
@@ -75,11 +83,23 @@ namespace AZ::IO
         void Thread_ScheduleRequests();
 
         // Stores data that's unguarded and should only be changed by the scheduling thread.
+        //! A read that has been issued on behalf of several reads in the same file.
+        struct CoalescedRead final
+        {
+            FileRequest* m_combinedRead{ nullptr };
+            //! Copy of the path as the original reads can be canceled and released before the combined read completes.
+            RequestPath m_path;
+            //! The original reads that still need to receive their data from the combined read.
+            AZStd::vector<FileRequest*> m_reads;
+        };
         struct ThreadData final
         {
             //! Requests pending in the Streaming stack entries. Cached here so it doesn't need to allocate
             //! and free memory whenever scheduling happens.
             AZStd::vector<FileRequest*> m_internalPendingRequests;
+            //! Reads that are serviced by a combined read. These are kept so cancel and reschedule requests can still find the
+            //! original reads while the combined read is in flight.
+            AZStd::list<CoalescedRead> m_coalescedReads;
             RequestPath m_lastFilePath; //!< Path of the last file queued for reading.
             AZStd::shared_ptr<StreamStackEntry> m_streamStack;
             u64 m_lastFileOffset{ 0 }; //!< Offset of into the last file queued after reading has completed.
@@ -90,6 +110,10 @@ namespace AZ::IO
         IStreamerTypes::Recommendations m_recommendations;
 
         StreamStackEntry::Status m_stackStatus;
+        //! Total number of bytes from reads that were combined into a read that was already going to be issued.
+        u64 m_coalescedBytes{ 0 };
+        //! Total number of reads that didn't need to be issued separately because they were combined with another read.
+        u64 m_seeksAvoided{ 0 };
 #if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
         AZStd::chrono::system_clock::time_point m_processingStartTime;
         size_t m_processingSize{ 0 };
@@ -42,6 +42,9 @@ namespace AZ
                 s32 m_numAvailableSlots{ std::numeric_limits<s32>::max() };
                 //! True if no node in the stack is doing any work or has any work pending.
                 bool m_isIdle{ true };
+                //! True if a node in the stack can provide views into memory mapped files for read requests that have no
+                //! memory assigned yet. If false, memory for those requests is allocated before they're queued.
+                bool m_supportsMappedViews{ false };
             };
 
             explicit StreamStackEntry(AZStd::string&& name);
@@ -219,6 +219,24 @@ namespace AZ::IO
             {
                 AZ_Assert(HasRequestCompleted(request), "Claiming memory from a read request that's still in progress. "
                     "This can lead to crashing if data is still being streamed to the request's buffer.");
+                if (readRequest->m_mappedView)
+                {
+                    // A view into a memory mapped file can't be handed over, so copy the data into memory the caller can own.
+                    IStreamerTypes::RequestMemoryAllocatorResult allocation = readRequest->m_allocator->Allocate(
+                        readRequest->m_size, readRequest->m_size, aznumeric_caster(GetRecommendations().m_memoryAlignment));
+                    if (allocation.m_address == nullptr)
+                    {
+                        buffer = nullptr;
+                        numBytesRead = 0;
+                        return false;
+                    }
+                    memcpy(allocation.m_address, readRequest->m_output, readRequest->m_size);
+                    readRequest->m_output = allocation.m_address;
+                    readRequest->m_outputSize = allocation.m_size;
+                    readRequest->m_memoryType = allocation.m_type;
+                    readRequest->m_mappedView.reset();
+                    buffer = readRequest->m_output;
+                }
                 // The caller has claimed the buffer and is now responsible for clearing it. 
                 readRequest->m_allocator->UnlockAllocator();
                 readRequest->m_allocator = nullptr;
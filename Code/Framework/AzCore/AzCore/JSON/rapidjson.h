@@ -42,6 +42,19 @@ namespace rapidjson_ly_internal
 #define RAPIDJSON_FREE(_ptr) if (_ptr) { AZ::AllocatorInstance<AZ::SystemAllocator>::Get().DeAllocate(_ptr, 0, 0); }
 #define RAPIDJSON_CLASS_ALLOCATOR(_class) AZ_CLASS_ALLOCATOR(_class, AZ::SystemAllocator, 0)
 
+// Enable the SIMD accelerated whitespace skipping and string scanning in rapidjson. Rapidjson selects these code paths at
+// compile time, so the instruction set is picked from what the compiler is already allowed to generate for the target
+// rather than detected at runtime. SSE2 is part of the baseline for all 64-bit x86 targets.
+#if !defined(RAPIDJSON_SSE42) && !defined(RAPIDJSON_SSE2) && !defined(RAPIDJSON_NEON)
+#   if defined(__SSE4_2__)
+#       define RAPIDJSON_SSE42
+#   elif AZ_TRAIT_USE_PLATFORM_SIMD_SSE
+#       define RAPIDJSON_SSE2
+#   elif defined(__ARM_NEON) || defined(_M_ARM64)
+#       define RAPIDJSON_NEON
+#   endif
+#endif
+
 // Set custom namespace for AzCore's rapidjson to avoid various collisions.
 #define RAPIDJSON_NAMESPACE rapidjson_ly
 
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Memory/FrameArenaAllocator.h>
+
+#include <AzCore/Memory/AllocationRecords.h>
+#include <AzCore/Memory/OSAllocator.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ
+{
+    FrameArenaAllocator::FrameArenaAllocator()
+        : Base("FrameArenaAllocator", "Linear allocator for transient per frame data")
+    {
+        // Memory is reclaimed by resetting the schema, which doesn't work if the allocations come from another source
+        DisableOverriding();
+    }
+
+    AllocatorDebugConfig FrameArenaAllocator::GetDebugConfig()
+    {
+        // Memory guards would be placed between allocations that are expected to be tightly packed
+        return AllocatorDebugConfig()
+            .UsesMemoryGuards(false)
+            .MarksUnallocatedMemory(false);
+    }
+
+    void FrameArenaAllocator::ResetFrame()
+    {
+        AZ_MEMORY_PROFILE(ProfileFrameReset(false));
+        static_cast<FrameArenaSchema*>(m_schema)->Reset();
+    }
+
+    void FrameArenaAllocator::ResetThreadFrame()
+    {
+        AZ_MEMORY_PROFILE(ProfileFrameReset(true));
+        static_cast<FrameArenaSchema*>(m_schema)->ResetThread();
+    }
+
+    FrameArenaAllocator::size_type FrameArenaAllocator::GetPeakFrameBytes() const
+    {
+        return static_cast<const FrameArenaSchema*>(m_schema)->GetPeakFrameBytes();
+    }
+
+    void FrameArenaAllocator::ResetPeakFrameBytes()
+    {
+        static_cast<FrameArenaSchema*>(m_schema)->ResetPeakFrameBytes();
+    }
+
+    void FrameArenaAllocator::ProfileFrameReset(bool threadOnly)
+    {
+        // Allocations that weren't deallocated individually are released by the reset, unregister them so the records
+        // and the memory driller don't report them as leaks. This only costs time while profiling is active.
+        Debug::AllocationRecords* records = GetRecords();
+        if (!IsProfilingActive() || records == nullptr)
+        {
+            return;
+        }
+
+        const FrameArenaSchema* schema = static_cast<const FrameArenaSchema*>(m_schema);
+        AZStd::vector<void*, OSStdAllocator> addresses;
+        records->lock();
+        addresses.reserve(records->GetMap().size());
+        for (const auto& record : records->GetMap())
+        {
+            if (!threadOnly || schema->IsThreadAllocation(record.first))
+            {
+                addresses.push_back(record.first);
+            }
+        }
+        records->unlock();
+
+        for (void* address : addresses)
+        {
+            ProfileDeallocation(address, 0, 0, nullptr);
+        }
+    }
+} // namespace AZ
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Memory/FrameArenaSchema.h>
+#include <AzCore/Memory/SimpleSchemaAllocator.h>
+#include <AzCore/Memory/SystemAllocator.h>
+
+namespace AZ
+{
+    /**
+     * Allocator for transient per frame data, such as culling work lists and scratch buffers. Allocations are very cheap
+     * and lock free, but memory is only reclaimed at once when the frame ends, so anything allocated from this allocator
+     * must not be used after the frame of the thread that allocated it ends. The ComponentApplication ends the frame of the
+     * tick thread at the start of every tick, other threads end their own frames with ResetThreadFrame, or all threads
+     * at once with ResetFrame when none of them are running.
+     * Can be used with AZStd containers through AZStdAlloc<FrameArenaAllocator>.
+     */
+    class FrameArenaAllocator
+        : public SimpleSchemaAllocator<FrameArenaSchema>
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(FrameArenaAllocator, SystemAllocator, 0);
+        AZ_TYPE_INFO(FrameArenaAllocator, "{D92B8DF2-7D60-4AD6-99A8-75D89451E1D9}");
+
+        using Base = SimpleSchemaAllocator<FrameArenaSchema>;
+        using Descriptor = Base::Descriptor;
+
+        FrameArenaAllocator();
+
+        //---------------------------------------------------------------------
+        // IAllocator
+        //---------------------------------------------------------------------
+        AllocatorDebugConfig GetDebugConfig() override;
+
+        /// Ends the current frame and reclaims all memory that was allocated during it. Must also be called before the
+        /// allocator is destroyed, so the allocation records don't report the allocations of the last frame as leaks.
+        /// See FrameArenaSchema::Reset for the threading requirements.
+        void ResetFrame();
+
+        /// Ends the current frame of the calling thread and reclaims the memory it allocated during it. The allocations of
+        /// other threads aren't affected.
+        void ResetThreadFrame();
+
+        /// Returns the largest number of bytes that were allocated during a single frame.
+        size_type GetPeakFrameBytes() const;
+        void ResetPeakFrameBytes();
+
+    private:
+        /// Unregisters the allocations of the frame that ends from the allocation records. If threadOnly is set only the
+        /// allocations of the calling thread are unregistered.
+        void ProfileFrameReset(bool threadOnly);
+    };
+} // namespace AZ
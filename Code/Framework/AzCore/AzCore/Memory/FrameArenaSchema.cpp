@@ -0,0 +1,645 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Memory/FrameArenaSchema.h>
+#include <AzCore/Memory/SystemAllocator.h>
+
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace AZ
+{
+    namespace
+    {
+        // Minimum alignment of every allocation
+        static constexpr size_t FrameArenaMinAlignment = sizeof(void*);
+        // Alignment of the chunks, which keeps the chunks of different threads on separate cache lines
+        static constexpr size_t FrameArenaChunkAlignment = 64;
+        // Every allocation is preceded by its size, which makes AllocationSize and ReAllocate work for any allocation
+        static constexpr size_t FrameArenaAllocationHeaderSize = sizeof(size_t);
+        static_assert(FrameArenaMinAlignment >= FrameArenaAllocationHeaderSize, "The allocation header must fit in the minimum alignment");
+
+        size_t& AllocationSizeHeader(void* address)
+        {
+            return *(reinterpret_cast<size_t*>(address) - 1);
+        }
+
+        static AZStd::atomic<u64> s_nextFrameArenaInstanceId{ 1 };
+
+        // The slots are keyed by the instance id of the schema instead of its address, so a slot that refers to a
+        // destroyed schema can't be mistaken for a new schema that's created at the same address.
+        struct FrameArenaSlot
+        {
+            u64 m_instanceId = 0;
+            void* m_arena = nullptr;
+        };
+        static constexpr size_t FrameArenaSlotCount = 4;
+    }
+
+    // Arenas of the current thread. When the thread exits its arenas are handed back to their schemas, which give them
+    // to new threads or release them on GarbageCollect.
+    struct FrameArenaSchema::ThreadArenaSlots
+    {
+        ~ThreadArenaSlots();
+
+        FrameArenaSlot m_slots[FrameArenaSlotCount];
+        size_t m_nextSlot = 0;
+    };
+    thread_local FrameArenaSchema::ThreadArenaSlots FrameArenaSchema::s_threadArenaSlots;
+
+    struct FrameArenaSchema::Chunk
+    {
+        static constexpr size_t HeaderSize = AZ_SIZE_ALIGN_UP(sizeof(void*) + sizeof(size_t), FrameArenaMinAlignment * 2);
+
+        char* Begin()   { return reinterpret_cast<char*>(this) + HeaderSize; }
+        char* End()     { return reinterpret_cast<char*>(this) + m_size; }
+
+        Chunk* m_next;
+        size_t m_size;  ///< Size of the chunk including the header.
+    };
+
+    struct FrameArenaSchema::ThreadArena
+    {
+        AZ_CLASS_ALLOCATOR(ThreadArena, SystemAllocator, 0);
+
+        Chunk* m_chunks = nullptr;          ///< Chunks used in the current frame, the chunk that's allocated from is first.
+        Chunk* m_freeChunks = nullptr;      ///< Chunks that can be reused.
+        char* m_cursor = nullptr;
+        char* m_end = nullptr;
+        char* m_lastAllocation = nullptr;   ///< Most recent allocation from the current chunk, which can be rolled back or resized.
+        AZStd::atomic_uint m_frame{ 0 };
+        AZStd::atomic<size_t> m_allocatedBytes{ 0 }; ///< Bytes allocated in m_frame, only written by the owning thread.
+        unsigned int m_trimRequest = 0;
+        AZStd::thread_id m_owner;
+        FrameArenaSlot* m_slot = nullptr;   ///< Slot of the owning thread that refers to this arena, guarded by GetOwnershipMutex.
+        AZStd::atomic_bool m_isOrphaned{ false }; ///< Set when the owning thread exited.
+        ThreadArena* m_next = nullptr;
+    };
+
+    FrameArenaSchema::ThreadArenaSlots::~ThreadArenaSlots()
+    {
+        // The schemas detach the slots under the same lock when they're destroyed, so the arenas that are still
+        // referenced here are alive.
+        AZStd::lock_guard<AZStd::mutex> lock(GetOwnershipMutex());
+        for (FrameArenaSlot& slot : m_slots)
+        {
+            if (ThreadArena* arena = reinterpret_cast<ThreadArena*>(slot.m_arena))
+            {
+                arena->m_slot = nullptr;
+                arena->m_isOrphaned.store(true, AZStd::memory_order_relaxed);
+            }
+            slot = FrameArenaSlot{};
+        }
+    }
+
+    AZStd::mutex& FrameArenaSchema::GetOwnershipMutex()
+    {
+        // Shared by all schemas so an exiting thread can tell whether the schemas of its arenas still exist. Never
+        // taken on the allocation path.
+        static AZStd::mutex s_mutex;
+        return s_mutex;
+    }
+
+    //=========================================================================
+    // FrameArenaSchema
+    //=========================================================================
+    FrameArenaSchema::FrameArenaSchema(const Descriptor& desc)
+        : m_desc(desc)
+        , m_instanceId(s_nextFrameArenaInstanceId.fetch_add(1, AZStd::memory_order_relaxed))
+    {
+        if (m_desc.m_subAllocator == nullptr)
+        {
+            m_desc.m_subAllocator = &AllocatorInstance<SystemAllocator>::Get();
+        }
+        AZ_Assert(m_desc.m_chunkSize > Chunk::HeaderSize, "Chunk size %zu is too small", m_desc.m_chunkSize);
+    }
+
+    //=========================================================================
+    // ~FrameArenaSchema
+    //=========================================================================
+    FrameArenaSchema::~FrameArenaSchema()
+    {
+        AZStd::lock_guard<AZStd::mutex> ownershipLock(GetOwnershipMutex());
+        AZStd::lock_guard<AZStd::mutex> lock(m_arenasMutex);
+        while (m_arenas)
+        {
+            ThreadArena* arena = m_arenas;
+            m_arenas = arena->m_next;
+            if (arena->m_slot)
+            {
+                // The owning thread is still alive, make sure it doesn't touch the arena when it exits
+                *arena->m_slot = FrameArenaSlot{};
+            }
+            FreeThreadArena(arena);
+        }
+        AZ_Assert(m_capacity.load() == 0, "FrameArenaSchema still has %zu bytes in chunks", m_capacity.load());
+    }
+
+    //=========================================================================
+    // Allocate
+    //=========================================================================
+    FrameArenaSchema::pointer_type
+    FrameArenaSchema::Allocate(size_type byteSize, size_type alignment, int flags, const char* name, const char* fileName, int lineNum, unsigned int suppressStackRecord)
+    {
+        (void)flags;
+        (void)name;
+        (void)fileName;
+        (void)lineNum;
+        (void)suppressStackRecord;
+
+        if (byteSize == 0)
+        {
+            return nullptr;
+        }
+        ThreadArena* arena = GetThreadArena();
+        if (arena == nullptr)
+        {
+            return nullptr;
+        }
+        const unsigned int frame = m_frame.load(AZStd::memory_order_acquire);
+        if (arena->m_frame.load(AZStd::memory_order_relaxed) != frame)
+        {
+            RewindThreadArena(*arena, frame);
+        }
+
+        alignment = AZStd::GetMax(alignment, FrameArenaMinAlignment);
+        char* address = arena->m_cursor ? AZ::PointerAlignUp(arena->m_cursor + FrameArenaAllocationHeaderSize, alignment) : nullptr;
+        if (address == nullptr || address + byteSize > arena->m_end)
+        {
+            return AllocateFromNewChunk(*arena, byteSize, alignment);
+        }
+
+        AllocationSizeHeader(address) = byteSize;
+        arena->m_allocatedBytes.store(arena->m_allocatedBytes.load(AZStd::memory_order_relaxed) + byteSize, AZStd::memory_order_relaxed);
+        arena->m_cursor = address + byteSize;
+        arena->m_lastAllocation = address;
+        return address;
+    }
+
+    //=========================================================================
+    // DeAllocate
+    //=========================================================================
+    void
+    FrameArenaSchema::DeAllocate(pointer_type ptr, size_type byteSize, size_type alignment)
+    {
+        (void)byteSize;
+        (void)alignment;
+
+        // Only the most recent allocation of this thread can be given back, everything else is reclaimed by Reset
+        ThreadArena* arena = FindThreadArena();
+        if (ptr && arena && ptr == arena->m_lastAllocation && arena->m_frame.load(AZStd::memory_order_relaxed) == m_frame.load(AZStd::memory_order_relaxed))
+        {
+            char* address = reinterpret_cast<char*>(ptr);
+            arena->m_allocatedBytes.store(arena->m_allocatedBytes.load(AZStd::memory_order_relaxed) - AllocationSizeHeader(address), AZStd::memory_order_relaxed);
+            arena->m_cursor = address - FrameArenaAllocationHeaderSize;
+            arena->m_lastAllocation = nullptr;
+        }
+    }
+
+    //=========================================================================
+    // Resize
+    //=========================================================================
+    FrameArenaSchema::size_type
+    FrameArenaSchema::Resize(pointer_type ptr, size_type newSize)
+    {
+        // The most recent allocation of this thread can be resized in place as long as it fits in the chunk
+        ThreadArena* arena = FindThreadArena();
+        if (ptr && arena && ptr == arena->m_lastAllocation && arena->m_frame.load(AZStd::memory_order_relaxed) == m_frame.load(AZStd::memory_order_relaxed))
+        {
+            char* address = reinterpret_cast<char*>(ptr);
+            if (newSize > 0 && address + newSize <= arena->m_end)
+            {
+                size_t& allocationSize = AllocationSizeHeader(address);
+                arena->m_allocatedBytes.store(arena->m_allocatedBytes.load(AZStd::memory_order_relaxed) + newSize - allocationSize, AZStd::memory_order_relaxed);
+                allocationSize = newSize;
+                arena->m_cursor = address + newSize;
+                return newSize;
+            }
+        }
+        return 0;
+    }
+
+    //=========================================================================
+    // ReAllocate
+    //=========================================================================
+    FrameArenaSchema::pointer_type
+    FrameArenaSchema::ReAllocate(pointer_type ptr, size_type newSize, size_type newAlignment)
+    {
+        if (ptr == nullptr)
+        {
+            return Allocate(newSize, newAlignment);
+        }
+        if (newSize == 0)
+        {
+            DeAllocate(ptr);
+            return nullptr;
+        }
+        if ((reinterpret_cast<size_t>(ptr) & (AZStd::GetMax(newAlignment, FrameArenaMinAlignment) - 1)) == 0 && Resize(ptr, newSize) == newSize)
+        {
+            return ptr;
+        }
+
+        const size_t copySize = AZStd::GetMin<size_t>(newSize, AllocationSize(ptr));
+        void* newPtr = Allocate(newSize, newAlignment);
+        if (newPtr)
+        {
+            memmove(newPtr, ptr, copySize);
+        }
+        return newPtr;
+    }
+
+    //=========================================================================
+    // AllocationSize
+    //=========================================================================
+    FrameArenaSchema::size_type
+    FrameArenaSchema::AllocationSize(pointer_type ptr)
+    {
+        return ptr ? AllocationSizeHeader(ptr) : 0;
+    }
+
+    //=========================================================================
+    // NumAllocatedBytes
+    //=========================================================================
+    FrameArenaSchema::size_type
+    FrameArenaSchema::NumAllocatedBytes() const
+    {
+        const unsigned int frame = m_frame.load(AZStd::memory_order_relaxed);
+        size_type allocatedBytes = 0;
+        AZStd::lock_guard<AZStd::mutex> lock(m_arenasMutex);
+        for (const ThreadArena* arena = m_arenas; arena; arena = arena->m_next)
+        {
+            // arenas that haven't rewound yet didn't allocate anything in this frame
+            if (arena->m_frame.load(AZStd::memory_order_relaxed) == frame)
+            {
+                allocatedBytes += arena->m_allocatedBytes.load(AZStd::memory_order_relaxed);
+            }
+        }
+        return allocatedBytes;
+    }
+
+    //=========================================================================
+    // Capacity
+    //=========================================================================
+    FrameArenaSchema::size_type
+    FrameArenaSchema::Capacity() const
+    {
+        return m_capacity.load(AZStd::memory_order_relaxed);
+    }
+
+    FrameArenaSchema::size_type
+    FrameArenaSchema::GetMaxAllocationSize() const
+    {
+        // larger allocations than the chunk size get their own chunk
+        return AZ_CORE_MAX_ALLOCATOR_SIZE;
+    }
+
+    FrameArenaSchema::size_type
+    FrameArenaSchema::GetMaxContiguousAllocationSize() const
+    {
+        return AZ_CORE_MAX_ALLOCATOR_SIZE;
+    }
+
+    IAllocatorAllocate*
+    FrameArenaSchema::GetSubAllocator()
+    {
+        return m_desc.m_subAllocator;
+    }
+
+    //=========================================================================
+    // GarbageCollect
+    //=========================================================================
+    void
+    FrameArenaSchema::GarbageCollect()
+    {
+        // Chunks belong to the threads that use them, so they can only be released by those threads when they rewind
+        m_trimRequest.fetch_add(1, AZStd::memory_order_relaxed);
+
+        // Arenas of threads that exited have no owner to rewind them. Their memory can be released as long as none of it
+        // is used by the current frame, otherwise they're kept until a new thread adopts them or the next collect.
+        const unsigned int frame = m_frame.load(AZStd::memory_order_acquire);
+        AZStd::lock_guard<AZStd::mutex> lock(m_arenasMutex);
+        for (ThreadArena** link = &m_arenas; *link;)
+        {
+            ThreadArena* arena = *link;
+            if (arena->m_isOrphaned.load(AZStd::memory_order_relaxed) && arena->m_frame.load(AZStd::memory_order_relaxed) != frame)
+            {
+                *link = arena->m_next;
+                FreeThreadArena(arena);
+            }
+            else
+            {
+                link = &arena->m_next;
+            }
+        }
+    }
+
+    //=========================================================================
+    // Reset
+    //=========================================================================
+    void
+    FrameArenaSchema::Reset()
+    {
+        UpdatePeakFrameBytes();
+        m_frame.fetch_add(1, AZStd::memory_order_release);
+    }
+
+    //=========================================================================
+    // ResetThread
+    //=========================================================================
+    void
+    FrameArenaSchema::ResetThread()
+    {
+        ThreadArena* arena = FindThreadArena();
+        if (arena == nullptr)
+        {
+            return;
+        }
+        UpdatePeakFrameBytes();
+        // The arena stays in the current frame, so it's neither rewound again nor considered unused by GarbageCollect
+        RewindThreadArena(*arena, m_frame.load(AZStd::memory_order_acquire));
+    }
+
+    //=========================================================================
+    // IsThreadAllocation
+    //=========================================================================
+    bool
+    FrameArenaSchema::IsThreadAllocation(pointer_type ptr) const
+    {
+        const ThreadArena* arena = FindThreadArena();
+        if (ptr == nullptr || arena == nullptr || arena->m_frame.load(AZStd::memory_order_relaxed) != m_frame.load(AZStd::memory_order_relaxed))
+        {
+            return false;
+        }
+        const char* address = reinterpret_cast<const char*>(ptr);
+        for (Chunk* chunk = arena->m_chunks; chunk; chunk = chunk->m_next)
+        {
+            if (address >= chunk->Begin() && address < chunk->End())
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    FrameArenaSchema::size_type
+    FrameArenaSchema::GetPeakFrameBytes() const
+    {
+        return AZStd::GetMax(m_peakFrameBytes.load(AZStd::memory_order_relaxed), NumAllocatedBytes());
+    }
+
+    void
+    FrameArenaSchema::ResetPeakFrameBytes()
+    {
+        m_peakFrameBytes.store(0, AZStd::memory_order_relaxed);
+    }
+
+    void
+    FrameArenaSchema::UpdatePeakFrameBytes()
+    {
+        const size_t frameBytes = NumAllocatedBytes();
+        size_t peakBytes = m_peakFrameBytes.load(AZStd::memory_order_relaxed);
+        while (frameBytes > peakBytes && !m_peakFrameBytes.compare_exchange_weak(peakBytes, frameBytes, AZStd::memory_order_relaxed))
+        {
+        }
+    }
+
+    //=========================================================================
+    // FindThreadArena
+    //=========================================================================
+    FrameArenaSchema::ThreadArena*
+    FrameArenaSchema::FindThreadArena() const
+    {
+        for (const FrameArenaSlot& slot : s_threadArenaSlots.m_slots)
+        {
+            if (slot.m_instanceId == m_instanceId)
+            {
+                return reinterpret_cast<ThreadArena*>(slot.m_arena);
+            }
+        }
+        return nullptr;
+    }
+
+    //=========================================================================
+    // GetThreadArena
+    //=========================================================================
+    FrameArenaSchema::ThreadArena*
+    FrameArenaSchema::GetThreadArena()
+    {
+        if (ThreadArena* arena = FindThreadArena())
+        {
+            return arena;
+        }
+
+        // The thread either didn't allocate from this schema before or its slot was taken by another schema. In the
+        // latter case the arena is still registered. Otherwise the arena of a thread that exited is adopted, so its
+        // chunks are reused.
+        const AZStd::thread_id threadId = AZStd::this_thread::get_id();
+        AZStd::lock_guard<AZStd::mutex> ownershipLock(GetOwnershipMutex());
+        ThreadArena* arena = nullptr;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_arenasMutex);
+            ThreadArena* orphanedArena = nullptr;
+            for (arena = m_arenas; arena; arena = arena->m_next)
+            {
+                if (arena->m_isOrphaned.load(AZStd::memory_order_relaxed))
+                {
+                    orphanedArena = orphanedArena ? orphanedArena : arena;
+                }
+                else if (arena->m_owner == threadId)
+                {
+                    break;
+                }
+            }
+            if (arena == nullptr && orphanedArena)
+            {
+                arena = orphanedArena;
+                arena->m_owner = threadId;
+                arena->m_isOrphaned.store(false, AZStd::memory_order_relaxed);
+            }
+            if (arena == nullptr)
+            {
+                arena = aznew ThreadArena();
+                arena->m_owner = threadId;
+                arena->m_frame.store(m_frame.load(AZStd::memory_order_relaxed), AZStd::memory_order_relaxed);
+                arena->m_trimRequest = m_trimRequest.load(AZStd::memory_order_relaxed);
+                arena->m_next = m_arenas;
+                m_arenas = arena;
+            }
+        }
+
+        ThreadArenaSlots& slots = s_threadArenaSlots;
+        FrameArenaSlot* slot = nullptr;
+        for (FrameArenaSlot& candidate : slots.m_slots)
+        {
+            if (candidate.m_arena == nullptr)
+            {
+                slot = &candidate;
+                break;
+            }
+        }
+        if (slot == nullptr)
+        {
+            slot = &slots.m_slots[slots.m_nextSlot];
+            slots.m_nextSlot = (slots.m_nextSlot + 1) % FrameArenaSlotCount;
+            // The evicted arena stays registered with its schema and is found again by thread id
+            reinterpret_cast<ThreadArena*>(slot->m_arena)->m_slot = nullptr;
+        }
+        slot->m_instanceId = m_instanceId;
+        slot->m_arena = arena;
+        arena->m_slot = slot;
+        return arena;
+    }
+
+    //=========================================================================
+    // RewindThreadArena
+    //=========================================================================
+    void
+    FrameArenaSchema::RewindThreadArena(ThreadArena& arena, unsigned int frame)
+    {
+        // If a garbage collect was requested, release the chunks that weren't needed during the last frame
+        const unsigned int trimRequest = m_trimRequest.load(AZStd::memory_order_relaxed);
+        if (arena.m_trimRequest != trimRequest)
+        {
+            arena.m_trimRequest = trimRequest;
+            while (arena.m_freeChunks)
+            {
+                Chunk* next = arena.m_freeChunks->m_next;
+                FreeChunk(arena.m_freeChunks);
+                arena.m_freeChunks = next;
+            }
+        }
+
+        // Keep the regular chunks for the next frame, dedicated chunks for large allocations are released
+        while (arena.m_chunks)
+        {
+            Chunk* chunk = arena.m_chunks;
+            arena.m_chunks = chunk->m_next;
+            if (chunk->m_size == m_desc.m_chunkSize)
+            {
+                chunk->m_next = arena.m_freeChunks;
+                arena.m_freeChunks = chunk;
+            }
+            else
+            {
+                FreeChunk(chunk);
+            }
+        }
+
+        arena.m_cursor = nullptr;
+        arena.m_end = nullptr;
+        arena.m_lastAllocation = nullptr;
+        arena.m_allocatedBytes.store(0, AZStd::memory_order_relaxed);
+        arena.m_frame.store(frame, AZStd::memory_order_relaxed);
+    }
+
+    //=========================================================================
+    // AllocateFromNewChunk
+    //=========================================================================
+    void*
+    FrameArenaSchema::AllocateFromNewChunk(ThreadArena& arena, size_t byteSize, size_t alignment)
+    {
+        const size_t requiredSize = Chunk::HeaderSize + FrameArenaAllocationHeaderSize + byteSize + alignment - 1;
+        if (requiredSize > m_desc.m_chunkSize)
+        {
+            // Large allocations get a dedicated chunk, which is linked behind the current chunk so the current chunk
+            // can still be used for the following allocations
+            Chunk* chunk = AllocateChunk(requiredSize);
+            if (chunk == nullptr)
+            {
+                return nullptr;
+            }
+            if (arena.m_chunks)
+            {
+                chunk->m_next = arena.m_chunks->m_next;
+                arena.m_chunks->m_next = chunk;
+            }
+            else
+            {
+                chunk->m_next = nullptr;
+                arena.m_chunks = chunk;
+                arena.m_cursor = chunk->End();
+                arena.m_end = chunk->End();
+            }
+            char* address = AZ::PointerAlignUp(chunk->Begin() + FrameArenaAllocationHeaderSize, alignment);
+            AllocationSizeHeader(address) = byteSize;
+            arena.m_allocatedBytes.store(arena.m_allocatedBytes.load(AZStd::memory_order_relaxed) + byteSize, AZStd::memory_order_relaxed);
+            return address;
+        }
+
+        Chunk* chunk = arena.m_freeChunks;
+        if (chunk)
+        {
+            arena.m_freeChunks = chunk->m_next;
+        }
+        else
+        {
+            chunk = AllocateChunk(m_desc.m_chunkSize);
+            if (chunk == nullptr)
+            {
+                return nullptr;
+            }
+        }
+        chunk->m_next = arena.m_chunks;
+        arena.m_chunks = chunk;
+
+        char* address = AZ::PointerAlignUp(chunk->Begin() + FrameArenaAllocationHeaderSize, alignment);
+        AllocationSizeHeader(address) = byteSize;
+        arena.m_allocatedBytes.store(arena.m_allocatedBytes.load(AZStd::memory_order_relaxed) + byteSize, AZStd::memory_order_relaxed);
+        arena.m_cursor = address + byteSize;
+        arena.m_end = chunk->End();
+        arena.m_lastAllocation = address;
+        return address;
+    }
+
+    //=========================================================================
+    // AllocateChunk
+    //=========================================================================
+    FrameArenaSchema::Chunk*
+    FrameArenaSchema::AllocateChunk(size_t chunkSize)
+    {
+        void* memory = m_desc.m_subAllocator->Allocate(chunkSize, FrameArenaChunkAlignment, 0, "AZ::FrameArenaSchema::Chunk", __FILE__, __LINE__);
+        if (memory == nullptr)
+        {
+            return nullptr;
+        }
+        m_capacity.fetch_add(chunkSize, AZStd::memory_order_relaxed);
+        Chunk* chunk = reinterpret_cast<Chunk*>(memory);
+        chunk->m_next = nullptr;
+        chunk->m_size = chunkSize;
+        return chunk;
+    }
+
+    //=========================================================================
+    // FreeThreadArena
+    //=========================================================================
+    void
+    FrameArenaSchema::FreeThreadArena(ThreadArena* arena)
+    {
+        for (Chunk* chunkList : { arena->m_chunks, arena->m_freeChunks })
+        {
+            while (chunkList)
+            {
+                Chunk* next = chunkList->m_next;
+                FreeChunk(chunkList);
+                chunkList = next;
+            }
+        }
+        delete arena;
+    }
+
+    //=========================================================================
+    // FreeChunk
+    //=========================================================================
+    void
+    FrameArenaSchema::FreeChunk(Chunk* chunk)
+    {
+        const size_t chunkSize = chunk->m_size;
+        m_desc.m_subAllocator->DeAllocate(chunk, chunkSize, FrameArenaChunkAlignment);
+        m_capacity.fetch_sub(chunkSize, AZStd::memory_order_relaxed);
+    }
+} // namespace AZ
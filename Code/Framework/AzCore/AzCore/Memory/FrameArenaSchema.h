@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ
+{
+    /**
+     * Frame arena schema, a linear (bump pointer) allocator for transient data that lives for at most one frame.
+     * Every thread allocates from its own chunks, so allocations never take a lock. Individual deallocations are
+     * ignored (apart from the most recent allocation of the calling thread, which is rolled back), all memory is
+     * reclaimed at once by calling Reset at the frame boundary. Reset is O(1), each thread rewinds its chunks the next
+     * time it allocates. Threads that don't share the frame boundary of the other threads, for instance job workers that
+     * run across the tick, end their own frame with ResetThread instead. Chunks are kept between frames, so a steady state
+     * frame doesn't allocate from the sub allocator.
+     */
+    class FrameArenaSchema
+        : public IAllocatorAllocate
+    {
+    public:
+        struct Descriptor
+        {
+            Descriptor()
+                : m_chunkSize(256 * 1024)
+                , m_subAllocator(nullptr)
+            {}
+
+            size_t                  m_chunkSize;        ///< Size of the chunks each thread allocates from. Larger allocations get a dedicated chunk which is released at the next Reset.
+            IAllocatorAllocate*     m_subAllocator;     ///< Allocator the chunks are allocated from. If null the SystemAllocator will be used.
+        };
+
+        FrameArenaSchema(const Descriptor& desc = Descriptor());
+        ~FrameArenaSchema();
+
+        pointer_type    Allocate(size_type byteSize, size_type alignment, int flags = 0, const char* name = 0, const char* fileName = 0, int lineNum = 0, unsigned int suppressStackRecord = 0) override;
+        void            DeAllocate(pointer_type ptr, size_type byteSize = 0, size_type alignment = 0) override;
+        size_type       Resize(pointer_type ptr, size_type newSize) override;
+        /// Resizes in place if ptr is the most recent allocation of the calling thread, otherwise allocates and copies.
+        pointer_type    ReAllocate(pointer_type ptr, size_type newSize, size_type newAlignment) override;
+        /// Returns the size that was requested for ptr, which has to be an allocation that wasn't reclaimed yet.
+        size_type       AllocationSize(pointer_type ptr) override;
+
+        /// Returns the number of bytes allocated during the current frame.
+        size_type       NumAllocatedBytes() const override;
+        /// Returns the number of bytes in chunks held by all threads.
+        size_type       Capacity() const override;
+        size_type       GetMaxAllocationSize() const override;
+        size_type       GetMaxContiguousAllocationSize() const override;
+        IAllocatorAllocate* GetSubAllocator() override;
+
+        /// Chunks that weren't used during the last frame are released when their thread rewinds after the next Reset. The
+        /// chunks of threads that exited are released immediately if they aren't used by the current frame.
+        void            GarbageCollect() override;
+
+        /// Ends the current frame, all memory allocated before the call is invalid afterwards. No thread may still be using
+        /// the memory of the frame that ends, threads are allowed to allocate for the new frame right after the call returns.
+        void            Reset();
+        /// Ends the current frame of the calling thread only, all memory the calling thread allocated before the call is
+        /// invalid afterwards. The allocations of other threads are unaffected.
+        void            ResetThread();
+        /// Returns true if ptr was allocated by the calling thread and wasn't reclaimed yet.
+        bool            IsThreadAllocation(pointer_type ptr) const;
+
+        /// Returns the largest number of bytes that were allocated during a single frame.
+        size_type       GetPeakFrameBytes() const;
+        void            ResetPeakFrameBytes();
+
+    private:
+        struct Chunk;
+        struct ThreadArena;
+        struct ThreadArenaSlots;
+
+        ThreadArena*    FindThreadArena() const;
+        ThreadArena*    GetThreadArena();
+        void            UpdatePeakFrameBytes();
+        void            RewindThreadArena(ThreadArena& arena, unsigned int frame);
+        void*           AllocateFromNewChunk(ThreadArena& arena, size_t byteSize, size_t alignment);
+        Chunk*          AllocateChunk(size_t chunkSize);
+        void            FreeChunk(Chunk* chunk);
+        void            FreeThreadArena(ThreadArena* arena);
+        static AZStd::mutex& GetOwnershipMutex();
+
+        FrameArenaSchema(const FrameArenaSchema&) = delete;
+        FrameArenaSchema& operator=(const FrameArenaSchema&) = delete;
+
+        Descriptor                  m_desc;
+        u64                         m_instanceId;
+        AZStd::atomic_uint          m_frame{ 0 };
+        AZStd::atomic_uint          m_trimRequest{ 0 };     ///< Incremented by GarbageCollect.
+        AZStd::atomic<size_t>       m_capacity{ 0 };
+        AZStd::atomic<size_t>       m_peakFrameBytes{ 0 };
+        mutable AZStd::mutex        m_arenasMutex;          ///< Guards m_arenas, never taken on the allocation path.
+        ThreadArena*                m_arenas = nullptr;
+
+        static thread_local ThreadArenaSlots s_threadArenaSlots;
+    };
+} // namespace AZ
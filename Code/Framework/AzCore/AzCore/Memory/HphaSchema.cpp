@@ -14,6 +14,8 @@
 #include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/lock.h>
 #include <AzCore/std/containers/intrusive_set.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/spin_mutex.h>
 
 #ifdef _DEBUG
 //#define DEBUG_ALLOCATOR
@@ -468,6 +470,55 @@ namespace AZ {
         size_t bucket_get_unused_memory(bool isPrint) const;
         void bucket_purge();
 
+        // the thread cache keeps a small magazine (stack) of free elements per bucket for every thread
+        // that allocates from this HpAllocator, small allocations and frees are served from the magazine
+        // without taking the bucket lock. Magazines are refilled from and drained to the shared buckets
+        // in batches, so the bucket lock is taken once per batch instead of once per call.
+        // Elements in a magazine remain part of their bucket page, so ptr_in_bucket and the size
+        // queries work the same for them. Similar to ThreadPoolSchema, but any thread can free any element.
+        // The magazines are guarded by a per cache spin lock which is only contended when another thread
+        // flushes the cache (garbage collection, destruction), so it stays in the owning thread's CPU cache.
+        static const size_t THREAD_CACHE_BATCH_BYTES = 1024UL;
+        static const unsigned THREAD_CACHE_MIN_BATCH = 4;
+        static const unsigned THREAD_CACHE_MAX_BATCH = 32;
+        static const unsigned MAX_THREAD_CACHES = 64;
+        struct thread_cache
+        {
+            free_link* mMagazines[NUM_BUCKETS] = {};
+            unsigned short mCounts[NUM_BUCKETS] = {};
+            // guards the magazines and counts
+            AZStd::spin_mutex mLock;
+            // allocator the cache belongs to, null when the allocator was destroyed before the thread exited.
+            // Only changed while holding thread_cache_registry_mutex, so a thread that exits can safely check it.
+            AZStd::atomic<HpAllocator*> mOwner{ nullptr };
+            // index in the owner's mThreadCacheSlots
+            unsigned mSlot = 0;
+        };
+        // the number of bytes held by a thread cache is kept in the allocator rather than in the cache itself, so
+        // allocated() can add them up without locking while threads exit and free their caches
+        struct alignas(64) thread_cache_slot
+        {
+            AZStd::atomic<size_t> mCachedBytes{ 0 };
+            // guarded by thread_cache_registry_mutex
+            thread_cache* mCache = nullptr;
+        };
+        static inline unsigned thread_cache_batch_size(unsigned bi)
+        {
+            size_t batch = THREAD_CACHE_BATCH_BYTES / bucket_spacing_function_inverse(bi);
+            return (unsigned)AZStd::GetMin<size_t>(AZStd::GetMax<size_t>(batch, THREAD_CACHE_MIN_BATCH), THREAD_CACHE_MAX_BATCH);
+        }
+        thread_cache* thread_cache_get();
+        void thread_cache_refill(thread_cache& cache, unsigned bi);
+        void thread_cache_drain(thread_cache& cache, unsigned bi, unsigned count);
+        void thread_cache_flush(thread_cache& cache);
+        void thread_cache_flush_all(bool detach);
+        size_t thread_cache_cached_bytes() const;
+        void thread_cache_add_cached_bytes(const thread_cache& cache, ptrdiff_t bytes);
+        static AZStd::mutex& thread_cache_registry_mutex();
+        static void thread_cache_release(thread_cache* cache);
+        void* bucket_cached_alloc(unsigned bi);
+        void bucket_cached_free(void* ptr, unsigned bi);
+
         // locate the page information from a pointer
         inline page* ptr_get_page(void* ptr) const
         {
@@ -723,6 +774,10 @@ namespace AZ {
         size_t mTotalCapacitySizeBuckets = 0;
         size_t mTotalAllocatedSizeTree = 0;
         size_t mTotalCapacitySizeTree = 0;
+        thread_cache_slot mThreadCacheSlots[MAX_THREAD_CACHES];
+        // number of used mThreadCacheSlots, changed while holding thread_cache_registry_mutex
+        AZStd::atomic<unsigned> mThreadCacheCount{ 0 };
+        bool mIsThreadCacheEnabled = true;
     public:
         HpAllocator(AZ::HphaSchema::Descriptor desc);
         ~HpAllocator();
@@ -738,7 +793,7 @@ namespace AZ {
             if (m_isPoolAllocations && is_small_allocation(size))
             {
                 size = clamp_small_allocation(size);
-                void* ptr = bucket_alloc_direct(bucket_spacing_function(size + MEMORY_GUARD_SIZE));
+                void* ptr = bucket_cached_alloc(bucket_spacing_function(size + MEMORY_GUARD_SIZE));
                 debug_add(ptr, size, DEBUG_SOURCE_BUCKETS);
                 return ptr;
             }
@@ -767,7 +822,7 @@ namespace AZ {
             if (m_isPoolAllocations && is_small_allocation(size) && alignment <= MAX_SMALL_ALLOCATION)
             {
                 size = clamp_small_allocation(size);
-                void* ptr = bucket_alloc_direct(bucket_spacing_function(AZ::SizeAlignUp(size + MEMORY_GUARD_SIZE, alignment)));
+                void* ptr = bucket_cached_alloc(bucket_spacing_function(AZ::SizeAlignUp(size + MEMORY_GUARD_SIZE, alignment)));
                 debug_add(ptr, size, DEBUG_SOURCE_BUCKETS);
                 return ptr;
             }
@@ -1000,7 +1055,7 @@ namespace AZ {
             if (ptr_in_bucket(ptr))
             {
                 debug_remove(ptr, DEBUG_UNKNOWN_SIZE, DEBUG_SOURCE_BUCKETS);
-                return bucket_free(ptr);
+                return bucket_cached_free(ptr, ptr_get_page(ptr)->bucket_index());
             }
             debug_remove(ptr, DEBUG_UNKNOWN_SIZE, DEBUG_SOURCE_TREE);
             tree_free(ptr);
@@ -1018,7 +1073,7 @@ namespace AZ {
                 // if this asserts probably the original alloc used alignment
                 HPPA_ASSERT(ptr_in_bucket(ptr));
                 debug_remove(ptr, origSize, DEBUG_SOURCE_BUCKETS);
-                return bucket_free_direct(ptr, bucket_spacing_function(origSize + MEMORY_GUARD_SIZE));
+                return bucket_cached_free(ptr, bucket_spacing_function(origSize + MEMORY_GUARD_SIZE));
             }
             debug_remove(ptr, origSize, DEBUG_SOURCE_TREE);
             tree_free(ptr);
@@ -1035,7 +1090,7 @@ namespace AZ {
             {
                 HPPA_ASSERT(ptr_in_bucket(ptr), "small object ptr not in a bucket");
                 debug_remove(ptr, origSize, DEBUG_SOURCE_BUCKETS);
-                return bucket_free_direct(ptr, bucket_spacing_function(AZ::SizeAlignUp(origSize + MEMORY_GUARD_SIZE, oldAlignment)));
+                return bucket_cached_free(ptr, bucket_spacing_function(AZ::SizeAlignUp(origSize + MEMORY_GUARD_SIZE, oldAlignment)));
             }
             debug_remove(ptr, origSize, DEBUG_SOURCE_TREE);
             tree_free(ptr);
@@ -1047,6 +1102,8 @@ namespace AZ {
         // in all cases memory is never automatically returned to the OS
         void purge()
         {
+            // Return the elements cached by all threads so their pages can be released
+            thread_cache_flush_all(false);
             // Purge buckets first since they use tree pages
             bucket_purge();
             tree_purge();
@@ -1063,7 +1120,10 @@ namespace AZ {
         // return the total number of allocated memory
         inline  size_t allocated() const
         {
-            return mTotalAllocatedSizeBuckets + mTotalAllocatedSizeTree;
+            // elements held in the thread caches are free from the user's point of view
+            size_t allocatedBuckets = mTotalAllocatedSizeBuckets;
+            size_t cachedBuckets = thread_cache_cached_bytes();
+            return (allocatedBuckets > cachedBuckets ? allocatedBuckets - cachedBuckets : 0) + mTotalAllocatedSizeTree;
         }
 
         /// returns allocation size for the pointer if it belongs to the allocator. result is undefined if the pointer doesn't belong to the allocator.
@@ -1151,6 +1211,7 @@ namespace AZ {
         m_fixedBlock = desc.m_fixedMemoryBlock;
         m_fixedBlockSize = desc.m_fixedMemoryBlockByteSize;
         m_isPoolAllocations = desc.m_isPoolAllocations;
+        mIsThreadCacheEnabled = desc.m_isThreadCacheEnabled;
         if (desc.m_fixedMemoryBlock)
         {
             block_header* bl = tree_add_block(m_fixedBlock, m_fixedBlockSize);
@@ -1181,7 +1242,10 @@ namespace AZ {
         report();
         check();
 #endif
-        
+
+        // Return the elements of all threads that still have a cache and detach those caches, the threads
+        // reuse them for another allocator or release them on exit
+        thread_cache_flush_all(true);
         purge();
 
 #ifdef DEBUG_ALLOCATOR 
@@ -1571,6 +1635,302 @@ namespace AZ {
         }
     }
 
+    namespace
+    {
+        // thread caches of the current thread, one per HpAllocator the thread allocated small blocks from
+        struct ThreadCacheSlots
+        {
+            static const size_t MAX_SLOTS = 8;
+
+            ~ThreadCacheSlots();
+
+            HpAllocator::thread_cache* mCaches[MAX_SLOTS] = {};
+            bool mIsDestroyed = false;
+        };
+        thread_local ThreadCacheSlots t_threadCaches;
+
+        ThreadCacheSlots::~ThreadCacheSlots()
+        {
+            // frees during the destruction of other thread locals go directly to the buckets
+            mIsDestroyed = true;
+            for (HpAllocator::thread_cache*& cache : mCaches)
+            {
+                if (cache)
+                {
+                    HpAllocator::thread_cache_release(cache);
+                    cache = nullptr;
+                }
+            }
+        }
+    }
+
+    HpAllocator::thread_cache* HpAllocator::thread_cache_get()
+    {
+        ThreadCacheSlots& slots = t_threadCaches;
+        if (slots.mIsDestroyed)
+        {
+            return nullptr;
+        }
+        for (thread_cache*& cache : slots.mCaches)
+        {
+            if (cache)
+            {
+                if (cache->mOwner.load(AZStd::memory_order_relaxed) == this)
+                {
+                    return cache;
+                }
+                if (cache->mOwner.load(AZStd::memory_order_relaxed) != nullptr)
+                {
+                    continue;
+                }
+                // the owner of this cache was destroyed, the (empty) cache can be reused
+            }
+            else
+            {
+                // the caches are allocated from the OS as they can outlive this allocator
+                void* mem = AZ_OS_MALLOC(sizeof(thread_cache), alignof(thread_cache));
+                if (!mem)
+                {
+                    return nullptr;
+                }
+                cache = new (mem) thread_cache();
+            }
+
+            if (mThreadCacheCount.load(AZStd::memory_order_relaxed) >= MAX_THREAD_CACHES)
+            {
+                // more threads use this allocator than it tracks caches for, use the buckets directly
+                // without taking the registry lock on every call
+                return nullptr;
+            }
+            AZStd::lock_guard<AZStd::mutex> lock(thread_cache_registry_mutex());
+            for (unsigned slot = 0; slot < MAX_THREAD_CACHES; ++slot)
+            {
+                if (!mThreadCacheSlots[slot].mCache)
+                {
+                    mThreadCacheSlots[slot].mCache = cache;
+                    mThreadCacheCount.store(mThreadCacheCount.load(AZStd::memory_order_relaxed) + 1, AZStd::memory_order_relaxed);
+                    cache->mSlot = slot;
+                    cache->mOwner.store(this, AZStd::memory_order_relaxed);
+                    return cache;
+                }
+            }
+            // more threads use this allocator than it tracks caches for, use the buckets directly
+            return nullptr;
+        }
+        // this thread uses more allocators than we have slots for, use the buckets directly
+        return nullptr;
+    }
+
+    void HpAllocator::thread_cache_refill(thread_cache& cache, unsigned bi)
+    {
+        const unsigned batchSize = thread_cache_batch_size(bi);
+        const size_t elemSize = bucket_spacing_function_inverse(bi);
+        free_link* head = cache.mMagazines[bi];
+        unsigned count = 0;
+        {
+#ifdef MULTITHREADED
+    #if defined (USE_MUTEX_PER_BUCKET)
+            AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
+    #else
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    #endif
+#endif
+            for (; count < batchSize; ++count)
+            {
+                page* p = mBuckets[bi].get_free_page();
+                if (!p)
+                {
+                    p = bucket_grow(elemSize, mBuckets[bi].marker());
+                    if (!p)
+                    {
+                        break;
+                    }
+                    mBuckets[bi].add_free_page(p);
+                }
+                free_link* link = (free_link*)mBuckets[bi].alloc(p);
+                link->mNext = head;
+                head = link;
+            }
+            mTotalAllocatedSizeBuckets += elemSize * count;
+        }
+        cache.mMagazines[bi] = head;
+        cache.mCounts[bi] = (unsigned short)(cache.mCounts[bi] + count);
+        thread_cache_add_cached_bytes(cache, (ptrdiff_t)(elemSize * count));
+    }
+
+    void HpAllocator::thread_cache_drain(thread_cache& cache, unsigned bi, unsigned count)
+    {
+        HPPA_ASSERT(count <= cache.mCounts[bi]);
+        if (count == 0)
+        {
+            return;
+        }
+        // keep the most recently freed elements, they are the most likely to still be in the CPU cache
+        const unsigned keep = cache.mCounts[bi] - count;
+        free_link* drained = cache.mMagazines[bi];
+        if (keep > 0)
+        {
+            free_link* last = drained;
+            for (unsigned i = 1; i < keep; ++i)
+            {
+                last = last->mNext;
+            }
+            drained = last->mNext;
+            last->mNext = nullptr;
+        }
+        else
+        {
+            cache.mMagazines[bi] = nullptr;
+        }
+        cache.mCounts[bi] = (unsigned short)keep;
+
+        const size_t elemSize = bucket_spacing_function_inverse(bi);
+        {
+#ifdef MULTITHREADED
+    #if defined (USE_MUTEX_PER_BUCKET)
+            AZStd::lock_guard<AZStd::mutex> lock(mBuckets[bi].get_lock());
+    #else
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+    #endif
+#endif
+            while (drained)
+            {
+                // bucket::free overwrites the link
+                free_link* next = drained->mNext;
+                mBuckets[bi].free(ptr_get_page(drained), drained);
+                drained = next;
+            }
+            mTotalAllocatedSizeBuckets -= elemSize * count;
+        }
+        thread_cache_add_cached_bytes(cache, -(ptrdiff_t)(elemSize * count));
+    }
+
+    void HpAllocator::thread_cache_flush(thread_cache& cache)
+    {
+        for (unsigned i = 0; i < NUM_BUCKETS; i++)
+        {
+            thread_cache_drain(cache, i, cache.mCounts[i]);
+        }
+    }
+
+    void HpAllocator::thread_cache_flush_all(bool detach)
+    {
+        // NOTE: when detaching, the owning threads must not use this allocator anymore. The caches are left
+        // empty so the threads can reuse them for another allocator or release them when they exit
+        AZStd::lock_guard<AZStd::mutex> lock(thread_cache_registry_mutex());
+        for (thread_cache_slot& slot : mThreadCacheSlots)
+        {
+            if (thread_cache* cache = slot.mCache)
+            {
+                {
+                    AZStd::lock_guard<AZStd::spin_mutex> cacheLock(cache->mLock);
+                    thread_cache_flush(*cache);
+                }
+                if (detach)
+                {
+                    cache->mOwner.store(nullptr, AZStd::memory_order_relaxed);
+                    slot.mCache = nullptr;
+                    mThreadCacheCount.store(mThreadCacheCount.load(AZStd::memory_order_relaxed) - 1, AZStd::memory_order_relaxed);
+                }
+            }
+        }
+    }
+
+    size_t HpAllocator::thread_cache_cached_bytes() const
+    {
+        size_t cachedBytes = 0;
+        for (const thread_cache_slot& slot : mThreadCacheSlots)
+        {
+            cachedBytes += slot.mCachedBytes.load(AZStd::memory_order_relaxed);
+        }
+        return cachedBytes;
+    }
+
+    void HpAllocator::thread_cache_add_cached_bytes(const thread_cache& cache, ptrdiff_t bytes)
+    {
+        // only written while holding the cache lock, so there's no need for an atomic add
+        AZStd::atomic<size_t>& cachedBytes = mThreadCacheSlots[cache.mSlot].mCachedBytes;
+        cachedBytes.store(cachedBytes.load(AZStd::memory_order_relaxed) + bytes, AZStd::memory_order_relaxed);
+    }
+
+    AZStd::mutex& HpAllocator::thread_cache_registry_mutex()
+    {
+        // shared by all allocators so an exiting thread can check whether the owner of its cache still exists,
+        // never taken on the allocation path
+        static AZStd::mutex s_mutex;
+        return s_mutex;
+    }
+
+    void HpAllocator::thread_cache_release(thread_cache* cache)
+    {
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(thread_cache_registry_mutex());
+            // a detached cache was already flushed by its owner's destructor
+            if (HpAllocator* owner = cache->mOwner.load(AZStd::memory_order_relaxed))
+            {
+                {
+                    AZStd::lock_guard<AZStd::spin_mutex> cacheLock(cache->mLock);
+                    owner->thread_cache_flush(*cache);
+                }
+                owner->mThreadCacheSlots[cache->mSlot].mCache = nullptr;
+                owner->mThreadCacheCount.store(owner->mThreadCacheCount.load(AZStd::memory_order_relaxed) - 1, AZStd::memory_order_relaxed);
+                cache->mOwner.store(nullptr, AZStd::memory_order_relaxed);
+            }
+        }
+        cache->~thread_cache();
+        AZ_OS_FREE(cache);
+    }
+
+    void* HpAllocator::bucket_cached_alloc(unsigned bi)
+    {
+        HPPA_ASSERT(bi < NUM_BUCKETS);
+        thread_cache* cache = mIsThreadCacheEnabled ? thread_cache_get() : nullptr;
+        if (!cache)
+        {
+            return bucket_alloc_direct(bi);
+        }
+        AZStd::lock_guard<AZStd::spin_mutex> cacheLock(cache->mLock);
+        if (!cache->mMagazines[bi])
+        {
+            thread_cache_refill(*cache, bi);
+            if (!cache->mMagazines[bi])
+            {
+                return nullptr;
+            }
+        }
+        free_link* link = cache->mMagazines[bi];
+        cache->mMagazines[bi] = link->mNext;
+        cache->mCounts[bi]--;
+        thread_cache_add_cached_bytes(*cache, -(ptrdiff_t)bucket_spacing_function_inverse(bi));
+        return link;
+    }
+
+    void HpAllocator::bucket_cached_free(void* ptr, unsigned bi)
+    {
+        HPPA_ASSERT(bi < NUM_BUCKETS);
+        // if this asserts, the free size doesn't match the allocated size
+        // most likely a class needs a base virtual destructor
+        HPPA_ASSERT(bi == ptr_get_page(ptr)->bucket_index());
+        thread_cache* cache = mIsThreadCacheEnabled ? thread_cache_get() : nullptr;
+        if (!cache)
+        {
+            return bucket_free_direct(ptr, bi);
+        }
+        AZStd::lock_guard<AZStd::spin_mutex> cacheLock(cache->mLock);
+        free_link* link = (free_link*)ptr;
+        link->mNext = cache->mMagazines[bi];
+        cache->mMagazines[bi] = link;
+        cache->mCounts[bi]++;
+        thread_cache_add_cached_bytes(*cache, (ptrdiff_t)bucket_spacing_function_inverse(bi));
+
+        // allow a magazine to hold up to two batches so alternating allocs and frees don't hit the bucket every time
+        const unsigned batchSize = thread_cache_batch_size(bi);
+        if (cache->mCounts[bi] > 2 * batchSize)
+        {
+            thread_cache_drain(*cache, bi, batchSize);
+        }
+    }
+
     void HpAllocator::split_block(block_header* bl, size_t size)
     {
         HPPA_ASSERT(size + sizeof(block_header) + sizeof(free_node) <= bl->size());
@@ -39,6 +39,7 @@ namespace AZ
                 , m_subAllocator(nullptr)
                 , m_systemChunkSize(0)
                 , m_capacity(AZ_CORE_MAX_ALLOCATOR_SIZE)
+                , m_isThreadCacheEnabled(true)
             {}
 
             unsigned int            m_fixedMemoryBlockAlignment;
@@ -50,6 +51,7 @@ namespace AZ
             IAllocatorAllocate*     m_subAllocator;                         ///< Allocator that m_memoryBlocks memory was allocated from or should be allocated (if NULL).
             size_t                  m_systemChunkSize;                      ///< Size of chunk to request from the OS when more memory is needed (defaults to m_pageSize)
             size_t                  m_capacity;                             ///< Max size this allocator can grow to
+            bool                    m_isThreadCacheEnabled;                 ///< True to serve small allocations from per thread caches, which avoids taking the bucket locks for most calls.
         };
 
 
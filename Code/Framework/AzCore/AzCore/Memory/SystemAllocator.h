@@ -62,6 +62,7 @@ namespace AZ
                     , m_numFixedMemoryBlocks(0)
                     , m_subAllocator(nullptr)
                     , m_systemChunkSize(0)
+                    , m_isThreadCacheEnabled(true)
                 {}
                 static const int        m_defaultPageSize = AZ_TRAIT_OS_DEFAULT_PAGE_SIZE;
                 static const int        m_defaultPoolPageSize = 4 * 1024;
@@ -75,6 +76,7 @@ namespace AZ
                 size_t                  m_fixedMemoryBlocksByteSize[m_maxNumFixedBlocks]; ///< Sizes of different memory blocks (MUST be multiple of m_pageSize), if m_memoryBlock is 0 the block will be allocated for you with the System Allocator.
                 IAllocatorAllocate*     m_subAllocator;                             ///< Allocator that m_memoryBlocks memory was allocated from or should be allocated (if NULL).
                 size_t                  m_systemChunkSize;                          ///< Size of chunk to request from the OS when more memory is needed (defaults to m_pageSize)
+                bool                    m_isThreadCacheEnabled;                     ///< True (default) if small allocations are served from per thread caches. Only used with m_isPoolAllocations.
             }                           m_heap;
             bool                        m_allocationRecords;    ///< True if we want to track memory allocations, otherwise false.
             unsigned char               m_stackRecordLevels;    ///< If stack recording is enabled, how many stack levels to record.
@@ -28,6 +28,21 @@ namespace AZ
         SetName(name);
     }
 
+    Name::Name(const NameLiteral& literal)
+    {
+        if (!literal.GetStringView().empty())
+        {
+            AZ_Assert(NameDictionary::IsReady(), "Attempted to initialize Name '%.*s' before the NameDictionary is ready.",
+                AZ_STRING_ARG(literal.GetStringView()));
+
+            *this = NameDictionary::Instance().MakeName(literal);
+        }
+        else
+        {
+            SetEmptyString();
+        }
+    }
+
     Name::Name(Hash hash)
     {
         *this = NameDictionary::Instance().FindName(hash);
@@ -18,6 +18,7 @@ namespace UnitTest
 namespace AZ
 {
     class NameDictionary;
+    class NameLiteral;
     class ScriptDataContext;
     class ReflectContext;
 
@@ -54,6 +55,9 @@ namespace AZ
         //! internally held after the call.
         explicit Name(AZStd::string_view name);
 
+        //! Creates an instance of a name from a literal with a hash computed at compile time.
+        explicit Name(const NameLiteral& literal);
+
         //! Creates an instance of a name from a hash.
         //! The hash will be used to find an existing name in the dictionary. If there is no
         //! name with this hash, the resulting name will be empty.
@@ -95,6 +99,15 @@ namespace AZ
             return m_hash;
         }
 
+        //! Calculates the hash of a string as used by the NameDictionary. The hash of a Name may differ if the
+        //! NameDictionary had to resolve a hash collision.
+        static constexpr Hash CalcHash(AZStd::string_view name)
+        {
+            // AZStd::hash<AZStd::string_view> returns 64 bits but we want 32 bit hashes for the sake
+            // of network synchronization. So just take the low 32 bits.
+            return static_cast<Hash>(AZStd::hash<AZStd::string_view>()(name) & 0xFFFFFFFF);
+        }
+
     private:
         
         // Assigns a new name.  
@@ -122,6 +135,34 @@ namespace AZ
         AZStd::intrusive_ptr<Internal::NameData> m_data;
     };
 
+    //! A string literal together with its dictionary hash, computed at compile time when declared constexpr.
+    //! Names created from a literal skip hashing the string at runtime.
+    //! Example:
+    //!     static constexpr AZ::NameLiteral s_positionLiteral{ "POSITION" };
+    //!     AZ::Name position{ s_positionLiteral };
+    class NameLiteral
+    {
+    public:
+        constexpr explicit NameLiteral(AZStd::string_view name)
+            : m_name{ name }
+            , m_hash{ Name::CalcHash(name) }
+        {
+        }
+
+        constexpr AZStd::string_view GetStringView() const
+        {
+            return m_name;
+        }
+
+        constexpr Name::Hash GetHash() const
+        {
+            return m_hash;
+        }
+
+    private:
+        AZStd::string_view m_name;
+        Name::Hash m_hash;
+    };
 } // namespace AZ
 
 namespace AZStd
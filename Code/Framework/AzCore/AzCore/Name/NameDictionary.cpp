@@ -13,6 +13,7 @@
 #include <AzCore/std/parallel/lock.h>
 #include <AzCore/std/string/conversions.h>
 #include <AzCore/Module/Environment.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <cstring>
 
 namespace AZ
@@ -22,6 +23,21 @@ namespace AZ
     namespace NameDictionaryInternal
     {
         static AZ::EnvironmentVariable<NameDictionary> s_instance = nullptr;
+
+        // A small direct-mapped cache per thread of names recently made on that thread, indexed by the
+        // unresolved hash of the name string.
+        struct ThreadCacheEntry
+        {
+            uint64_t m_instanceId = 0;
+            Name::Hash m_hash = 0;
+            Internal::NameData* m_nameData = nullptr;
+        };
+        static constexpr size_t ThreadCacheSize = 64;
+        static thread_local ThreadCacheEntry t_threadCache[ThreadCacheSize];
+
+        // The dictionary is always created from the executable's memory space (see IsReady), so a single counter
+        // is enough to give every dictionary instance a unique id. Zero is reserved for unused cache entries.
+        static AZStd::atomic<uint64_t> s_nextInstanceId{ 1 };
     }
 
     void NameDictionary::Create()
@@ -76,28 +92,38 @@ namespace AZ
     }
     
     NameDictionary::NameDictionary()
-    {}
+        : m_instanceId(NameDictionaryInternal::s_nextInstanceId.fetch_add(1, AZStd::memory_order_relaxed))
+    {
+    }
 
     NameDictionary::~NameDictionary()
     {
         bool leaksDetected = false;
 
-        for (const auto& keyValue : m_dictionary)
+        for (Shard& shard : m_shards)
         {
-            Internal::NameData* nameData = keyValue.second;
-            const int useCount = keyValue.second->m_useCount;
-            [[maybe_unused]] const bool hadCollision = keyValue.second->m_hashCollision;
-
-            if (useCount == 0)
+            for (const auto& keyValue : shard.m_dictionary)
             {
-                // Entries that had resolved hash collisions are allowed to remain in the dictionary until shutdown.
-                AZ_Assert(hadCollision, "Only colliding names are allowed to remain in the dictionary");
-                delete nameData;
+                Internal::NameData* nameData = keyValue.second;
+                const int useCount = keyValue.second->m_useCount;
+                [[maybe_unused]] const bool hadCollision = keyValue.second->m_hashCollision;
+
+                if (useCount == 0)
+                {
+                    // Entries that had resolved hash collisions are allowed to remain in the dictionary until shutdown.
+                    AZ_Assert(hadCollision, "Only colliding names are allowed to remain in the dictionary");
+                    delete nameData;
+                }
+                else
+                {
+                    leaksDetected = true;
+                    AZ_TracePrintf("NameDictionary", "\tLeaked Name [%3d reference(s)]: hash 0x%08X, '%.*s'\n", useCount, keyValue.first, AZ_STRING_ARG(keyValue.second->GetName()));
+                }
             }
-            else
+
+            for (Internal::NameData* nameData : shard.m_releasedEntries)
             {
-                leaksDetected = true;
-                AZ_TracePrintf("NameDictionary", "\tLeaked Name [%3d reference(s)]: hash 0x%08X, '%.*s'\n", useCount, keyValue.first, AZ_STRING_ARG(keyValue.second->GetName()));
+                delete nameData;
             }
         }
 
@@ -106,9 +132,10 @@ namespace AZ
 
     Name NameDictionary::FindName(Name::Hash hash) const
     {
-        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
-        auto iter = m_dictionary.find(hash);
-        if (iter != m_dictionary.end())
+        const Shard& shard = m_shards[GetShardIndex(hash)];
+        AZStd::shared_lock<AZStd::shared_mutex> lock(shard.m_sharedMutex);
+        auto iter = shard.m_dictionary.find(hash);
+        if (iter != shard.m_dictionary.end())
         {
             return Name(iter->second);
         }
@@ -123,36 +150,87 @@ namespace AZ
             return Name();
         }
 
-        Name::Hash hash = CalcHash(nameString);
+        return MakeName(nameString, CalcHash(nameString));
+    }
+
+    Name NameDictionary::MakeName(const NameLiteral& literal)
+    {
+        if (literal.GetStringView().empty())
+        {
+            return Name();
+        }
+
+        AZ_Assert(literal.GetHash() == CalcHash(literal.GetStringView()), "NameLiteral '%.*s' has an invalid hash.",
+            AZ_STRING_ARG(literal.GetStringView()));
+        return MakeName(literal.GetStringView(), literal.GetHash());
+    }
+
+    Name NameDictionary::MakeName(AZStd::string_view nameString, Name::Hash hash)
+    {
+        // Names that are made repeatedly on the same thread are found without taking any lock.
+        Name name = FindInThreadCache(nameString, hash);
+        if (!name.IsEmpty())
+        {
+            return name;
+        }
+
+        Shard& shard = m_shards[GetShardIndex(hash)];
 
         // If we find the same name with the same hash, just return it. 
-        // This path is faster than the loop below because FindName() takes a shared_lock whereas the
-        // loop requires a unique_lock to modify the dictionary.
-        Name name = FindName(hash);
+        // This path is faster than the one below because FindName() takes a shared_lock whereas adding
+        // a name requires a unique_lock to modify the dictionary.
+        name = FindName(hash);
         if (name.GetStringView() == nameString)
         {
-            return AZStd::move(name);
+            AddToThreadCache(hash, name.m_data.get());
+            return name;
         }
 
         // The name doesn't exist in the dictionary, so we have to lock and add it
-        AZStd::unique_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        {
+            AZStd::unique_lock<AZStd::shared_mutex> lock(shard.m_sharedMutex);
 
-        auto iter = m_dictionary.find(hash);
+            auto iter = shard.m_dictionary.find(hash);
+            // No existing entry, add a new one and we're done
+            if (iter == shard.m_dictionary.end())
+            {
+                Internal::NameData* nameData = AddEntry(shard, nameString, hash);
+                AddToThreadCache(hash, nameData);
+                return Name(nameData);
+            }
+            // Found the desired entry, return it
+            else if (iter->second->GetName() == nameString)
+            {
+                AddToThreadCache(hash, iter->second);
+                return Name(iter->second);
+            }
+        }
+
+        // Hash collision. Colliding names are resolved by trying consecutive hashes, which can belong to any shard, so
+        // all shards are locked. Collisions are rare enough that this doesn't cause contention. The dictionary may have
+        // changed while no lock was held, so the search starts over from the original hash.
+        for (Shard& lockedShard : m_shards)
+        {
+            lockedShard.m_sharedMutex.lock();
+        }
+
+        const Name::Hash unresolvedHash = hash;
+        Internal::NameData* nameData = nullptr;
         bool collisionDetected = false;
-        while (true)
+        while (nameData == nullptr)
         {
+            Shard& hashShard = m_shards[GetShardIndex(hash)];
+            auto iter = hashShard.m_dictionary.find(hash);
             // No existing entry, add a new one and we're done
-            if (iter == m_dictionary.end())
+            if (iter == hashShard.m_dictionary.end())
             {
-                Internal::NameData* nameData = aznew Internal::NameData(nameString, hash);
+                nameData = AddEntry(hashShard, nameString, hash);
                 nameData->m_hashCollision = collisionDetected;
-                m_dictionary.emplace(hash, nameData);
-                return Name(nameData);
             }
             // Found the desired entry, return it
             else if (iter->second->GetName() == nameString)
             {
-                return Name(iter->second);
+                nameData = iter->second;
             }
             // Hash collision, try a new hash
             else
@@ -160,9 +238,83 @@ namespace AZ
                 collisionDetected = true;
                 iter->second->m_hashCollision = true; // Make sure the existing entry is flagged as colliding too
                 ++hash;
-                iter = m_dictionary.find(hash);
             }
         }
+        AddToThreadCache(unresolvedHash, nameData);
+        name = Name(nameData);
+
+        for (Shard& lockedShard : m_shards)
+        {
+            lockedShard.m_sharedMutex.unlock();
+        }
+        return name;
+    }
+
+    Internal::NameData* NameDictionary::AddEntry(Shard& shard, AZStd::string_view nameString, Name::Hash hash)
+    {
+        Internal::NameData* nameData;
+        if (!shard.m_releasedEntries.empty())
+        {
+            // Reuse a released entry. Other threads can only observe the reference count of a released entry,
+            // which is still -1 at this point, so it's safe to update the name.
+            nameData = shard.m_releasedEntries.back();
+            shard.m_releasedEntries.pop_back();
+            nameData->m_name = nameString;
+            nameData->m_hash = hash;
+            nameData->m_hashCollision = false;
+            nameData->m_useCount.store(0, AZStd::memory_order_release);
+        }
+        else
+        {
+            nameData = aznew Internal::NameData(nameString, hash);
+        }
+        shard.m_dictionary.emplace(hash, nameData);
+        return nameData;
+    }
+
+    Name NameDictionary::FindInThreadCache(AZStd::string_view nameString, Name::Hash hash) const
+    {
+        using namespace NameDictionaryInternal;
+
+        const ThreadCacheEntry& entry = t_threadCache[hash & (ThreadCacheSize - 1)];
+        if (entry.m_instanceId != m_instanceId || entry.m_hash != hash)
+        {
+            return Name();
+        }
+
+        // The entry may have been released, and possibly reused for another name, since it was cached. The memory
+        // stays valid for the lifetime of the dictionary, so only take a reference if the entry is still in use.
+        // Once a reference is held the entry can't be released, so the name can be safely compared.
+        Internal::NameData* nameData = entry.m_nameData;
+        int32_t useCount = nameData->m_useCount.load(AZStd::memory_order_relaxed);
+        do
+        {
+            if (useCount <= 0)
+            {
+                return Name();
+            }
+        } while (!nameData->m_useCount.compare_exchange_weak(useCount, useCount + 1, AZStd::memory_order_acquire));
+
+        if (nameData->GetName() != nameString)
+        {
+            nameData->release();
+            return Name();
+        }
+
+        Name name(nameData);
+        // The Name holds its own reference so this can't drop the count to zero
+        nameData->m_useCount.fetch_sub(1, AZStd::memory_order_relaxed);
+        return name;
+    }
+
+    void NameDictionary::AddToThreadCache(Name::Hash hash, Internal::NameData* nameData) const
+    {
+        using namespace NameDictionaryInternal;
+
+        ThreadCacheEntry& entry = t_threadCache[hash & (ThreadCacheSize - 1)];
+        entry.m_instanceId = m_instanceId;
+        entry.m_hash = hash;
+        entry.m_nameData = nameData;
     }
 
     void NameDictionary::TryReleaseName(Name::Hash hash)
@@ -178,41 +330,44 @@ namespace AZ
         //      the dictionary *again*, this time with hash value 1000. Name objects pointing to the original
         //      entry and Name objects pointing to the new entry will fail comparison operations.
 
-
-        AZStd::unique_lock<AZStd::shared_mutex> lock(m_sharedMutex);
-
-        auto dictIt = m_dictionary.find(hash);
-        if (dictIt == m_dictionary.end())
         {
-            // This check is to safeguard around the following scenario
-            // T1, gets into TryReleaseName
-            // T2 gets into MakeName, acquires the lock, returns a new Name that increments the counter
-            // T2 deletes the Name decrements the counter, gets into TryReleaseName
-            // T1 gets the lock, goes to the compare_exchange if and has a counter of 0, deletes
-            // Then T2 continues, gets the lock and crashes because nameData was deleted
-            return;
-        }
+            Shard& shard = m_shards[GetShardIndex(hash)];
+            AZStd::unique_lock<AZStd::shared_mutex> lock(shard.m_sharedMutex);
 
-        Internal::NameData* nameData = dictIt->second;
+            auto dictIt = shard.m_dictionary.find(hash);
+            if (dictIt == shard.m_dictionary.end())
+            {
+                // This check is to safeguard around the following scenario
+                // T1, gets into TryReleaseName
+                // T2 gets into MakeName, acquires the lock, returns a new Name that increments the counter
+                // T2 deletes the Name decrements the counter, gets into TryReleaseName
+                // T1 gets the lock, goes to the compare_exchange if and has a counter of 0, deletes
+                // Then T2 continues, gets the lock and crashes because nameData was deleted
+                return;
+            }
 
-        // Check m_hashCollision inside the m_sharedMutex because a new collision could have happened
-        // on another thread before taking the lock.
-        if (nameData->m_hashCollision)
-        {
-            return;
-        }
+            Internal::NameData* nameData = dictIt->second;
 
-        // We need to check the count again in here in case
-        // someone was trying to get the name on another thread.
-        // Set it to -1 so only this thread will attempt to clean up the
-        // dictionary and delete the name.
-        int32_t expectedRefCount = 0;
-        if (nameData->m_useCount.compare_exchange_strong(expectedRefCount, -1))
-        {
-            m_dictionary.erase(nameData->GetHash());
-            delete nameData;
+            // Check m_hashCollision inside the m_sharedMutex because a new collision could have happened
+            // on another thread before taking the lock.
+            if (nameData->m_hashCollision)
+            {
+                return;
+            }
+
+            // We need to check the count again in here in case
+            // someone was trying to get the name on another thread.
+            // Set it to -1 so only this thread will attempt to clean up the
+            // dictionary and release the name.
+            int32_t expectedRefCount = 0;
+            if (nameData->m_useCount.compare_exchange_strong(expectedRefCount, -1))
+            {
+                shard.m_dictionary.erase(nameData->GetHash());
+                shard.m_releasedEntries.push_back(nameData);
+            }
         }
 
+        // Called without holding the shard lock because the stats lock every shard in turn.
         ReportStats();
     }
 
@@ -228,51 +383,53 @@ namespace AZ
             size_t potentialStringMemoryUsed = 0;
             size_t actualStringMemoryUsed = 0;
 
-            Internal::NameData* longestName = nullptr;
-            Internal::NameData* mostRepeatedName = nullptr;
+            // Copies are kept of the reported names because entries can be released once their shard is unlocked.
+            AZStd::string longestName;
+            AZStd::string mostRepeatedName;
+            int mostRepeatedCount = 0;
 
-            for (auto& iter : m_dictionary)
+            size_t nameCount = 0;
+            for (const Shard& shard : m_shards)
             {
-                const size_t nameLength = iter.second->m_name.size();
-                actualStringMemoryUsed += nameLength;
-                potentialStringMemoryUsed += (nameLength * iter.second->m_useCount);
-
-                if (!longestName || longestName->m_name.size() < nameLength)
+                AZStd::shared_lock<AZStd::shared_mutex> lock(shard.m_sharedMutex);
+                nameCount += shard.m_dictionary.size();
+                for (auto& iter : shard.m_dictionary)
                 {
-                    longestName = iter.second;
-                }
+                    const size_t nameLength = iter.second->m_name.size();
+                    const int useCount = iter.second->m_useCount.load();
+                    actualStringMemoryUsed += nameLength;
+                    potentialStringMemoryUsed += (nameLength * useCount);
 
-                if (!mostRepeatedName)
-                {
-                    mostRepeatedName = iter.second;
-                }
-                else
-                {
-                    const size_t mostIndividualSavings = mostRepeatedName->m_name.size() * (mostRepeatedName->m_useCount - 1);
-                    const size_t currentIndividualSavings = nameLength * (iter.second->m_useCount - 1);
-                    if (currentIndividualSavings > mostIndividualSavings)
+                    if (longestName.empty() || longestName.size() < nameLength)
+                    {
+                        longestName = iter.second->m_name;
+                    }
+
+                    const size_t mostIndividualSavings = mostRepeatedName.size() * (mostRepeatedCount - 1);
+                    const size_t currentIndividualSavings = nameLength * (useCount - 1);
+                    if (mostRepeatedName.empty() || currentIndividualSavings > mostIndividualSavings)
                     {
-                        mostRepeatedName = iter.second;
+                        mostRepeatedName = iter.second->m_name;
+                        mostRepeatedCount = useCount;
                     }
                 }
             }
 
             AZ_TracePrintf("NameDictionary", "NameDictionary Stats\n");
-            AZ_TracePrintf("NameDictionary", "Names:              %d\n", m_dictionary.size());
+            AZ_TracePrintf("NameDictionary", "Names:              %zu\n", nameCount);
             AZ_TracePrintf("NameDictionary", "Total chars:        %d\n", actualStringMemoryUsed);
             AZ_TracePrintf("NameDictionary", "Logical chars:      %d\n", potentialStringMemoryUsed);
             AZ_TracePrintf("NameDictionary", "Memory saved:       %d\n", potentialStringMemoryUsed - actualStringMemoryUsed);
-            if (longestName)
+            if (!longestName.empty())
             {
-                AZ_TracePrintf("NameDictionary", "Longest name:       \"%.*s\"\n", aznumeric_cast<int>(longestName->m_name.size()), longestName->m_name.data());
-                AZ_TracePrintf("NameDictionary", "Longest name size:  %d\n", longestName->m_name.size());
+                AZ_TracePrintf("NameDictionary", "Longest name:       \"%.*s\"\n", AZ_STRING_ARG(longestName));
+                AZ_TracePrintf("NameDictionary", "Longest name size:  %d\n", longestName.size());
             }
-            if (mostRepeatedName)
+            if (!mostRepeatedName.empty())
             {
-                AZ_TracePrintf("NameDictionary", "Most repeated name:        \"%.*s\"\n", aznumeric_cast<int>(mostRepeatedName->m_name.size()), mostRepeatedName->m_name.data());
-                AZ_TracePrintf("NameDictionary", "Most repeated name size:   %d\n", mostRepeatedName->m_name.size());
-                const int refCount = mostRepeatedName->m_useCount.load();
-                AZ_TracePrintf("NameDictionary", "Most repeated name count:  %d\n", refCount);
+                AZ_TracePrintf("NameDictionary", "Most repeated name:        \"%.*s\"\n", AZ_STRING_ARG(mostRepeatedName));
+                AZ_TracePrintf("NameDictionary", "Most repeated name size:   %d\n", mostRepeatedName.size());
+                AZ_TracePrintf("NameDictionary", "Most repeated name count:  %d\n", mostRepeatedCount);
             }
 
             reportUsage = false;
@@ -283,9 +440,6 @@ namespace AZ
 
     Name::Hash NameDictionary::CalcHash(AZStd::string_view name)
     {
-        // AZStd::hash<AZStd::string_view> returns 64 bits but we want 32 bit hashes for the sake
-        // of network synchronization. So just take the low 32 bits.
-        const uint32_t hash = AZStd::hash<AZStd::string_view>()(name) & 0xFFFFFFFF;
-        return hash;
+        return Name::CalcHash(name);
     }
 }
@@ -8,7 +8,9 @@
 
 #pragma once
 
+#include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/string/string_view.h>
 #include <AzCore/std/parallel/shared_mutex.h>
@@ -43,6 +45,11 @@ namespace AZ
     //! Benchmarks have shown that creating a new Name object can be quite slow when the name doesn't
     //! already exist in the NameDictionary, but is comparable to creating an AZStd::string for names
     //! that already exist.
+    //!
+    //! The dictionary is split into shards, selected by the upper bits of the hash, that are locked
+    //! independently so threads creating different names rarely contend on the same lock. Each thread
+    //! additionally keeps a small cache of recently made names which avoids taking any lock for names
+    //! that are created repeatedly.
     class NameDictionary final
     {
         AZ_CLASS_ALLOCATOR(NameDictionary, AZ::OSAllocator, 0);
@@ -70,6 +77,11 @@ namespace AZ
         //! @return A Name instance holding a dictionary entry associated with the provided raw string.
         Name MakeName(AZStd::string_view name);
 
+        //! Makes a Name from a literal with a hash that was precomputed at compile time.
+        //! @param literal The literal to resolve against the dictionary.
+        //! @return A Name instance holding a dictionary entry associated with the literal's string.
+        Name MakeName(const NameLiteral& literal);
+
         //! Search for an existing name in the dictionary by hash.
         //! @param hash The key by which to search for the name.
         //! @return A Name instance. If the hash was not found, the Name will be empty.
@@ -79,8 +91,37 @@ namespace AZ
         NameDictionary();
         ~NameDictionary();
 
+        // The number of shards must be a power of two. Shards are selected with the upper bits of the hash.
+        static constexpr uint32_t ShardBits = 5;
+        static constexpr uint32_t ShardCount = 1 << ShardBits;
+
+        struct alignas(64) Shard
+        {
+            AZStd::unordered_map<Name::Hash, Internal::NameData*> m_dictionary;
+            // Entries that were released from the dictionary. The memory of NameData is never returned while
+            // the dictionary exists, so the per-thread caches can safely inspect the reference count of an
+            // entry that may have been released in the meantime. Released entries are reused for new names.
+            AZStd::vector<Internal::NameData*> m_releasedEntries;
+            mutable AZStd::shared_mutex m_sharedMutex;
+        };
+
         void ReportStats() const;
 
+        Name MakeName(AZStd::string_view name, Name::Hash hash);
+
+        // Adds a new entry for the name to the shard, reusing a released entry if there is one. The shard must be
+        // locked for writing.
+        Internal::NameData* AddEntry(Shard& shard, AZStd::string_view name, Name::Hash hash);
+
+        // Returns an empty Name if the name is not in the calling thread's cache.
+        Name FindInThreadCache(AZStd::string_view name, Name::Hash hash) const;
+        void AddToThreadCache(Name::Hash hash, Internal::NameData* nameData) const;
+
+        static constexpr uint32_t GetShardIndex(Name::Hash hash)
+        {
+            return hash >> (32 - ShardBits);
+        }
+
         //////////////////////////////////////////////////////////////////////////
         // Private API for NameData
 
@@ -94,7 +135,10 @@ namespace AZ
         // Does not attempt to resolve hash collisions; that is handled elsewhere.
         Name::Hash CalcHash(AZStd::string_view name);
 
-        AZStd::unordered_map<Name::Hash, Internal::NameData*> m_dictionary;
-        mutable AZStd::shared_mutex m_sharedMutex;
+        AZStd::array<Shard, ShardCount> m_shards;
+
+        // Identifies this instance of the dictionary in the per-thread caches, so stale entries from a
+        // previously destroyed dictionary are never used.
+        uint64_t m_instanceId = 0;
     };
 }
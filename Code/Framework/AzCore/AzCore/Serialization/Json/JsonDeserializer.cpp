@@ -63,19 +63,28 @@ namespace AZ
                 AZStd::string::format("Failed to retrieve serialization information for %s.", typeId.ToString<AZStd::string>().c_str()));
         }
 
-        if (classData->m_azRtti && classData->m_azRtti->GetGenericTypeId() != typeId)
+        return LoadWithClassData(object, typeId, *classData, value, isNewInstance, custom, context);
+    }
+
+    JsonSerializationResult::ResultCode JsonDeserializer::LoadWithClassData(void* object, const Uuid& typeId,
+        const SerializeContext::ClassData& classData, const rapidjson::Value& value, bool isNewInstance, UseTypeDeserializer custom,
+        JsonDeserializerContext& context)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        if (classData.m_azRtti && classData.m_azRtti->GetGenericTypeId() != typeId)
         {
-            if (((classData->m_azRtti->GetTypeTraits() & (AZ::TypeTraits::is_signed | AZ::TypeTraits::is_unsigned)) != AZ::TypeTraits{0}) &&
-                context.GetSerializeContext()->GetUnderlyingTypeId(typeId) == classData->m_typeId)
+            if (((classData.m_azRtti->GetTypeTraits() & (AZ::TypeTraits::is_signed | AZ::TypeTraits::is_unsigned)) != AZ::TypeTraits{0}) &&
+                context.GetSerializeContext()->GetUnderlyingTypeId(typeId) == classData.m_typeId)
             {
                 // This value is from an enum, where a field has been reflected using ClassBuilder::Field, but the enum
                 // type itself has not been reflected using EnumBuilder. Treat it as an enum.
-                return LoadEnum(object, *classData, value, context);
+                return LoadEnum(object, classData, value, context);
             }
             
             if (BaseJsonSerializer* serializer
                 = (custom == UseTypeDeserializer::Yes)
-                    ? context.GetRegistrationContext()->GetSerializerForType(classData->m_azRtti->GetGenericTypeId())
+                    ? context.GetRegistrationContext()->GetSerializerForType(classData.m_azRtti->GetGenericTypeId())
                     : nullptr)
             {
                 return DeserializerDefaultCheck(serializer, object, typeId, value, isNewInstance, context);
@@ -87,11 +96,11 @@ namespace AZ
             return context.Report(Tasks::ReadField, Outcomes::DefaultsUsed, "Value has an explicit default.");
         }
         
-        if (classData->m_azRtti && (classData->m_azRtti->GetTypeTraits() & AZ::TypeTraits::is_enum) == AZ::TypeTraits::is_enum)
+        if (classData.m_azRtti && (classData.m_azRtti->GetTypeTraits() & AZ::TypeTraits::is_enum) == AZ::TypeTraits::is_enum)
         {
-            return LoadEnum(object, *classData, value, context);
+            return LoadEnum(object, classData, value, context);
         }
-        if (classData->m_container)
+        if (classData.m_container)
         {
             return context.Report(Tasks::ReadField, Outcomes::Unsupported,
                 "The Json Serializer uses custom serializers to load containers. If this message is encountered "
@@ -99,10 +108,10 @@ namespace AZ
         }
         if (value.IsObject())
         {
-            return LoadClass(object, *classData, value, context);
+            return LoadClass(object, classData, value, context);
         }
         return context.Report(Tasks::ReadField, Outcomes::Unsupported,
-            AZStd::string::format("Reading into targets of type '%s' is not supported.", classData->m_name));
+            AZStd::string::format("Reading into targets of type '%s' is not supported.", classData.m_name));
     }
 
     JsonSerializationResult::ResultCode JsonDeserializer::LoadToPointer(void* object, const Uuid& typeId,
@@ -184,6 +193,26 @@ namespace AZ
         }
     }
 
+    JsonSerializationResult::ResultCode JsonDeserializer::LoadWithPlanField(void* object, const rapidjson::Value& value,
+        const JsonSerializationPlan::Field& field, JsonDeserializerContext& context)
+    {
+        const SerializeContext::ClassElement& classElement = *field.m_element;
+        if (classElement.m_flags & SerializeContext::ClassElement::Flags::FLG_POINTER)
+        {
+            return LoadWithClassElement(object, value, classElement, context);
+        }
+        // Same as Load, but with the serializer and class data already looked up.
+        if (field.m_serializer)
+        {
+            return DeserializerDefaultCheck(field.m_serializer, object, classElement.m_typeId, value, false, context);
+        }
+        if (field.m_classData)
+        {
+            return LoadWithClassData(object, classElement.m_typeId, *field.m_classData, value, false, UseTypeDeserializer::Yes, context);
+        }
+        return Load(object, classElement.m_typeId, value, false, UseTypeDeserializer::Yes, context);
+    }
+
     JsonSerializationResult::ResultCode JsonDeserializer::LoadClass(void* object, const SerializeContext::ClassData& classData,
         const rapidjson::Value& value, JsonDeserializerContext& context)
     {
@@ -191,6 +220,9 @@ namespace AZ
 
         AZ_Assert(context.GetRegistrationContext() && context.GetSerializeContext(), "Expected valid registration context and serialize context.");
 
+        JsonSerializationPlanCache::PlanPtr plan = context.GetRegistrationContext()->GetSerializationPlanCache().GetPlan(
+            *context.GetSerializeContext(), *context.GetRegistrationContext(), classData);
+
         size_t numLoads = 0;
         ResultCode retVal(Tasks::ReadField);
         for (auto iter = value.MemberBegin(); iter != value.MemberEnd(); ++iter)
@@ -202,12 +234,29 @@ namespace AZ
                 continue;
             }
             Crc32 nameCrc(name);
-            ElementDataResult foundElementData = FindElementByNameCrc(*context.GetSerializeContext(), object, classData, nameCrc);
+            ElementDataResult foundElementData;
+            const JsonSerializationPlan::Field* field = nullptr;
+            if (plan)
+            {
+                field = plan->FindLoadField(nameCrc);
+                if (field)
+                {
+                    foundElementData.m_data = reinterpret_cast<char*>(object) + field->m_offset;
+                    foundElementData.m_info = field->m_element;
+                    foundElementData.m_found = true;
+                }
+            }
+            else
+            {
+                foundElementData = FindElementByNameCrc(*context.GetSerializeContext(), object, classData, nameCrc);
+            }
 
             ScopedContextPath subPath(context, name);
             if (foundElementData.m_found)
             {
-                ResultCode result = LoadWithClassElement(foundElementData.m_data, val, *foundElementData.m_info, context);
+                ResultCode result = field
+                    ? LoadWithPlanField(foundElementData.m_data, val, *field, context)
+                    : LoadWithClassElement(foundElementData.m_data, val, *foundElementData.m_info, context);
                 retVal.Combine(result);
 
                 if (result.GetProcessing() == Processing::Halted)
@@ -226,7 +275,7 @@ namespace AZ
             }
         }
 
-        size_t elementCount = CountElements(*context.GetSerializeContext(), classData);
+        size_t elementCount = plan ? plan->m_elementCount : CountElements(*context.GetSerializeContext(), classData);
         if (elementCount > numLoads)
         {
             retVal.Combine(ResultCode(Tasks::ReadField, numLoads == 0 ? Outcomes::DefaultsUsed : Outcomes::PartialDefaults));
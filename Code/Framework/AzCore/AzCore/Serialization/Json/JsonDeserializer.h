@@ -11,6 +11,7 @@
 #include <AzCore/JSON/document.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/Json/JsonSerialization.h>
+#include <AzCore/Serialization/Json/JsonSerializationPlan.h>
 #include <AzCore/std/utils.h>
 
 namespace AZ
@@ -63,11 +64,20 @@ namespace AZ
             void* object, const Uuid& typeId, const rapidjson::Value& value, bool isNewInstance, UseTypeDeserializer useCustom,
             JsonDeserializerContext& context);
 
+        //! Same as Load, but for when the class data for typeId has already been retrieved.
+        static JsonSerializationResult::ResultCode LoadWithClassData(void* object, const Uuid& typeId,
+            const SerializeContext::ClassData& classData, const rapidjson::Value& value, bool isNewInstance, UseTypeDeserializer useCustom,
+            JsonDeserializerContext& context);
+
         static JsonSerializationResult::ResultCode LoadToPointer(void* object, const Uuid& typeId, const rapidjson::Value& value,
             UseTypeDeserializer useCustom, JsonDeserializerContext& context);
 
         static JsonSerializationResult::ResultCode LoadWithClassElement(void* object, const rapidjson::Value& value,
             const SerializeContext::ClassElement& classElement, JsonDeserializerContext& context);
+
+        //! Loads a field using the precomputed information from a serialization plan.
+        static JsonSerializationResult::ResultCode LoadWithPlanField(void* object, const rapidjson::Value& value,
+            const JsonSerializationPlan::Field& field, JsonDeserializerContext& context);
         
         static JsonSerializationResult::ResultCode LoadClass(void* object, const SerializeContext::ClassData& classData, const rapidjson::Value& value,
             JsonDeserializerContext& context);
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Serialization/Json/JsonSerializationPlan.h>
+#include <AzCore/Serialization/Json/RegistrationContext.h>
+#include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+namespace AZ
+{
+    namespace JsonSerializationPlanInternal
+    {
+        // Adds fields in the same order as JsonDeserializer::FindElementByNameCrc searches them.
+        static void AddLoadFields(AZStd::vector<JsonSerializationPlan::Field>& fields, const SerializeContext& serializeContext,
+            const JsonRegistrationContext& registrationContext, const SerializeContext::ClassData& classData, size_t offset)
+        {
+            for (auto element = classData.m_elements.crbegin(); element != classData.m_elements.crend(); ++element)
+            {
+                JsonSerializationPlan::Field field;
+                field.m_element = &*element;
+                field.m_classData = serializeContext.FindClassData(element->m_typeId);
+                field.m_serializer = registrationContext.GetSerializerForType(element->m_typeId);
+                field.m_offset = offset + element->m_offset;
+                field.m_nameCrc = element->m_nameCrc;
+                fields.push_back(field);
+
+                if ((element->m_flags & SerializeContext::ClassElement::Flags::FLG_BASE_CLASS) && field.m_classData)
+                {
+                    AddLoadFields(fields, serializeContext, registrationContext, *field.m_classData, field.m_offset);
+                }
+            }
+        }
+
+        // Counts the elements the same way as JsonDeserializer::CountElements.
+        static size_t CountElements(const SerializeContext& serializeContext, const SerializeContext::ClassData& classData)
+        {
+            size_t count = 0;
+            for (const SerializeContext::ClassElement& element : classData.m_elements)
+            {
+                if (element.m_flags & SerializeContext::ClassElement::Flags::FLG_BASE_CLASS)
+                {
+                    if (const SerializeContext::ClassData* baseClassData = serializeContext.FindClassData(element.m_typeId))
+                    {
+                        count += CountElements(serializeContext, *baseClassData);
+                    }
+                }
+                else
+                {
+                    count++;
+                }
+            }
+            return count;
+        }
+    } // namespace JsonSerializationPlanInternal
+
+    const JsonSerializationPlan::Field* JsonSerializationPlan::FindLoadField(Crc32 nameCrc) const
+    {
+        for (const Field& field : m_loadFields)
+        {
+            if (field.m_nameCrc == nameCrc)
+            {
+                return &field;
+            }
+        }
+        return nullptr;
+    }
+
+    auto JsonSerializationPlanCache::GetPlan(const SerializeContext& serializeContext,
+        const JsonRegistrationContext& registrationContext, const SerializeContext::ClassData& classData) -> PlanPtr
+    {
+        if (!m_enabled.load(AZStd::memory_order_relaxed))
+        {
+            return nullptr;
+        }
+
+        u64 changeCount = serializeContext.GetClassDataChangeCount();
+        {
+            AZStd::shared_lock lock(m_mutex);
+            if (auto context = m_contexts.find(&serializeContext);
+                context != m_contexts.end() && context->second.m_classDataChangeCount == changeCount)
+            {
+                if (auto plan = context->second.m_plans.find(&classData); plan != context->second.m_plans.end())
+                {
+                    return plan->second;
+                }
+            }
+        }
+
+        // Build the plan outside the lock so other threads can continue to use existing plans.
+        PlanPtr plan = BuildPlan(serializeContext, registrationContext, classData);
+
+        AZStd::unique_lock lock(m_mutex);
+        ContextPlans& context = m_contexts[&serializeContext];
+        if (context.m_classDataChangeCount != changeCount)
+        {
+            // Class data has been added or removed since the plans were built, so they may be out of date or pointing to data
+            // that no longer exists.
+            context.m_plans.clear();
+            context.m_classDataChangeCount = changeCount;
+        }
+        // If another thread built the same plan in the meantime use that one.
+        return context.m_plans.try_emplace(&classData, AZStd::move(plan)).first->second;
+    }
+
+    void JsonSerializationPlanCache::Clear()
+    {
+        AZStd::unique_lock lock(m_mutex);
+        m_contexts.clear();
+    }
+
+    void JsonSerializationPlanCache::SetEnabled(bool enabled)
+    {
+        m_enabled = enabled;
+    }
+
+    bool JsonSerializationPlanCache::IsEnabled() const
+    {
+        return m_enabled;
+    }
+
+    auto JsonSerializationPlanCache::BuildPlan(const SerializeContext& serializeContext,
+        const JsonRegistrationContext& registrationContext, const SerializeContext::ClassData& classData) -> PlanPtr
+    {
+        using namespace JsonSerializationPlanInternal;
+
+        auto plan = AZStd::make_shared<JsonSerializationPlan>();
+
+        AddLoadFields(plan->m_loadFields, serializeContext, registrationContext, classData, 0);
+
+        plan->m_storeFields.reserve(classData.m_elements.size());
+        for (const SerializeContext::ClassElement& element : classData.m_elements)
+        {
+            JsonSerializationPlan::Field field;
+            field.m_element = &element;
+            field.m_classData = serializeContext.FindClassData(element.m_typeId);
+            // Storing looks up the serializer using the type in the class data rather than the type of the element.
+            field.m_serializer = field.m_classData ? registrationContext.GetSerializerForType(field.m_classData->m_typeId) : nullptr;
+            field.m_offset = element.m_offset;
+            field.m_nameCrc = element.m_nameCrc;
+            plan->m_storeFields.push_back(field);
+        }
+
+        plan->m_elementCount = CountElements(serializeContext, classData);
+        return plan;
+    }
+} // namespace AZ
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Crc.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+
+namespace AZ
+{
+    class BaseJsonSerializer;
+    class JsonRegistrationContext;
+
+    //! Precomputed information about a reflected class that allows the Json Serialization to load and store instances of the
+    //! class without looking up the class data and serializers of every field for every instance.
+    struct JsonSerializationPlan
+    {
+        AZ_CLASS_ALLOCATOR(JsonSerializationPlan, SystemAllocator, 0);
+
+        struct Field
+        {
+            const SerializeContext::ClassElement* m_element{ nullptr };
+            //! The class data for the type of the element or null if the type isn't reflected.
+            const SerializeContext::ClassData* m_classData{ nullptr };
+            //! The serializer registered for the type of the element, or null if there's none.
+            BaseJsonSerializer* m_serializer{ nullptr };
+            //! Offset of the field from the start of the object, including the offsets of any base classes.
+            size_t m_offset{ 0 };
+            Crc32 m_nameCrc;
+        };
+
+        //! Searches the load fields for a field with the provided name.
+        const Field* FindLoadField(Crc32 nameCrc) const;
+
+        //! All fields that can be loaded, including the fields of base classes, in the order they're searched for a name. Fields
+        //! of a derived class are listed before the fields of its base classes so they take precedence in case of name conflicts.
+        AZStd::vector<Field> m_loadFields;
+        //! The direct elements of the class in the order they're stored.
+        AZStd::vector<Field> m_storeFields;
+        //! The number of fields that are stored at the root of a json object, including those of base classes.
+        size_t m_elementCount{ 0 };
+    };
+
+    //! Cache for the serialization plans of classes. Plans are built the first time a class is loaded or stored and reused for
+    //! every following instance of that class. Plans can be retrieved from multiple threads at the same time.
+    //! Plans are automatically discarded when class data is added to or removed from the Serialize Context, but the owner of the cache
+    //! needs to call Clear if the registered serializers change.
+    class JsonSerializationPlanCache
+    {
+    public:
+        using PlanPtr = AZStd::shared_ptr<const JsonSerializationPlan>;
+
+        //! Gets the plan for the provided class data, building it if needed. Returns null if plans are disabled.
+        PlanPtr GetPlan(const SerializeContext& serializeContext, const JsonRegistrationContext& registrationContext,
+            const SerializeContext::ClassData& classData);
+
+        //! Removes all plans.
+        void Clear();
+
+        //! Enables or disables the use of plans. This is primarily intended for testing and measuring performance.
+        void SetEnabled(bool enabled);
+        bool IsEnabled() const;
+
+    private:
+        static PlanPtr BuildPlan(const SerializeContext& serializeContext, const JsonRegistrationContext& registrationContext,
+            const SerializeContext::ClassData& classData);
+
+        struct ContextPlans
+        {
+            AZStd::unordered_map<const SerializeContext::ClassData*, PlanPtr> m_plans;
+            u64 m_classDataChangeCount{ 0 };
+        };
+
+        AZStd::shared_mutex m_mutex;
+        AZStd::unordered_map<const SerializeContext*, ContextPlans> m_contexts;
+        AZStd::atomic_bool m_enabled{ true };
+    };
+} // namespace AZ
@@ -12,6 +12,7 @@
 #include <AzCore/Serialization/Json/JsonSerializer.h>
 #include <AzCore/Serialization/Json/BaseJsonSerializer.h>
 #include <AzCore/Serialization/Json/JsonSerialization.h>
+#include <AzCore/Serialization/Json/JsonSerializationPlan.h>
 #include <AzCore/Serialization/Json/RegistrationContext.h>
 #include <AzCore/Serialization/Json/StackedString.h>
 #include <AzCore/std/any.h>
@@ -94,15 +95,21 @@ namespace AZ
     JsonSerializationResult::ResultCode JsonSerializer::StoreWithClassData(rapidjson::Value& node, const void* object,
         const void* defaultObject, const SerializeContext::ClassData& classData, StoreTypeId storeTypeId,
         UseTypeSerializer custom, JsonSerializerContext& context)
+    {
+        BaseJsonSerializer* serializer = custom == UseTypeSerializer::Yes
+            ? context.GetRegistrationContext()->GetSerializerForType(classData.m_typeId) : nullptr;
+        return StoreWithClassDataAndSerializer(node, object, defaultObject, classData, storeTypeId, serializer, context);
+    }
+
+    JsonSerializationResult::ResultCode JsonSerializer::StoreWithClassDataAndSerializer(rapidjson::Value& node, const void* object,
+        const void* defaultObject, const SerializeContext::ClassData& classData, StoreTypeId storeTypeId,
+        BaseJsonSerializer* serializer, JsonSerializerContext& context)
     {
         using namespace JsonSerializationResult;
 
         // Start by setting the object to be an explicit default.
         node.SetObject();
 
-        auto serializer = custom == UseTypeSerializer::Yes
-            ? context.GetRegistrationContext()->GetSerializerForType(classData.m_typeId) : nullptr;
-
         if (serializer)
         {
             ResultCode result = serializer->Store(node, object, defaultObject, classData.m_typeId, context);
@@ -210,6 +217,16 @@ namespace AZ
             || elementClassData->m_typeId == GetAssetClassId(), "Type id mismatch in '%s' during serialization to a json file. (%s vs %s)",
             elementClassData->m_name, elementClassData->m_azRtti->GetTypeId().ToString<AZStd::string>().c_str(), elementClassData->m_typeId.ToString<AZStd::string>().c_str());
 
+        return StoreElementWithClassData(parentNode, object, defaultObject, classElement, *elementClassData,
+            context.GetRegistrationContext()->GetSerializerForType(elementClassData->m_typeId), context);
+    }
+
+    JsonSerializationResult::ResultCode JsonSerializer::StoreElementWithClassData(rapidjson::Value& parentNode, const void* object,
+        const void* defaultObject, const SerializeContext::ClassElement& classElement, const SerializeContext::ClassData& elementClassData,
+        BaseJsonSerializer* serializer, JsonSerializerContext& context)
+    {
+        using namespace JsonSerializationResult;
+
         if (classElement.m_flags & SerializeContext::ClassElement::FLG_NO_DEFAULT_VALUE)
         {
             defaultObject = nullptr;
@@ -219,14 +236,14 @@ namespace AZ
         {
             // Base class information can be reconstructed so doesn't need to be written to the final json. StoreClass
             // will simply pick up where this left off and write to the same element.
-            return StoreClass(parentNode, object, defaultObject, *elementClassData, context);
+            return StoreClass(parentNode, object, defaultObject, elementClassData, context);
         }
         else
         {
             rapidjson::Value value;
             ResultCode result = classElement.m_flags & SerializeContext::ClassElement::FLG_POINTER ?
-                StoreWithClassDataFromPointer(value, object, defaultObject, *elementClassData, UseTypeSerializer::Yes, context):
-                StoreWithClassData(value, object, defaultObject, *elementClassData, StoreTypeId::No, UseTypeSerializer::Yes, context);
+                StoreWithClassDataFromPointer(value, object, defaultObject, elementClassData, UseTypeSerializer::Yes, context):
+                StoreWithClassDataAndSerializer(value, object, defaultObject, elementClassData, StoreTypeId::No, serializer, context);
             if (result.GetProcessing() != Processing::Halted)
             {
                 if (parentNode.IsObject())
@@ -255,6 +272,31 @@ namespace AZ
         if (!classData.m_elements.empty())
         {
             ResultCode result(Tasks::WriteValue);
+            JsonSerializationPlanCache::PlanPtr plan = context.GetRegistrationContext()->GetSerializationPlanCache().GetPlan(
+                *context.GetSerializeContext(), *context.GetRegistrationContext(), classData);
+            if (plan)
+            {
+                for (const JsonSerializationPlan::Field& field : plan->m_storeFields)
+                {
+                    const void* elementPtr = reinterpret_cast<const uint8_t*>(object) + field.m_offset;
+                    const void* elementDefaultPtr = defaultObject ?
+                        (reinterpret_cast<const uint8_t*>(defaultObject) + field.m_offset) : nullptr;
+
+                    if (field.m_classData && field.m_classData->m_azRtti)
+                    {
+                        ScopedContextPath elementPath(context, field.m_element->m_name);
+                        result.Combine(StoreElementWithClassData(output, elementPtr, elementDefaultPtr, *field.m_element,
+                            *field.m_classData, field.m_serializer, context));
+                    }
+                    else
+                    {
+                        // Let the regular path report the missing information.
+                        result.Combine(StoreWithClassElement(output, elementPtr, elementDefaultPtr, *field.m_element, context));
+                    }
+                }
+                return result;
+            }
+
             for (const SerializeContext::ClassElement& element : classData.m_elements)
             {
                 const void* elementPtr = reinterpret_cast<const uint8_t*>(object) + element.m_offset;
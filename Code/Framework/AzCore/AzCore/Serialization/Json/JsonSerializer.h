@@ -14,6 +14,7 @@
 
 namespace AZ
 {
+    class BaseJsonSerializer;
     class JsonSerializerContext;
 
     class JsonSerializer final
@@ -55,6 +56,11 @@ namespace AZ
             const SerializeContext::ClassData& classData, StoreTypeId storeTypeId, UseTypeSerializer custom,
             JsonSerializerContext& context);
 
+        //! Same as StoreWithClassData, but with the serializer for the class already looked up. The serializer can be null.
+        static JsonSerializationResult::ResultCode StoreWithClassDataAndSerializer(rapidjson::Value& node, const void* object,
+            const void* defaultObject, const SerializeContext::ClassData& classData, StoreTypeId storeTypeId, BaseJsonSerializer* serializer,
+            JsonSerializerContext& context);
+
         static JsonSerializationResult::ResultCode StoreWithClassDataFromPointer(rapidjson::Value& output, const void* object,
             const void* defaultObject, const SerializeContext::ClassData& classData, UseTypeSerializer custom,
             JsonSerializerContext& context);
@@ -62,6 +68,12 @@ namespace AZ
         static JsonSerializationResult::ResultCode StoreWithClassElement(rapidjson::Value& parentNode, const void* object,
             const void* defaultObject, const SerializeContext::ClassElement& classElement, JsonSerializerContext& context);
 
+        //! Stores an element for which the class data and serializer have already been retrieved, either by StoreWithClassElement
+        //! or from a serialization plan. The caller is responsible for adding the name of the element to the path.
+        static JsonSerializationResult::ResultCode StoreElementWithClassData(rapidjson::Value& parentNode, const void* object,
+            const void* defaultObject, const SerializeContext::ClassElement& classElement, const SerializeContext::ClassData& elementClassData,
+            BaseJsonSerializer* serializer, JsonSerializerContext& context);
+
         static JsonSerializationResult::ResultCode StoreClass(rapidjson::Value& output, const void* object, const void* defaultObject,
             const SerializeContext::ClassData& classData, JsonSerializerContext& context);
 
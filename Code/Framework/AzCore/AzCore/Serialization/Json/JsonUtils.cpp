@@ -207,7 +207,10 @@ namespace AZ
         }
 
 
-        AZ::Outcome<rapidjson::Document, AZStd::string> ReadJsonString(AZStd::string_view jsonText)
+        // Parses the json text. If the text is known to be followed by a zero terminator it's parsed from a string stream, which
+        // allows rapidjson to use its SIMD code paths for skipping whitespace and scanning strings. Parsing with an explicit
+        // length goes through a memory stream which checks for the end of the buffer for every character.
+        AZ::Outcome<rapidjson::Document, AZStd::string> ParseJsonString(AZStd::string_view jsonText, bool isZeroTerminated)
         {
             if (jsonText.empty())
             {
@@ -215,7 +218,15 @@ namespace AZ
             }
 
             rapidjson::Document jsonDocument;
-            jsonDocument.Parse<rapidjson::kParseCommentsFlag>(jsonText.data(), jsonText.size());
+            if (isZeroTerminated)
+            {
+                AZ_Assert(jsonText.data()[jsonText.size()] == 0, "Json text was expected to be zero terminated.");
+                jsonDocument.Parse<rapidjson::kParseCommentsFlag>(jsonText.data());
+            }
+            else
+            {
+                jsonDocument.Parse<rapidjson::kParseCommentsFlag>(jsonText.data(), jsonText.size());
+            }
             if (jsonDocument.HasParseError())
             {
                 size_t lineNumber = 1;
@@ -236,6 +247,11 @@ namespace AZ
             }
         }
 
+        AZ::Outcome<rapidjson::Document, AZStd::string> ReadJsonString(AZStd::string_view jsonText)
+        {
+            return ParseJsonString(jsonText, false);
+        }
+
         AZ::Outcome<rapidjson::Document, AZStd::string> ReadJsonStream(IO::GenericStream& stream)
         {
             IO::SizeType length = stream.GetLength();
@@ -251,7 +267,7 @@ namespace AZ
 
             memoryBuffer.back() = 0;
 
-            return ReadJsonString(AZStd::string_view{memoryBuffer.data(), memoryBuffer.size()});
+            return ParseJsonString(AZStd::string_view{memoryBuffer.data(), memoryBuffer.size() - 1}, true);
         }
 
         AZ::Outcome<rapidjson::Document, AZStd::string> ReadJsonFile(AZStd::string_view filePath, size_t maxFileSize)
@@ -267,7 +283,7 @@ namespace AZ
 
             AZStd::string jsonContent = readResult.TakeValue();
 
-            auto result = ReadJsonString(jsonContent);
+            auto result = ParseJsonString(jsonContent, true);
             if (!result.IsSuccess())
             {
                 return AZ::Failure(AZStd::string::format("Failed to load '%.*s'. %s", AZ_STRING_ARG(filePath), result.GetError().c_str()));
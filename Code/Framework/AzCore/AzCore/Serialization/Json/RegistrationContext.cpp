@@ -32,6 +32,7 @@ namespace AZ
     JsonRegistrationContext::SerializerBuilder* JsonRegistrationContext::SerializerBuilder::HandlesTypeId(
         const Uuid& uuid, bool overwriteExisting)
     {
+        m_context->m_serializationPlanCache.Clear();
         if (!m_context->IsRemovingReflection())
         {
             auto serializer = m_serializerIter->second.get();
@@ -84,4 +85,9 @@ namespace AZ
         auto serializerIter = m_jsonSerializers.find(typeId);
         return serializerIter != m_jsonSerializers.end() ? serializerIter->second.get() : nullptr;
     }
+
+    JsonSerializationPlanCache& JsonRegistrationContext::GetSerializationPlanCache() const
+    {
+        return m_serializationPlanCache;
+    }
 } // namespace AZ
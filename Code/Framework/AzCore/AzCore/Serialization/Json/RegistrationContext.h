@@ -11,6 +11,7 @@
 #include <AzCore/RTTI/ReflectContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/Json/BaseJsonSerializer.h>
+#include <AzCore/Serialization/Json/JsonSerializationPlan.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/Math/Uuid.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
@@ -32,6 +33,8 @@ namespace AZ
         const HandledTypesMap& GetRegisteredSerializers() const;
         BaseJsonSerializer* GetSerializerForType(const Uuid& typeId) const;
         BaseJsonSerializer* GetSerializerForSerializerType(const Uuid& typeId) const;
+        //! Returns the cache with the serialization plans for the classes that are loaded and stored with this context.
+        JsonSerializationPlanCache& GetSerializationPlanCache() const;
         
         template <typename T>
         SerializerBuilder Serializer()
@@ -41,6 +44,7 @@ namespace AZ
             {
                 AZ_Assert(m_jsonSerializers.find(typeId) == m_jsonSerializers.end(), "Duplicate Serializer registered with typeid %s", typeId.ToString<AZStd::string>().c_str());
                 auto insertIter = m_jsonSerializers.emplace(typeId, aznew T);
+                m_serializationPlanCache.Clear();
                 return SerializerBuilder(this, insertIter.first);
             }
             else
@@ -48,6 +52,7 @@ namespace AZ
                 SerializerMap::const_iterator serializerIter = m_jsonSerializers.find(typeId);
                 AZ_Assert(serializerIter != m_jsonSerializers.end(), "Attempting to unregister a serializer that has not been registered yet with typeid %s", typeId.ToString<AZStd::string>().c_str());
                 m_jsonSerializers.erase(serializerIter);
+                m_serializationPlanCache.Clear();
                 return SerializerBuilder(this, m_jsonSerializers.end());
             }
         }
@@ -111,5 +116,7 @@ namespace AZ
     protected:
         SerializerMap m_jsonSerializers;
         HandledTypesMap m_handledTypesMap;
+        //! Plans store pointers to serializers so the cache is cleared whenever the registered serializers change.
+        mutable JsonSerializationPlanCache m_serializationPlanCache;
     };
 } // namespace AZ
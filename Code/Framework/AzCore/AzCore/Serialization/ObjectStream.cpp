@@ -104,6 +104,8 @@ namespace AZ
                 , m_pending(0)
                 , m_inStream(&m_buffer1)
                 , m_outStream(&m_buffer2)
+                , m_streamData(nullptr)
+                , m_borrowedValue(nullptr)
             {
                 // Assign default asset filter if none was provided by the user.
                 m_filterDesc = filterDesc;
@@ -122,6 +124,8 @@ namespace AZ
             bool ReadElement(SerializeContext& sc, const SerializeContext::ClassData*& cd, SerializeContext::DataElement& element, const SerializeContext::ClassData* parent, bool nextLevel, bool isTopElement);
             // used during load to skip the rest of the element including any subelements
             void SkipElement();
+            // returns true if the binary value of the element can be read directly from m_streamData by LoadClass
+            bool CanBorrowValue(const SerializeContext::ClassData* cd, const SerializeContext::DataElement& element) const;
 
             bool WriteClass(const void* classPtr, const Uuid& classId, const SerializeContext::ClassData* classData) override;
             bool WriteElement(const void* elemPtr, const SerializeContext::ClassData* classData, const SerializeContext::ClassElement* classElement);
@@ -221,6 +225,12 @@ namespace AZ
             IO::ByteContainerStream<AZStd::vector<char> > m_inStream;
             IO::ByteContainerStream<AZStd::vector<char> > m_outStream;
 
+            // Start of the data of m_stream if the entire stream is available in memory. Binary values of leaf elements are
+            // read directly from this memory instead of being copied into m_inStream first.
+            const char*                         m_streamData;
+            // The value of the element last read by ReadElement if it was borrowed from m_streamData, otherwise null.
+            const char*                         m_borrowedValue;
+
             // other state info
             // keep tracks of the number of WriteElements that have
             // completed successfully to make sure the equivalent amount
@@ -390,6 +400,7 @@ namespace AZ
             {
                 // reset the class info
                 const SerializeContext::ClassData* classData = nullptr;
+                const char* borrowedValue = nullptr;
 
                 bool isConvertedData = false;
                 // read from the converted list (if we have something)
@@ -422,6 +433,7 @@ namespace AZ
                         // we have reached the end of this branch, so exit the loop
                         break;
                     }
+                    borrowedValue = m_borrowedValue;
                     nextLevel = false;
                 }
 
@@ -789,9 +801,11 @@ namespace AZ
                 {
                     AZ_PROFILE_SCOPE(AzCore, "ObjectStreamImpl::LoadClass Load");
 
-                    // Wrap the stream
+                    // Wrap the stream, either around the value in the source stream or the copy in m_inStream.
                     IO::GenericStream* currentStream = &m_inStream;
-                    IO::MemoryStream memStream(m_inStream.GetData()->data(), 0, element.m_dataSize);
+                    IO::MemoryStream memStream = borrowedValue
+                        ? IO::MemoryStream(borrowedValue, element.m_dataSize)
+                        : IO::MemoryStream(m_inStream.GetData()->data(), 0, element.m_dataSize);
                     currentStream = &memStream;
 
                     if (element.m_byteStream.GetLength() > 0)
@@ -1275,6 +1289,8 @@ namespace AZ
             }
             else /*ST_BINARY*/
             {
+                m_borrowedValue = nullptr;
+
                 if (m_stream->GetCurPos() == m_stream->GetLength())
                 {
                     // Reached the end of the stream. We may reach this state if we just skipped the root element
@@ -1400,7 +1416,13 @@ namespace AZ
 
                     element.m_dataSize = valueBytes;
                     element.m_stream->Seek(0, IO::GenericStream::ST_SEEK_BEGIN);
-                    if (element.m_dataSize)
+                    if (element.m_dataSize && CanBorrowValue(cd, element))
+                    {
+                        // Skip over the value and let LoadClass read it in place.
+                        m_borrowedValue = m_streamData + m_stream->GetCurPos();
+                        m_stream->Seek(valueBytes, IO::GenericStream::ST_SEEK_CUR);
+                    }
+                    else if (element.m_dataSize)
                     {
                         // Directly copy data from m_stream into element.m_stream
                         [[maybe_unused]] IO::SizeType bytesWritten = element.m_stream->WriteFromStream(valueBytes, m_stream);
@@ -1415,6 +1437,22 @@ namespace AZ
             return true;
         }
 
+        //=========================================================================
+        // CanBorrowValue
+        //=========================================================================
+        bool ObjectStreamImpl::CanBorrowValue(const SerializeContext::ClassData* cd, const SerializeContext::DataElement& element) const
+        {
+            // Only values that are passed straight to a serializer can be borrowed. Values for version conversion, deprecated
+            // classes and elements that are read into their own byte stream need to be copied, because they're accessed through
+            // the element's stream. Assets are loaded from the element's stream as well.
+            if (!m_streamData || element.m_stream != &m_inStream || !cd || !cd->m_serializer || cd->IsDeprecated() ||
+                element.m_id == GetAssetClassId() || cd->m_typeId == GetAssetClassId())
+            {
+                return false;
+            }
+            return m_stream->GetCurPos() + element.m_dataSize <= m_stream->GetLength();
+        }
+
         //=========================================================================
         // SkipElement
         // [1/19/2013]
@@ -1989,6 +2027,8 @@ namespace AZ
                         AZStd::endian_swap(version);
                         m_version = version;
 
+                        m_streamData = reinterpret_cast<const char*>(m_stream->GetContiguousData());
+
                         if (m_version <= s_objectStreamVersion)
                         {
                             result = LoadClass(m_inStream, convertedClassElement, nullptr, nullptr, m_flags) && result;
@@ -566,6 +566,7 @@ namespace AZ
     //=========================================================================
     void SerializeContext::ClassDeprecate(const char* name, const AZ::Uuid& typeUuid, VersionConverter converter)
     {
+        ++m_classDataChangeCount;
         if (IsRemovingReflection())
         {
             m_uuidMap.erase(typeUuid);
@@ -734,6 +735,7 @@ namespace AZ
             if (scGenericInfoFoundIt == scGenericClassInfoRange.second)
             {
                 m_uuidGenericMap.emplace(classId, genericClassInfo);
+                ++m_classDataChangeCount;
                 m_uuidAnyCreationMap.emplace(classId, createAnyFunc);
                 m_classNameToUuid.emplace(genericClassInfo->GetClassData()->m_name, classId);
                 m_legacySpecializeTypeIdToTypeIdMap.emplace(genericClassInfo->GetLegacySpecializedTypeId(), classId);
@@ -2795,8 +2797,14 @@ namespace AZ
     //=========================================================================
     // RemoveClassData
     //=========================================================================
+    u64 SerializeContext::GetClassDataChangeCount() const
+    {
+        return m_classDataChangeCount;
+    }
+
     void SerializeContext::RemoveClassData(ClassData* classData)
     {
+        ++m_classDataChangeCount;
         if (m_editContext)
         {
             m_editContext->RemoveClassData(classData);
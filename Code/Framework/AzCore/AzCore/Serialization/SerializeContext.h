@@ -1099,6 +1099,10 @@ namespace AZ
         */
         const TypeId& GetUnderlyingTypeId(const TypeId& enumTypeId) const;
 
+        /// Returns a number that changes every time class data is added to or removed from this context. This can be used
+        /// to detect if information derived from reflected class data is out of date.
+        u64 GetClassDataChangeCount() const;
+
     private:
 
         /// Enumerate function called to enumerate an azrtti hierarchy
@@ -1341,6 +1345,7 @@ namespace AZ
         AZStd::unordered_map<Uuid, CreateAnyFunc>  m_uuidAnyCreationMap;      ///< Uuid to Any creation function map
         AZStd::unordered_map<TypeId, TypeId> m_enumTypeIdToUnderlyingTypeIdMap; ///< Uuid to keep track of the correspond underlying type id for an enum type that is reflected as a Field within the SerializeContext
         AZStd::vector<AZStd::unique_ptr<IDataContainer>> m_dataContainers; ///< Takes care of all related IDataContainer's lifetimes
+        AZStd::atomic<u64> m_classDataChangeCount{ 0 }; ///< Incremented every time class data is added or removed
 
         class PerModuleGenericClassInfo;
         AZStd::unordered_set<PerModuleGenericClassInfo*>  m_perModuleSet; ///< Stores the static PerModuleGenericClass structures keeps track of reflected GenericClassInfo per module
@@ -1923,6 +1928,7 @@ namespace AZ
             UuidToClassMap::pair_iter_bool result = m_uuidMap.insert(AZStd::make_pair(typeUuid, ClassData::Create<T>(name, typeUuid, factory)));
             AZ_Assert(result.second, "This class type %s could not be registered with duplicated Uuid: %s.", name, typeUuid.ToString<AZStd::string>().c_str());
             m_uuidAnyCreationMap.emplace(SerializeTypeInfo<T>::GetUuid(), &AnyTypeInfoConcept<T>::CreateAny);
+            ++m_classDataChangeCount;
 
             AddClassData<T, TBaseClasses...>(&result.first->second);
 
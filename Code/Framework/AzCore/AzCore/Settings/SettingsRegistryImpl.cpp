@@ -17,9 +17,12 @@
 #include <AzCore/Serialization/Json/JsonSerialization.h>
 #include <AzCore/Serialization/Json/StackedString.h>
 #include <AzCore/Settings/SettingsRegistryImpl.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
 #include <AzCore/std/containers/variant.h>
 #include <AzCore/std/sort.h>
 #include <AzCore/std/parallel/scoped_lock.h>
+#include <AzCore/std/parallel/thread.h>
 
 namespace AZ::SettingsRegistryImplInternal
 {
@@ -51,6 +54,12 @@ namespace AZ::SettingsRegistryImplInternal
 
 namespace AZ
 {
+    namespace
+    {
+        // Minimum number of files each thread of the temporary executor that loads files before the task graph is active gets.
+        constexpr size_t BootstrapLoadFilesPerWorker = 4;
+    }
+
     template<typename T>
     bool SettingsRegistryImpl::SetValueInternal(AZStd::string_view path, T value)
     {
@@ -758,12 +767,9 @@ namespace AZ
             return false;
         }
 
-
-        AZStd::vector<char> buffer;
-        if (!scratchBuffer)
-        {
-            scratchBuffer = &buffer;
-        }
+        // Every file in the folder is loaded into its own buffer so the files can be parsed in parallel, which means the
+        // scratch buffer isn't needed.
+        AZ_UNUSED(scratchBuffer);
 
         Pointer pointer(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/-");
 
@@ -785,7 +791,6 @@ namespace AZ
         }
 
         RegistryFileList fileList;
-        scratchBuffer->clear();
 
         AZ::IO::FixedMaxPath folderPath{ path };
 
@@ -799,9 +804,14 @@ namespace AZ
             AZStd::string_view name = specializations.GetSpecialization(i);
             specialzationArray.PushBack(Value(name.data(), aznumeric_caster(name.length()), m_settings.GetAllocator()), m_settings.GetAllocator());
         }
-        pointer.Create(m_settings, m_settings.GetAllocator()).SetObject()
+        Value& historyEntry = pointer.Create(m_settings, m_settings.GetAllocator()).SetObject()
             .AddMember(StringRef("Folder"), Value(folderPath.c_str(), aznumeric_caster(folderPath.Native().size()), m_settings.GetAllocator()), m_settings.GetAllocator())
             .AddMember(StringRef("Specializations"), AZStd::move(specialzationArray), m_settings.GetAllocator());
+        if (!platform.empty())
+        {
+            // Recorded so the platform folder can be tracked as an input for snapshots.
+            historyEntry.AddMember(StringRef("Platform"), Value(platform.data(), aznumeric_caster(platform.size()), m_settings.GetAllocator()), m_settings.GetAllocator());
+        }
 
 
         auto CreateSettingsFindCallback = [this, &fileList, &specializations, &pointer, &folderPath](bool isPlatformFile)
@@ -888,7 +898,12 @@ namespace AZ
                 return false;
             }
 
-            // Load the registry files in the sorted order.
+            // Read and parse all files up front so this can be done in parallel, after which the files are merged in the
+            // sorted order to keep the results deterministic.
+            AZStd::vector<AZStd::unique_ptr<LoadedSettingsFile>> loadedFiles;
+            AZStd::vector<LoadedSettingsFile*> filesToLoad;
+            loadedFiles.reserve(fileList.size());
+            filesToLoad.reserve(fileList.size());
             for (RegistryFile& registryFile : fileList)
             {
                 folderPath.Native().erase(platformKeyOffset); // Erase all characters after the platformKeyOffset
@@ -899,16 +914,15 @@ namespace AZ
                 }
 
                 folderPath /= registryFile.m_relativePath;
+                auto& loadedFile = loadedFiles.emplace_back(AZStd::make_unique<LoadedSettingsFile>());
+                loadedFile->m_path = folderPath;
+                filesToLoad.push_back(loadedFile.get());
+            }
+            LoadSettingsFiles(filesToLoad);
 
-                if (!registryFile.m_isPatch)
-                {
-                    MergeSettingsFileInternal(folderPath.c_str(), Format::JsonMergePatch, rootKey, *scratchBuffer);
-                }
-                else
-                {
-                    MergeSettingsFileInternal(folderPath.c_str(), Format::JsonPatch, rootKey, *scratchBuffer);
-                }
-                scratchBuffer->clear();
+            for (size_t i = 0; i < fileList.size(); ++i)
+            {
+                MergeLoadedSettingsFile(*loadedFiles[i], fileList[i].m_isPatch ? Format::JsonPatch : Format::JsonMergePatch, rootKey);
             }
         }
         return true;
@@ -1173,49 +1187,142 @@ namespace AZ
 
     bool SettingsRegistryImpl::MergeSettingsFileInternal(const char* path, Format format, AZStd::string_view rootKey,
         AZStd::vector<char>& scratchBuffer)
+    {
+        LoadedSettingsFile file;
+        file.m_path = path;
+        // Borrow the scratch buffer so its memory can be reused by the caller for the next file.
+        file.m_buffer.swap(scratchBuffer);
+        LoadSettingsFile(file);
+        bool result = MergeLoadedSettingsFile(file, format, rootKey);
+        file.m_buffer.swap(scratchBuffer);
+        return result;
+    }
+
+    void SettingsRegistryImpl::LoadSettingsFile(LoadedSettingsFile& file) const
+    {
+        // This function doesn't touch the settings, so it can be called for multiple files at the same time.
+        AZ::IO::FileReader fileReader(m_useFileIo ? AZ::IO::FileIOBase::GetInstance() : nullptr, file.m_path.c_str());
+        if (!fileReader.IsOpen())
+        {
+            file.m_status = LoadStatus::OpenFailed;
+            return;
+        }
+
+        u64 fileSize = fileReader.Length();
+        if (fileSize == 0)
+        {
+            file.m_status = LoadStatus::EmptyFile;
+            return;
+        }
+
+        file.m_buffer.clear();
+        file.m_buffer.resize_no_construct(fileSize + 1);
+        if (fileReader.Read(fileSize, file.m_buffer.data()) != fileSize)
+        {
+            file.m_status = LoadStatus::ReadFailed;
+            return;
+        }
+        file.m_buffer[fileSize] = 0;
+
+        constexpr int flags = rapidjson::kParseStopWhenDoneFlag | rapidjson::kParseCommentsFlag | rapidjson::kParseTrailingCommasFlag;
+        file.m_document.ParseInsitu<flags>(file.m_buffer.data());
+        file.m_status = file.m_document.HasParseError() ? LoadStatus::ParseFailed : LoadStatus::Success;
+    }
+
+    void SettingsRegistryImpl::LoadSettingsFiles(AZStd::vector<LoadedSettingsFile*>& files) const
+    {
+        // Reading and parsing is independent for every file so spread it over the task workers if they're available. This can't
+        // be done from a task worker as the results need to be waited on.
+        AZ::TaskGraph graph;
+        auto addLoadTasks = [this, &files, &graph]()
+        {
+            AZ::TaskDescriptor descriptor{ "AZ::SettingsRegistryImpl::LoadSettingsFiles", "Settings Registry" };
+            descriptor.grainSize = 1;
+            graph.AddParallelFor(descriptor, 0, files.size(), [this, &files](size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    LoadSettingsFile(*files[i]);
+                }
+            });
+        };
+
+        auto taskGraphActive = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        if (files.size() > 1 && taskGraphActive != nullptr && taskGraphActive->IsTaskGraphActive() &&
+            !AZ::TaskExecutor::Instance().IsTaskWorkerThread())
+        {
+            addLoadTasks();
+            AZ::TaskGraphEvent finished;
+            graph.Submit(&finished);
+            finished.Wait();
+        }
+        else if (files.size() >= BootstrapLoadFilesPerWorker * 2 && !AZ::TaskExecutor::HasInstance())
+        {
+            // The task executor is only created once the TaskGraphSystemComponent is activated, which is after the settings
+            // registry has been merged during application startup. Folders with enough files to make up for starting the
+            // threads are loaded on a temporary executor instead, so the startup merge is parallel as well.
+            const uint32_t workerCount = aznumeric_cast<uint32_t>(AZStd::min<size_t>(
+                AZStd::max(1u, AZStd::thread::hardware_concurrency()), files.size() / BootstrapLoadFilesPerWorker));
+            AZ::TaskExecutor bootstrapExecutor(workerCount);
+            addLoadTasks();
+            AZ::TaskGraphEvent finished;
+            graph.SubmitOnExecutor(bootstrapExecutor, &finished);
+            finished.Wait();
+        }
+        else
+        {
+            for (LoadedSettingsFile* file : files)
+            {
+                LoadSettingsFile(*file);
+            }
+        }
+    }
+
+    bool SettingsRegistryImpl::MergeLoadedSettingsFile(const LoadedSettingsFile& file, Format format, AZStd::string_view rootKey)
     {
         using namespace AZ::IO;
         using namespace rapidjson;
 
         Pointer pointer(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/-");
+        const char* path = file.m_path.c_str();
+        const rapidjson::Document& jsonPatch = file.m_document;
 
-        FileReader fileReader(m_useFileIo ? AZ::IO::FileIOBase::GetInstance(): nullptr, path);
-        if (!fileReader.IsOpen())
+        switch (file.m_status)
+        {
+        case LoadStatus::Success:
+            break;
+        case LoadStatus::Pending:
+            AZ_Assert(false, R"(Registry file "%s" is being merged before it was loaded.)", path);
+            return false;
+        case LoadStatus::OpenFailed:
         {
             AZ_Error("Settings Registry", false, R"(Unable to open registry file "%s".)", path);
+            AZStd::scoped_lock lock(m_settingMutex);
             pointer.Create(m_settings, m_settings.GetAllocator()).SetObject()
                 .AddMember(StringRef("Error"), StringRef("Unable to open registry file."), m_settings.GetAllocator())
                 .AddMember(StringRef("Path"), Value(path, m_settings.GetAllocator()), m_settings.GetAllocator());
             return false;
         }
-
-        u64 fileSize = fileReader.Length();
-        if (fileSize == 0)
+        case LoadStatus::EmptyFile:
         {
             AZ_Warning("Settings Registry", false, R"(Registry file "%s" is 0 bytes in length. There is no nothing to merge)", path);
+            AZStd::scoped_lock lock(m_settingMutex);
             pointer.Create(m_settings, m_settings.GetAllocator())
                 .SetObject()
                 .AddMember(StringRef("Error"), StringRef("registry file is 0 bytes."), m_settings.GetAllocator())
                 .AddMember(StringRef("Path"), Value(path, m_settings.GetAllocator()), m_settings.GetAllocator());
             return false;
         }
-
-        scratchBuffer.clear();
-        scratchBuffer.resize_no_construct(fileSize + 1);
-        if (fileReader.Read(fileSize, scratchBuffer.data()) != fileSize)
+        case LoadStatus::ReadFailed:
         {
             AZ_Error("Settings Registry", false, R"(Unable to read registry file "%s".)", path);
+            AZStd::scoped_lock lock(m_settingMutex);
             pointer.Create(m_settings, m_settings.GetAllocator()).SetObject()
                 .AddMember(StringRef("Error"), StringRef("Unable to read registry file."), m_settings.GetAllocator())
                 .AddMember(StringRef("Path"), Value(path, m_settings.GetAllocator()), m_settings.GetAllocator());
             return false;
         }
-        scratchBuffer[fileSize] = 0;
-
-        rapidjson::Document jsonPatch;
-        constexpr int flags = rapidjson::kParseStopWhenDoneFlag | rapidjson::kParseCommentsFlag | rapidjson::kParseTrailingCommasFlag;
-        jsonPatch.ParseInsitu<flags>(scratchBuffer.data());
-        if (jsonPatch.HasParseError())
+        case LoadStatus::ParseFailed:
         {
             auto nativeUI = AZ::Interface<NativeUI::NativeUIRequests>::Get();
             if (jsonPatch.GetParseError() == rapidjson::kParseErrorDocumentEmpty)
@@ -1244,6 +1351,10 @@ namespace AZ
                 .AddMember(StringRef("Offset"), aznumeric_cast<uint64_t>(jsonPatch.GetErrorOffset()), m_settings.GetAllocator());
             return false;
         }
+        default:
+            AZ_Assert(false, "Unsupported load status for settings registry file '%s'.", path);
+            return false;
+        }
 
         JsonMergeApproach mergeApproach;
         switch (format)
@@ -1340,4 +1451,92 @@ namespace AZ
     {
         m_useFileIo = useFileIo;
     }
+
+    u64 SettingsRegistryImpl::CalculateHash() const
+    {
+        AZStd::scoped_lock lock(m_settingMutex);
+        return SettingsRegistrySnapshot::CalculateValueHash(m_settings);
+    }
+
+    bool SettingsRegistryImpl::WriteSnapshot(AZStd::string_view filePath, u64 contextKey) const
+    {
+        using namespace AZ::IO;
+
+        if (filePath.empty() || filePath.size() > AZ::IO::MaxPathLength)
+        {
+            AZ_Error("Settings Registry", false, "Invalid path provided for the Settings Registry snapshot.");
+            return false;
+        }
+
+        SettingsRegistrySnapshot::Buffer snapshot;
+        {
+            AZStd::scoped_lock lock(m_settingMutex);
+            SettingsRegistrySnapshot::InputList inputs;
+            SettingsRegistrySnapshot::CollectInputs(inputs, m_settings, AZ_SETTINGS_REGISTRY_HISTORY_KEY);
+            SettingsRegistrySnapshot::Write(snapshot, m_settings, contextKey, inputs);
+        }
+
+        // Write to a temporary file first so another process never picks up a partially written snapshot.
+        AZ::IO::FixedMaxPath snapshotPath{ filePath };
+        AZ::IO::FixedMaxPath tempPath{ snapshotPath };
+        tempPath.Native() += ".tmp";
+        SystemFile file;
+        if (!file.Open(tempPath.c_str(), SystemFile::SF_OPEN_CREATE | SystemFile::SF_OPEN_CREATE_PATH | SystemFile::SF_OPEN_WRITE_ONLY))
+        {
+            AZ_Warning("Settings Registry", false, R"(Unable to open "%s" to write the Settings Registry snapshot.)", tempPath.c_str());
+            return false;
+        }
+        bool result = file.Write(snapshot.data(), snapshot.size()) == snapshot.size();
+        file.Close();
+
+        result = result && SystemFile::Rename(tempPath.c_str(), snapshotPath.c_str(), true);
+        if (!result)
+        {
+            AZ_Warning("Settings Registry", false, R"(Unable to write the Settings Registry snapshot to "%s".)", snapshotPath.c_str());
+            SystemFile::Delete(tempPath.c_str());
+        }
+        return result;
+    }
+
+    bool SettingsRegistryImpl::LoadSnapshot(AZStd::string_view filePath, u64 contextKey)
+    {
+        using namespace AZ::IO;
+
+        if (filePath.empty() || filePath.size() > AZ::IO::MaxPathLength)
+        {
+            return false;
+        }
+
+        AZ::IO::FixedMaxPath snapshotPath{ filePath };
+        FileReader fileReader(m_useFileIo ? AZ::IO::FileIOBase::GetInstance() : nullptr, snapshotPath.c_str());
+        if (!fileReader.IsOpen())
+        {
+            return false;
+        }
+
+        SettingsRegistrySnapshot::Buffer snapshot;
+        u64 fileSize = fileReader.Length();
+        snapshot.resize_no_construct(fileSize);
+        if (fileReader.Read(fileSize, snapshot.data()) != fileSize || !SettingsRegistrySnapshot::IsValid(snapshot, contextKey))
+        {
+            return false;
+        }
+
+        rapidjson::Document settings;
+        if (!SettingsRegistrySnapshot::Read(settings, snapshot))
+        {
+            AZ_Warning("Settings Registry", false, R"(Settings Registry snapshot "%s" is corrupted and will be ignored.)", snapshotPath.c_str());
+            return false;
+        }
+
+        {
+            AZStd::scoped_lock lock(m_settingMutex);
+            m_settings.Swap(settings);
+            // The strings in the settings refer to the snapshot so it needs to be kept alive. The previous snapshot is released
+            // together with the previous settings.
+            m_snapshot.swap(snapshot);
+        }
+        SignalNotifier("", Type::Object);
+        return true;
+    }
 } // namespace AZ
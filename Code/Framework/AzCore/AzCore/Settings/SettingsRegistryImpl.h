@@ -10,13 +10,15 @@
 
 #include <AzCore/JSON/document.h>
 #include <AzCore/JSON/pointer.h>
-#include <AzCore/IO/Path/Path_fwd.h>
+#include <AzCore/IO/Path/Path.h>
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/Serialization/Json/JsonSerialization.h>
 #include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/Settings/SettingsRegistrySnapshot.h>
 #include <AzCore/std/containers/fixed_vector.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 
 // Using a define instead of a static string to avoid the need for temporary buffers to composite the full paths.
 #define AZ_SETTINGS_REGISTRY_HISTORY_KEY "/Amazon/AzCore/Runtime/Registry/FileHistory"
@@ -89,6 +91,16 @@ namespace AZ
 
         void SetUseFileIO(bool useFileIo) override;
 
+        //! Calculates a hash of all the settings currently in the registry. This can be used to create the context key for a
+        //! snapshot before any files are merged.
+        u64 CalculateHash() const;
+        //! Writes a binary snapshot of the settings to the provided file. See SettingsRegistrySnapshot.h for details.
+        bool WriteSnapshot(AZStd::string_view filePath, u64 contextKey) const;
+        //! Replaces all settings with the ones stored in a snapshot if the snapshot was created with the same context key and
+        //! none of the settings files it was created from have changed.
+        //! @return True if the snapshot was loaded, false if the snapshot doesn't exist or is out of date.
+        bool LoadSnapshot(AZStd::string_view filePath, u64 contextKey);
+
     private:
         using TagList = AZStd::fixed_vector<size_t, Specializations::MaxCount + 1>;
         struct RegistryFile
@@ -113,6 +125,29 @@ namespace AZ
         bool ExtractFileDescription(RegistryFile& output, AZStd::string_view filename, const Specializations& specializations);
         bool MergeSettingsFileInternal(const char* path, Format format, AZStd::string_view rootKey, AZStd::vector<char>& scratchBuffer);
 
+        enum class LoadStatus
+        {
+            Pending,
+            Success,
+            OpenFailed,
+            EmptyFile,
+            ReadFailed,
+            ParseFailed
+        };
+        //! A settings file that has been read and parsed, but not merged yet. Loading doesn't touch the settings so multiple files
+        //! can be loaded in parallel. Any errors are reported when the file is merged so they're reported in a deterministic order.
+        struct LoadedSettingsFile
+        {
+            AZ::IO::FixedMaxPath m_path;
+            AZStd::vector<char> m_buffer; //!< The file is parsed in place so this holds the strings in m_document.
+            rapidjson::Document m_document;
+            LoadStatus m_status{ LoadStatus::Pending };
+        };
+
+        void LoadSettingsFile(LoadedSettingsFile& file) const;
+        void LoadSettingsFiles(AZStd::vector<LoadedSettingsFile*>& files) const;
+        bool MergeLoadedSettingsFile(const LoadedSettingsFile& file, Format format, AZStd::string_view rootKey);
+
         void SignalNotifier(AZStd::string_view jsonPath, Type type);
         
         mutable AZStd::recursive_mutex m_settingMutex;
@@ -135,6 +170,8 @@ namespace AZ
         AZStd::atomic_int m_signalCount{};
 
         rapidjson::Document m_settings;
+        //! Memory of the last loaded snapshot. Strings in m_settings may point directly into this buffer.
+        SettingsRegistrySnapshot::Buffer m_snapshot;
         JsonSerializerSettings m_serializationSettings;
         JsonDeserializerSettings m_deserializationSettings;
         JsonApplyPatchSettings m_applyPatchSettings;
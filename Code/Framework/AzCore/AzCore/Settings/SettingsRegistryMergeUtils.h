@@ -23,6 +23,10 @@ namespace AZ::SettingsRegistryMergeUtils
     inline static constexpr char OrganizationRootKey[] = "/Amazon";
     inline static constexpr char BuildTargetNameKey[] = "/Amazon/AzCore/Settings/BuildTargetName";
     inline static constexpr char SpecializationsRootKey[] = "/Amazon/AzCore/Settings/Specializations";
+    //! Path to a binary snapshot of the merged Settings Registry. If set, the ComponentApplication loads the settings from the
+    //! snapshot instead of merging all settings files, as long as none of those files have changed since the snapshot was written.
+    //! This needs to be set before the settings files are merged, for instance on the command line or in the o3de user registry.
+    inline static constexpr char SnapshotPathKey[] = "/Amazon/AzCore/Settings/RegistrySnapshotPath";
     inline static constexpr char BootstrapSettingsRootKey[] = "/Amazon/AzCore/Bootstrap";
     inline static constexpr char GemListRootKey[] = "/Amazon/AzCore/Gems";
     inline static constexpr char FilePathsRootKey[] = "/Amazon/AzCore/Runtime/FilePaths";
@@ -0,0 +1,469 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/JSON/pointer.h>
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/Settings/SettingsRegistrySnapshot.h>
+#include <AzCore/std/hash.h>
+#include <AzCore/std/string/string_view.h>
+
+namespace AZ::SettingsRegistrySnapshot
+{
+    namespace Internal
+    {
+        static constexpr u32 Magic = 0x5352534f; // "OSRS" when stored in little endian.
+
+        struct Header
+        {
+            u32 m_magic;
+            u32 m_version;
+            u64 m_contextKey;
+            u64 m_inputKey;
+            u64 m_size; //!< Total size of the snapshot, used to detect truncated files.
+            u64 m_inputsOffset;
+            u64 m_valuesOffset;
+            u64 m_stringsOffset;
+            u32 m_inputCount;
+            u32 m_valueCount;
+        };
+
+        struct StoredInput
+        {
+            u64 m_pathOffset;
+            u32 m_pathLength;
+            u32 m_isFolder;
+        };
+
+        enum class ValueType : u32
+        {
+            Null,
+            False,
+            True,
+            Object, //!< m_count is the number of members, which directly follow as pairs of a string and a value.
+            Array, //!< m_count is the number of elements, which directly follow.
+            String, //!< m_count is the length, m_data is the offset into the string table.
+            Int64,
+            Uint64,
+            Double
+        };
+
+        //! Values are stored depth-first so the document can be rebuilt with a single linear pass.
+        struct StoredValue
+        {
+            ValueType m_type;
+            u32 m_count;
+            u64 m_data;
+        };
+
+        using ValueList = AZStd::vector<StoredValue, AZ::OSStdAllocator>;
+
+        static u64 StoreString(Buffer& strings, const char* text, size_t length)
+        {
+            u64 offset = strings.size();
+            strings.insert(strings.end(), text, text + length);
+            strings.push_back(0);
+            return offset;
+        }
+
+        static void StoreValue(ValueList& values, Buffer& strings, const rapidjson::Value& value)
+        {
+            switch (value.GetType())
+            {
+            case rapidjson::kNullType:
+                values.push_back(StoredValue{ ValueType::Null, 0, 0 });
+                break;
+            case rapidjson::kFalseType:
+                values.push_back(StoredValue{ ValueType::False, 0, 0 });
+                break;
+            case rapidjson::kTrueType:
+                values.push_back(StoredValue{ ValueType::True, 0, 0 });
+                break;
+            case rapidjson::kObjectType:
+                values.push_back(StoredValue{ ValueType::Object, value.MemberCount(), 0 });
+                for (const auto& member : value.GetObject())
+                {
+                    StoreValue(values, strings, member.name);
+                    StoreValue(values, strings, member.value);
+                }
+                break;
+            case rapidjson::kArrayType:
+                values.push_back(StoredValue{ ValueType::Array, value.Size(), 0 });
+                for (const rapidjson::Value& element : value.GetArray())
+                {
+                    StoreValue(values, strings, element);
+                }
+                break;
+            case rapidjson::kStringType:
+                values.push_back(StoredValue{ ValueType::String, value.GetStringLength(),
+                    StoreString(strings, value.GetString(), value.GetStringLength()) });
+                break;
+            case rapidjson::kNumberType:
+            {
+                StoredValue stored{ ValueType::Double, 0, 0 };
+                if (value.IsDouble())
+                {
+                    double number = value.GetDouble();
+                    memcpy(&stored.m_data, &number, sizeof(number));
+                }
+                else if (value.IsUint64())
+                {
+                    stored.m_type = ValueType::Uint64;
+                    stored.m_data = value.GetUint64();
+                }
+                else
+                {
+                    stored.m_type = ValueType::Int64;
+                    s64 number = value.GetInt64();
+                    memcpy(&stored.m_data, &number, sizeof(number));
+                }
+                values.push_back(stored);
+                break;
+            }
+            default:
+                AZ_Assert(false, "Unsupported json type %i found while creating a Settings Registry snapshot.", value.GetType());
+                values.push_back(StoredValue{ ValueType::Null, 0, 0 });
+                break;
+            }
+        }
+
+        template<typename T>
+        static bool Load(T& result, const Buffer& snapshot, u64 offset)
+        {
+            if (offset > snapshot.size() || snapshot.size() - offset < sizeof(T))
+            {
+                return false;
+            }
+            // Copy instead of casting as the snapshot memory isn't guaranteed to be aligned.
+            memcpy(&result, snapshot.data() + offset, sizeof(T));
+            return true;
+        }
+
+        static bool LoadHeader(Header& header, const Buffer& snapshot)
+        {
+            return Load(header, snapshot, 0) && header.m_magic == Magic && header.m_version == Version && header.m_size == snapshot.size();
+        }
+
+        static const char* GetString(const Buffer& snapshot, const Header& header, u64 offset, u64 length)
+        {
+            u64 start = header.m_stringsOffset + offset;
+            if (start < header.m_stringsOffset || start > snapshot.size() || snapshot.size() - start <= length)
+            {
+                return nullptr;
+            }
+            const char* result = snapshot.data() + start;
+            return result[length] == 0 ? result : nullptr;
+        }
+
+        class Reader
+        {
+        public:
+            Reader(const Buffer& snapshot, const Header& header, rapidjson::Document::AllocatorType& allocator)
+                : m_snapshot(snapshot)
+                , m_header(header)
+                , m_allocator(allocator)
+            {
+            }
+
+            bool ReadValue(rapidjson::Value& value)
+            {
+                StoredValue stored;
+                if (m_index >= m_header.m_valueCount ||
+                    !Load(stored, m_snapshot, m_header.m_valuesOffset + m_index * sizeof(StoredValue)))
+                {
+                    return false;
+                }
+                m_index++;
+
+                switch (stored.m_type)
+                {
+                case ValueType::Null:
+                    value.SetNull();
+                    return true;
+                case ValueType::False:
+                    value.SetBool(false);
+                    return true;
+                case ValueType::True:
+                    value.SetBool(true);
+                    return true;
+                case ValueType::Object:
+                    value.SetObject();
+                    for (u32 i = 0; i < stored.m_count; ++i)
+                    {
+                        rapidjson::Value name;
+                        rapidjson::Value member;
+                        if (!ReadValue(name) || !name.IsString() || !ReadValue(member))
+                        {
+                            return false;
+                        }
+                        value.AddMember(name.Move(), member.Move(), m_allocator);
+                    }
+                    return true;
+                case ValueType::Array:
+                    value.SetArray();
+                    value.Reserve(stored.m_count, m_allocator);
+                    for (u32 i = 0; i < stored.m_count; ++i)
+                    {
+                        rapidjson::Value element;
+                        if (!ReadValue(element))
+                        {
+                            return false;
+                        }
+                        value.PushBack(element.Move(), m_allocator);
+                    }
+                    return true;
+                case ValueType::String:
+                    if (const char* text = GetString(m_snapshot, m_header, stored.m_data, stored.m_count); text != nullptr)
+                    {
+                        // Reference the string in the snapshot instead of copying it.
+                        value.SetString(rapidjson::StringRef(text, stored.m_count));
+                        return true;
+                    }
+                    return false;
+                case ValueType::Int64:
+                {
+                    s64 number;
+                    memcpy(&number, &stored.m_data, sizeof(number));
+                    value.SetInt64(number);
+                    return true;
+                }
+                case ValueType::Uint64:
+                    value.SetUint64(stored.m_data);
+                    return true;
+                case ValueType::Double:
+                {
+                    double number;
+                    memcpy(&number, &stored.m_data, sizeof(number));
+                    value.SetDouble(number);
+                    return true;
+                }
+                default:
+                    return false;
+                }
+            }
+
+            bool IsAtEnd() const
+            {
+                return m_index == m_header.m_valueCount;
+            }
+
+        private:
+            const Buffer& m_snapshot;
+            const Header& m_header;
+            rapidjson::Document::AllocatorType& m_allocator;
+            u64 m_index{ 0 };
+        };
+    } // namespace Internal
+
+    void CollectInputs(InputList& inputs, const rapidjson::Value& settings, const char* historyKey)
+    {
+        const rapidjson::Value* history = rapidjson::Pointer(historyKey).Get(settings);
+        if (history == nullptr || !history->IsArray())
+        {
+            return;
+        }
+
+        auto addInput = [&inputs](AZStd::string_view path, bool isFolder)
+        {
+            if (!path.empty() && path.size() <= AZ::IO::MaxPathLength)
+            {
+                inputs.push_back(Input{ AZ::IO::FixedMaxPathString(path), isFolder });
+            }
+        };
+
+        for (const rapidjson::Value& entry : history->GetArray())
+        {
+            if (entry.IsString())
+            {
+                addInput(AZStd::string_view(entry.GetString(), entry.GetStringLength()), false);
+            }
+            else if (entry.IsObject())
+            {
+                // Folders are stored with a trailing wildcard. The merge history also stores files that failed to merge, which are
+                // tracked so the snapshot is updated once the problem has been fixed.
+                if (auto folder = entry.FindMember("Folder"); folder != entry.MemberEnd() && folder->value.IsString())
+                {
+                    AZ::IO::PathView folderPath(AZStd::string_view(folder->value.GetString(), folder->value.GetStringLength()));
+                    if (folderPath.Filename() == "*")
+                    {
+                        folderPath = folderPath.ParentPath();
+                    }
+                    addInput(folderPath.Native(), true);
+
+                    if (auto platform = entry.FindMember("Platform"); platform != entry.MemberEnd() && platform->value.IsString())
+                    {
+                        AZ::IO::FixedMaxPath platformPath(folderPath);
+                        platformPath /= AZ::SettingsRegistryInterface::PlatformFolder;
+                        platformPath /= AZStd::string_view(platform->value.GetString(), platform->value.GetStringLength());
+                        addInput(platformPath.Native(), true);
+                    }
+                }
+                else if (auto path = entry.FindMember("Path"); path != entry.MemberEnd() && path->value.IsString())
+                {
+                    addInput(AZStd::string_view(path->value.GetString(), path->value.GetStringLength()), false);
+                }
+            }
+        }
+    }
+
+    u64 CalculateInputKey(const InputList& inputs)
+    {
+        size_t key = 0;
+        for (const Input& input : inputs)
+        {
+            AZStd::hash_combine(key, AZStd::string_view(input.m_path));
+            if (input.m_isFolder)
+            {
+                // Combine the names of the files in the folder without depending on the order they're reported in.
+                size_t folderKey = 0;
+                AZ::IO::FixedMaxPath filter(input.m_path);
+                filter /= "*";
+                AZ::IO::SystemFile::FindFiles(filter.c_str(), [&folderKey](const char* fileName, bool isFile)
+                {
+                    if (isFile)
+                    {
+                        folderKey += AZStd::hash<AZStd::string_view>{}(fileName);
+                    }
+                    return true;
+                });
+                AZStd::hash_combine(key, folderKey);
+            }
+            else
+            {
+                AZStd::hash_combine(key, AZ::IO::SystemFile::ModificationTime(input.m_path.c_str()));
+            }
+        }
+        return aznumeric_cast<u64>(key);
+    }
+
+    u64 CalculateValueHash(const rapidjson::Value& value)
+    {
+        size_t hash = value.GetType();
+        switch (value.GetType())
+        {
+        case rapidjson::kObjectType:
+            for (const auto& member : value.GetObject())
+            {
+                AZStd::hash_combine(hash, AZStd::string_view(member.name.GetString(), member.name.GetStringLength()));
+                AZStd::hash_combine(hash, CalculateValueHash(member.value));
+            }
+            break;
+        case rapidjson::kArrayType:
+            for (const rapidjson::Value& element : value.GetArray())
+            {
+                AZStd::hash_combine(hash, CalculateValueHash(element));
+            }
+            break;
+        case rapidjson::kStringType:
+            AZStd::hash_combine(hash, AZStd::string_view(value.GetString(), value.GetStringLength()));
+            break;
+        case rapidjson::kNumberType:
+            if (value.IsDouble())
+            {
+                AZStd::hash_combine(hash, value.GetDouble());
+            }
+            else if (value.IsUint64())
+            {
+                AZStd::hash_combine(hash, value.GetUint64());
+            }
+            else
+            {
+                AZStd::hash_combine(hash, value.GetInt64());
+            }
+            break;
+        default:
+            break;
+        }
+        return aznumeric_cast<u64>(hash);
+    }
+
+    void Write(Buffer& output, const rapidjson::Value& settings, u64 contextKey, const InputList& inputs)
+    {
+        using namespace Internal;
+
+        Buffer strings;
+        ValueList values;
+        AZStd::vector<StoredInput, AZ::OSStdAllocator> storedInputs;
+        storedInputs.reserve(inputs.size());
+        for (const Input& input : inputs)
+        {
+            storedInputs.push_back(StoredInput{ StoreString(strings, input.m_path.c_str(), input.m_path.size()),
+                aznumeric_cast<u32>(input.m_path.size()), input.m_isFolder ? 1u : 0u });
+        }
+        StoreValue(values, strings, settings);
+
+        Header header;
+        header.m_magic = Magic;
+        header.m_version = Version;
+        header.m_contextKey = contextKey;
+        header.m_inputKey = CalculateInputKey(inputs);
+        header.m_inputCount = aznumeric_cast<u32>(storedInputs.size());
+        header.m_valueCount = aznumeric_cast<u32>(values.size());
+        header.m_inputsOffset = sizeof(Header);
+        header.m_valuesOffset = header.m_inputsOffset + storedInputs.size() * sizeof(StoredInput);
+        header.m_stringsOffset = header.m_valuesOffset + values.size() * sizeof(StoredValue);
+        header.m_size = header.m_stringsOffset + strings.size();
+
+        output.clear();
+        output.reserve(header.m_size);
+        auto append = [&output](const void* data, size_t size)
+        {
+            const char* bytes = reinterpret_cast<const char*>(data);
+            output.insert(output.end(), bytes, bytes + size);
+        };
+        append(&header, sizeof(header));
+        append(storedInputs.data(), storedInputs.size() * sizeof(StoredInput));
+        append(values.data(), values.size() * sizeof(StoredValue));
+        append(strings.data(), strings.size());
+    }
+
+    bool IsValid(const Buffer& snapshot, u64 contextKey)
+    {
+        using namespace Internal;
+
+        Header header;
+        if (!LoadHeader(header, snapshot) || header.m_contextKey != contextKey)
+        {
+            return false;
+        }
+
+        InputList inputs;
+        inputs.reserve(header.m_inputCount);
+        for (u32 i = 0; i < header.m_inputCount; ++i)
+        {
+            StoredInput stored;
+            if (!Load(stored, snapshot, header.m_inputsOffset + i * sizeof(StoredInput)))
+            {
+                return false;
+            }
+            const char* path = GetString(snapshot, header, stored.m_pathOffset, stored.m_pathLength);
+            if (path == nullptr || stored.m_pathLength > AZ::IO::MaxPathLength)
+            {
+                return false;
+            }
+            inputs.push_back(Input{ AZ::IO::FixedMaxPathString(path, stored.m_pathLength), stored.m_isFolder != 0 });
+        }
+        return CalculateInputKey(inputs) == header.m_inputKey;
+    }
+
+    bool Read(rapidjson::Document& document, const Buffer& snapshot)
+    {
+        using namespace Internal;
+
+        Header header;
+        if (!LoadHeader(header, snapshot))
+        {
+            return false;
+        }
+
+        Reader reader(snapshot, header, document.GetAllocator());
+        return reader.ReadValue(document) && reader.IsAtEnd();
+    }
+} // namespace AZ::SettingsRegistrySnapshot
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/IO/Path/Path_fwd.h>
+#include <AzCore/JSON/document.h>
+#include <AzCore/Memory/OSAllocator.h>
+#include <AzCore/std/containers/vector.h>
+
+//! A snapshot is a binary copy of the fully merged Settings Registry which can be loaded without parsing and merging json files.
+//! The layout of a snapshot is position independent and only uses offsets, so it can be loaded with a single read or mapped
+//! directly into memory. Strings are stored zero-terminated and are referenced in place when a snapshot is loaded, so the
+//! memory of the snapshot needs to be kept alive for as long as the loaded document exists.
+//!
+//! A snapshot stores two keys to determine if it's still up to date:
+//!     - The context key is provided by the caller and describes the state the registry was in before the settings were merged,
+//!       such as the command line and the executable location.
+//!     - The input key is calculated from the files and folders that were merged into the registry, as recorded in the merge
+//!       history. Files contribute their modification time and folders contribute the names of the files they contain, so adding,
+//!       removing or changing a settings file invalidates the snapshot.
+namespace AZ::SettingsRegistrySnapshot
+{
+    using Buffer = AZStd::vector<char, AZ::OSStdAllocator>;
+
+    inline constexpr u32 Version = 1;
+
+    struct Input
+    {
+        AZ::IO::FixedMaxPathString m_path;
+        bool m_isFolder{ false };
+    };
+    using InputList = AZStd::vector<Input, AZ::OSStdAllocator>;
+
+    //! Collects the files and folders that were merged into the settings from the merge history stored at historyKey.
+    void CollectInputs(InputList& inputs, const rapidjson::Value& settings, const char* historyKey);
+    //! Calculates a key that changes if any of the inputs are changed, added or removed.
+    u64 CalculateInputKey(const InputList& inputs);
+    //! Calculates a hash of all the values in the provided json value, including the names of fields.
+    u64 CalculateValueHash(const rapidjson::Value& value);
+
+    //! Stores the provided value and the inputs it was created from into the output buffer.
+    void Write(Buffer& output, const rapidjson::Value& settings, u64 contextKey, const InputList& inputs);
+    //! Checks if the snapshot is complete, was created with the same context key and none of its inputs have changed.
+    bool IsValid(const Buffer& snapshot, u64 contextKey);
+    //! Recreates the stored settings in the provided document. Strings in the document refer to the memory in the snapshot.
+    //! The snapshot should be checked with IsValid before reading it.
+    bool Read(rapidjson::Document& document, const Buffer& snapshot);
+} // namespace AZ::SettingsRegistrySnapshot
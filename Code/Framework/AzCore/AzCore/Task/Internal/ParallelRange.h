@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace AZ::Internal
+{
+    // Shared iteration state for the tasks that make up a ParallelFor or ParallelReduce node. Rather than
+    // statically dividing the range across tasks, each task repeatedly claims a chunk from a shared cursor. Chunks
+    // start large (a fraction of the remaining iterations) and shrink towards the grain size as the range is
+    // consumed, so tasks that start late or run on a slow core still end up with a balanced share of the work.
+    class ParallelRange final
+    {
+    public:
+        // Grain size used when the TaskDescriptor doesn't provide a hint
+        constexpr static size_t DefaultGrainSize = 64;
+
+        ParallelRange(size_t begin, size_t end, size_t grainSize, uint32_t workerCount)
+            : m_begin{ begin }
+            , m_end{ AZStd::max(begin, end) }
+            , m_grainSize{ grainSize == 0 ? DefaultGrainSize : grainSize }
+            , m_cursor{ begin }
+        {
+            // Never spawn more tasks than there are chunks or task workers to run them
+            const size_t chunkCount = (m_end - m_begin + m_grainSize - 1) / m_grainSize;
+            m_taskCount = static_cast<uint32_t>(AZStd::max<size_t>(1, AZStd::min<size_t>(chunkCount, workerCount)));
+        }
+
+        uint32_t GetTaskCount() const
+        {
+            return m_taskCount;
+        }
+
+        // Rewind the cursor so the range can be processed again when a retained graph is resubmitted
+        void Reset()
+        {
+            m_cursor.store(m_begin, AZStd::memory_order_relaxed);
+        }
+
+        // Claim the next chunk of the range. Returns false once the entire range has been handed out.
+        bool Claim(size_t& begin, size_t& end)
+        {
+            size_t current = m_cursor.load(AZStd::memory_order_relaxed);
+            while (current < m_end)
+            {
+                // Guided self-scheduling: hand out half of an even split of the remaining iterations, but never
+                // less than the grain size
+                const size_t remaining = m_end - current;
+                const size_t chunk = AZStd::max(m_grainSize, remaining / (2 * m_taskCount));
+                const size_t next = current + AZStd::min(chunk, remaining);
+                if (m_cursor.compare_exchange_weak(current, next, AZStd::memory_order_relaxed))
+                {
+                    begin = current;
+                    end = next;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+    private:
+        size_t m_begin;
+        size_t m_end;
+        size_t m_grainSize;
+        uint32_t m_taskCount;
+        AZStd::atomic<size_t> m_cursor;
+    };
+
+    template<typename Body>
+    struct ParallelForState
+    {
+        ParallelForState(size_t begin, size_t end, size_t grainSize, uint32_t workerCount, Body&& body)
+            : m_range{ begin, end, grainSize, workerCount }
+            , m_body{ AZStd::move(body) }
+        {
+        }
+
+        void Run()
+        {
+            size_t begin;
+            size_t end;
+            while (m_range.Claim(begin, end))
+            {
+                m_body(begin, end);
+            }
+        }
+
+        ParallelRange m_range;
+        Body m_body;
+    };
+
+    template<typename T, typename Body, typename Combine>
+    struct ParallelReduceState
+    {
+        // Each task accumulates into its own partial result. The partial results are padded to avoid false sharing
+        // between tasks that run concurrently.
+        struct alignas(64) Partial
+        {
+            T m_value;
+        };
+
+        ParallelReduceState(
+            size_t begin, size_t end, size_t grainSize, uint32_t workerCount, T identity, Body&& body, Combine&& combine, T* result)
+            : m_range{ begin, end, grainSize, workerCount }
+            , m_identity{ AZStd::move(identity) }
+            , m_body{ AZStd::move(body) }
+            , m_combine{ AZStd::move(combine) }
+            , m_result{ result }
+        {
+            m_partials.resize(m_range.GetTaskCount(), Partial{ m_identity });
+        }
+
+        void Reset()
+        {
+            m_range.Reset();
+            for (Partial& partial : m_partials)
+            {
+                partial.m_value = m_identity;
+            }
+        }
+
+        void Run(uint32_t taskIndex)
+        {
+            T& partial = m_partials[taskIndex].m_value;
+            size_t begin;
+            size_t end;
+            while (m_range.Claim(begin, end))
+            {
+                m_body(begin, end, partial);
+            }
+        }
+
+        void Join()
+        {
+            T result = m_identity;
+            for (const Partial& partial : m_partials)
+            {
+                result = m_combine(result, partial.m_value);
+            }
+            *m_result = AZStd::move(result);
+        }
+
+        ParallelRange m_range;
+        T m_identity;
+        Body m_body;
+        Combine m_combine;
+        T* m_result;
+        AZStd::vector<Partial> m_partials;
+    };
+} // namespace AZ::Internal
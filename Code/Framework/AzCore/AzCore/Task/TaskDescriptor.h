@@ -42,6 +42,12 @@ namespace AZ
         // that were queued before it provided they had not yet started
         TaskPriority priority = TaskPriority::MEDIUM;
 
+        // Hint for data-parallel nodes (TaskGraph::AddParallelFor/AddParallelReduce) that specifies the minimum
+        // number of iterations a task processes at a time. Use larger values for cheap loop bodies to amortize the
+        // scheduling overhead. 0 selects a default grain size. Ignored by regular tasks
+        // NOTE: Kept at 16 bits so the descriptor doesn't reduce the space available for lambda captures in a Task
+        uint16_t grainSize = 0;
+
         // EXPERTS ONLY. A bitmask that restricts tasks of this kind to run only on cores
         // corresponding to a set bit. 0 is synonymous with all bits set
         uint32_t cpuMask = 0;
@@ -99,6 +99,9 @@ namespace AZ
         // - offset to the "head" of the ring, from where we acquire elements
         // - offset to the "tail" of the ring, which tracks where new elements should be enqueued
         // - offset to a tail reservation index, which is used to reserve a slot to enqueue elements
+        //
+        // Acquisition from the head is safe from any thread, which permits idle workers to steal tasks from
+        // the queues of other workers.
         class TaskQueue final
         {
         public:
@@ -114,6 +117,9 @@ namespace AZ
             void Enqueue(Task* task);
             Task* TryDequeue();
 
+            // Attempt to acquire a task of a single priority level only
+            Task* TryDequeue(uint8_t priority);
+
         private:
             QueueStatus m_status[PriorityLevelCount] = {};
             Task* m_queues[PriorityLevelCount][MaxQueueSize] = {};
@@ -161,32 +167,40 @@ namespace AZ
 
         Task* TaskQueue::TryDequeue()
         {
-            for (size_t priority = 0; priority != PriorityLevelCount; ++priority)
+            for (uint8_t priority = 0; priority != PriorityLevelCount; ++priority)
             {
-                QueueStatus& status = m_status[priority];
-                while (true)
+                if (Task* task = TryDequeue(priority))
                 {
-                    uint16_t head = status.head.load();
-                    uint16_t tail = status.tail.load();
-                    if (head == tail)
-                    {
-                        // Queue empty
-                        break;
-                    }
-                    else
-                    {
-                        Task* task = m_queues[priority][status.head];
-                        if (status.head.compare_exchange_weak(head, head + 1))
-                        {
-                            return task;
-                        }
-                    }
+                    return task;
                 }
             }
 
             return nullptr;
         }
 
+        Task* TaskQueue::TryDequeue(uint8_t priority)
+        {
+            QueueStatus& status = m_status[priority];
+            while (true)
+            {
+                uint16_t head = status.head.load();
+                uint16_t tail = status.tail.load();
+                if (head == tail)
+                {
+                    // Queue empty
+                    return nullptr;
+                }
+                else
+                {
+                    Task* task = m_queues[priority][head];
+                    if (status.head.compare_exchange_weak(head, head + 1))
+                    {
+                        return task;
+                    }
+                }
+            }
+        }
+
         class TaskWorker
         {
         public:
@@ -195,6 +209,7 @@ namespace AZ
             void Spawn(::AZ::TaskExecutor& executor, uint32_t id, AZStd::semaphore& initSemaphore, bool affinitize)
             {
                 m_executor = &executor;
+                m_id = id;
 
                 AZStd::string threadName = AZStd::string::format("TaskWorker %u", id);
                 AZStd::thread_desc desc = {};
@@ -230,6 +245,15 @@ namespace AZ
                 return m_enabled;
             }
 
+            // A worker is idle if it is parked on its semaphore (or about to be) and can be woken to steal work.
+            // This load pairs with the store in TryAcquireTaskBeforeIdle: the submitter enqueues and then loads m_busy, while
+            // the worker stores m_busy and then checks the queues. Both sides must be seq_cst so that at least one of them
+            // sees the other's write, otherwise the wakeup can be lost.
+            bool Idle() const
+            {
+                return !m_busy.load(AZStd::memory_order_seq_cst);
+            }
+
             void Join()
             {
                 m_active.store(false, AZStd::memory_order_release);
@@ -244,7 +268,40 @@ namespace AZ
                 m_semaphore.release();
             }
 
+            void Wake()
+            {
+                m_semaphore.release();
+            }
+
         private:
+            // Tasks are acquired in priority order. For each priority level, the local queue is checked first,
+            // followed by the queues of the other workers so that an idle worker can steal tasks queued behind
+            // a long running task elsewhere. A task of lower priority is never taken while a task of higher
+            // priority is visible in any queue.
+            Task* TryAcquireTask()
+            {
+                TaskWorker* workers = m_executor->m_workers;
+                const uint32_t threadCount = m_executor->m_threadCount;
+
+                for (uint8_t priority = 0; priority != TaskQueue::PriorityLevelCount; ++priority)
+                {
+                    if (Task* task = m_queue.TryDequeue(priority))
+                    {
+                        return task;
+                    }
+
+                    for (uint32_t i = 1; i < threadCount; ++i)
+                    {
+                        if (Task* task = workers[(m_id + i) % threadCount].m_queue.TryDequeue(priority))
+                        {
+                            return task;
+                        }
+                    }
+                }
+
+                return nullptr;
+            }
+
             void Run()
             {
                 while (m_active)
@@ -256,35 +313,96 @@ namespace AZ
                         return;
                     }
 
-                    Task* task = m_queue.TryDequeue();
+                    m_busy.store(true, AZStd::memory_order_release);
+
+                    Task* task = TryAcquireTask();
+                    if (!task)
+                    {
+                        task = TryAcquireTaskBeforeIdle();
+                    }
+
                     while (task)
                     {
+                        // All predecessors have finished, so the dependency counter is reused to track the
+                        // outstanding work of this task: the task itself plus any child graphs it submits
+                        task->m_dependencyCount.store(1, AZStd::memory_order_relaxed);
+                        m_currentTask = task;
                         task->Invoke();
-                        // Decrement counts for all task successors
-                        for (size_t j = 0; j != task->m_outboundLinkCount; ++j)
-                        {
-                            Task* successor = task->m_graph->m_successors[task->m_successorOffset + j];
-                            if (--successor->m_dependencyCount == 0)
-                            {
-                                m_executor->Submit(*successor);
-                            }
-                        }
+                        m_currentTask = nullptr;
+                        FinishTask(*task);
 
-                        bool isRetained = task->m_graph->m_parent != nullptr;
-                        if (task->m_graph->Release() == (isRetained ? 1u : 0u))
+                        task = TryAcquireTask();
+                        if (!task)
                         {
-                            m_executor->ReleaseGraph();
+                            task = TryAcquireTaskBeforeIdle();
                         }
+                    }
+                }
+            }
+
+            // Advertise that this worker may be woken to steal work, then check once more to close the window in which
+            // a submission could have seen this worker as busy and skipped waking it
+            Task* TryAcquireTaskBeforeIdle()
+            {
+                m_busy.store(false, AZStd::memory_order_seq_cst);
+                Task* task = TryAcquireTask();
+                if (task)
+                {
+                    m_busy.store(true, AZStd::memory_order_release);
+                }
+                return task;
+            }
+
+            // Mark a unit of work of the task (its own invocation or a child graph) as finished. Successors are
+            // released once the task and all of its children are done.
+            void FinishTask(Task& task)
+            {
+                if (--task.m_dependencyCount != 0)
+                {
+                    return;
+                }
+
+                // Decrement counts for all task successors
+                for (size_t j = 0; j != task.m_outboundLinkCount; ++j)
+                {
+                    Task* successor = task.m_graph->m_successors[task.m_successorOffset + j];
+                    if (--successor->m_dependencyCount == 0)
+                    {
+                        m_executor->Submit(*successor);
+                    }
+                }
 
-                        task = m_queue.TryDequeue();
+                // Read before the release as the graph is destroyed when a detached graph finishes
+                CompiledTaskGraph* graph = task.m_graph;
+                Task* parentTask = graph->m_parentTask;
+                bool isRetained = graph->m_parent != nullptr;
+                if (graph->Release() == (isRetained ? 1u : 0u))
+                {
+                    m_executor->ReleaseGraph();
+
+                    if (parentTask)
+                    {
+                        // The graph was submitted from within a running task, which may now be complete as well
+                        FinishTask(*parentTask);
                     }
                 }
             }
 
+            void AttachChild(CompiledTaskGraph& graph)
+            {
+                AZ_Assert(m_currentTask, "Child task graphs can only be submitted from within a running task");
+                ++m_currentTask->m_dependencyCount;
+                graph.m_parentTask = m_currentTask;
+            }
+
             AZStd::thread m_thread;
             AZStd::atomic<bool> m_active;
             AZStd::atomic<bool> m_enabled = true;
+            AZStd::atomic<bool> m_busy = false;
+            uint32_t m_id = 0;
             AZStd::binary_semaphore m_semaphore;
+            // The task currently being invoked by this worker, used to parent graphs submitted from within the task
+            Task* m_currentTask = nullptr;
 
             ::AZ::TaskExecutor* m_executor;
             TaskQueue m_queue;
@@ -306,6 +424,16 @@ namespace AZ
         return **s_executor;
     }
 
+    bool TaskExecutor::HasInstance()
+    {
+        if (!s_executor)
+        {
+            s_executor = AZ::Environment::FindVariable<TaskExecutor*>(s_executorName);
+        }
+
+        return s_executor && *s_executor != nullptr;
+    }
+
     void TaskExecutor::SetInstance(TaskExecutor* executor)
     {
         if (!executor) // allow unsetting the executor
@@ -359,6 +487,16 @@ namespace AZ
         return nullptr;
     }
 
+    bool TaskExecutor::IsTaskWorkerThread()
+    {
+        return GetTaskWorker() != nullptr;
+    }
+
+    uint32_t TaskExecutor::GetWorkerCount() const
+    {
+        return m_threadCount;
+    }
+
     void TaskExecutor::Submit(Internal::CompiledTaskGraph& graph, TaskGraphEvent* event)
     {
         ++m_graphsRemaining;
@@ -379,6 +517,15 @@ namespace AZ
         }
     }
 
+    void TaskExecutor::SubmitChild(Internal::CompiledTaskGraph& graph)
+    {
+        Internal::TaskWorker* worker = GetTaskWorker();
+        AZ_Assert(worker, "Child task graphs must be submitted from a task running on the same executor");
+        worker->AttachChild(graph);
+
+        Submit(graph, nullptr);
+    }
+
     void TaskExecutor::Submit(Internal::Task& task)
     {
         // TODO: Something more sophisticated is likely needed here.
@@ -393,6 +540,26 @@ namespace AZ
         }
 
         m_workers[nextWorker].Enqueue(&task);
+
+        // If the chosen worker is occupied, the task may sit in its queue for a long time. Wake an idle worker
+        // so that it can steal the task instead.
+        if (!m_workers[nextWorker].Idle())
+        {
+            WakeIdleTaskWorker(nextWorker);
+        }
+    }
+
+    void TaskExecutor::WakeIdleTaskWorker(uint32_t busyWorker)
+    {
+        for (uint32_t i = 1; i < m_threadCount; ++i)
+        {
+            Internal::TaskWorker& worker = m_workers[(busyWorker + i) % m_threadCount];
+            if (worker.Idle() && worker.Enabled())
+            {
+                worker.Wake();
+                return;
+            }
+        }
     }
 
     void TaskExecutor::ReleaseGraph()
@@ -52,6 +52,9 @@ namespace AZ
             TaskGraphEvent* m_waitEvent = nullptr;
             // The pointer to the parent graph is set only if it is retained
             TaskGraph* m_parent = nullptr;
+            // The task that submitted this graph, set only if the graph was submitted from within a running task.
+            // The parent task is not considered finished until this graph finishes.
+            Task* m_parentTask = nullptr;
             AZStd::atomic<uint32_t> m_remaining;
         };
 
@@ -64,6 +67,8 @@ namespace AZ
         AZ_CLASS_ALLOCATOR(TaskExecutor, SystemAllocator, 0);
 
         static TaskExecutor& Instance();
+        // Returns true if an executor was set through SetInstance
+        static bool HasInstance();
 
         // Invoked by a system component on program launch
         static void SetInstance(TaskExecutor* executor);
@@ -72,17 +77,29 @@ namespace AZ
         explicit TaskExecutor(uint32_t threadCount = 0);
         ~TaskExecutor();
 
-        // Submit a task graph for execution. Waitable task graphs cannot enqueue work on the task thread
-        // that is currently active
+        // Submit a task graph for execution. Tasks are distributed round-robin to the task workers, and idle
+        // workers steal queued tasks from busy workers (respecting task priority). Waitable task graphs cannot
+        // enqueue work on the task thread that is currently active (use SubmitChild to wait on work spawned by a task instead)
         void Submit(Internal::CompiledTaskGraph& graph, TaskGraphEvent* event);
 
+        // Submit a task graph from within a task running on this executor. The running task, and therefore its
+        // successors, won't complete until all tasks of the child graph have finished. This doesn't block the worker
+        void SubmitChild(Internal::CompiledTaskGraph& graph);
+
         void Submit(Internal::Task& task);
 
+        // Returns true if the calling thread is one of the task workers of this executor. Waiting on a task graph isn't
+        // supported on these threads, so code that submits and waits should run the work inline instead
+        bool IsTaskWorkerThread();
+
+        uint32_t GetWorkerCount() const;
+
     private:
         friend class Internal::TaskWorker;
         friend class TaskGraphEvent;
 
         Internal::TaskWorker* GetTaskWorker();
+        void WakeIdleTaskWorker(uint32_t busyWorker);
         void ReleaseGraph();
         void ReactivateTaskWorker();
 
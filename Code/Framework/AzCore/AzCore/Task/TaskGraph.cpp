@@ -64,12 +64,17 @@ namespace AZ
     {
         AZ_Assert(!m_parent.m_submitted, "Cannot mutate a TaskGraph that was previously submitted.");
 
+        m_parent.LinkInternal(m_exitIndex, comesAfter.m_index);
+    }
+
+    void TaskGraph::LinkInternal(uint32_t comesBefore, uint32_t comesAfter)
+    {
         // Increment inbound/outbound edge counts
-        m_parent.m_tasks[m_index].Link(m_parent.m_tasks[comesAfter.m_index]);
+        m_tasks[comesBefore].Link(m_tasks[comesAfter]);
 
-        m_parent.m_links[m_index].emplace_back(comesAfter.m_index);
+        m_links[comesBefore].emplace_back(comesAfter);
 
-        ++m_parent.m_linkCount;
+        ++m_linkCount;
     }
 
     TaskGraph::~TaskGraph()
@@ -84,6 +89,15 @@ namespace AZ
         }
     }
 
+    uint32_t TaskGraph::GetParallelWorkerCount()
+    {
+        if (TaskExecutor::HasInstance())
+        {
+            return TaskExecutor::Instance().GetWorkerCount();
+        }
+        return AZStd::max(1u, AZStd::thread::hardware_concurrency());
+    }
+
     void TaskGraph::Reset()
     {
         AZ_Assert(!m_submitted, "Cannot reset a job graph while it is in flight");
@@ -103,6 +117,31 @@ namespace AZ
     }
 
     void TaskGraph::SubmitOnExecutor(TaskExecutor& executor, TaskGraphEvent* waitEvent)
+    {
+        executor.Submit(Compile(waitEvent), waitEvent);
+        FinishSubmission();
+    }
+
+    void TaskGraph::SubmitAsChild()
+    {
+        SubmitAsChildOnExecutor(TaskExecutor::Instance());
+    }
+
+    void TaskGraph::SubmitAsChildOnExecutor(TaskExecutor& executor)
+    {
+        if (IsEmpty())
+        {
+            // Nothing for the parent task to wait on
+            return;
+        }
+
+        // The submitting task may return before the children finish, so the graph can't rely on this object
+        Detach();
+        executor.SubmitChild(Compile(nullptr));
+        FinishSubmission();
+    }
+
+    CompiledTaskGraph& TaskGraph::Compile(TaskGraphEvent* waitEvent)
     {
         if (!m_compiledTaskGraph)
         {
@@ -116,9 +155,11 @@ namespace AZ
         {
             m_compiledTaskGraph->m_tasks[i].Init();
         }
+        return *m_compiledTaskGraph;
+    }
 
-        executor.Submit(*m_compiledTaskGraph, waitEvent);
-
+    void TaskGraph::FinishSubmission()
+    {
         if (m_retained)
         {
             m_submitted = true;
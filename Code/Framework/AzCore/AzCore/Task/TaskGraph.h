@@ -10,12 +10,14 @@
 
 // NOTE: If adding additional header/symbol dependencies, consider if such additions are better
 // suited in the private CompiledTaskGraph implementation instead to keep this header lean.
+#include <AzCore/Task/Internal/ParallelRange.h>
 #include <AzCore/Task/Internal/Task.h>
 #include <AzCore/Task/TaskDescriptor.h>
 #include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/parallel/binary_semaphore.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 
 namespace AZ
 {
@@ -38,6 +40,9 @@ namespace AZ
     // A TaskToken is returned each time a Task is added to the TaskGraph. TaskTokens are used to
     // express dependencies between tasks within the graph, and have no purpose after the graph
     // is submitted (simply let them go out of scope)
+    //
+    // Nodes that expand to multiple tasks (e.g. ParallelFor) are represented by a single token. Inbound
+    // edges attach to the first task of the node and outbound edges to the last task of the node.
     class TaskToken final
     {
     public:
@@ -56,9 +61,12 @@ namespace AZ
 
         // Only the TaskGraph should be creating TaskToken
         TaskToken(TaskGraph& parent, uint32_t index);
+        TaskToken(TaskGraph& parent, uint32_t index, uint32_t exitIndex);
 
         TaskGraph& m_parent;
         uint32_t m_index;
+        // Index of the task that outbound edges originate from (same as m_index for single tasks)
+        uint32_t m_exitIndex;
     };
 
     // A TaskGraphEvent may be used to block until one or more task graphs has finished executing. Usage
@@ -116,6 +124,24 @@ namespace AZ
         template <typename... Lambdas>
         AZStd::array<TaskToken, sizeof...(Lambdas)> AddTasks(TaskDescriptor const& descriptor, Lambdas&&... lambdas);
 
+        // Add a data-parallel loop over the half-open range [begin, end) to the graph. The body is invoked with
+        // sub-ranges (void(size_t begin, size_t end)) from multiple tasks concurrently. Sub-ranges are claimed
+        // adaptively, starting large and shrinking towards descriptor.grainSize as the range is consumed, so
+        // uneven per-iteration cost is balanced across the workers.
+        // NOTE: The body is stored once and shared between the tasks, so it may capture any amount of data.
+        // NOTE: A graph containing parallel nodes must not be in flight more than once at the same time.
+        template<typename Body>
+        TaskToken AddParallelFor(TaskDescriptor const& descriptor, size_t begin, size_t end, Body&& body);
+
+        // Add a data-parallel reduction over the half-open range [begin, end) to the graph. Each task accumulates
+        // into its own partial result, which starts as a copy of identity, by invoking
+        // body(size_t begin, size_t end, T& partial). Once all sub-ranges are processed, the partial results are
+        // folded with T combine(T const&, T const&) and written to *result. The result is available to tasks
+        // that follow the returned token.
+        template<typename T, typename Body, typename Combine>
+        TaskToken AddParallelReduce(
+            TaskDescriptor const& descriptor, size_t begin, size_t end, T identity, Body&& body, Combine&& combine, T* result);
+
         // By default, you are responsible for retaining the TaskGraph, indicating you promise that
         // this TaskGraph will live as long as it takes for all constituent tasks to complete.
         // Once retained, this task graph can be resubmitted after completion without any
@@ -148,10 +174,34 @@ namespace AZ
         // Same as submit but run on a different executor than the default system executor
         void SubmitOnExecutor(TaskExecutor& executor, TaskGraphEvent* waitEvent = nullptr);
 
+        // Submit the graph from within a running task. The graph becomes a child of the running task: the task
+        // isn't considered finished, and its successors don't start, until every task in this graph has finished.
+        // The worker is not blocked and returns to processing other tasks as soon as the running task returns,
+        // which makes this suitable for recursive work that can't be expressed up front. Child graphs may in turn
+        // submit children of their own.
+        //
+        // The graph is implicitly detached, so this TaskGraph may go out of scope immediately after submission.
+        // NOTE: Must be called from a task running on the executor the graph is submitted to
+        void SubmitAsChild();
+        void SubmitAsChildOnExecutor(TaskExecutor& executor);
+
+        // Add a task that runs after every task currently in the graph without successors has finished, and
+        // therefore after all tasks in the graph. Combined with SubmitAsChild, this attaches a continuation to
+        // work spawned from a running task.
+        template<typename Lambda>
+        TaskToken AddContinuation(TaskDescriptor const& descriptor, Lambda&& lambda);
+
     private:
         friend class TaskToken;
         friend class Internal::CompiledTaskGraph;
 
+        void LinkInternal(uint32_t comesBefore, uint32_t comesAfter);
+        // Number of tasks data-parallel nodes are split across at most. This matches the worker count of the default
+        // executor, or the hardware concurrency if no default executor has been set.
+        static uint32_t GetParallelWorkerCount();
+        Internal::CompiledTaskGraph& Compile(TaskGraphEvent* waitEvent);
+        void FinishSubmission();
+
         Internal::CompiledTaskGraph* m_compiledTaskGraph = nullptr;
 
         AZStd::vector<Internal::Task> m_tasks;
@@ -13,6 +13,14 @@ namespace AZ
     inline TaskToken::TaskToken(TaskGraph& parent, uint32_t index)
         : m_parent{ parent }
         , m_index{ index }
+        , m_exitIndex{ index }
+    {
+    }
+
+    inline TaskToken::TaskToken(TaskGraph& parent, uint32_t index, uint32_t exitIndex)
+        : m_parent{ parent }
+        , m_index{ index }
+        , m_exitIndex{ exitIndex }
     {
     }
 
@@ -49,6 +57,102 @@ namespace AZ
         return { AddTask(descriptor, AZStd::forward<Lambdas>(lambdas))... };
     }
 
+    template<typename Lambda>
+    TaskToken TaskGraph::AddContinuation(TaskDescriptor const& descriptor, Lambda&& lambda)
+    {
+        const uint32_t taskCount = aznumeric_cast<uint32_t>(m_tasks.size());
+        TaskToken continuation = AddTask(descriptor, AZStd::forward<Lambda>(lambda));
+        for (uint32_t i = 0; i != taskCount; ++i)
+        {
+            auto it = m_links.find(i);
+            if (it == m_links.end() || it->second.empty())
+            {
+                LinkInternal(i, continuation.m_index);
+            }
+        }
+        return continuation;
+    }
+
+    template<typename Body>
+    TaskToken TaskGraph::AddParallelFor(TaskDescriptor const& descriptor, size_t begin, size_t end, Body&& body)
+    {
+        AZ_Assert(!m_submitted, "Cannot mutate a TaskGraph that was previously submitted or in flight.");
+
+        using State = Internal::ParallelForState<AZStd::decay_t<Body>>;
+        auto state = AZStd::make_shared<State>(
+            begin, end, descriptor.grainSize, GetParallelWorkerCount(), AZStd::decay_t<Body>{ AZStd::forward<Body>(body) });
+
+        //    fork     <-- Rewinds the range; inbound edges of the node attach here
+        //   / | \     (one task per task worker, bounded by the number of grains)
+        //  t0 t1 tn   <-- Claim sub-ranges until the range is exhausted
+        //   \ | /
+        //    join     <-- Outbound edges of the node originate here
+        TaskToken fork = AddTask(
+            descriptor,
+            [state]
+            {
+                state->m_range.Reset();
+            });
+        TaskToken join = AddTask(
+            descriptor,
+            []
+            {
+            });
+        for (uint32_t i = 0; i != state->m_range.GetTaskCount(); ++i)
+        {
+            TaskToken task = AddTask(
+                descriptor,
+                [state]
+                {
+                    state->Run();
+                });
+            LinkInternal(fork.m_index, task.m_index);
+            LinkInternal(task.m_index, join.m_index);
+        }
+
+        return { *this, fork.m_index, join.m_index };
+    }
+
+    template<typename T, typename Body, typename Combine>
+    TaskToken TaskGraph::AddParallelReduce(
+        TaskDescriptor const& descriptor, size_t begin, size_t end, T identity, Body&& body, Combine&& combine, T* result)
+    {
+        AZ_Assert(!m_submitted, "Cannot mutate a TaskGraph that was previously submitted or in flight.");
+        AZ_Assert(result, "AddParallelReduce requires a location to store the result.");
+
+        using State = Internal::ParallelReduceState<T, AZStd::decay_t<Body>, AZStd::decay_t<Combine>>;
+        auto state = AZStd::make_shared<State>(
+            begin, end, descriptor.grainSize, GetParallelWorkerCount(), AZStd::move(identity),
+            AZStd::decay_t<Body>{ AZStd::forward<Body>(body) },
+            AZStd::decay_t<Combine>{ AZStd::forward<Combine>(combine) }, result);
+
+        TaskToken fork = AddTask(
+            descriptor,
+            [state]
+            {
+                state->Reset();
+            });
+        TaskToken join = AddTask(
+            descriptor,
+            [state]
+            {
+                state->Join();
+            });
+        for (uint32_t i = 0; i != state->m_range.GetTaskCount(); ++i)
+        {
+            TaskToken task = AddTask(
+                descriptor,
+                [state, i]
+                {
+                    state->Run(i);
+                });
+            LinkInternal(fork.m_index, task.m_index);
+            LinkInternal(task.m_index, join.m_index);
+        }
+
+        return { *this, fork.m_index, join.m_index };
+    }
+
     inline bool TaskGraph::IsEmpty()
     {
         return m_tasks.empty();
@@ -156,6 +156,7 @@ set(FILES
     EBus/Internal/CallstackEntry.h
     EBus/Internal/Debug.h
     EBus/Internal/Handlers.h
+    EBus/Internal/MessageQueue.h
     EBus/Internal/StoragePolicies.h
     Interface/Interface.h
     IO/ByteContainerStream.h
@@ -384,6 +385,10 @@ set(FILES
     Memory/BestFitExternalMapSchema.h
     Memory/Config.h
     Memory/dlmalloc.inl
+    Memory/FrameArenaAllocator.cpp
+    Memory/FrameArenaAllocator.h
+    Memory/FrameArenaSchema.cpp
+    Memory/FrameArenaSchema.h
     Memory/HeapSchema.h
     Memory/HphaSchema.cpp
     Memory/HphaSchema.h
@@ -537,6 +542,8 @@ set(FILES
     Serialization/Json/JsonSerialization.cpp
     Serialization/Json/JsonSerializationMetadata.h
     Serialization/Json/JsonSerializationMetadata.inl
+    Serialization/Json/JsonSerializationPlan.h
+    Serialization/Json/JsonSerializationPlan.cpp
     Serialization/Json/JsonSerializationResult.h
     Serialization/Json/JsonSerializationResult.cpp
     Serialization/Json/JsonSerializationSettings.h
@@ -576,6 +583,8 @@ set(FILES
     Settings/SettingsRegistryMergeUtils.h
     Settings/SettingsRegistryScriptUtils.cpp
     Settings/SettingsRegistryScriptUtils.h
+    Settings/SettingsRegistrySnapshot.cpp
+    Settings/SettingsRegistrySnapshot.h
     Settings/SettingsRegistryVisitorUtils.cpp
     Settings/SettingsRegistryVisitorUtils.h
     State/HSM.cpp
@@ -635,6 +644,7 @@ set(FILES
     Socket/AzSocket_fwd.h
     Socket/AzSocket.cpp
     Socket/AzSocket.h
+    Task/Internal/ParallelRange.h
     Task/Internal/Task.cpp
     Task/Internal/Task.inl
     Task/Internal/Task.h
@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/IO/Streamer/MemoryMappedReader_Linux.h>
+#include <AzCore/IO/Streamer/MemoryMappedReaderConfig_Linux.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+
+namespace AZ::IO
+{
+    AZStd::shared_ptr<StreamStackEntry> LinuxMemoryMappedReaderConfig::AddStreamStackEntry(
+        const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent)
+    {
+        auto stackEntry = AZStd::make_shared<MemoryMappedReaderLinux>(
+            m_maxMappedFiles, aznumeric_cast<u64>(m_minReadSizeKib) * 1_kib, hardware.m_maxPhysicalSectorSize, m_enableZeroCopy,
+            m_copyResidentReads);
+        stackEntry->SetNext(AZStd::move(parent));
+        return stackEntry;
+    }
+
+    void LinuxMemoryMappedReaderConfig::Reflect(ReflectContext* context)
+    {
+        if (auto serializeContext = azrtti_cast<SerializeContext*>(context); serializeContext != nullptr)
+        {
+            serializeContext->Class<LinuxMemoryMappedReaderConfig, IStreamerStackConfig>()
+                ->Version(2)
+                ->Field("MaxMappedFiles", &LinuxMemoryMappedReaderConfig::m_maxMappedFiles)
+                ->Field("MinReadSizeKib", &LinuxMemoryMappedReaderConfig::m_minReadSizeKib)
+                ->Field("EnableZeroCopy", &LinuxMemoryMappedReaderConfig::m_enableZeroCopy)
+                ->Field("CopyResidentReads", &LinuxMemoryMappedReaderConfig::m_copyResidentReads);
+        }
+    }
+} // namespace AZ::IO
@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+
+namespace AZ::IO
+{
+    class LinuxMemoryMappedReaderConfig final :
+        public IStreamerStackConfig
+    {
+    public:
+        AZ_RTTI(AZ::IO::LinuxMemoryMappedReaderConfig, "{10C52C6A-72DA-49A3-94A0-05D419AE1C5E}", IStreamerStackConfig);
+        AZ_CLASS_ALLOCATOR(LinuxMemoryMappedReaderConfig, SystemAllocator, 0);
+
+        ~LinuxMemoryMappedReaderConfig() override = default;
+        AZStd::shared_ptr<StreamStackEntry> AddStreamStackEntry(
+            const HardwareInformation& hardware, AZStd::shared_ptr<StreamStackEntry> parent) override;
+        static void Reflect(ReflectContext* context);
+
+    private:
+        AZ::u32 m_maxMappedFiles{ 32 };
+        AZ::u32 m_minReadSizeKib{ 256 };
+        bool m_enableZeroCopy{ true };
+        bool m_copyResidentReads{ false };
+    };
+} // namespace AZ::IO
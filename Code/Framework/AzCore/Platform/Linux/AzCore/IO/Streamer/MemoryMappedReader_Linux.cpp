@@ -0,0 +1,376 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/MemoryMappedReader_Linux.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/typetraits/decay.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace AZ::IO
+{
+    MemoryMappedReaderLinux::MappedFile::MappedFile(RequestPath path, const u8* address, u64 size)
+        : m_path(AZStd::move(path))
+        , m_address(address)
+        , m_size(size)
+    {
+    }
+
+    MemoryMappedReaderLinux::MappedFile::~MappedFile()
+    {
+        ::munmap(const_cast<u8*>(m_address), aznumeric_cast<size_t>(m_size));
+    }
+
+    MemoryMappedReaderLinux::MemoryMappedReaderLinux(
+        u32 maxMappedFiles, u64 minReadSize, size_t memoryAlignment, bool enableZeroCopy, bool copyResidentReads)
+        : StreamStackEntry("Memory mapped reader (Linux)")
+        , m_minReadSize(minReadSize)
+        , m_memoryAlignment(memoryAlignment)
+        , m_pageSize(aznumeric_cast<size_t>(::sysconf(_SC_PAGESIZE)))
+        , m_maxMappedFiles(AZStd::max(maxMappedFiles, 1u))
+        , m_enableZeroCopy(enableZeroCopy)
+        , m_copyResidentReads(copyResidentReads)
+    {
+        m_mappedFiles.reserve(m_maxMappedFiles);
+
+        // Add initial dummy values to the stats to avoid division by zero later on and avoid needing branches.
+        m_readSizeAverage.PushEntry(1);
+        m_readTimeAverage.PushEntry(AZStd::chrono::microseconds(1));
+    }
+
+    void MemoryMappedReaderLinux::QueueRequest(FileRequest* request)
+    {
+        AZ_Assert(request, "QueueRequest was provided a null request.");
+        AZStd::visit([this, request](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, FileRequest::ReadData>)
+            {
+                if (ShouldMap(args))
+                {
+                    m_pendingRequests.push_back(request);
+                }
+                else
+                {
+                    ForwardRead(request);
+                }
+                return;
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::CancelData>)
+            {
+                CancelRequest(request, args.m_target);
+                return;
+            }
+            else
+            {
+                if constexpr (AZStd::is_same_v<Command, FileRequest::FlushData>)
+                {
+                    FlushCache(args.m_path);
+                }
+                else if constexpr (AZStd::is_same_v<Command, FileRequest::FlushAllData>)
+                {
+                    FlushEntireCache();
+                }
+                StreamStackEntry::QueueRequest(request);
+            }
+        }, request->GetCommand());
+    }
+
+    bool MemoryMappedReaderLinux::ExecuteRequests()
+    {
+        bool hasProcessedRequest = false;
+        if (!m_pendingRequests.empty())
+        {
+            FileRequest* request = m_pendingRequests.front();
+            m_pendingRequests.pop_front();
+            ReadFile(request);
+            hasProcessedRequest = true;
+        }
+        return StreamStackEntry::ExecuteRequests() || hasProcessedRequest;
+    }
+
+    void MemoryMappedReaderLinux::UpdateStatus(Status& status) const
+    {
+        StreamStackEntry::UpdateStatus(status);
+        status.m_numAvailableSlots = AZStd::min(status.m_numAvailableSlots, s_maxRequests - aznumeric_cast<s32>(m_pendingRequests.size()));
+        status.m_isIdle = status.m_isIdle && m_pendingRequests.empty();
+        status.m_supportsMappedViews = status.m_supportsMappedViews || m_enableZeroCopy;
+    }
+
+    void MemoryMappedReaderLinux::UpdateCompletionEstimates(AZStd::chrono::system_clock::time_point now,
+        AZStd::vector<FileRequest*>& internalPending, StreamerContext::PreparedQueue::iterator pendingBegin,
+        StreamerContext::PreparedQueue::iterator pendingEnd)
+    {
+        StreamStackEntry::UpdateCompletionEstimates(now, internalPending, pendingBegin, pendingEnd);
+
+        // Reads from a mapping are limited by how fast pages can be faulted in, which is tracked as the overall read speed.
+        const double totalReadTimeUSec = aznumeric_caster(m_readTimeAverage.GetTotal().count());
+        const double totalBytesRead = aznumeric_caster(m_readSizeAverage.GetTotal());
+        AZStd::chrono::system_clock::time_point startTime = now;
+        for (FileRequest* request : m_pendingRequests)
+        {
+            auto& data = AZStd::get<FileRequest::ReadData>(request->GetCommand());
+            startTime += AZStd::chrono::microseconds(aznumeric_cast<u64>((data.m_size * totalReadTimeUSec) / totalBytesRead));
+            request->SetEstimatedCompletion(startTime);
+        }
+    }
+
+    void MemoryMappedReaderLinux::CollectStatistics(AZStd::vector<Statistic>& statistics) const
+    {
+        constexpr double bytesToMB = (1024.0 * 1024.0);
+        using DoubleSeconds = AZStd::chrono::duration<double>;
+
+        if (m_readSizeAverage.GetTotal() > 1) // A default value is always added.
+        {
+            double totalBytesReadMB = m_readSizeAverage.GetTotal() / bytesToMB;
+            double totalReadTimeSec = AZStd::chrono::duration_cast<DoubleSeconds>(m_readTimeAverage.GetTotal()).count();
+            statistics.push_back(Statistic::CreateFloat(m_name, "Read Speed (avg. mbps)", totalBytesReadMB / totalReadTimeSec));
+        }
+        if (m_mapTimeAverage.GetNumRecorded() > 0)
+        {
+            statistics.push_back(Statistic::CreateInteger(m_name, "File map (avg. us)", m_mapTimeAverage.CalculateAverage().count()));
+        }
+        statistics.push_back(Statistic::CreateInteger(m_name, "Mapped files", aznumeric_cast<s64>(m_mappedFiles.size())));
+        statistics.push_back(Statistic::CreateInteger(m_name, "Copied reads", aznumeric_cast<s64>(m_numCopiedReads)));
+        statistics.push_back(Statistic::CreateInteger(m_name, "Zero-copy reads", aznumeric_cast<s64>(m_numZeroCopyReads)));
+        statistics.push_back(Statistic::CreateInteger(m_name, "Forwarded reads", aznumeric_cast<s64>(m_numForwardedReads)));
+        statistics.push_back(Statistic::CreateInteger(m_name, "Non-resident reads", aznumeric_cast<s64>(m_numNonResidentReads)));
+        statistics.push_back(Statistic::CreateInteger(m_name, "Available slots",
+            s64{ s_maxRequests } - aznumeric_cast<s64>(m_pendingRequests.size())));
+
+        StreamStackEntry::CollectStatistics(statistics);
+    }
+
+    bool MemoryMappedReaderLinux::ShouldMap(const FileRequest::ReadData& data) const
+    {
+        // A read without output memory has been deferred by the scheduler so it can receive a mapped view.
+        if (data.m_output != nullptr && (!m_copyResidentReads || data.m_size < m_minReadSize))
+        {
+            return false;
+        }
+        return AZStd::find(m_unmappableFiles.begin(), m_unmappableFiles.end(), data.m_path) == m_unmappableFiles.end();
+    }
+
+    AZStd::shared_ptr<MemoryMappedReaderLinux::MappedFile> MemoryMappedReaderLinux::GetMappedFile(const RequestPath& filePath)
+    {
+        m_useCounter++;
+        for (AZStd::shared_ptr<MappedFile>& mappedFile : m_mappedFiles)
+        {
+            if (mappedFile->m_path == filePath)
+            {
+                mappedFile->m_lastUsed = m_useCounter;
+                return mappedFile;
+            }
+        }
+
+        AZStd::shared_ptr<MappedFile> result;
+        {
+            TIMED_AVERAGE_WINDOW_SCOPE(m_mapTimeAverage);
+
+            int fileHandle = ::open(filePath.GetAbsolutePath(), O_RDONLY | O_CLOEXEC);
+            if (fileHandle >= 0)
+            {
+                struct stat fileInfo;
+                // Empty files can't be mapped and anything that's not a regular file, such as a pipe, isn't guaranteed to be mappable.
+                if (::fstat(fileHandle, &fileInfo) == 0 && S_ISREG(fileInfo.st_mode) && fileInfo.st_size > 0)
+                {
+                    const size_t fileSize = aznumeric_cast<size_t>(fileInfo.st_size);
+                    void* address = ::mmap(nullptr, fileSize, PROT_READ, MAP_SHARED, fileHandle, 0);
+                    if (address != MAP_FAILED)
+                    {
+                        result = AZStd::make_shared<MappedFile>(filePath, reinterpret_cast<const u8*>(address), fileSize);
+                        result->m_lastUsed = m_useCounter;
+                    }
+                }
+                // The mapping stays valid after the file handle has been closed.
+                ::close(fileHandle);
+            }
+        }
+
+        if (!result)
+        {
+            if (m_unmappableFiles.size() >= m_maxMappedFiles)
+            {
+                m_unmappableFiles.erase(m_unmappableFiles.begin());
+            }
+            m_unmappableFiles.push_back(filePath);
+            return result;
+        }
+
+        if (m_mappedFiles.size() < m_maxMappedFiles)
+        {
+            m_mappedFiles.push_back(result);
+        }
+        else
+        {
+            // Replace the least recently used mapping. Reads that still hold a view keep the mapping alive until they're released.
+            auto oldest = m_mappedFiles.begin();
+            for (auto it = m_mappedFiles.begin() + 1; it != m_mappedFiles.end(); ++it)
+            {
+                if ((*it)->m_lastUsed < (*oldest)->m_lastUsed)
+                {
+                    oldest = it;
+                }
+            }
+            *oldest = result;
+        }
+        return result;
+    }
+
+    bool MemoryMappedReaderLinux::IsResident(const MappedFile& mappedFile, u64 offset, u64 size)
+    {
+        const size_t rangeStart = AZ_SIZE_ALIGN_DOWN(aznumeric_cast<size_t>(offset), m_pageSize);
+        const size_t rangeSize = aznumeric_cast<size_t>(offset + size) - rangeStart;
+        m_residency.resize_no_construct((rangeSize + m_pageSize - 1) / m_pageSize);
+        if (::mincore(const_cast<u8*>(mappedFile.m_address) + rangeStart, rangeSize, m_residency.data()) != 0)
+        {
+            return false;
+        }
+        return AZStd::all_of(m_residency.begin(), m_residency.end(), [](unsigned char page) { return (page & 1) != 0; });
+    }
+
+    void MemoryMappedReaderLinux::ReadFile(FileRequest* request)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+
+        auto& data = AZStd::get<FileRequest::ReadData>(request->GetCommand());
+        AZStd::shared_ptr<MappedFile> mappedFile = GetMappedFile(data.m_path);
+        if (!mappedFile)
+        {
+            ForwardRead(request);
+            return;
+        }
+
+        if (data.m_offset + data.m_size > mappedFile->m_size)
+        {
+            AZ_Warning("Streamer", false, "Reading %llu bytes at offset %llu from '%s' which is beyond the end of the file (%llu bytes).",
+                data.m_size, data.m_offset, data.m_path.GetRelativePath(), mappedFile->m_size);
+            request->SetStatus(IStreamerTypes::RequestStatus::Failed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+
+        // Copying from pages that aren't resident would block the Streamer thread on page faults, so let the drive read those
+        // asynchronously instead.
+        if (data.m_output != nullptr && !IsResident(*mappedFile, data.m_offset, data.m_size))
+        {
+            m_numNonResidentReads++;
+            ForwardRead(request);
+            return;
+        }
+
+        const u8* source = mappedFile->m_address + data.m_offset;
+        {
+            TIMED_AVERAGE_WINDOW_SCOPE(m_readTimeAverage);
+
+            if (data.m_output == nullptr)
+            {
+                // Let the kernel start reading the pages in the background so they're likely resident by the time the view is
+                // read from.
+                const size_t adviseStart = AZ_SIZE_ALIGN_DOWN(aznumeric_cast<size_t>(data.m_offset), m_pageSize);
+                const size_t adviseSize = aznumeric_cast<size_t>(data.m_offset + data.m_size) - adviseStart;
+                ::madvise(const_cast<u8*>(mappedFile->m_address) + adviseStart, adviseSize, MADV_WILLNEED);
+
+                auto parentReadRequest = request->GetCommandFromChain<FileRequest::ReadRequestData>();
+                AZ_Assert(parentReadRequest, "A read without an output buffer reached the memory mapped reader without a read request.");
+                parentReadRequest->m_output = const_cast<u8*>(source);
+                parentReadRequest->m_outputSize = data.m_size;
+                parentReadRequest->m_mappedView = AZStd::move(mappedFile);
+                data.m_output = parentReadRequest->m_output;
+                data.m_outputSize = data.m_size;
+                m_numZeroCopyReads++;
+            }
+            else
+            {
+                memcpy(data.m_output, source, data.m_size);
+                m_numCopiedReads++;
+            }
+        }
+        m_readSizeAverage.PushEntry(data.m_size);
+
+        request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+        m_context->MarkRequestAsCompleted(request);
+    }
+
+    void MemoryMappedReaderLinux::ForwardRead(FileRequest* request)
+    {
+        auto& data = AZStd::get<FileRequest::ReadData>(request->GetCommand());
+        if (data.m_output == nullptr)
+        {
+            // The scheduler deferred the allocation in case the file could be mapped, so allocate before passing the read on.
+            auto parentReadRequest = request->GetCommandFromChain<FileRequest::ReadRequestData>();
+            AZ_Assert(parentReadRequest && parentReadRequest->m_allocator,
+                "A read without an output buffer reached the memory mapped reader without an allocator to provide one.");
+            IStreamerTypes::RequestMemoryAllocatorResult allocation = parentReadRequest->m_allocator->Allocate(
+                data.m_size, data.m_size, m_memoryAlignment);
+            if (allocation.m_address == nullptr || allocation.m_size < data.m_size)
+            {
+                request->SetStatus(IStreamerTypes::RequestStatus::Failed);
+                m_context->MarkRequestAsCompleted(request);
+                return;
+            }
+            parentReadRequest->m_output = allocation.m_address;
+            parentReadRequest->m_outputSize = allocation.m_size;
+            parentReadRequest->m_memoryType = allocation.m_type;
+            data.m_output = allocation.m_address;
+            data.m_outputSize = allocation.m_size;
+        }
+        m_numForwardedReads++;
+        StreamStackEntry::QueueRequest(request);
+    }
+
+    void MemoryMappedReaderLinux::CancelRequest(FileRequest* cancelRequest, FileRequestPtr& target)
+    {
+        for (auto it = m_pendingRequests.begin(); it != m_pendingRequests.end();)
+        {
+            if ((*it)->WorksOn(target))
+            {
+                (*it)->SetStatus(IStreamerTypes::RequestStatus::Canceled);
+                m_context->MarkRequestAsCompleted(*it);
+                it = m_pendingRequests.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+        // Requests that were forwarded can still be pending further down the stack.
+        StreamStackEntry::QueueRequest(cancelRequest);
+    }
+
+    void MemoryMappedReaderLinux::FlushCache(const RequestPath& filePath)
+    {
+        // Views that are still held by requests keep their mapping alive until those requests are released.
+        auto mappedIt = AZStd::find_if(m_mappedFiles.begin(), m_mappedFiles.end(),
+            [&filePath](const AZStd::shared_ptr<MappedFile>& mappedFile) { return mappedFile->m_path == filePath; });
+        if (mappedIt != m_mappedFiles.end())
+        {
+            m_mappedFiles.erase(mappedIt);
+        }
+
+        auto unmappableIt = AZStd::find(m_unmappableFiles.begin(), m_unmappableFiles.end(), filePath);
+        if (unmappableIt != m_unmappableFiles.end())
+        {
+            m_unmappableFiles.erase(unmappableIt);
+        }
+    }
+
+    void MemoryMappedReaderLinux::FlushEntireCache()
+    {
+        m_mappedFiles.clear();
+        m_unmappableFiles.clear();
+    }
+} // namespace AZ::IO
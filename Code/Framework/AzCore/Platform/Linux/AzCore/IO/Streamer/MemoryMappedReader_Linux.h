@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/Statistics.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/IO/Streamer/StreamStackEntry.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
+
+namespace AZ::IO
+{
+    //! Stream stack entry that serves reads from memory mapped files. This applies to loose files as well as uncompressed
+    //! entries in archives, as both arrive as reads with an absolute path and an offset. If the request accepts mapped views
+    //! (see RequestMemoryAllocator::AcceptsMappedViews) the request receives a pinned read-only view into the mapping without
+    //! any copies. Pages of the view are faulted in by whoever reads the view, not by the Streamer thread.
+    //! Optionally reads can also be copied from the mapping into the request's buffer, but only if all pages of the range are
+    //! already resident as copying would otherwise block the Streamer thread on page faults. All other reads, including reads
+    //! for files that can't be mapped, are forwarded to the next entry in the stack.
+    //! For zero-copy reads this entry needs to be placed above any entry that writes to the output of a read, such as the
+    //! BlockCache and DedicatedCache, as the output of those reads is only assigned by this entry.
+    //! Note that a file that's truncated while it's mapped will cause a SIGBUS on access, so this entry should only be used for
+    //! files that don't change while the application is running, such as shipped assets and archives.
+    class MemoryMappedReaderLinux
+        : public StreamStackEntry
+    {
+    public:
+        //! @param maxMappedFiles The maximum number of files that are kept mapped. Mappings that are still used by a zero-copy
+        //!     read are kept alive by that read even after they've been removed from this entry.
+        //! @param minReadSize Copied reads smaller than this are forwarded to the next entry, as those are better served by caches.
+        //!     Reads that accept a mapped view are always served if the file can be mapped.
+        //! @param memoryAlignment The alignment used when memory has to be allocated for a read that accepts mapped views but
+        //!     for which the file couldn't be mapped.
+        //! @param enableZeroCopy If true, reads that accept a mapped view will receive one.
+        //! @param copyResidentReads If true, reads that don't accept a mapped view are copied from the mapping if the requested
+        //!     range is fully resident in memory. If false, those reads are always forwarded to the next entry.
+        MemoryMappedReaderLinux(u32 maxMappedFiles, u64 minReadSize, size_t memoryAlignment, bool enableZeroCopy, bool copyResidentReads);
+        ~MemoryMappedReaderLinux() override = default;
+
+        void QueueRequest(FileRequest* request) override;
+        bool ExecuteRequests() override;
+
+        void UpdateStatus(Status& status) const override;
+        void UpdateCompletionEstimates(AZStd::chrono::system_clock::time_point now, AZStd::vector<FileRequest*>& internalPending,
+            StreamerContext::PreparedQueue::iterator pendingBegin, StreamerContext::PreparedQueue::iterator pendingEnd) override;
+
+        void CollectStatistics(AZStd::vector<Statistic>& statistics) const override;
+
+    protected:
+        inline static constexpr s32 s_maxRequests = 4;
+
+        struct MappedFile
+        {
+            AZ_CLASS_ALLOCATOR(MappedFile, SystemAllocator, 0);
+
+            MappedFile(RequestPath path, const u8* address, u64 size);
+            ~MappedFile();
+
+            RequestPath m_path;
+            const u8* m_address;
+            u64 m_size;
+            u64 m_lastUsed{ 0 };
+        };
+
+        bool ShouldMap(const FileRequest::ReadData& data) const;
+        AZStd::shared_ptr<MappedFile> GetMappedFile(const RequestPath& filePath);
+        bool IsResident(const MappedFile& mappedFile, u64 offset, u64 size);
+        void ReadFile(FileRequest* request);
+        void ForwardRead(FileRequest* request);
+        void CancelRequest(FileRequest* cancelRequest, FileRequestPtr& target);
+        void FlushCache(const RequestPath& filePath);
+        void FlushEntireCache();
+
+        TimedAverageWindow<s_statisticsWindowSize> m_mapTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_readTimeAverage;
+        AverageWindow<u64, float, s_statisticsWindowSize> m_readSizeAverage;
+
+        AZStd::deque<FileRequest*> m_pendingRequests;
+        AZStd::vector<AZStd::shared_ptr<MappedFile>> m_mappedFiles;
+        //! Files that recently failed to map. These are forwarded without trying to map them again until the cache is flushed.
+        AZStd::vector<RequestPath> m_unmappableFiles;
+        //! Scratch buffer for querying which pages of a mapping are resident.
+        AZStd::vector<unsigned char> m_residency;
+
+        u64 m_useCounter{ 0 };
+        u64 m_numCopiedReads{ 0 };
+        u64 m_numZeroCopyReads{ 0 };
+        u64 m_numForwardedReads{ 0 };
+        u64 m_numNonResidentReads{ 0 };
+        u64 m_minReadSize;
+        size_t m_memoryAlignment;
+        size_t m_pageSize;
+        u32 m_maxMappedFiles;
+        bool m_enableZeroCopy;
+        bool m_copyResidentReads;
+    };
+} // namespace AZ::IO
@@ -0,0 +1,1382 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/IO/Streamer/StorageDrive_Linux.h>
+#include <AzCore/std/typetraits/decay.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace AZ::IO
+{
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+    static constexpr char FileSwitchesName[] = "File switches";
+    static constexpr char SeeksName[] = "Seeks";
+    static constexpr char DirectReadsName[] = "Direct reads (no internal alloc)";
+    static constexpr char QueueDepthName[] = "Queue depth";
+#endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+
+    const AZStd::chrono::microseconds StorageDriveLinux::s_averageSeekTime =
+        AZStd::chrono::milliseconds(9) + // Common average seek time for desktop hdd drives.
+        AZStd::chrono::milliseconds(3); // Rotational latency for a 7200RPM disk
+
+    //
+    // Ring
+    //
+
+    bool StorageDriveLinux::Ring::Initialize(u32 entries)
+    {
+#if defined(__NR_io_uring_setup)
+        io_uring_params params{};
+        int ringFd = aznumeric_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+        if (ringFd < 0)
+        {
+            return false;
+        }
+        m_ringFd = ringFd;
+
+        m_submissionRingSize = params.sq_off.array + params.sq_entries * sizeof(u32);
+        m_completionRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        const bool singleMap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+        if (singleMap)
+        {
+            m_submissionRingSize = AZStd::max(m_submissionRingSize, m_completionRingSize);
+            m_completionRingSize = m_submissionRingSize;
+        }
+
+        m_submissionRing = ::mmap(nullptr, m_submissionRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+            m_ringFd, IORING_OFF_SQ_RING);
+        if (m_submissionRing == MAP_FAILED)
+        {
+            m_submissionRing = nullptr;
+            Shutdown();
+            return false;
+        }
+
+        if (singleMap)
+        {
+            m_completionRing = m_submissionRing;
+        }
+        else
+        {
+            m_completionRing = ::mmap(nullptr, m_completionRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+                m_ringFd, IORING_OFF_CQ_RING);
+            if (m_completionRing == MAP_FAILED)
+            {
+                m_completionRing = nullptr;
+                Shutdown();
+                return false;
+            }
+        }
+
+        m_submissionEntriesSize = params.sq_entries * sizeof(io_uring_sqe);
+        void* submissionEntries = ::mmap(nullptr, m_submissionEntriesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+            m_ringFd, IORING_OFF_SQES);
+        if (submissionEntries == MAP_FAILED)
+        {
+            Shutdown();
+            return false;
+        }
+        m_submissionEntries = reinterpret_cast<io_uring_sqe*>(submissionEntries);
+
+        u8* submissionRing = reinterpret_cast<u8*>(m_submissionRing);
+        m_submissionHead = reinterpret_cast<u32*>(submissionRing + params.sq_off.head);
+        m_submissionTail = reinterpret_cast<u32*>(submissionRing + params.sq_off.tail);
+        m_submissionMask = reinterpret_cast<u32*>(submissionRing + params.sq_off.ring_mask);
+        m_submissionArray = reinterpret_cast<u32*>(submissionRing + params.sq_off.array);
+
+        u8* completionRing = reinterpret_cast<u8*>(m_completionRing);
+        m_completionHead = reinterpret_cast<u32*>(completionRing + params.cq_off.head);
+        m_completionTail = reinterpret_cast<u32*>(completionRing + params.cq_off.tail);
+        m_completionMask = reinterpret_cast<u32*>(completionRing + params.cq_off.ring_mask);
+        m_completionEntries = reinterpret_cast<io_uring_cqe*>(completionRing + params.cq_off.cqes);
+
+        m_localTail = *m_submissionTail;
+        m_toSubmit = 0;
+        return true;
+#else
+        AZ_UNUSED(entries);
+        return false;
+#endif
+    }
+
+    void StorageDriveLinux::Ring::Shutdown()
+    {
+        if (m_submissionEntries)
+        {
+            ::munmap(m_submissionEntries, m_submissionEntriesSize);
+        }
+        if (m_completionRing && m_completionRing != m_submissionRing)
+        {
+            ::munmap(m_completionRing, m_completionRingSize);
+        }
+        if (m_submissionRing)
+        {
+            ::munmap(m_submissionRing, m_submissionRingSize);
+        }
+        if (m_ringFd >= 0)
+        {
+            ::close(m_ringFd);
+        }
+        *this = Ring{};
+    }
+
+    io_uring_sqe* StorageDriveLinux::Ring::GetSubmissionEntry()
+    {
+        const u32 head = __atomic_load_n(m_submissionHead, __ATOMIC_ACQUIRE);
+        if (m_localTail - head > *m_submissionMask)
+        {
+            return nullptr;
+        }
+
+        const u32 index = m_localTail & *m_submissionMask;
+        io_uring_sqe* entry = &m_submissionEntries[index];
+        ::memset(entry, 0, sizeof(io_uring_sqe));
+        m_submissionArray[index] = index;
+        ++m_localTail;
+        ++m_toSubmit;
+        return entry;
+    }
+
+    int StorageDriveLinux::Ring::Submit()
+    {
+#if defined(__NR_io_uring_enter)
+        if (m_toSubmit == 0)
+        {
+            return 0;
+        }
+
+        // Publish the new entries before telling the kernel about them.
+        __atomic_store_n(m_submissionTail, m_localTail, __ATOMIC_RELEASE);
+
+        int result;
+        do
+        {
+            result = aznumeric_cast<int>(::syscall(__NR_io_uring_enter, m_ringFd, m_toSubmit, 0, 0, nullptr, 0));
+        } while (result < 0 && errno == EINTR);
+
+        if (result > 0)
+        {
+            m_toSubmit -= AZStd::min(m_toSubmit, aznumeric_cast<u32>(result));
+        }
+        return result;
+#else
+        return -1;
+#endif
+    }
+
+    template<typename Callback>
+    size_t StorageDriveLinux::Ring::ProcessCompletions(Callback&& callback)
+    {
+        u32 head = *m_completionHead;
+        const u32 tail = __atomic_load_n(m_completionTail, __ATOMIC_ACQUIRE);
+        size_t count = 0;
+        while (head != tail)
+        {
+            const io_uring_cqe& entry = m_completionEntries[head & *m_completionMask];
+            callback(entry.user_data, entry.res);
+            ++head;
+            ++count;
+        }
+        // Hand the processed entries back to the kernel.
+        __atomic_store_n(m_completionHead, head, __ATOMIC_RELEASE);
+        return count;
+    }
+
+    template<typename Callback>
+    size_t StorageDriveLinux::Ring::DiscardPendingSubmissions(Callback&& callback)
+    {
+        // Only safe because this ring is only submitted to from the streamer thread and doesn't use a kernel polling
+        // thread, so the kernel doesn't consume entries outside of Submit.
+        const u32 head = __atomic_load_n(m_submissionHead, __ATOMIC_ACQUIRE);
+        for (u32 index = head; index != m_localTail; ++index)
+        {
+            callback(m_submissionEntries[index & *m_submissionMask].user_data);
+        }
+        const size_t count = m_localTail - head;
+        m_localTail = head;
+        __atomic_store_n(m_submissionTail, m_localTail, __ATOMIC_RELEASE);
+        m_toSubmit = 0;
+        return count;
+    }
+
+    bool StorageDriveLinux::Ring::RegisterEventFd(int eventFd)
+    {
+#if defined(__NR_io_uring_register)
+        return ::syscall(__NR_io_uring_register, m_ringFd, IORING_REGISTER_EVENTFD, &eventFd, 1) == 0;
+#else
+        AZ_UNUSED(eventFd);
+        return false;
+#endif
+    }
+
+    //
+    // ConstructionOptions
+    //
+
+    StorageDriveLinux::ConstructionOptions::ConstructionOptions()
+        : m_hasSeekPenalty(true)
+        , m_enableUnbufferedReads(true)
+        , m_minimalReporting(false)
+    {}
+
+    //
+    // FileReadInformation
+    //
+
+    void StorageDriveLinux::FileReadInformation::AllocateAlignedBuffer(size_t size, size_t sectorSize)
+    {
+        AZ_Assert(m_sectorAlignedOutput == nullptr, "Assign a sector aligned buffer when one is already assigned.");
+        m_sectorAlignedOutput = azmalloc(size, sectorSize, AZ::SystemAllocator);
+    }
+
+    void StorageDriveLinux::FileReadInformation::Clear()
+    {
+        if (m_sectorAlignedOutput)
+        {
+            azfree(m_sectorAlignedOutput, AZ::SystemAllocator);
+        }
+        *this = FileReadInformation{};
+    }
+
+    //
+    // StorageDriveLinux
+    //
+    StorageDriveLinux::StorageDriveLinux(const AZStd::vector<AZStd::string_view>& drivePaths, u32 maxFileHandles,
+        u32 maxMetaDataCacheEntries, size_t physicalSectorSize, size_t logicalSectorSize, u32 queueDepth, s32 overCommit,
+        ConstructionOptions options)
+        : m_physicalSectorSize(physicalSectorSize)
+        , m_logicalSectorSize(logicalSectorSize)
+        , m_maxFileHandles(maxFileHandles)
+        , m_queueDepth(queueDepth)
+        , m_overCommit(overCommit)
+        , m_constructionOptions(options)
+    {
+        AZ_Assert(!drivePaths.empty(), "StorageDriveLinux requires at least one drive path to work.");
+
+        m_drivePaths.reserve(drivePaths.size());
+        for (AZStd::string_view drivePath : drivePaths)
+        {
+            AZStd::string path(drivePath);
+            // Erase the trailing slash so the root path matches every absolute path.
+            if (!path.empty() && path.back() == '/')
+            {
+                path.pop_back();
+            }
+            m_drivePaths.push_back(AZStd::move(path));
+        }
+
+        // Create name for statistics. The name will include all mount points serviced by this device, for
+        // instance "Storage drive (/,/mnt/data)".
+        m_name = "Storage drive (";
+        for (size_t i = 0; i < m_drivePaths.size(); ++i)
+        {
+            if (i > 0)
+            {
+                m_name += ',';
+            }
+            m_name += m_drivePaths[i].empty() ? AZStd::string_view("/") : AZStd::string_view(m_drivePaths[i]);
+        }
+        m_name += ')';
+
+        if (m_physicalSectorSize == 0)
+        {
+            m_physicalSectorSize = 4_kib;
+            AZ_Error("StorageDriveLinux", false,
+                "Received physical sector size of 0 for %s. Picking a sector size of %zu instead.\n", m_name.c_str(), m_physicalSectorSize);
+        }
+        if (m_logicalSectorSize == 0)
+        {
+            m_logicalSectorSize = 4_kib;
+            AZ_Error("StorageDriveLinux", false,
+                "Received logical sector size of 0 for %s. Picking a sector size of %zu instead.\n", m_name.c_str(), m_logicalSectorSize);
+        }
+        AZ_Error("StorageDriveLinux", IStreamerTypes::IsPowerOf2(m_physicalSectorSize) && IStreamerTypes::IsPowerOf2(m_logicalSectorSize),
+            "StorageDriveLinux requires power-of-2 sector sizes. Received physical: %zu and logical: %zu",
+            m_physicalSectorSize, m_logicalSectorSize);
+
+        if (m_queueDepth == 0)
+        {
+            m_queueDepth = 32;
+            AZ_Warning("StorageDriveLinux", false,
+                "Received queue depth of 0 for %s. Picking a depth of %u instead.\n", m_name.c_str(), m_queueDepth);
+        }
+        // Make sure that the overCommit isn't so small that no slots are ever reported.
+        if (aznumeric_cast<s32>(m_queueDepth) + m_overCommit <= 0)
+        {
+            AZ_Error("StorageDriveLinux", false,
+                "Received overcommit (%i) for %s that subtracts more than the queue depth (%u). Setting combined count to 1.\n",
+                m_overCommit, m_name.c_str(), m_queueDepth);
+            m_overCommit = 1 - aznumeric_cast<s32>(m_queueDepth);
+        }
+
+        // Add initial dummy values to the stats to avoid division by zero later on and avoid needing branches.
+        m_readSizeAverage.PushEntry(1);
+        m_readTimeAverage.PushEntry(AZStd::chrono::microseconds(1));
+
+        AZ_Assert(IStreamerTypes::IsPowerOf2(maxMetaDataCacheEntries),
+            "StorageDriveLinux requires a power-of-2 for maxMetaDataCacheEntries. Received %u", maxMetaDataCacheEntries);
+        m_metaDataCache_paths.resize(maxMetaDataCacheEntries);
+        m_metaDataCache_fileSize.resize(maxMetaDataCacheEntries);
+
+        if (!InitializeRing())
+        {
+            m_ringUnavailable = true;
+            AZ_Warning("StorageDriveLinux", false,
+                "Unable to create an io_uring for %s (Error: %i). Requests will be forwarded to the next entry in the stack.\n",
+                m_name.c_str(), errno);
+        }
+        else if (!m_constructionOptions.m_minimalReporting)
+        {
+            AZ_Printf("Streamer", "%s created with a queue depth of %u.\n", m_name.c_str(), m_queueDepth);
+        }
+    }
+
+    StorageDriveLinux::~StorageDriveLinux()
+    {
+        AZ_Assert(m_activeReads_Count == 0, "%s destroyed while %u reads are still in flight.", m_name.c_str(), m_activeReads_Count);
+
+        for (size_t i = 0; i < m_fileCache_handles.size(); ++i)
+        {
+            CloseFileHandle(i);
+        }
+        // The completion event isn't returned as it's owned by the streamer context, which may already have been destroyed.
+        m_ring.Shutdown();
+        if (!m_constructionOptions.m_minimalReporting)
+        {
+            AZ_Printf("Streamer", "%s destroyed.\n", m_name.c_str());
+        }
+    }
+
+    bool StorageDriveLinux::InitializeRing()
+    {
+        return m_ring.Initialize(m_queueDepth);
+    }
+
+    bool StorageDriveLinux::SubmitEntries()
+    {
+        if (m_ring.Submit() >= 0)
+        {
+            return true;
+        }
+
+        // None of the pending entries made it to the kernel, so they'll never complete. Fail the reads instead of
+        // leaving them marked as active, which would otherwise stall this drive indefinitely.
+        const int error = errno;
+        AZ_Error("StorageDriveLinux", false, "Failed to submit reads to io_uring (Error: %i).\n", error);
+        m_ring.DiscardPendingSubmissions([this, error](u64 userData)
+            {
+                if (userData != IgnoredCompletion)
+                {
+                    FinalizeSingleRequest(aznumeric_cast<size_t>(userData), -error);
+                }
+            });
+        return false;
+    }
+
+    void StorageDriveLinux::PrepareRequest(FileRequest* request)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+        AZ_Assert(request, "PrepareRequest was provided a null request.");
+
+        if (!m_ringUnavailable && AZStd::holds_alternative<FileRequest::ReadRequestData>(request->GetCommand()))
+        {
+            auto& readRequest = AZStd::get<FileRequest::ReadRequestData>(request->GetCommand());
+            if (IsServicedByThisDrive(readRequest.m_path.GetAbsolutePath()))
+            {
+                FileRequest* read = m_context->GetNewInternalRequest();
+                read->CreateRead(request, readRequest.m_output, readRequest.m_outputSize, readRequest.m_path,
+                    readRequest.m_offset, readRequest.m_size);
+                m_context->PushPreparedRequest(read);
+                return;
+            }
+        }
+        StreamStackEntry::PrepareRequest(request);
+    }
+
+    void StorageDriveLinux::QueueRequest(FileRequest* request)
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+        AZ_Assert(request, "QueueRequest was provided a null request.");
+
+        if (m_ringUnavailable)
+        {
+            StreamStackEntry::QueueRequest(request);
+            return;
+        }
+
+        AZStd::visit([this, request](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, FileRequest::ReadData>)
+            {
+                if (IsServicedByThisDrive(args.m_path.GetAbsolutePath()))
+                {
+                    m_pendingReadRequests.push_back(request);
+                    return;
+                }
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::FileExistsCheckData> ||
+                AZStd::is_same_v<Command, FileRequest::FileMetaDataRetrievalData>)
+            {
+                if (IsServicedByThisDrive(args.m_path.GetAbsolutePath()))
+                {
+                    m_pendingRequests.push_back(request);
+                    return;
+                }
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::CancelData>)
+            {
+                if (CancelRequest(request, args.m_target))
+                {
+                    // Only forward if this isn't part of the request chain, otherwise the storage device should
+                    // be the last step as it doesn't forward any (sub)requests.
+                    return;
+                }
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::FlushData>)
+            {
+                FlushCache(args.m_path);
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::FlushAllData>)
+            {
+                FlushEntireCache();
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::ReportData>)
+            {
+                Report(args);
+            }
+            StreamStackEntry::QueueRequest(request);
+        }, request->GetCommand());
+    }
+
+    bool StorageDriveLinux::ExecuteRequests()
+    {
+        if (m_ringUnavailable)
+        {
+            return StreamStackEntry::ExecuteRequests();
+        }
+
+        bool hasFinalizedReads = FinalizeReads();
+        bool hasWorked = false;
+
+        // Continue partial reads before starting new ones as they already occupy a read slot.
+        while (!m_pendingResubmissions.empty())
+        {
+            size_t readSlot = m_pendingResubmissions.front();
+            if (m_readSlots_readInfo[readSlot].m_isCanceled)
+            {
+                FinalizeSingleRequest(readSlot, -ECANCELED);
+            }
+            else if (!SubmitRemainingRead(readSlot))
+            {
+                break;
+            }
+            m_pendingResubmissions.pop_front();
+            hasWorked = true;
+        }
+
+        // Fill up the submission queue as far as possible before notifying the kernel so the reads are submitted with
+        // a single system call.
+        while (!m_pendingReadRequests.empty())
+        {
+            FileRequest* request = m_pendingReadRequests.front();
+            if (ReadRequest(request))
+            {
+                m_pendingReadRequests.pop_front();
+                hasWorked = true;
+            }
+            else
+            {
+                break;
+            }
+        }
+        SubmitEntries();
+
+        if (!hasWorked && !m_pendingRequests.empty())
+        {
+            FileRequest* request = m_pendingRequests.front();
+            hasWorked = AZStd::visit([this, request](auto&& args)
+            {
+                using Command = AZStd::decay_t<decltype(args)>;
+                if constexpr (AZStd::is_same_v<Command, FileRequest::FileExistsCheckData>)
+                {
+                    FileExistsRequest(request);
+                    m_pendingRequests.pop_front();
+                    return true;
+                }
+                else if constexpr (AZStd::is_same_v<Command, FileRequest::FileMetaDataRetrievalData>)
+                {
+                    FileMetaDataRetrievalRequest(request);
+                    m_pendingRequests.pop_front();
+                    return true;
+                }
+                else
+                {
+                    AZ_Assert(false, "A request was added to StorageDriveLinux's pending queue that isn't supported.");
+                    return false;
+                }
+            }, request->GetCommand());
+        }
+
+        return StreamStackEntry::ExecuteRequests() || hasFinalizedReads || hasWorked;
+    }
+
+    void StorageDriveLinux::UpdateStatus(Status& status) const
+    {
+        StreamStackEntry::UpdateStatus(status);
+        if (!m_ringUnavailable)
+        {
+            status.m_numAvailableSlots = AZStd::min(status.m_numAvailableSlots, CalculateNumAvailableSlots());
+            status.m_isIdle = status.m_isIdle && m_pendingReadRequests.empty() && m_pendingRequests.empty() &&
+                m_pendingResubmissions.empty() && (m_activeReads_Count == 0);
+        }
+    }
+
+    void StorageDriveLinux::UpdateCompletionEstimates(AZStd::chrono::system_clock::time_point now,
+        AZStd::vector<FileRequest*>& internalPending, StreamerContext::PreparedQueue::iterator pendingBegin,
+        StreamerContext::PreparedQueue::iterator pendingEnd)
+    {
+        StreamStackEntry::UpdateCompletionEstimates(now, internalPending, pendingBegin, pendingEnd);
+        if (m_ringUnavailable)
+        {
+            return;
+        }
+
+        const RequestPath* activeFile = nullptr;
+        if (m_activeCacheSlot != InvalidFileCacheIndex)
+        {
+            activeFile = &m_fileCache_paths[m_activeCacheSlot];
+        }
+        u64 activeOffset = m_activeOffset;
+
+        // Determine the time of the first available slot
+        AZStd::chrono::system_clock::time_point earliestSlot = AZStd::chrono::system_clock::time_point::max();
+        for (size_t i = 0; i < m_readSlots_readInfo.size(); ++i)
+        {
+            if (m_readSlots_active[i])
+            {
+                FileReadInformation& read = m_readSlots_readInfo[i];
+                u64 totalBytesRead = m_readSizeAverage.GetTotal();
+                double totalReadTimeUSec = aznumeric_caster(m_readTimeAverage.GetTotal().count());
+                auto readCommand = AZStd::get_if<FileRequest::ReadData>(&read.m_request->GetCommand());
+                AZ_Assert(readCommand, "Request currently reading doesn't contain a read command.");
+                auto endTime = read.m_startTime +
+                    AZStd::chrono::microseconds(aznumeric_cast<u64>((readCommand->m_size * totalReadTimeUSec) / totalBytesRead));
+                earliestSlot = AZStd::min(earliestSlot, endTime);
+                read.m_request->SetEstimatedCompletion(endTime);
+            }
+        }
+        if (earliestSlot != AZStd::chrono::system_clock::time_point::max())
+        {
+            now = earliestSlot;
+        }
+
+        // Estimate requests in this stack entry.
+        for (FileRequest* request : m_pendingReadRequests)
+        {
+            EstimateCompletionTimeForRequest(request, now, activeFile, activeOffset);
+        }
+        for (FileRequest* request : m_pendingRequests)
+        {
+            EstimateCompletionTimeForRequest(request, now, activeFile, activeOffset);
+        }
+
+        // Estimate internally pending requests. Because this call will go from the top of the stack to the bottom,
+        // but estimation is calculated from the bottom to the top, this list should be processed in reverse order.
+        for (auto requestIt = internalPending.rbegin(); requestIt != internalPending.rend(); ++requestIt)
+        {
+            EstimateCompletionTimeForRequestChecked(*requestIt, now, activeFile, activeOffset);
+        }
+
+        // Estimate pending requests that have not been queued yet.
+        for (auto requestIt = pendingBegin; requestIt != pendingEnd; ++requestIt)
+        {
+            EstimateCompletionTimeForRequestChecked(*requestIt, now, activeFile, activeOffset);
+        }
+    }
+
+    void StorageDriveLinux::EstimateCompletionTimeForRequest(FileRequest* request, AZStd::chrono::system_clock::time_point& startTime,
+        const RequestPath*& activeFile, u64& activeOffset) const
+    {
+        u64 readSize = 0;
+        u64 offset = 0;
+        const RequestPath* targetFile = nullptr;
+
+        AZStd::visit([&](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, FileRequest::ReadData>)
+            {
+                targetFile = &args.m_path;
+                readSize = args.m_size;
+                offset = args.m_offset;
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::CompressedReadData>)
+            {
+                targetFile = &args.m_compressionInfo.m_archiveFilename;
+                readSize = args.m_compressionInfo.m_compressedSize;
+                offset = args.m_compressionInfo.m_offset;
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::FileExistsCheckData>)
+            {
+                readSize = 0;
+                startTime += m_getFileExistsTimeAverage.CalculateAverage();
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::FileMetaDataRetrievalData>)
+            {
+                readSize = 0;
+                startTime += m_getFileMetaDataRetrievalTimeAverage.CalculateAverage();
+            }
+        }, request->GetCommand());
+
+        if (readSize > 0)
+        {
+            if (activeFile && activeFile != targetFile)
+            {
+                if (FindInFileHandleCache(*targetFile) == InvalidFileCacheIndex)
+                {
+                    startTime += m_fileOpenCloseTimeAverage.CalculateAverage();
+                }
+                activeOffset = std::numeric_limits<u64>::max();
+            }
+
+            if (activeOffset != offset && m_constructionOptions.m_hasSeekPenalty)
+            {
+                startTime += s_averageSeekTime;
+            }
+
+            // Reads are serviced in parallel, so the average time per read is divided over the queue depth.
+            u64 totalBytesRead = m_readSizeAverage.GetTotal();
+            double totalReadTimeUSec = aznumeric_caster(m_readTimeAverage.GetTotal().count());
+            startTime += AZStd::chrono::microseconds(aznumeric_cast<u64>((readSize * totalReadTimeUSec) / totalBytesRead));
+            activeOffset = offset + readSize;
+        }
+        request->SetEstimatedCompletion(startTime);
+    }
+
+    void StorageDriveLinux::EstimateCompletionTimeForRequestChecked(FileRequest* request,
+        AZStd::chrono::system_clock::time_point startTime, const RequestPath*& activeFile, u64& activeOffset) const
+    {
+        AZStd::visit([&, this](auto&& args)
+        {
+            using Command = AZStd::decay_t<decltype(args)>;
+            if constexpr (AZStd::is_same_v<Command, FileRequest::ReadData> ||
+                          AZStd::is_same_v<Command, FileRequest::FileExistsCheckData>)
+            {
+                if (IsServicedByThisDrive(args.m_path.GetAbsolutePath()))
+                {
+                    EstimateCompletionTimeForRequest(request, startTime, activeFile, activeOffset);
+                }
+            }
+            else if constexpr (AZStd::is_same_v<Command, FileRequest::CompressedReadData>)
+            {
+                if (IsServicedByThisDrive(args.m_compressionInfo.m_archiveFilename.GetAbsolutePath()))
+                {
+                    EstimateCompletionTimeForRequest(request, startTime, activeFile, activeOffset);
+                }
+            }
+        }, request->GetCommand());
+    }
+
+    s32 StorageDriveLinux::CalculateNumAvailableSlots() const
+    {
+        return (m_overCommit + aznumeric_cast<s32>(m_queueDepth)) - aznumeric_cast<s32>(m_pendingReadRequests.size()) -
+            aznumeric_cast<s32>(m_pendingRequests.size()) - m_activeReads_Count;
+    }
+
+    auto StorageDriveLinux::OpenFile(int& fileHandle, size_t& cacheSlot, FileRequest* request, const FileRequest::ReadData& data)
+        -> OpenFileResult
+    {
+        int file = InvalidFileHandle;
+
+        // If the file is already opened for use, use that file handle and update it's last touched time.
+        size_t cacheIndex = FindInFileHandleCache(data.m_path);
+        if (cacheIndex != InvalidFileCacheIndex)
+        {
+            file = m_fileCache_handles[cacheIndex];
+            AZ_Assert(file != InvalidFileHandle, "Found the file '%s' in cache, but file handle is invalid.\n",
+                data.m_path.GetRelativePath());
+        }
+        else
+        {
+            // If the file is not already found in the cache, attempt to claim an available cache entry.
+            cacheIndex = FindAvailableFileHandleCacheIndex();
+            if (cacheIndex == InvalidFileCacheIndex)
+            {
+                // No files ready to be evicted.
+                return OpenFileResult::CacheFull;
+            }
+
+            // Adding explicit scope here for profiling file Open & Close
+            {
+                AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::ReadRequest OpenFile %s", m_name.c_str());
+                TIMED_AVERAGE_WINDOW_SCOPE(m_fileOpenCloseTimeAverage);
+
+                bool isUnbuffered = false;
+                if (m_constructionOptions.m_enableUnbufferedReads)
+                {
+                    file = ::open(data.m_path.GetAbsolutePath(), O_RDONLY | O_CLOEXEC | O_DIRECT);
+                    isUnbuffered = file != InvalidFileHandle;
+                }
+                if (file == InvalidFileHandle)
+                {
+                    // Either unbuffered reads are disabled or the file system doesn't support O_DIRECT.
+                    file = ::open(data.m_path.GetAbsolutePath(), O_RDONLY | O_CLOEXEC);
+                }
+
+                if (file == InvalidFileHandle)
+                {
+                    // Failed to open the file, so let the next entry in the stack try.
+                    StreamStackEntry::QueueRequest(request);
+                    return OpenFileResult::RequestForwarded;
+                }
+
+                CloseFileHandle(cacheIndex);
+                m_fileCache_isUnbuffered[cacheIndex] = isUnbuffered;
+                m_fileCache_closePending[cacheIndex] = false;
+            }
+
+            // Fill the cache entry with data about the new file.
+            m_fileCache_handles[cacheIndex] = file;
+            m_fileCache_activeReads[cacheIndex] = 0;
+            m_fileCache_paths[cacheIndex] = data.m_path;
+        }
+
+        // Set the current request and update timestamp, regardless of cache hit or miss.
+        m_fileCache_lastTimeUsed[cacheIndex] = AZStd::chrono::system_clock::now();
+        fileHandle = file;
+        cacheSlot = cacheIndex;
+        return OpenFileResult::FileOpened;
+    }
+
+    bool StorageDriveLinux::ReadRequest(FileRequest* request)
+    {
+        if (!m_cachesInitialized)
+        {
+            m_fileCache_lastTimeUsed.resize(m_maxFileHandles, AZStd::chrono::system_clock::time_point::min());
+            m_fileCache_paths.resize(m_maxFileHandles);
+            m_fileCache_handles.resize(m_maxFileHandles, InvalidFileHandle);
+            m_fileCache_activeReads.resize(m_maxFileHandles, 0);
+            m_fileCache_isUnbuffered.resize(m_maxFileHandles, false);
+            m_fileCache_closePending.resize(m_maxFileHandles, false);
+
+            m_readSlots_readInfo.resize(m_queueDepth);
+            m_readSlots_active.resize(m_queueDepth);
+
+            m_cachesInitialized = true;
+        }
+
+        if (m_activeReads_Count >= m_queueDepth)
+        {
+            return false;
+        }
+
+        size_t readSlot = FindAvailableReadSlot();
+        AZ_Assert(readSlot != InvalidReadSlotIndex, "Active read slot count indicates there's a read slot available, but no read slot was found.");
+
+        return ReadRequest(request, readSlot);
+    }
+
+    bool StorageDriveLinux::ReadRequest(FileRequest* request, size_t readSlot)
+    {
+        AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::ReadRequest %s", m_name.c_str());
+
+        if (m_completionEvent == InvalidFileHandle)
+        {
+            // The first read claims an event so completions wake up the streamer thread if it goes to sleep. The event
+            // stays registered with the ring for the lifetime of this drive, so it's only registered once.
+            if (!m_context->GetStreamerThreadSynchronizer().AreEventHandlesAvailable())
+            {
+                // There are no more events handles available so delay executing this request until events become available.
+                return false;
+            }
+            m_completionEvent = m_context->GetStreamerThreadSynchronizer().CreateEventHandle();
+            if (!m_ring.RegisterEventFd(m_completionEvent))
+            {
+                AZ_Warning("StorageDriveLinux", false, "Failed to register completion event with io_uring (Error: %i).\n", errno);
+            }
+        }
+
+        auto data = AZStd::get_if<FileRequest::ReadData>(&request->GetCommand());
+        AZ_Assert(data, "Read request in StorageDriveLinux doesn't contain read data.");
+
+        int file = InvalidFileHandle;
+        size_t fileCacheSlot = InvalidFileCacheIndex;
+        switch (OpenFile(file, fileCacheSlot, request, *data))
+        {
+        case OpenFileResult::FileOpened:
+            break;
+        case OpenFileResult::RequestForwarded:
+            return true;
+        case OpenFileResult::CacheFull:
+            return false;
+        default:
+            AZ_Assert(false, "Unsupported OpenFileRequest returned.");
+        }
+
+        io_uring_sqe* entry = m_ring.GetSubmissionEntry();
+        if (!entry)
+        {
+            // The submission queue is full. This only happens if the kernel hasn't consumed previous entries yet. The
+            // file remains in the handle cache so the next attempt doesn't have to open it again.
+            return false;
+        }
+
+        u64 readSize = data->m_size;
+        u64 readOffs = data->m_offset;
+        void* output = data->m_output;
+
+        FileReadInformation& readInfo = m_readSlots_readInfo[readSlot];
+        readInfo.m_request = request;
+        readInfo.m_fileHandleIndex = fileCacheSlot;
+
+        if (m_fileCache_isUnbuffered[fileCacheSlot])
+        {
+            // O_DIRECT requires the output address, the offset and the size to be aligned to the sector size. If any
+            // of these are unaligned, read into an internal aligned buffer and copy the requested section back when
+            // the read completes. See StorageDriveWin::ReadRequest for a breakdown of the adjustments.
+            const bool alignedAddr = IStreamerTypes::IsAlignedTo(data->m_output, aznumeric_caster(m_physicalSectorSize));
+            const bool alignedOffs = IStreamerTypes::IsAlignedTo(data->m_offset, aznumeric_caster(m_logicalSectorSize));
+
+            if (!alignedOffs)
+            {
+                readOffs = AZ_SIZE_ALIGN_DOWN(readOffs, m_logicalSectorSize);
+                u64 offsetCorrection = data->m_offset - readOffs;
+                readInfo.m_copyBackOffset = offsetCorrection;
+                readSize = data->m_size + offsetCorrection;
+            }
+
+            bool alignedSize = IStreamerTypes::IsAlignedTo(readSize, aznumeric_caster(m_logicalSectorSize));
+            if (!alignedSize)
+            {
+                u64 alignedReadSize = AZ_SIZE_ALIGN_UP(readSize, m_logicalSectorSize);
+                if (alignedReadSize <= data->m_outputSize)
+                {
+                    alignedSize = true;
+                    readSize = alignedReadSize;
+                }
+            }
+
+            const bool isAligned = (alignedAddr && alignedSize && alignedOffs);
+            if (!isAligned)
+            {
+                readSize = AZ_SIZE_ALIGN_UP(readSize, m_logicalSectorSize);
+                readInfo.AllocateAlignedBuffer(readSize, m_physicalSectorSize);
+                output = readInfo.m_sectorAlignedOutput;
+            }
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+            m_directReadsPercentageStat.PushSample(isAligned ? 1.0 : 0.0);
+            Statistic::PlotImmediate(m_name, DirectReadsName, m_directReadsPercentageStat.GetMostRecentSample());
+#endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+        }
+
+        // IORING_OP_READV is used instead of IORING_OP_READ as it's available on all kernels that support io_uring.
+        readInfo.m_ioVector.iov_base = output;
+        readInfo.m_ioVector.iov_len = readSize;
+
+        entry->opcode = IORING_OP_READV;
+        entry->fd = file;
+        entry->off = readOffs;
+        entry->addr = reinterpret_cast<u64>(&readInfo.m_ioVector);
+        entry->len = 1;
+        entry->user_data = readSlot;
+        readInfo.m_fileOffset = readOffs;
+
+        auto now = AZStd::chrono::system_clock::now();
+        if (m_activeReads_Count++ == 0)
+        {
+            m_activeReads_startTime = now;
+        }
+        readInfo.m_startTime = now;
+        m_readSlots_active[readSlot] = true;
+
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+        if (m_activeCacheSlot == fileCacheSlot)
+        {
+            m_fileSwitchPercentageStat.PushSample(0.0);
+            m_seekPercentageStat.PushSample(m_activeOffset == data->m_offset ? 0.0 : 1.0);
+        }
+        else
+        {
+            m_fileSwitchPercentageStat.PushSample(1.0);
+            m_seekPercentageStat.PushSample(0.0);
+        }
+        m_queueDepthStat.PushSample(m_activeReads_Count);
+
+        Statistic::PlotImmediate(m_name, FileSwitchesName, m_fileSwitchPercentageStat.GetMostRecentSample());
+        Statistic::PlotImmediate(m_name, SeeksName, m_seekPercentageStat.GetMostRecentSample());
+        Statistic::PlotImmediate(m_name, QueueDepthName, m_queueDepthStat.GetMostRecentSample());
+#endif // AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+
+        m_fileCache_activeReads[fileCacheSlot]++;
+        m_activeCacheSlot = fileCacheSlot;
+        m_activeOffset = readOffs + readSize;
+
+        return true;
+    }
+
+    bool StorageDriveLinux::CancelRequest(FileRequest* cancelRequest, FileRequestPtr& target)
+    {
+        bool ownsRequestChain = false;
+        for (auto it = m_pendingReadRequests.begin(); it != m_pendingReadRequests.end();)
+        {
+            if ((*it)->WorksOn(target))
+            {
+                (*it)->SetStatus(IStreamerTypes::RequestStatus::Canceled);
+                m_context->MarkRequestAsCompleted(*it);
+                it = m_pendingReadRequests.erase(it);
+                ownsRequestChain = true;
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        // Pending requests have been accounted for, now address any active reads by asking the kernel to cancel them.
+        // A read that already started can't always be canceled, in which case it completes normally but is still
+        // reported as canceled.
+        for (size_t readSlot = 0; readSlot < m_readSlots_active.size(); ++readSlot)
+        {
+            if (m_readSlots_active[readSlot] && m_readSlots_readInfo[readSlot].m_request->WorksOn(target))
+            {
+                ownsRequestChain = true;
+                m_readSlots_readInfo[readSlot].m_isCanceled = true;
+                if (io_uring_sqe* entry = m_ring.GetSubmissionEntry(); entry != nullptr)
+                {
+                    entry->opcode = IORING_OP_ASYNC_CANCEL;
+                    entry->fd = -1;
+                    entry->addr = readSlot;
+                    entry->user_data = IgnoredCompletion;
+                }
+            }
+        }
+        SubmitEntries();
+
+        if (ownsRequestChain)
+        {
+            cancelRequest->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(cancelRequest);
+        }
+
+        return ownsRequestChain;
+    }
+
+    void StorageDriveLinux::FileExistsRequest(FileRequest* request)
+    {
+        auto& fileExists = AZStd::get<FileRequest::FileExistsCheckData>(request->GetCommand());
+
+        AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::FileExistsRequest %s : %s",
+            m_name.c_str(), fileExists.m_path.GetRelativePath());
+        TIMED_AVERAGE_WINDOW_SCOPE(m_getFileExistsTimeAverage);
+
+        AZ_Assert(IsServicedByThisDrive(fileExists.m_path.GetAbsolutePath()),
+            "FileExistsRequest was queued on a StorageDriveLinux that doesn't service files on the given path '%s'.",
+            fileExists.m_path.GetRelativePath());
+
+        size_t cacheIndex = FindInFileHandleCache(fileExists.m_path);
+        if (cacheIndex != InvalidFileCacheIndex)
+        {
+            fileExists.m_found = true;
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+
+        cacheIndex = FindInMetaDataCache(fileExists.m_path);
+        if (cacheIndex != InvalidMetaDataCacheIndex)
+        {
+            fileExists.m_found = true;
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+
+        struct stat attributes;
+        if (::stat(fileExists.m_path.GetAbsolutePath(), &attributes) == 0)
+        {
+            if (S_ISREG(attributes.st_mode))
+            {
+                cacheIndex = GetNextMetaDataCacheSlot();
+                m_metaDataCache_paths[cacheIndex] = fileExists.m_path;
+                m_metaDataCache_fileSize[cacheIndex] = aznumeric_caster(attributes.st_size);
+                fileExists.m_found = true;
+
+                request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+                m_context->MarkRequestAsCompleted(request);
+            }
+            return;
+        }
+
+        StreamStackEntry::QueueRequest(request);
+    }
+
+    void StorageDriveLinux::FileMetaDataRetrievalRequest(FileRequest* request)
+    {
+        auto& command = AZStd::get<FileRequest::FileMetaDataRetrievalData>(request->GetCommand());
+
+        AZ_PROFILE_SCOPE(AzCore, "StorageDriveLinux::FileMetaDataRetrievalRequest %s : %s",
+            m_name.c_str(), command.m_path.GetRelativePath());
+        TIMED_AVERAGE_WINDOW_SCOPE(m_getFileMetaDataRetrievalTimeAverage);
+
+        size_t cacheIndex = FindInMetaDataCache(command.m_path);
+        if (cacheIndex != InvalidMetaDataCacheIndex)
+        {
+            command.m_fileSize = m_metaDataCache_fileSize[cacheIndex];
+            command.m_found = true;
+            request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+            m_context->MarkRequestAsCompleted(request);
+            return;
+        }
+
+        struct stat attributes;
+        cacheIndex = FindInFileHandleCache(command.m_path);
+        if (cacheIndex != InvalidFileCacheIndex)
+        {
+            AZ_Assert(m_fileCache_handles[cacheIndex] != InvalidFileHandle,
+                "File path '%s' doesn't have an associated file handle.", m_fileCache_paths[cacheIndex].GetRelativePath());
+            if (::fstat(m_fileCache_handles[cacheIndex], &attributes) != 0)
+            {
+                StreamStackEntry::QueueRequest(request);
+                return;
+            }
+        }
+        else if (::stat(command.m_path.GetAbsolutePath(), &attributes) != 0 || !S_ISREG(attributes.st_mode))
+        {
+            StreamStackEntry::QueueRequest(request);
+            return;
+        }
+
+        command.m_fileSize = aznumeric_caster(attributes.st_size);
+        command.m_found = true;
+
+        cacheIndex = GetNextMetaDataCacheSlot();
+        m_metaDataCache_paths[cacheIndex] = command.m_path;
+        m_metaDataCache_fileSize[cacheIndex] = aznumeric_caster(attributes.st_size);
+
+        request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+        m_context->MarkRequestAsCompleted(request);
+    }
+
+    void StorageDriveLinux::CloseFileHandle(size_t cacheIndex)
+    {
+        if (m_fileCache_handles[cacheIndex] != InvalidFileHandle)
+        {
+            AZ_Assert(m_fileCache_activeReads[cacheIndex] == 0, "Closing '%s' but it has %u active reads\n",
+                m_fileCache_paths[cacheIndex].GetRelativePath(), m_fileCache_activeReads[cacheIndex]);
+            ::close(m_fileCache_handles[cacheIndex]);
+            m_fileCache_handles[cacheIndex] = InvalidFileHandle;
+        }
+    }
+
+    void StorageDriveLinux::ReleaseFileHandle(size_t cacheIndex)
+    {
+        if (m_fileCache_activeReads[cacheIndex] == 0)
+        {
+            CloseFileHandle(cacheIndex);
+            m_fileCache_closePending[cacheIndex] = false;
+        }
+        else
+        {
+            // The kernel is still reading from the file, so keep the handle open until those reads complete. Clearing
+            // the path below makes sure no new reads will be queued on this handle in the meantime.
+            m_fileCache_closePending[cacheIndex] = true;
+        }
+    }
+
+    void StorageDriveLinux::FlushCache(const RequestPath& filePath)
+    {
+        if (m_cachesInitialized)
+        {
+            size_t cacheIndex = FindInFileHandleCache(filePath);
+            if (cacheIndex != InvalidFileCacheIndex)
+            {
+                ReleaseFileHandle(cacheIndex);
+                m_fileCache_lastTimeUsed[cacheIndex] = AZStd::chrono::system_clock::time_point();
+                m_fileCache_paths[cacheIndex].Clear();
+            }
+
+            cacheIndex = FindInMetaDataCache(filePath);
+            if (cacheIndex != InvalidMetaDataCacheIndex)
+            {
+                m_metaDataCache_paths[cacheIndex].Clear();
+                m_metaDataCache_fileSize[cacheIndex] = 0;
+            }
+        }
+    }
+
+    void StorageDriveLinux::FlushEntireCache()
+    {
+        if (m_cachesInitialized)
+        {
+            // Clear file handle cache
+            for (size_t cacheIndex = 0; cacheIndex < m_maxFileHandles; ++cacheIndex)
+            {
+                ReleaseFileHandle(cacheIndex);
+                m_fileCache_lastTimeUsed[cacheIndex] = AZStd::chrono::system_clock::time_point();
+                m_fileCache_paths[cacheIndex].Clear();
+            }
+
+            // Clear meta data cache
+            auto metaDataCacheSize = m_metaDataCache_paths.size();
+            m_metaDataCache_paths.clear();
+            m_metaDataCache_fileSize.clear();
+            m_metaDataCache_front = 0;
+            m_metaDataCache_paths.resize(metaDataCacheSize);
+            m_metaDataCache_fileSize.resize(metaDataCacheSize);
+        }
+    }
+
+    bool StorageDriveLinux::FinalizeReads()
+    {
+        AZ_PROFILE_FUNCTION(AzCore);
+
+        // The completion queue is always drained, even if no reads are active, because the completions for cancel
+        // requests can arrive after the read they targeted has already completed.
+        bool hasWorked = false;
+        m_ring.ProcessCompletions([this, &hasWorked](u64 userData, s32 result)
+            {
+                if (userData != IgnoredCompletion)
+                {
+                    hasWorked = true;
+                    FinalizeSingleRequest(aznumeric_cast<size_t>(userData), result);
+                }
+            });
+        return hasWorked;
+    }
+
+    void StorageDriveLinux::FinalizeSingleRequest(size_t readSlot, s32 result)
+    {
+        AZ_Assert(readSlot < m_readSlots_active.size() && m_readSlots_active[readSlot],
+            "io_uring returned a completion for read slot %zu which isn't active.", readSlot);
+
+        FileReadInformation& fileReadInfo = m_readSlots_readInfo[readSlot];
+
+        auto readCommand = AZStd::get_if<FileRequest::ReadData>(&fileReadInfo.m_request->GetCommand());
+        AZ_Assert(readCommand != nullptr, "Request stored with the io_uring read did not contain a read request.");
+
+        const bool encounteredError = result < 0 && result != -ECANCELED;
+        const size_t numBytesTransferred = result > 0 ? aznumeric_cast<size_t>(result) : 0;
+        AZ_Error("StorageDriveLinux", !encounteredError, "Async file read operation completed with error code %i\n", -result);
+
+        m_activeReads_ByteCount += numBytesTransferred;
+        fileReadInfo.m_bytesTransferred += numBytesTransferred;
+
+        // A read can return fewer bytes than requested without having reached the end of the file, for instance if it
+        // got interrupted. In that case queue another read for the remainder instead of failing the request. A read
+        // that returns no data has reached the end of the file and will fail below.
+        if (numBytesTransferred > 0 && numBytesTransferred < fileReadInfo.m_ioVector.iov_len && !fileReadInfo.m_isCanceled &&
+            fileReadInfo.m_bytesTransferred < fileReadInfo.m_copyBackOffset + readCommand->m_size)
+        {
+            fileReadInfo.m_ioVector.iov_base = reinterpret_cast<u8*>(fileReadInfo.m_ioVector.iov_base) + numBytesTransferred;
+            fileReadInfo.m_ioVector.iov_len -= numBytesTransferred;
+            if (!SubmitRemainingRead(readSlot))
+            {
+                // The submission queue is full, so try again on the next update. The read keeps its slot in the meantime.
+                m_pendingResubmissions.push_back(readSlot);
+            }
+            return;
+        }
+
+        if (--m_activeReads_Count == 0)
+        {
+            // Update read stats now that the operation is done.
+            m_readSizeAverage.PushEntry(m_activeReads_ByteCount);
+            m_readTimeAverage.PushEntry(AZStd::chrono::duration_cast<AZStd::chrono::microseconds>(
+                AZStd::chrono::system_clock::now() - m_activeReads_startTime));
+
+            m_activeReads_ByteCount = 0;
+        }
+
+        // The request could be reading more due to alignment requirements. It should however never read less that the amount of
+        // requested data.
+        const bool isCanceled = fileReadInfo.m_isCanceled || result == -ECANCELED;
+        const bool isSuccess = !encounteredError && !isCanceled &&
+            (fileReadInfo.m_copyBackOffset + readCommand->m_size <= fileReadInfo.m_bytesTransferred);
+
+        if (fileReadInfo.m_sectorAlignedOutput && isSuccess)
+        {
+            auto offsetAddress = reinterpret_cast<u8*>(fileReadInfo.m_sectorAlignedOutput) + fileReadInfo.m_copyBackOffset;
+            ::memcpy(readCommand->m_output, offsetAddress, readCommand->m_size);
+        }
+
+        fileReadInfo.m_request->SetStatus(
+            isCanceled
+                ? IStreamerTypes::RequestStatus::Canceled
+                : isSuccess
+                    ? IStreamerTypes::RequestStatus::Completed
+                    : IStreamerTypes::RequestStatus::Failed
+        );
+        m_context->MarkRequestAsCompleted(fileReadInfo.m_request);
+
+        const size_t fileCacheSlot = fileReadInfo.m_fileHandleIndex;
+        if (--m_fileCache_activeReads[fileCacheSlot] == 0 && m_fileCache_closePending[fileCacheSlot])
+        {
+            CloseFileHandle(fileCacheSlot);
+            m_fileCache_closePending[fileCacheSlot] = false;
+        }
+        m_readSlots_active[readSlot] = false;
+        fileReadInfo.Clear();
+    }
+
+    bool StorageDriveLinux::SubmitRemainingRead(size_t readSlot)
+    {
+        io_uring_sqe* entry = m_ring.GetSubmissionEntry();
+        if (!entry)
+        {
+            return false;
+        }
+
+        FileReadInformation& fileReadInfo = m_readSlots_readInfo[readSlot];
+        entry->opcode = IORING_OP_READV;
+        entry->fd = m_fileCache_handles[fileReadInfo.m_fileHandleIndex];
+        entry->off = fileReadInfo.m_fileOffset + fileReadInfo.m_bytesTransferred;
+        entry->addr = reinterpret_cast<u64>(&fileReadInfo.m_ioVector);
+        entry->len = 1;
+        entry->user_data = readSlot;
+        return true;
+    }
+
+    size_t StorageDriveLinux::FindInFileHandleCache(const RequestPath& filePath) const
+    {
+        size_t numFiles = m_fileCache_paths.size();
+        for (size_t i = 0; i < numFiles; ++i)
+        {
+            if (m_fileCache_paths[i] == filePath)
+            {
+                return i;
+            }
+        }
+        return InvalidFileCacheIndex;
+    }
+
+    size_t StorageDriveLinux::FindAvailableFileHandleCacheIndex() const
+    {
+        AZ_Assert(m_cachesInitialized, "Using file cache before it has been (lazily) initialized\n");
+
+        // This needs to look for files with no active reads, and the oldest file among those.
+        size_t cacheIndex = InvalidFileCacheIndex;
+        AZStd::chrono::system_clock::time_point oldest = AZStd::chrono::system_clock::time_point::max();
+        for (size_t index = 0; index < m_maxFileHandles; ++index)
+        {
+            if (m_fileCache_activeReads[index] == 0 && m_fileCache_lastTimeUsed[index] < oldest)
+            {
+                oldest = m_fileCache_lastTimeUsed[index];
+                cacheIndex = index;
+            }
+        }
+
+        return cacheIndex;
+    }
+
+    size_t StorageDriveLinux::FindAvailableReadSlot()
+    {
+        for (size_t i = 0; i < m_readSlots_active.size(); ++i)
+        {
+            if (!m_readSlots_active[i])
+            {
+                return i;
+            }
+        }
+        return InvalidReadSlotIndex;
+    }
+
+    size_t StorageDriveLinux::FindInMetaDataCache(const RequestPath& filePath) const
+    {
+        size_t numFiles = m_metaDataCache_paths.size();
+        for (size_t i = 0; i < numFiles; ++i)
+        {
+            if (m_metaDataCache_paths[i] == filePath)
+            {
+                return i;
+            }
+        }
+        return InvalidMetaDataCacheIndex;
+    }
+
+    size_t StorageDriveLinux::GetNextMetaDataCacheSlot()
+    {
+        m_metaDataCache_front = (m_metaDataCache_front + 1) & (m_metaDataCache_paths.size() - 1);
+        return m_metaDataCache_front;
+    }
+
+    bool StorageDriveLinux::IsServicedByThisDrive(const char* filePath) const
+    {
+        // Only absolute paths are serviced. Paths are compared by prefix only, so mount points aren't resolved.
+        for (const AZStd::string& drivePath : m_drivePaths)
+        {
+            if (strncmp(filePath, drivePath.c_str(), drivePath.length()) == 0 &&
+                (filePath[drivePath.length()] == '/' || filePath[drivePath.length()] == 0))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void StorageDriveLinux::CollectStatistics(AZStd::vector<Statistic>& statistics) const
+    {
+        if (m_cachesInitialized)
+        {
+            constexpr double bytesToMB = aznumeric_cast<double>(1_mib);
+            using DoubleSeconds = AZStd::chrono::duration<double>;
+
+            double totalBytesReadMB = m_readSizeAverage.GetTotal() / bytesToMB;
+            double totalReadTimeSec = AZStd::chrono::duration_cast<DoubleSeconds>(m_readTimeAverage.GetTotal()).count();
+            statistics.push_back(Statistic::CreateFloat(m_name, "Read Speed (avg. mbps)", totalBytesReadMB / totalReadTimeSec));
+            statistics.push_back(Statistic::CreateInteger(m_name, "File Open & Close (avg. us)", m_fileOpenCloseTimeAverage.CalculateAverage().count()));
+            statistics.push_back(Statistic::CreateInteger(m_name, "Get file exists (avg. us)", m_getFileExistsTimeAverage.CalculateAverage().count()));
+            statistics.push_back(Statistic::CreateInteger(m_name, "Get file meta data (avg. us)", m_getFileMetaDataRetrievalTimeAverage.CalculateAverage().count()));
+
+            statistics.push_back(Statistic::CreateInteger(m_name, "Available slots", CalculateNumAvailableSlots()));
+
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+            statistics.push_back(Statistic::CreatePercentage(m_name, FileSwitchesName, m_fileSwitchPercentageStat.GetAverage()));
+            statistics.push_back(Statistic::CreatePercentage(m_name, SeeksName, m_seekPercentageStat.GetAverage()));
+            statistics.push_back(Statistic::CreatePercentage(m_name, DirectReadsName, m_directReadsPercentageStat.GetAverage()));
+            statistics.push_back(Statistic::CreateFloat(m_name, QueueDepthName, m_queueDepthStat.GetAverage()));
+#endif
+        }
+        StreamStackEntry::CollectStatistics(statistics);
+    }
+
+    void StorageDriveLinux::Report(const FileRequest::ReportData& data) const
+    {
+        switch (data.m_reportType)
+        {
+        case FileRequest::ReportData::ReportType::FileLocks:
+            if (m_cachesInitialized)
+            {
+                for (u32 i = 0; i < m_maxFileHandles; ++i)
+                {
+                    if (m_fileCache_handles[i] != InvalidFileHandle)
+                    {
+                        AZ_Printf("Streamer", "File lock in %s : '%s'.\n", m_name.c_str(), m_fileCache_paths[i].GetRelativePath());
+                    }
+                }
+            }
+            else
+            {
+                AZ_Printf("Streamer", "File lock in %s : No files have been streamed.\n", m_name.c_str());
+            }
+            break;
+        default:
+            break;
+        }
+    }
+} // namespace AZ::IO
@@ -0,0 +1,247 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IO/Streamer/Statistics.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/IO/Streamer/StreamStackEntry.h>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/chrono/clocks.h>
+#include <AzCore/std/string/string.h>
+#include <AzCore/std/string/string_view.h>
+#include <AzCore/Statistics/RunningStatistic.h>
+
+#include <sys/uio.h>
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+namespace AZ::IO
+{
+    //! Storage drive that uses io_uring to keep many reads in flight at the same time. Reads can optionally bypass the
+    //! page cache with O_DIRECT, in which case reads are adjusted to meet the sector alignment requirements. If io_uring
+    //! isn't available, for instance due to an older kernel or a container security policy, all requests are forwarded
+    //! to the next entry in the stack, which is expected to be the generic StorageDrive.
+    class StorageDriveLinux
+        : public StreamStackEntry
+    {
+    public:
+        struct ConstructionOptions
+        {
+            ConstructionOptions();
+
+            //! Whether or not the device has a cost for seeking, such as happens on platter disks. This
+            //! will be accounted for when predicting file reads.
+            u8 m_hasSeekPenalty : 1;
+            //! Use O_DIRECT to bypass the page cache. This results in a faster read the first time a file is read and
+            //! avoids double buffering data in the page cache, but subsequent reads will possibly be slower as those
+            //! could have been serviced from the page cache. File systems that don't support O_DIRECT, such as tmpfs,
+            //! automatically fall back to buffered reads.
+            u8 m_enableUnbufferedReads : 1;
+            //! If true, only information that's explicitly requested or issues are reported. If false, status information
+            //! such as when drives are created and destroyed is reported as well.
+            u8 m_minimalReporting : 1;
+        };
+
+        //! Creates an instance of a storage device that's optimized for use on Linux.
+        //! @param drivePaths The paths that are supported by this device.
+        //! @param maxFileHandles The maximum number of file handles that are cached. Only a small number are needed when
+        //!     running from archives, but it's recommended that a larger number are kept open when reading from loose files.
+        //! @param maxMetaDataCacheEntires The maximum number of files to keep meta data, such as the file size, to cache. Must
+        //!     be a power of 2.
+        //! @param physicalSectorSize The alignment for the output buffer when unbuffered reads are used.
+        //! @param logicalSectorSize The alignment for the file size and read offset when unbuffered reads are used.
+        //! @param queueDepth The maximum number of reads that are in flight at the same time.
+        //! @param overCommit The number of additional slots that will be reported as available. This makes sure that there are
+        //!     always a few requests pending to avoid starvation. A negative value will under-commit.
+        //! @param options Additional configuration options. See ConstructionOptions for more details.
+        StorageDriveLinux(const AZStd::vector<AZStd::string_view>& drivePaths, u32 maxFileHandles, u32 maxMetaDataCacheEntries,
+            size_t physicalSectorSize, size_t logicalSectorSize, u32 queueDepth, s32 overCommit, ConstructionOptions options);
+        ~StorageDriveLinux() override;
+
+        void PrepareRequest(FileRequest* request) override;
+        void QueueRequest(FileRequest* request) override;
+        bool ExecuteRequests() override;
+
+        void UpdateStatus(Status& status) const override;
+        void UpdateCompletionEstimates(AZStd::chrono::system_clock::time_point now, AZStd::vector<FileRequest*>& internalPending,
+            StreamerContext::PreparedQueue::iterator pendingBegin, StreamerContext::PreparedQueue::iterator pendingEnd) override;
+
+        void CollectStatistics(AZStd::vector<Statistic>& statistics) const override;
+
+    protected:
+        static const AZStd::chrono::microseconds s_averageSeekTime;
+
+        inline static constexpr size_t InvalidFileCacheIndex = std::numeric_limits<size_t>::max();
+        inline static constexpr size_t InvalidReadSlotIndex = std::numeric_limits<size_t>::max();
+        inline static constexpr size_t InvalidMetaDataCacheIndex = std::numeric_limits<size_t>::max();
+        inline static constexpr int InvalidFileHandle = -1;
+        //! User data for completions that don't belong to a read slot, such as cancel requests.
+        inline static constexpr u64 IgnoredCompletion = std::numeric_limits<u64>::max();
+
+        //! Thin wrapper around the memory mapped submission and completion rings of an io_uring instance. The raw
+        //! system calls are used so there's no dependency on liburing.
+        struct Ring
+        {
+            bool Initialize(u32 entries);
+            void Shutdown();
+            bool IsInitialized() const { return m_ringFd >= 0; }
+
+            //! Returns the next free submission entry or nullptr if the submission queue is full.
+            io_uring_sqe* GetSubmissionEntry();
+            //! Publishes all submission entries that were retrieved since the last call and notifies the kernel.
+            int Submit();
+            //! Calls the callback for each available completion entry without waiting.
+            template<typename Callback>
+            size_t ProcessCompletions(Callback&& callback);
+            //! Removes the entries that were published but not consumed by the kernel, which happens if Submit failed.
+            //! The callback is called with the user data of each removed entry.
+            template<typename Callback>
+            size_t DiscardPendingSubmissions(Callback&& callback);
+            //! Registers an eventfd that's signaled whenever a completion is posted.
+            bool RegisterEventFd(int eventFd);
+
+            int m_ringFd{ InvalidFileHandle };
+
+            void* m_submissionRing{ nullptr };
+            size_t m_submissionRingSize{ 0 };
+            void* m_completionRing{ nullptr };
+            size_t m_completionRingSize{ 0 };
+            io_uring_sqe* m_submissionEntries{ nullptr };
+            size_t m_submissionEntriesSize{ 0 };
+
+            u32* m_submissionHead{ nullptr };
+            u32* m_submissionTail{ nullptr };
+            u32* m_submissionMask{ nullptr };
+            u32* m_submissionArray{ nullptr };
+            u32* m_completionHead{ nullptr };
+            u32* m_completionTail{ nullptr };
+            u32* m_completionMask{ nullptr };
+            io_uring_cqe* m_completionEntries{ nullptr };
+
+            u32 m_localTail{ 0 };
+            u32 m_toSubmit{ 0 };
+        };
+
+        struct FileReadInformation
+        {
+            AZStd::chrono::system_clock::time_point m_startTime;
+            FileRequest* m_request{ nullptr };
+            void* m_sectorAlignedOutput{ nullptr };    // Internally allocated buffer that is sector aligned.
+            size_t m_copyBackOffset{ 0 };
+            size_t m_fileHandleIndex{ InvalidFileCacheIndex };
+            u64 m_fileOffset{ 0 };
+            size_t m_bytesTransferred{ 0 };    // Total over all (partial) reads issued for this request.
+            iovec m_ioVector{};
+            bool m_isCanceled{ false };
+
+            void AllocateAlignedBuffer(size_t size, size_t sectorSize);
+            void Clear();
+        };
+
+        enum class OpenFileResult
+        {
+            FileOpened,
+            RequestForwarded,
+            CacheFull
+        };
+
+        OpenFileResult OpenFile(int& fileHandle, size_t& cacheSlot, FileRequest* request, const FileRequest::ReadData& data);
+        bool ReadRequest(FileRequest* request);
+        bool ReadRequest(FileRequest* request, size_t readSlot);
+        bool CancelRequest(FileRequest* cancelRequest, FileRequestPtr& target);
+        void FileExistsRequest(FileRequest* request);
+        void FileMetaDataRetrievalRequest(FileRequest* request);
+        size_t FindInFileHandleCache(const RequestPath& filePath) const;
+        size_t FindAvailableFileHandleCacheIndex() const;
+        size_t FindAvailableReadSlot();
+        size_t FindInMetaDataCache(const RequestPath& filePath) const;
+        size_t GetNextMetaDataCacheSlot();
+        bool IsServicedByThisDrive(const char* filePath) const;
+
+        void EstimateCompletionTimeForRequest(FileRequest* request, AZStd::chrono::system_clock::time_point& startTime,
+            const RequestPath*& activeFile, u64& activeOffset) const;
+        void EstimateCompletionTimeForRequestChecked(FileRequest* request,
+            AZStd::chrono::system_clock::time_point startTime, const RequestPath*& activeFile, u64& activeOffset) const;
+        s32 CalculateNumAvailableSlots() const;
+
+        void FlushCache(const RequestPath& filePath);
+        void FlushEntireCache();
+        //! Closes the file handle, or defers closing it until all reads that are in flight for it have completed.
+        void ReleaseFileHandle(size_t cacheIndex);
+        void CloseFileHandle(size_t cacheIndex);
+
+        bool InitializeRing();
+        bool SubmitEntries();
+        bool FinalizeReads();
+        void FinalizeSingleRequest(size_t readSlot, s32 result);
+        //! Queues a read for the remainder of a partially completed read. Returns false if the submission queue is full.
+        bool SubmitRemainingRead(size_t readSlot);
+
+        void Report(const FileRequest::ReportData& data) const;
+
+        TimedAverageWindow<s_statisticsWindowSize> m_fileOpenCloseTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_getFileExistsTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_getFileMetaDataRetrievalTimeAverage;
+        TimedAverageWindow<s_statisticsWindowSize> m_readTimeAverage;
+        AverageWindow<u64, float, s_statisticsWindowSize> m_readSizeAverage;
+#if AZ_STREAMER_ADD_EXTRA_PROFILING_INFO
+        AZ::Statistics::RunningStatistic m_fileSwitchPercentageStat;
+        AZ::Statistics::RunningStatistic m_seekPercentageStat;
+        AZ::Statistics::RunningStatistic m_directReadsPercentageStat;
+        AZ::Statistics::RunningStatistic m_queueDepthStat;
+#endif
+        AZStd::chrono::system_clock::time_point m_activeReads_startTime;
+
+        AZStd::deque<FileRequest*> m_pendingReadRequests;
+        AZStd::deque<FileRequest*> m_pendingRequests;
+        //! Read slots with a partially completed read for which the remainder couldn't be submitted yet.
+        AZStd::deque<size_t> m_pendingResubmissions;
+
+        AZStd::vector<FileReadInformation> m_readSlots_readInfo;
+        AZStd::vector<bool> m_readSlots_active;
+
+        AZStd::vector<AZStd::chrono::system_clock::time_point> m_fileCache_lastTimeUsed;
+        AZStd::vector<RequestPath> m_fileCache_paths;
+        AZStd::vector<int> m_fileCache_handles;
+        AZStd::vector<u16> m_fileCache_activeReads;
+        AZStd::vector<bool> m_fileCache_isUnbuffered;
+        //! Set for file handles that were flushed while reads were still in flight. These are closed once the reads drain.
+        AZStd::vector<bool> m_fileCache_closePending;
+
+        AZStd::vector<RequestPath> m_metaDataCache_paths;
+        AZStd::vector<u64> m_metaDataCache_fileSize;
+
+        AZStd::vector<AZStd::string> m_drivePaths;
+
+        Ring m_ring;
+        //! Event claimed from the streamer thread synchronizer on the first read. It remains registered with the ring
+        //! until the drive is destroyed.
+        int m_completionEvent{ InvalidFileHandle };
+
+        size_t m_activeReads_ByteCount{ 0 };
+
+        size_t m_physicalSectorSize{ 0 };
+        size_t m_logicalSectorSize{ 0 };
+        size_t m_activeCacheSlot{ InvalidFileCacheIndex };
+        size_t m_metaDataCache_front{ 0 };
+        u64 m_activeOffset{ 0 };
+        u32 m_maxFileHandles{ 1 };
+        u32 m_queueDepth{ 1 };
+        s32 m_overCommit{ 0 };
+
+        u16 m_activeReads_Count{ 0 };
+
+        ConstructionOptions m_constructionOptions;
+        bool m_cachesInitialized{ false };
+        //! Set if io_uring couldn't be created, in which case all requests are forwarded.
+        bool m_ringUnavailable{ false };
+    };
+} // namespace AZ::IO
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/IStreamerTypes.h>
+#include <AzCore/IO/Streamer/MemoryMappedReaderConfig_Linux.h>
+#include <AzCore/IO/Streamer/StorageDriveConfig_Linux.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration.h>
+#include <AzCore/IO/Streamer/StreamerConfiguration_Linux.h>
+#include <AzCore/Casting/numeric_cast.h>
+
+#include <stdio.h>
+#include <sys/stat.h>
+#include <sys/statvfs.h>
+#include <sys/sysmacros.h>
+#include <unistd.h>
+
+namespace AZ::IO
+{
+    // Reads a single numeric value from sysfs. Returns the fallback if the entry isn't available, which is common
+    // in containers.
+    static size_t ReadSysFsValue(const char* path, size_t fallback)
+    {
+        size_t result = fallback;
+        if (FILE* file = fopen(path, "r"); file != nullptr)
+        {
+            unsigned long long value = 0;
+            if (fscanf(file, "%llu", &value) == 1 && value > 0)
+            {
+                result = aznumeric_cast<size_t>(value);
+            }
+            fclose(file);
+        }
+        return result;
+    }
+
+    // Finds the block device that backs the given path and returns whether it reports to be rotational. For a partition
+    // the queue information lives on the parent disk. Devices that can't be resolved, such as network and overlay file
+    // systems, are treated as not having a seek penalty.
+    static bool HasSeekPenalty(const char* path)
+    {
+        struct stat pathInfo;
+        if (::stat(path, &pathInfo) != 0)
+        {
+            return false;
+        }
+
+        const unsigned int deviceMajor = major(pathInfo.st_dev);
+        const unsigned int deviceMinor = minor(pathInfo.st_dev);
+        char sysFsPath[128];
+        azsnprintf(sysFsPath, AZ_ARRAY_SIZE(sysFsPath), "/sys/dev/block/%u:%u/queue/rotational", deviceMajor, deviceMinor);
+        if (::access(sysFsPath, R_OK) != 0)
+        {
+            azsnprintf(sysFsPath, AZ_ARRAY_SIZE(sysFsPath), "/sys/dev/block/%u:%u/../queue/rotational", deviceMajor, deviceMinor);
+        }
+        return ReadSysFsValue(sysFsPath, 0) != 0;
+    }
+
+    static bool CollectHardwareInfo(HardwareInformation& hardwareInfo, bool reportHardware)
+    {
+        // Linux doesn't have drive letters so a single drive is created that services the entire file system. The
+        // sector size is based on the file system block size as that's the granularity O_DIRECT reads are guaranteed
+        // to work with, regardless of the underlying block device.
+        struct statvfs fileSystemInfo;
+        if (::statvfs("/", &fileSystemInfo) != 0)
+        {
+            return false;
+        }
+
+        DriveInformation driveInformation;
+        driveInformation.m_paths.emplace_back("/");
+        driveInformation.m_profile = "Generic";
+        driveInformation.m_physicalSectorSize = AZStd::max<size_t>(fileSystemInfo.f_bsize, 512);
+        driveInformation.m_logicalSectorSize = driveInformation.m_physicalSectorSize;
+        driveInformation.m_pageSize = aznumeric_cast<size_t>(::sysconf(_SC_PAGESIZE));
+        driveInformation.m_maxTransfer = 512_kib;
+        // The io_uring submission queue depth. NVMe drives can handle far more, but beyond this point the scheduler
+        // loses its ability to reorder requests while the gains in throughput are negligible.
+        driveInformation.m_ioChannelCount = 32;
+        driveInformation.m_supportsQueuing = true;
+        driveInformation.m_hasSeekPenalty = HasSeekPenalty("/");
+
+        if (reportHardware)
+        {
+            AZ_Printf(
+                "Streamer",
+                "Drive info for '/':\n"
+                "    Sector size: %zu bytes\n"
+                "    Page size: %zu bytes\n"
+                "    Queue depth: %u\n"
+                "    Has seek penalty: %s\n",
+                driveInformation.m_physicalSectorSize, driveInformation.m_pageSize, driveInformation.m_ioChannelCount,
+                driveInformation.m_hasSeekPenalty ? "Yes" : "No");
+        }
+
+        hardwareInfo.m_maxPhysicalSectorSize = driveInformation.m_physicalSectorSize;
+        hardwareInfo.m_maxLogicalSectorSize = driveInformation.m_logicalSectorSize;
+        hardwareInfo.m_maxPageSize = driveInformation.m_pageSize;
+        hardwareInfo.m_maxTransfer = driveInformation.m_maxTransfer;
+        hardwareInfo.m_profile = driveInformation.m_profile;
+
+        DriveList driveList;
+        driveList.push_back(AZStd::move(driveInformation));
+        hardwareInfo.m_platformData = AZStd::make_any<DriveList>(AZStd::move(driveList));
+        return true;
+    }
+
+    bool CollectIoHardwareInformation(HardwareInformation& info, [[maybe_unused]] bool includeAllHardware, bool reportHardware)
+    {
+        if (!CollectHardwareInfo(info, reportHardware))
+        {
+            // The numbers below are based on common defaults from a local hardware survey.
+            info.m_maxPageSize = 4096;
+            info.m_maxTransfer = 512_kib;
+            info.m_maxPhysicalSectorSize = 4096;
+            info.m_maxLogicalSectorSize = 512;
+            info.m_profile = "Generic";
+        }
+        return true;
+    }
+
+    void ReflectNative(ReflectContext* context)
+    {
+        LinuxStorageDriveConfig::Reflect(context);
+        LinuxMemoryMappedReaderConfig::Reflect(context);
+    }
+} // namespace AZ::IO
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/Streamer/StreamerContext_Linux.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/std/utils.h>
+
+#include <errno.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+
+namespace AZ::Platform
+{
+    StreamerContextThreadSync::StreamerContextThreadSync()
+    {
+        for (size_t i = 0; i < MaxIoEvents + 1; ++i)
+        {
+            int event = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+            AZ_Assert(event >= 0, "Failed to create a required event for IO Scheduler (Error: %i).", errno);
+            m_events[i] = event;
+        }
+    }
+
+    StreamerContextThreadSync::~StreamerContextThreadSync()
+    {
+        for (int event : m_events)
+        {
+            if (event >= 0)
+            {
+                [[maybe_unused]] int result = ::close(event);
+                AZ_Assert(result == 0, "Failed to close an event handle for IO Scheduler (Error: %i)", errno);
+            }
+        }
+    }
+
+    void StreamerContextThreadSync::Suspend()
+    {
+        AZ_Assert(m_events[0] >= 0, "There is no synchronization event created for the main streamer thread to use to suspend.");
+
+        pollfd fds[MaxIoEvents + 1];
+        for (size_t i = 0; i < m_handleCount; ++i)
+        {
+            fds[i].fd = m_events[i];
+            fds[i].events = POLLIN;
+            fds[i].revents = 0;
+        }
+
+        int result;
+        do
+        {
+            result = ::poll(fds, m_handleCount, -1);
+        } while (result < 0 && errno == EINTR);
+
+        if (result > 0)
+        {
+            for (size_t i = 0; i < m_handleCount; ++i)
+            {
+                if (fds[i].revents & POLLIN)
+                {
+                    // Reset the event by draining the counter.
+                    eventfd_t value;
+                    ::eventfd_read(fds[i].fd, &value);
+                }
+            }
+        }
+        else
+        {
+            AZ_Assert(false, "Unexpected wait result: %i (Error: %i).", result, errno);
+        }
+    }
+
+    void StreamerContextThreadSync::Resume()
+    {
+        AZ_Assert(m_events[0] >= 0, "There is no synchronization event created for the main streamer thread to use to resume.");
+        ::eventfd_write(m_events[0], 1);
+    }
+
+    int StreamerContextThreadSync::CreateEventHandle()
+    {
+        AZ_Assert(m_handleCount < MaxIoEvents + 1, "There are no more slots available to allocate a new IO event in.");
+        return m_events[m_handleCount++];
+    }
+
+    void StreamerContextThreadSync::DestroyEventHandle(int event)
+    {
+        AZ_Assert(m_handleCount > 1, "There are no more IO events that can be destroyed.");
+
+        for (size_t i = 1; i < m_handleCount; ++i)
+        {
+            if (m_events[i] == event)
+            {
+                // Clear any pending signal so the next user of the event doesn't receive a spurious wake up.
+                eventfd_t value;
+                ::eventfd_read(event, &value);
+
+                m_handleCount--;
+                AZStd::swap(m_events[i], m_events[m_handleCount]);
+                return;
+            }
+        }
+
+        AZ_Assert(false, "IO event couldn't be destroyed as it wasn't found.");
+    }
+
+    size_t StreamerContextThreadSync::GetEventHandleCount() const
+    {
+        return m_handleCount - 1;
+    }
+
+    bool StreamerContextThreadSync::AreEventHandlesAvailable() const
+    {
+        return m_handleCount < MaxIoEvents + 1;
+    }
+} // namespace AZ::Platform
@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+
+namespace AZ::Platform
+{
+    //! Synchronization for the main streamer thread on Linux. The thread sleeps in poll() on a set of eventfds. The first
+    //! eventfd is reserved for wake up calls from the rest of the engine, the remaining ones can be handed out to
+    //! Streamer's internals, for instance to be registered with an io_uring so IO completions wake up the thread.
+    class StreamerContextThreadSync
+    {
+    public:
+        static constexpr size_t MaxIoEvents = 15;
+        static constexpr int InvalidEventHandle = -1;
+
+        StreamerContextThreadSync();
+        ~StreamerContextThreadSync();
+
+        void Suspend();
+        void Resume();
+
+        int CreateEventHandle();
+        void DestroyEventHandle(int event);
+        size_t GetEventHandleCount() const;
+        bool AreEventHandlesAvailable() const;
+
+    private:
+        // Note: The first event handle is reserved for the synchronization of the
+        // scheduler thread with the rest of the engine. The remaining event handles
+        // can be freely used by Streamer's internals.
+        int m_events[MaxIoEvents + 1];
+        size_t m_handleCount{ 1 }; // The first event is for external wake up calls.
+    };
+} // namespace AZ::Platform
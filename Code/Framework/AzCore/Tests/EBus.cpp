@@ -45,7 +45,7 @@ namespace BusImplementation
     };
 
     // Traits for the benchmark bus
-    template <AZ::EBusAddressPolicy addressPolicy, AZ::EBusHandlerPolicy handlerPolicy, bool locklessDispatch = false>
+    template <AZ::EBusAddressPolicy addressPolicy, AZ::EBusHandlerPolicy handlerPolicy, bool locklessDispatch = false, bool soleHandlerDispatch = false>
     class Traits
         : public AZ::EBusTraits
     {
@@ -53,6 +53,7 @@ namespace BusImplementation
         static const AZ::EBusAddressPolicy AddressPolicy = addressPolicy;
         static const AZ::EBusHandlerPolicy HandlerPolicy = handlerPolicy;
         static const bool LocklessDispatch = locklessDispatch;
+        static const bool EnableSoleHandlerDispatch = soleHandlerDispatch;
 
         // Allow queuing
         static const bool EnableEventQueue = true;
@@ -193,13 +194,17 @@ private:
 };
 
 // Definition of the benchmark bus, depending on supplied policies
-template <AZ::EBusAddressPolicy addressPolicy, AZ::EBusHandlerPolicy handlerPolicy, bool locklessDispatch = false>
-using TestBus = AZ::EBus<BusImplementation::Interface, BusImplementation::Traits<addressPolicy, handlerPolicy, locklessDispatch>>;
+template <AZ::EBusAddressPolicy addressPolicy, AZ::EBusHandlerPolicy handlerPolicy, bool locklessDispatch = false, bool soleHandlerDispatch = false>
+using TestBus = AZ::EBus<BusImplementation::Interface, BusImplementation::Traits<addressPolicy, handlerPolicy, locklessDispatch, soleHandlerDispatch>>;
 
 #define EBUS_TEST_ALIAS(BusType, AddressPolicy, HandlerPolicy)                                              \
     using BusType = TestBus<AZ::EBusAddressPolicy::AddressPolicy, AZ::EBusHandlerPolicy::HandlerPolicy>;    \
     namespace testing { namespace internal { template<> std::string GetTypeName<BusType>() { return #BusType; } } }
 
+#define EBUS_TEST_ALIAS_LOCKLESS(BusType, AddressPolicy, HandlerPolicy, SoleHandlerDispatch)                      \
+    using BusType = TestBus<AZ::EBusAddressPolicy::AddressPolicy, AZ::EBusHandlerPolicy::HandlerPolicy, true, SoleHandlerDispatch>; \
+    namespace testing { namespace internal { template<> std::string GetTypeName<BusType>() { return #BusType; } } }
+
 // Predefined benchmark bus instantiations
 // Single
 EBUS_TEST_ALIAS(OneToOne, Single, Single)
@@ -213,6 +218,13 @@ EBUS_TEST_ALIAS(ManyToManyOrdered, ById, MultipleAndOrdered)
 EBUS_TEST_ALIAS(ManyOrderedToOne, ByIdAndOrdered, Single)
 EBUS_TEST_ALIAS(ManyOrderedToMany, ByIdAndOrdered, Multiple)
 EBUS_TEST_ALIAS(ManyOrderedToManyOrdered, ByIdAndOrdered, MultipleAndOrdered)
+// Lockless, with and without sole handler dispatch
+EBUS_TEST_ALIAS_LOCKLESS(OneToOneLockless, Single, Single, false)
+EBUS_TEST_ALIAS_LOCKLESS(OneToOneSoleHandler, Single, Single, true)
+EBUS_TEST_ALIAS_LOCKLESS(OneToManyLockless, Single, Multiple, false)
+EBUS_TEST_ALIAS_LOCKLESS(OneToManySoleHandler, Single, Multiple, true)
+EBUS_TEST_ALIAS_LOCKLESS(ManyToManyLockless, ById, Multiple, false)
+EBUS_TEST_ALIAS_LOCKLESS(ManyToManySoleHandler, ById, Multiple, true)
 
 // Handler for multi-address buses
 template <typename Bus, AZ::EBusAddressPolicy addressPolicy = Bus::Traits::AddressPolicy>
@@ -1848,6 +1860,172 @@ namespace UnitTest
 
     }
 
+    namespace MessageQueueTest
+    {
+        using MessageQueue = AZ::Internal::EBusMessageQueue<AZ::Internal::EBusEnvironmentAllocator, AZStd::mutex>;
+
+        // Counts the number of live instances to check that queued functions are destroyed.
+        struct CountedFunction
+        {
+            explicit CountedFunction(int* counter)
+                : m_counter(counter)
+            {
+                ++(*m_counter);
+            }
+            CountedFunction(const CountedFunction& rhs)
+                : m_counter(rhs.m_counter)
+            {
+                ++(*m_counter);
+            }
+            ~CountedFunction()
+            {
+                --(*m_counter);
+            }
+            void operator()() {}
+
+            int* m_counter;
+        };
+    }
+
+    TEST_F(QueueEbusTest, MessageQueue_MultipleProducers_ExecutesEveryFunctionInOrderPerProducer)
+    {
+        using namespace MessageQueueTest;
+
+        constexpr int NumProducers = 8;
+        constexpr int NumCalls = 10000;
+        MessageQueue queue;
+        AZStd::vector<int> lastCall(NumProducers, -1);
+        AZStd::atomic_bool inOrder{ true };
+        AZStd::atomic_int finishedProducers{ 0 };
+
+        AZStd::vector<AZStd::thread> producers;
+        for (int producer = 0; producer < NumProducers; ++producer)
+        {
+            producers.emplace_back([&queue, &lastCall, &inOrder, &finishedProducers, producer]()
+            {
+                for (int call = 0; call < NumCalls; ++call)
+                {
+                    queue.Push([&lastCall, &inOrder, producer, call]()
+                    {
+                        if (lastCall[producer] + 1 != call)
+                        {
+                            inOrder = false;
+                        }
+                        lastCall[producer] = call;
+                    });
+                }
+                ++finishedProducers;
+            });
+        }
+
+        size_t executed = 0;
+        while (finishedProducers < NumProducers)
+        {
+            executed += queue.Execute();
+            AZStd::this_thread::yield();
+        }
+        for (AZStd::thread& producer : producers)
+        {
+            producer.join();
+        }
+        executed += queue.Execute();
+
+        EXPECT_EQ(static_cast<size_t>(NumProducers * NumCalls), executed);
+        EXPECT_EQ(0u, queue.Count());
+        EXPECT_TRUE(inOrder);
+    }
+
+    TEST_F(QueueEbusTest, MessageQueue_RepeatedlyQueueAndExecute_ReusesMemory)
+    {
+        using namespace MessageQueueTest;
+
+        MessageQueue queue;
+        int calls = 0;
+        for (int i = 0; i < 1000; ++i)
+        {
+            queue.Push([&calls]() { ++calls; });
+        }
+        queue.Execute();
+        const size_t blockCount = queue.GetBlockCount();
+        EXPECT_GT(blockCount, 0u);
+
+        for (int cycle = 0; cycle < 100; ++cycle)
+        {
+            for (int i = 0; i < 1000; ++i)
+            {
+                queue.Push([&calls]() { ++calls; });
+            }
+            queue.Execute();
+        }
+        EXPECT_EQ(101 * 1000, calls);
+        // One more block may be in use because the current block is only recycled after it's replaced.
+        EXPECT_LE(queue.GetBlockCount(), blockCount + 1);
+    }
+
+    TEST_F(QueueEbusTest, MessageQueue_LargeFunction_IsExecuted)
+    {
+        using namespace MessageQueueTest;
+
+        MessageQueue queue;
+        struct LargeFunction
+        {
+            void operator()()
+            {
+                *m_result = m_data[sizeof(m_data) - 1];
+            }
+            char m_data[MessageQueue::BlockSize];
+            char* m_result;
+        };
+        auto function = AZStd::make_unique<LargeFunction>();
+        char result = 0;
+        function->m_data[sizeof(function->m_data) - 1] = 42;
+        function->m_result = &result;
+
+        queue.Push(*function);
+        EXPECT_EQ(1u, queue.Count());
+        EXPECT_EQ(1u, queue.Execute());
+        EXPECT_EQ(42, result);
+    }
+
+    TEST_F(QueueEbusTest, MessageQueue_Clear_DestroysFunctionsWithoutCalling)
+    {
+        using namespace MessageQueueTest;
+
+        int liveFunctions = 0;
+        {
+            MessageQueue queue;
+            queue.Push(CountedFunction(&liveFunctions));
+            queue.Push(CountedFunction(&liveFunctions));
+            EXPECT_EQ(2, liveFunctions);
+            queue.Clear();
+            EXPECT_EQ(0, liveFunctions);
+            EXPECT_EQ(0u, queue.Count());
+
+            queue.Push(CountedFunction(&liveFunctions));
+        }
+        // Functions still in the queue are destroyed with it.
+        EXPECT_EQ(0, liveFunctions);
+    }
+
+    TEST_F(QueueEbusTest, QueueFunction_ExecuteFromQueuedFunction_NewFunctionsAreExecutedOnce)
+    {
+        using namespace QueueMessageTest;
+
+        int outerCalls = 0;
+        int innerCalls = 0;
+        QueueTestSingleBus::QueueFunction([&outerCalls, &innerCalls]()
+        {
+            ++outerCalls;
+            QueueTestSingleBus::QueueFunction([&innerCalls]() { ++innerCalls; });
+            QueueTestSingleBus::ExecuteQueuedEvents();
+        });
+        QueueTestSingleBus::ExecuteQueuedEvents();
+        QueueTestSingleBus::ExecuteQueuedEvents();
+
+        EXPECT_EQ(1, outerCalls);
+        EXPECT_EQ(1, innerCalls);
+    }
+
     class ConnectDisconnectInterface
         : public EBusTraits
     {
@@ -2745,6 +2923,123 @@ namespace UnitTest
         AZ_TEST_STOP_TRACE_SUPPRESSION(1);
     }
 
+    struct SoleHandlerEvents
+        : public AZ::EBusTraits
+    {
+        using MutexType = AZStd::recursive_mutex;
+        static const EBusAddressPolicy AddressPolicy = EBusAddressPolicy::ById;
+        using BusIdType = uint32_t;
+        static const bool LocklessDispatch = true;
+        static const bool EnableSoleHandlerDispatch = true;
+
+        virtual ~SoleHandlerEvents() = default;
+        virtual int GetValue() = 0;
+        virtual void RemoveMe() = 0;
+    };
+
+    using SoleHandlerBus = AZ::EBus<SoleHandlerEvents>;
+
+    struct SoleHandlerImpl
+        : public SoleHandlerBus::MultiHandler
+    {
+        int m_value;
+        int m_calls = 0;
+        bool m_calledInDispatch = false;
+
+        explicit SoleHandlerImpl(int value)
+            : m_value(value)
+        {
+        }
+
+        ~SoleHandlerImpl() override
+        {
+            BusDisconnect();
+        }
+
+        int GetValue() override
+        {
+            ++m_calls;
+            // Dispatches through the sole handler fast path aren't tracked on the callstack
+            m_calledInDispatch = SoleHandlerBus::IsInDispatch();
+            return m_value;
+        }
+
+        void RemoveMe() override
+        {
+            BusDisconnect();
+        }
+    };
+
+    TEST_F(EBus, SoleHandlerDispatch_OneHandler_CallsHandlerDirectly)
+    {
+        SoleHandlerImpl handler(7);
+        handler.BusConnect(1);
+
+        int result = 0;
+        SoleHandlerBus::BroadcastResult(result, &SoleHandlerBus::Events::GetValue);
+        EXPECT_EQ(7, result);
+        EXPECT_EQ(1, handler.m_calls);
+        EXPECT_FALSE(handler.m_calledInDispatch);
+
+        SoleHandlerBus::BroadcastReverse(&SoleHandlerBus::Events::GetValue);
+        EXPECT_EQ(2, handler.m_calls);
+        EXPECT_FALSE(handler.m_calledInDispatch);
+    }
+
+    TEST_F(EBus, SoleHandlerDispatch_MultipleHandlers_UsesRegularDispatch)
+    {
+        SoleHandlerImpl handler1(1);
+        SoleHandlerImpl handler2(2);
+        handler1.BusConnect(1);
+        handler2.BusConnect(2);
+
+        SoleHandlerBus::Broadcast(&SoleHandlerBus::Events::GetValue);
+        EXPECT_EQ(1, handler1.m_calls);
+        EXPECT_EQ(1, handler2.m_calls);
+        EXPECT_TRUE(handler1.m_calledInDispatch);
+        EXPECT_TRUE(handler2.m_calledInDispatch);
+
+        // Once only one handler remains it's called directly again
+        handler1.BusDisconnect();
+        int result = 0;
+        SoleHandlerBus::BroadcastResult(result, &SoleHandlerBus::Events::GetValue);
+        EXPECT_EQ(2, result);
+        EXPECT_EQ(1, handler1.m_calls);
+        EXPECT_EQ(2, handler2.m_calls);
+        EXPECT_FALSE(handler2.m_calledInDispatch);
+
+        handler2.BusDisconnect();
+        SoleHandlerBus::Broadcast(&SoleHandlerBus::Events::GetValue);
+        EXPECT_EQ(2, handler2.m_calls);
+    }
+
+    TEST_F(EBus, SoleHandlerDispatch_HandlerOnMultipleAddresses_IsCalledForEachAddress)
+    {
+        SoleHandlerImpl handler(3);
+        handler.BusConnect(1);
+        handler.BusConnect(2);
+
+        SoleHandlerBus::Broadcast(&SoleHandlerBus::Events::GetValue);
+        EXPECT_EQ(2, handler.m_calls);
+
+        handler.BusDisconnect(1);
+        SoleHandlerBus::Broadcast(&SoleHandlerBus::Events::GetValue);
+        EXPECT_EQ(3, handler.m_calls);
+        EXPECT_FALSE(handler.m_calledInDispatch);
+    }
+
+    TEST_F(EBus, SoleHandlerDispatch_DisconnectDuringDirectCall_HandlerIsDisconnected)
+    {
+        SoleHandlerImpl handler(4);
+        handler.BusConnect(1);
+
+        SoleHandlerBus::Broadcast(&SoleHandlerBus::Events::RemoveMe);
+        EXPECT_FALSE(handler.BusIsConnected());
+
+        SoleHandlerBus::Broadcast(&SoleHandlerBus::Events::GetValue);
+        EXPECT_EQ(0, handler.m_calls);
+    }
+
     namespace LocklessTest
     {
         struct LocklessConnectorEvents
@@ -4359,6 +4654,18 @@ namespace Benchmark
 // Register a benchmark for all bus permutations
 #define BUS_BENCHMARK_REGISTER_ALL(fn) BUS_BENCHMARK_PRIVATE_LIST_ALL(BUS_BENCHMARK_PRIVATE_REGISTER, fn)
 
+// Internal macro callback for listing lockless buses with and without sole handler dispatch
+#define BUS_BENCHMARK_PRIVATE_LIST_SOLE_HANDLER(cb, fn) \
+    cb(fn, OneToOneLockless, OneToOne)                  \
+    cb(fn, OneToOneSoleHandler, OneToOne)               \
+    cb(fn, OneToManyLockless, OneToMany)                \
+    cb(fn, OneToManySoleHandler, OneToMany)             \
+    cb(fn, ManyToManyLockless, ManyToMany)              \
+    cb(fn, ManyToManySoleHandler, ManyToMany)
+
+// Register a benchmark to compare dispatch with and without EBusTraits::EnableSoleHandlerDispatch
+#define BUS_BENCHMARK_REGISTER_SOLE_HANDLER(fn) BUS_BENCHMARK_PRIVATE_LIST_SOLE_HANDLER(BUS_BENCHMARK_PRIVATE_REGISTER, fn)
+
     //////////////////////////////////////////////////////////////////////////
     // Single Threaded Events/Broadcasts
     //////////////////////////////////////////////////////////////////////////
@@ -4446,6 +4753,7 @@ namespace Benchmark
         s_benchmarkEBusEnv<Bus>.Disconnect(state);
     }
     BUS_BENCHMARK_REGISTER_ALL(BM_EBus_Broadcast);
+    BUS_BENCHMARK_REGISTER_SOLE_HANDLER(BM_EBus_Broadcast);
 
     template <typename Bus>
     static void BM_EBus_BroadcastResult(::benchmark::State& state)
@@ -4460,6 +4768,7 @@ namespace Benchmark
         s_benchmarkEBusEnv<Bus>.Disconnect(state);
     }
     BUS_BENCHMARK_REGISTER_ALL(BM_EBus_BroadcastResult);
+    BUS_BENCHMARK_REGISTER_SOLE_HANDLER(BM_EBus_BroadcastResult);
 
     template <typename Bus>
     static void BM_EBus_Event(::benchmark::State& state)
@@ -4637,6 +4946,43 @@ namespace Benchmark
     // Multithreaded Broadcasts
     //////////////////////////////////////////////////////////////////////////
 
+    // Multiple producers queueing broadcasts while the first thread also executes the queue.
+    static void BM_EBus_Multithreaded_QueueBroadcast(::benchmark::State& state)
+    {
+        using Bus = TestBus<AZ::EBusAddressPolicy::Single, AZ::EBusHandlerPolicy::Multiple, false>;
+
+        AZStd::unique_ptr<BM_EBusEnvironment<Bus>> ebusBenchmarkEnv;
+        if (state.thread_index == 0)
+        {
+            ebusBenchmarkEnv = AZStd::make_unique<BM_EBusEnvironment<Bus>>();
+            ebusBenchmarkEnv->SetUpBenchmark();
+            ebusBenchmarkEnv->Connect(state);
+        }
+
+        int64_t queued = 0;
+        while (state.KeepRunning())
+        {
+            Bus::QueueBroadcast(&Bus::Events::OnEvent);
+            if (state.thread_index == 0 && (++queued % 1024) == 0)
+            {
+                Bus::ExecuteQueuedEvents();
+            }
+        };
+
+        if (state.thread_index == 0)
+        {
+            Bus::ClearQueuedEvents();
+            ebusBenchmarkEnv->Disconnect(state);
+            ebusBenchmarkEnv->TearDownBenchmark();
+        }
+    }
+    BENCHMARK(BM_EBus_Multithreaded_QueueBroadcast)
+        ->Apply(&BenchmarkSettings::Common)
+        ->ArgNames({ { "Addresses" },{ "Handlers" } })
+        ->Args({ 1, 1 })
+        ->ThreadRange(1, 16);
+
+
     static void BM_EBus_Multithreaded_Locks(::benchmark::State& state)
     {
         using Bus = TestBus<AZ::EBusAddressPolicy::Single, AZ::EBusHandlerPolicy::Multiple, false>;
@@ -4686,6 +5032,31 @@ namespace Benchmark
         }
     }
     BENCHMARK(BM_EBus_Multithreaded_Lockless)->Apply(&BenchmarkSettings::OneToMany)->Apply(&BenchmarkSettings::Multithreaded);
+
+    static void BM_EBus_Multithreaded_SoleHandler(::benchmark::State& state)
+    {
+        using Bus = TestBus<AZ::EBusAddressPolicy::Single, AZ::EBusHandlerPolicy::Multiple, true, true>;
+
+        AZStd::unique_ptr<BM_EBusEnvironment<Bus>> ebusBenchmarkEnv;
+        if (state.thread_index == 0)
+        {
+            ebusBenchmarkEnv = AZStd::make_unique<BM_EBusEnvironment<Bus>>();
+            ebusBenchmarkEnv->SetUpBenchmark();
+            ebusBenchmarkEnv->Connect(state);
+        }
+
+        while (state.KeepRunning())
+        {
+            Bus::Broadcast(&Bus::Events::OnWait);
+        };
+
+        if (state.thread_index == 0)
+        {
+            ebusBenchmarkEnv->Disconnect(state);
+            ebusBenchmarkEnv->TearDownBenchmark();
+        }
+    }
+    BENCHMARK(BM_EBus_Multithreaded_SoleHandler)->Apply(&BenchmarkSettings::OneToMany)->Apply(&BenchmarkSettings::Multithreaded);
 }
 
 #endif // HAVE_BENCHMARK
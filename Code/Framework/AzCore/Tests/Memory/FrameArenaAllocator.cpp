@@ -0,0 +1,310 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Memory/AllocatorManager.h>
+#include <AzCore/Memory/FrameArenaAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace UnitTest
+{
+    class FrameArenaAllocatorTestFixture
+        : public AllocatorsTestFixture
+    {
+    public:
+        void SetUp() override
+        {
+            AllocatorsTestFixture::SetUp();
+
+            AZ::FrameArenaAllocator::Descriptor desc;
+            desc.m_chunkSize = s_chunkSize;
+            AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Create(desc);
+        }
+
+        void TearDown() override
+        {
+            GetFrameArena().ResetFrame();
+            AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Destroy();
+
+            AllocatorsTestFixture::TearDown();
+        }
+
+    protected:
+        AZ::FrameArenaAllocator& GetFrameArena()
+        {
+            return static_cast<AZ::FrameArenaAllocator&>(AZ::AllocatorInstance<AZ::FrameArenaAllocator>::GetAllocator());
+        }
+
+        static constexpr size_t s_chunkSize = 4096;
+    };
+
+    TEST_F(FrameArenaAllocatorTestFixture, Allocate_RespectsAlignment)
+    {
+        AZ::IAllocatorAllocate& allocator = AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Get();
+        for (size_t alignment : { 1, 8, 16, 64, 256 })
+        {
+            void* allocation = allocator.Allocate(3, alignment);
+            ASSERT_NE(nullptr, allocation);
+            EXPECT_EQ(0, reinterpret_cast<size_t>(allocation) % alignment);
+        }
+    }
+
+    TEST_F(FrameArenaAllocatorTestFixture, ResetFrame_ReusesChunks)
+    {
+        AZ::IAllocatorAllocate& allocator = AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Get();
+        void* firstFrame = allocator.Allocate(128, 16);
+        for (int i = 0; i < 64; ++i)
+        {
+            allocator.Allocate(128, 16);
+        }
+        EXPECT_GE(allocator.NumAllocatedBytes(), 65 * 128);
+        const size_t capacity = allocator.Capacity();
+
+        GetFrameArena().ResetFrame();
+        EXPECT_EQ(0, allocator.NumAllocatedBytes());
+
+        // The next frame starts at the beginning of the same chunks and doesn't need any new memory
+        void* secondFrame = allocator.Allocate(128, 16);
+        for (int i = 0; i < 64; ++i)
+        {
+            allocator.Allocate(128, 16);
+        }
+        EXPECT_EQ(capacity, allocator.Capacity());
+        EXPECT_EQ(firstFrame, secondFrame);
+    }
+
+    TEST_F(FrameArenaAllocatorTestFixture, DeAllocate_MostRecentAllocation_IsRolledBack)
+    {
+        AZ::IAllocatorAllocate& allocator = AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Get();
+        void* first = allocator.Allocate(64, 8);
+        void* second = allocator.Allocate(64, 8);
+        allocator.DeAllocate(second, 64);
+        EXPECT_EQ(second, allocator.Allocate(64, 8));
+
+        // Deallocating older allocations is a no-op until the frame ends
+        const size_t allocatedBytes = allocator.NumAllocatedBytes();
+        allocator.DeAllocate(first, 64);
+        EXPECT_EQ(allocatedBytes, allocator.NumAllocatedBytes());
+    }
+
+    TEST_F(FrameArenaAllocatorTestFixture, ReAllocate_OlderAllocation_CopiesContent)
+    {
+        AZ::IAllocatorAllocate& allocator = AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Get();
+        char* first = static_cast<char*>(allocator.Allocate(64, 8));
+        memset(first, 0x5A, 64);
+        allocator.Allocate(64, 8);
+
+        // The first allocation isn't the most recent one anymore, so it has to move
+        char* grown = static_cast<char*>(allocator.ReAllocate(first, 256, 8));
+        ASSERT_NE(nullptr, grown);
+        EXPECT_NE(first, grown);
+        for (size_t i = 0; i < 64; ++i)
+        {
+            EXPECT_EQ(0x5A, static_cast<unsigned char>(grown[i]));
+        }
+    }
+
+    TEST_F(FrameArenaAllocatorTestFixture, ReAllocate_Shrink_CopiesOnlyNewSize)
+    {
+        AZ::IAllocatorAllocate& allocator = AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Get();
+        char* first = static_cast<char*>(allocator.Allocate(256, 8));
+        memset(first, 0x3C, 256);
+        char* second = static_cast<char*>(allocator.Allocate(16, 8));
+        memset(second, 0x7E, 16);
+
+        // A stricter alignment forces a copy, which mustn't read past the end of the old allocation
+        char* moved = static_cast<char*>(allocator.ReAllocate(second, 8, 64));
+        ASSERT_NE(nullptr, moved);
+        EXPECT_EQ(0, reinterpret_cast<size_t>(moved) % 64);
+        EXPECT_EQ(8, allocator.AllocationSize(moved));
+        for (size_t i = 0; i < 8; ++i)
+        {
+            EXPECT_EQ(0x7E, static_cast<unsigned char>(moved[i]));
+        }
+        EXPECT_EQ(0x3C, static_cast<unsigned char>(first[255]));
+    }
+
+    TEST_F(FrameArenaAllocatorTestFixture, AllocationSize_ReturnsRequestedSize)
+    {
+        AZ::IAllocatorAllocate& allocator = AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Get();
+        void* small = allocator.Allocate(24, 16);
+        void* large = allocator.Allocate(2 * s_chunkSize, 32);
+        EXPECT_EQ(24, allocator.AllocationSize(small));
+        EXPECT_EQ(2 * s_chunkSize, allocator.AllocationSize(large));
+
+        // Resizing the most recent allocation in place updates its size
+        void* last = allocator.Allocate(40, 8);
+        EXPECT_EQ(100, allocator.Resize(last, 100));
+        EXPECT_EQ(100, allocator.AllocationSize(last));
+    }
+
+    TEST_F(FrameArenaAllocatorTestFixture, ReAllocate_AllocationOfOtherThread_CopiesContent)
+    {
+        AZ::IAllocatorAllocate& allocator = AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Get();
+        char* allocation = nullptr;
+        AZStd::thread producer([&allocator, &allocation]()
+        {
+            allocation = static_cast<char*>(allocator.Allocate(48, 8));
+            memset(allocation, 0x11, 48);
+        });
+        producer.join();
+
+        char* grown = static_cast<char*>(allocator.ReAllocate(allocation, 96, 8));
+        ASSERT_NE(nullptr, grown);
+        EXPECT_NE(allocation, grown);
+        for (size_t i = 0; i < 48; ++i)
+        {
+            EXPECT_EQ(0x11, static_cast<unsigned char>(grown[i]));
+        }
+    }
+
+    TEST_F(FrameArenaAllocatorTestFixture, ResetThreadFrame_OnlyReclaimsCallingThread)
+    {
+        AZ::IAllocatorAllocate& allocator = AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Get();
+        void* mainAllocation = allocator.Allocate(64, 8);
+
+        // The worker ends its own frame while the allocation of the main thread stays valid
+        AZStd::thread worker([this, &allocator]()
+        {
+            void* workerFrame = allocator.Allocate(128, 8);
+            EXPECT_EQ(64 + 128, allocator.NumAllocatedBytes());
+            GetFrameArena().ResetThreadFrame();
+            EXPECT_EQ(64, allocator.NumAllocatedBytes());
+            EXPECT_EQ(workerFrame, allocator.Allocate(128, 8));
+            GetFrameArena().ResetThreadFrame();
+        });
+        worker.join();
+
+        EXPECT_EQ(64, allocator.NumAllocatedBytes());
+        EXPECT_EQ(64, allocator.AllocationSize(mainAllocation));
+        GetFrameArena().ResetThreadFrame();
+        EXPECT_EQ(0, allocator.NumAllocatedBytes());
+        EXPECT_EQ(mainAllocation, allocator.Allocate(64, 8));
+    }
+
+    TEST_F(FrameArenaAllocatorTestFixture, ExitedThread_ArenaIsReleasedOrReused)
+    {
+        AZ::IAllocatorAllocate& allocator = AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Get();
+        AZStd::thread first([&allocator]()
+        {
+            allocator.Allocate(128, 8);
+        });
+        first.join();
+        const size_t capacity = allocator.Capacity();
+        EXPECT_GE(capacity, s_chunkSize);
+
+        // A new thread adopts the arena of the exited thread instead of allocating new chunks
+        AZStd::thread second([&allocator]()
+        {
+            allocator.Allocate(128, 8);
+        });
+        second.join();
+        EXPECT_EQ(capacity, allocator.Capacity());
+
+        // Once the frame in which they were used ended, the chunks of exited threads are released
+        GetFrameArena().ResetFrame();
+        allocator.GarbageCollect();
+        EXPECT_EQ(0, allocator.Capacity());
+    }
+
+    TEST_F(FrameArenaAllocatorTestFixture, LargeAllocation_GetsDedicatedChunk)
+    {
+        AZ::IAllocatorAllocate& allocator = AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Get();
+        char* small = static_cast<char*>(allocator.Allocate(16, 8));
+        void* large = allocator.Allocate(4 * s_chunkSize, 16);
+        ASSERT_NE(nullptr, large);
+        EXPECT_GE(allocator.Capacity(), 5 * s_chunkSize);
+
+        // The current chunk is still used after the large allocation, the next allocation only skips the size header
+        char* next = static_cast<char*>(allocator.Allocate(16, 8));
+        EXPECT_EQ(small + 16 + sizeof(size_t), next);
+
+        // Dedicated chunks are released when the frame ends
+        GetFrameArena().ResetFrame();
+        allocator.Allocate(16, 8);
+        EXPECT_LT(allocator.Capacity(), 2 * s_chunkSize);
+    }
+
+    TEST_F(FrameArenaAllocatorTestFixture, PeakFrameBytes_TracksLargestFrame)
+    {
+        AZ::IAllocatorAllocate& allocator = AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Get();
+        allocator.Allocate(1024, 8);
+        GetFrameArena().ResetFrame();
+        allocator.Allocate(256, 8);
+        GetFrameArena().ResetFrame();
+
+        EXPECT_EQ(1024, GetFrameArena().GetPeakFrameBytes());
+        GetFrameArena().ResetPeakFrameBytes();
+        EXPECT_EQ(0, GetFrameArena().GetPeakFrameBytes());
+    }
+
+    TEST_F(FrameArenaAllocatorTestFixture, Threads_AllocateFromSeparateChunks)
+    {
+        AZ::IAllocatorAllocate& allocator = AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Get();
+        constexpr size_t numThreads = 4;
+        constexpr size_t numAllocations = 256;
+        AZStd::vector<AZStd::vector<void*>> allocations(numThreads);
+        AZStd::vector<AZStd::thread> threads;
+        for (size_t threadIndex = 0; threadIndex < numThreads; ++threadIndex)
+        {
+            threads.emplace_back([&allocator, &allocations, threadIndex]()
+            {
+                for (size_t i = 0; i < numAllocations; ++i)
+                {
+                    void* allocation = allocator.Allocate(32, 8);
+                    memset(allocation, static_cast<int>(threadIndex), 32);
+                    allocations[threadIndex].push_back(allocation);
+                }
+            });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        EXPECT_EQ(numThreads * numAllocations * 32, allocator.NumAllocatedBytes());
+        for (size_t threadIndex = 0; threadIndex < numThreads; ++threadIndex)
+        {
+            for (void* allocation : allocations[threadIndex])
+            {
+                EXPECT_EQ(threadIndex, static_cast<unsigned char*>(allocation)[0]);
+                EXPECT_EQ(threadIndex, static_cast<unsigned char*>(allocation)[31]);
+            }
+        }
+    }
+
+    TEST_F(FrameArenaAllocatorTestFixture, AZStdVector_UsesFrameArena)
+    {
+        AZStd::vector<int, AZ::AZStdAlloc<AZ::FrameArenaAllocator>> values;
+        for (int i = 0; i < 1000; ++i)
+        {
+            values.push_back(i);
+        }
+        EXPECT_EQ(999, values.back());
+        EXPECT_GE(AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Get().NumAllocatedBytes(), 1000 * sizeof(int));
+        values = {};
+        GetFrameArena().ResetFrame();
+    }
+
+    TEST_F(FrameArenaAllocatorTestFixture, AllocatorManager_ReportsFrameArena)
+    {
+        size_t usedBytes = 0;
+        size_t reservedBytes = 0;
+        AZStd::vector<AZ::AllocatorManager::AllocatorStats> stats;
+        AZ::AllocatorInstance<AZ::FrameArenaAllocator>::Get().Allocate(512, 8);
+        AZ::AllocatorManager::Instance().GetAllocatorStats(usedBytes, reservedBytes, &stats);
+
+        auto it = AZStd::find_if(stats.begin(), stats.end(), [](const AZ::AllocatorManager::AllocatorStats& stat)
+        {
+            return stat.m_name == AZStd::string("FrameArenaAllocator");
+        });
+        ASSERT_NE(stats.end(), it);
+        EXPECT_EQ(512, it->m_allocatedBytes);
+        EXPECT_GE(it->m_capacityBytes, 512);
+    }
+}
@@ -9,6 +9,9 @@
 #include <AzCore/PlatformIncl.h>
 #include <AzCore/Memory/HphaSchema.h>
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/binary_semaphore.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/thread.h>
 
 #if defined(HAVE_BENCHMARK)
 #include <benchmark/benchmark.h>
@@ -111,6 +114,165 @@ namespace UnitTest
     INSTANTIATE_TEST_CASE_P(Mixed,
         HphaSchemaTestFixture,
         ::testing::ValuesIn(s_mixedInstancesParameters));
+
+    class HphaSchemaThreadCacheTestFixture
+        : public AllocatorsTestFixture
+    {
+    public:
+        void SetUp() override
+        {
+            AZ::AllocatorInstance<HphaSchema_TestAllocator>::Create();
+        }
+
+        void TearDown() override
+        {
+            AZ::AllocatorInstance<HphaSchema_TestAllocator>::Destroy();
+        }
+    };
+
+    TEST_F(HphaSchemaThreadCacheTestFixture, CachedBlocks_AreNotReportedAsAllocated)
+    {
+        AZ::IAllocatorAllocate& allocator = AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get();
+        AZStd::vector<void*, AZ::AZStdAlloc<AZ::OSAllocator>> allocations;
+        for (size_t i = 0; i < 100; ++i)
+        {
+            const size_t allocationSize = s_smallAllocationSizes[i % s_smallAllocationSizes.size()];
+            allocations.push_back(allocator.Allocate(allocationSize, 0));
+        }
+        EXPECT_GE(allocator.NumAllocatedBytes(), 100 * s_smallAllocationSizes[0]);
+
+        for (size_t i = 0; i < allocations.size(); ++i)
+        {
+            allocator.DeAllocate(allocations[i], s_smallAllocationSizes[i % s_smallAllocationSizes.size()]);
+        }
+        // Freed blocks can stay in the thread cache, but they must not be reported as allocated
+        EXPECT_EQ(0, allocator.NumAllocatedBytes());
+    }
+
+    TEST_F(HphaSchemaThreadCacheTestFixture, FreeOnOtherThread_ReturnsBlocks)
+    {
+        AZ::IAllocatorAllocate& allocator = AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get();
+        constexpr size_t numAllocations = 1000;
+        AZStd::vector<void*, AZ::AZStdAlloc<AZ::OSAllocator>> allocations(numAllocations, nullptr);
+
+        // Allocate on one thread and free on another. The first thread exits before the blocks are freed, so its
+        // cache is released while the second thread still holds blocks that came from it.
+        AZStd::thread producer([&allocator, &allocations]()
+        {
+            for (void*& allocation : allocations)
+            {
+                allocation = allocator.Allocate(64, 0);
+            }
+        });
+        producer.join();
+
+        AZStd::thread consumer([&allocator, &allocations]()
+        {
+            for (void* allocation : allocations)
+            {
+                EXPECT_NE(nullptr, allocation);
+                allocator.DeAllocate(allocation, 64);
+            }
+        });
+        consumer.join();
+
+        EXPECT_EQ(0, allocator.NumAllocatedBytes());
+    }
+
+    TEST_F(HphaSchemaThreadCacheTestFixture, ConcurrentAllocations_AreUnique)
+    {
+        AZ::IAllocatorAllocate& allocator = AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get();
+        constexpr size_t numThreads = 4;
+        constexpr size_t numAllocations = 512;
+        AZStd::vector<AZStd::vector<void*, AZ::AZStdAlloc<AZ::OSAllocator>>> allocations(numThreads);
+        AZStd::vector<AZStd::thread> threads;
+        for (size_t threadIndex = 0; threadIndex < numThreads; ++threadIndex)
+        {
+            threads.emplace_back([&allocator, &allocations, threadIndex]()
+            {
+                for (size_t i = 0; i < numAllocations; ++i)
+                {
+                    const size_t allocationSize = s_smallAllocationSizes[i % s_smallAllocationSizes.size()];
+                    void* allocation = allocator.Allocate(allocationSize, 0);
+                    memset(allocation, static_cast<int>(threadIndex), allocationSize);
+                    allocations[threadIndex].push_back(allocation);
+                }
+            });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        // Every thread wrote its index into its blocks, a block handed out twice would have been overwritten
+        for (size_t threadIndex = 0; threadIndex < numThreads; ++threadIndex)
+        {
+            for (size_t i = 0; i < numAllocations; ++i)
+            {
+                const size_t allocationSize = s_smallAllocationSizes[i % s_smallAllocationSizes.size()];
+                const unsigned char* bytes = static_cast<const unsigned char*>(allocations[threadIndex][i]);
+                EXPECT_EQ(threadIndex, bytes[0]);
+                EXPECT_EQ(threadIndex, bytes[allocationSize - 1]);
+                allocator.DeAllocate(allocations[threadIndex][i], allocationSize);
+            }
+        }
+        EXPECT_EQ(0, allocator.NumAllocatedBytes());
+    }
+
+    TEST_F(HphaSchemaThreadCacheTestFixture, GarbageCollect_DrainsCachesOfOtherThreads)
+    {
+        AZ::IAllocatorAllocate& allocator = AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get();
+        AZStd::binary_semaphore cacheFilled;
+        AZStd::binary_semaphore collected;
+
+        // The worker keeps its cache alive, and filled with freed blocks, until the main thread collected garbage
+        AZStd::thread worker([&allocator, &cacheFilled, &collected]()
+        {
+            AZStd::vector<void*, AZ::AZStdAlloc<AZ::OSAllocator>> allocations(1000, nullptr);
+            for (void*& allocation : allocations)
+            {
+                allocation = allocator.Allocate(64, 0);
+            }
+            for (void* allocation : allocations)
+            {
+                allocator.DeAllocate(allocation, 64);
+            }
+            cacheFilled.release();
+            collected.acquire();
+        });
+
+        cacheFilled.acquire();
+        const size_t capacityBeforeCollect = allocator.Capacity();
+        allocator.GarbageCollect();
+        EXPECT_LT(allocator.Capacity(), capacityBeforeCollect);
+        EXPECT_EQ(0, allocator.NumAllocatedBytes());
+
+        collected.release();
+        worker.join();
+    }
+
+    TEST_F(HphaSchemaThreadCacheTestFixture, ThreadExitsAfterAllocatorDestroyed_DoesNotTouchAllocator)
+    {
+        AZStd::binary_semaphore cacheCreated;
+        AZStd::binary_semaphore allocatorDestroyed;
+
+        AZStd::thread worker([&cacheCreated, &allocatorDestroyed]()
+        {
+            AZ::IAllocatorAllocate& allocator = AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get();
+            allocator.DeAllocate(allocator.Allocate(64, 0), 64);
+            cacheCreated.release();
+            // The thread exits, and releases its cache, after the allocator it belonged to is gone
+            allocatorDestroyed.acquire();
+        });
+
+        cacheCreated.acquire();
+        AZ::AllocatorInstance<HphaSchema_TestAllocator>::Destroy();
+        allocatorDestroyed.release();
+        worker.join();
+
+        // Recreate the allocator for TearDown
+        AZ::AllocatorInstance<HphaSchema_TestAllocator>::Create();
+    }
 }
 
 
@@ -193,6 +355,81 @@ namespace Benchmark
         BM_Allocations(state, s_mixedAllocationSizes);
     }
 
+    // Measures the throughput of small allocations and frees from several threads at the same time. The first
+    // argument toggles the thread caches so the contention on the bucket locks can be compared.
+    class HphaSchemaThreadedBenchmarkFixture
+        : public ::benchmark::Fixture
+    {
+        void internalSetUp(const benchmark::State& state)
+        {
+            // SetUp and TearDown run on every benchmark thread without waiting for the other threads, so the allocator
+            // is created by the first thread to arrive and destroyed by the last one to leave. This guarantees it exists
+            // while any thread is using it.
+            AZStd::scoped_lock lock(s_lifetimeMutex);
+            if (s_activeThreadCount++ == 0)
+            {
+                HphaSchema_TestAllocator::Descriptor desc;
+                desc.m_isThreadCacheEnabled = state.range(0) != 0;
+                AZ::AllocatorInstance<HphaSchema_TestAllocator>::Create(desc);
+            }
+        }
+
+        void internalTearDown([[maybe_unused]] const benchmark::State& state)
+        {
+            AZStd::scoped_lock lock(s_lifetimeMutex);
+            if (--s_activeThreadCount == 0)
+            {
+                AZ::AllocatorInstance<HphaSchema_TestAllocator>::Destroy();
+            }
+        }
+
+        inline static AZStd::mutex s_lifetimeMutex;
+        inline static int s_activeThreadCount = 0;
+
+    public:
+        void SetUp(const benchmark::State& state) override
+        {
+            internalSetUp(state);
+        }
+        void SetUp(benchmark::State& state) override
+        {
+            internalSetUp(state);
+        }
+        void TearDown(const benchmark::State& state) override
+        {
+            internalTearDown(state);
+        }
+        void TearDown(benchmark::State& state) override
+        {
+            internalTearDown(state);
+        }
+    };
+
+    BENCHMARK_DEFINE_F(HphaSchemaThreadedBenchmarkFixture, SmallAllocAndFree)(benchmark::State& state)
+    {
+        constexpr size_t numAllocations = 64;
+        AZ::IAllocatorAllocate& allocator = AZ::AllocatorInstance<HphaSchema_TestAllocator>::Get();
+        AZStd::array<void*, numAllocations> allocations;
+        for (auto _ : state)
+        {
+            for (size_t i = 0; i < numAllocations; ++i)
+            {
+                allocations[i] = allocator.Allocate(s_smallAllocationSizes[i % s_smallAllocationSizes.size()], 0);
+            }
+            // Free in a different order than the allocation order, as most containers do
+            for (size_t i = 0; i < numAllocations; ++i)
+            {
+                const size_t index = (i * 7) % numAllocations;
+                allocator.DeAllocate(allocations[index], s_smallAllocationSizes[index % s_smallAllocationSizes.size()]);
+            }
+        }
+        state.SetItemsProcessed(state.iterations() * numAllocations);
+    }
+    BENCHMARK_REGISTER_F(HphaSchemaThreadedBenchmarkFixture, SmallAllocAndFree)
+        ->Arg(0)->Arg(1)
+        ->Threads(1)->Threads(4)->Threads(16)
+        ->UseRealTime();
+
 
 } // Benchmark
 #endif // HAVE_BENCHMARK
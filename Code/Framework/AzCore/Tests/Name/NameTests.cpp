@@ -25,6 +25,7 @@
 #include <AzCore/Serialization/ObjectStream.h>
 #include <AzCore/Serialization/Utils.h>
 #include <AzCore/Math/Random.h>
+#include <AzCore/std/parallel/mutex.h>
 
 #include <thread>
 #include <stdlib.h>
@@ -48,14 +49,25 @@ namespace UnitTest
             AZ::NameDictionary::Destroy();
         }
 
-        static const AZStd::unordered_map<AZ::Name::Hash, AZ::Internal::NameData*>& GetDictionary()
+        //! Returns a copy of the entries of all dictionary shards
+        static AZStd::unordered_map<AZ::Name::Hash, AZ::Internal::NameData*> GetDictionary()
         {
-            return AZ::NameDictionary::Instance().m_dictionary;
+            AZStd::unordered_map<AZ::Name::Hash, AZ::Internal::NameData*> dictionary;
+            for (const auto& shard : AZ::NameDictionary::Instance().m_shards)
+            {
+                dictionary.insert(shard.m_dictionary.begin(), shard.m_dictionary.end());
+            }
+            return dictionary;
         }
         
         static size_t GetEntryCount()
         {
-            return GetDictionary().size();
+            size_t count = 0;
+            for (const auto& shard : AZ::NameDictionary::Instance().m_shards)
+            {
+                count += shard.m_dictionary.size();
+            }
+            return count;
         }
 
         //! Directly calculate the hash value for a string without collision resolution
@@ -278,9 +290,9 @@ namespace UnitTest
         EXPECT_EQ(NameDictionaryTester::GetEntryCount(), localDictionary.size());
 
         // Make sure all entries in the localDictionary got copied into the globalDictionary
+        const auto globalDictionary = NameDictionaryTester::GetDictionary();
         for (const AZStd::string& nameString : localDictionary)
         {
-            auto& globalDictionary = NameDictionaryTester::GetDictionary();
             auto it = AZStd::find_if(globalDictionary.begin(), globalDictionary.end(), [&nameString](AZStd::pair<AZ::Name::Hash, AZ::Internal::NameData*> entry) {
                 return entry.second->GetName() == nameString;
             });
@@ -635,6 +647,58 @@ namespace UnitTest
         RunConcurrencyTest<ThreadRepeatedlyCreatesAndReleasesOneName<100>>(100, 2);
     }
 
+    TEST_F(NameTest, NameLiteralHashIsComputedAtCompileTime)
+    {
+        static constexpr AZ::NameLiteral literal{ "CompileTimeName" };
+        static_assert(literal.GetHash() == AZ::Name::CalcHash("CompileTimeName"), "NameLiteral hash must be a constant expression");
+
+        AZ::Name fromLiteral{ literal };
+        AZ::Name fromString{ "CompileTimeName" };
+        EXPECT_EQ(fromString, fromLiteral);
+        EXPECT_EQ(literal.GetHash(), fromLiteral.GetHash());
+        EXPECT_EQ(literal.GetStringView(), fromLiteral.GetStringView());
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), 1);
+
+        static constexpr AZ::NameLiteral emptyLiteral{ "" };
+        EXPECT_TRUE(AZ::Name(emptyLiteral).IsEmpty());
+    }
+
+    TEST_F(NameTest, ThreadCacheDoesNotKeepNamesAlive)
+    {
+        {
+            // The second name is served from the thread cache
+            AZ::Name a{ "cached" };
+            AZ::Name b{ "cached" };
+            EXPECT_EQ(a, b);
+            EXPECT_EQ(NameDictionaryTester::GetEntryCount(), 1);
+        }
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), 0);
+
+        // The released entry is recycled for a different name which must not be mistaken for the cached one
+        AZ::Name other{ "other" };
+        AZ::Name cached{ "cached" };
+        EXPECT_EQ("other", other.GetStringView());
+        EXPECT_EQ("cached", cached.GetStringView());
+        EXPECT_NE(other, cached);
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), 2);
+    }
+
+    TEST_F(NameTest, ThreadCacheIsInvalidatedWhenDictionaryIsRecreated)
+    {
+        AZ::Name::Hash hash;
+        {
+            AZ::Name name{ "recreated" };
+            hash = name.GetHash();
+        }
+        NameDictionaryTester::Destroy();
+        NameDictionaryTester::Create();
+
+        AZ::Name name{ "recreated" };
+        EXPECT_EQ(hash, name.GetHash());
+        EXPECT_EQ("recreated", name.GetStringView());
+        EXPECT_EQ(NameDictionaryTester::GetEntryCount(), 1);
+    }
+
     TEST_F(NameTest, DISABLED_NameVsStringPerf_Creation)
     {
         constexpr int CreateCount = 1000;
@@ -846,3 +910,114 @@ namespace UnitTest
     }
 }
 
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    class NameDictionaryBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& state) override
+        {
+            // Google benchmark calls SetUp and TearDown on every thread of a multithreaded run, without waiting for the
+            // other threads. The first thread to arrive creates the dictionary and the last one to leave destroys it, so
+            // no thread can create or release names before the dictionary exists or after it has been destroyed.
+            AZStd::scoped_lock lock(s_lifetimeMutex);
+            if (s_activeThreadCount++ == 0)
+            {
+                UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+                AZ::NameDictionary::Create();
+            }
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            SetUp(static_cast<const ::benchmark::State&>(state));
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            AZStd::scoped_lock lock(s_lifetimeMutex);
+            if (--s_activeThreadCount == 0)
+            {
+                AZ::NameDictionary::Destroy();
+                UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+            }
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            TearDown(static_cast<const ::benchmark::State&>(state));
+        }
+
+    protected:
+        static constexpr int NameCount = 256;
+
+        inline static AZStd::mutex s_lifetimeMutex;
+        inline static int s_activeThreadCount = 0;
+
+        static AZStd::string MakeNameString(int index)
+        {
+            return AZStd::string::format("Material/Pass/Shader/Option_%d", index);
+        }
+    };
+
+    // All threads repeatedly intern the same set of names, which exist for the duration of the benchmark. This is
+    // the common case of systems looking up names such as shader options or network properties every frame.
+    BENCHMARK_DEFINE_F(NameDictionaryBenchmarkFixture, MakeExistingNames)(benchmark::State& state)
+    {
+        AZStd::vector<AZStd::string> strings;
+        for (int i = 0; i < NameCount; ++i)
+        {
+            strings.push_back(MakeNameString(i));
+        }
+
+        // Keep all names alive so every lookup hits an existing entry
+        AZStd::vector<AZ::Name> names;
+        for (const AZStd::string& string : strings)
+        {
+            names.emplace_back(string);
+        }
+
+        int index = state.thread_index;
+        for (auto _ : state)
+        {
+            AZ::Name name{ strings[index % NameCount] };
+            benchmark::DoNotOptimize(name);
+            index += 7;
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    // All threads create and release names, which exercises insertion and removal from the dictionary
+    BENCHMARK_DEFINE_F(NameDictionaryBenchmarkFixture, MakeAndReleaseNames)(benchmark::State& state)
+    {
+        AZStd::vector<AZStd::string> strings;
+        for (int i = 0; i < NameCount; ++i)
+        {
+            strings.push_back(AZStd::string::format("%s_thread%d", MakeNameString(i).c_str(), state.thread_index));
+        }
+
+        int index = 0;
+        for (auto _ : state)
+        {
+            AZ::Name name{ strings[index % NameCount] };
+            benchmark::DoNotOptimize(name);
+            ++index;
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    BENCHMARK_REGISTER_F(NameDictionaryBenchmarkFixture, MakeExistingNames)
+        ->Threads(1)
+        ->Threads(4)
+        ->Threads(16)
+        ->Threads(32)
+        ->UseRealTime();
+
+    BENCHMARK_REGISTER_F(NameDictionaryBenchmarkFixture, MakeAndReleaseNames)
+        ->Threads(1)
+        ->Threads(4)
+        ->Threads(16)
+        ->Threads(32)
+        ->UseRealTime();
+} // namespace Benchmark
+#endif
@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/IStreamerTypes.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/MemoryMappedReader_Linux.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <Tests/Streamer/StreamStackEntryConformityTests.h>
+#include <Tests/Streamer/StreamStackEntryMock.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+namespace AZ::IO
+{
+    //
+    // StreamStackEntry API Conformity
+    //
+    class MemoryMappedReaderLinuxTestDescription :
+        public StreamStackEntryConformityTestsDescriptor<MemoryMappedReaderLinux>
+    {
+    public:
+        MemoryMappedReaderLinux CreateInstance() override
+        {
+            return MemoryMappedReaderLinux(4, 0, AZCORE_GLOBAL_NEW_ALIGNMENT, true, true);
+        }
+    };
+
+    INSTANTIATE_TYPED_TEST_CASE_P(
+        Streamer_MemoryMappedReaderLinuxConformityTests, StreamStackEntryConformityTests, MemoryMappedReaderLinuxTestDescription);
+
+    //
+    // MemoryMappedReaderLinux Tests
+    //
+
+    class Streamer_MemoryMappedReaderLinuxTest
+        : public UnitTest::AllocatorsFixture
+    {
+    public:
+        static constexpr u64 FileSize = 64_kib;
+
+        void SetUp() override
+        {
+            UnitTest::AllocatorsFixture::SetUp();
+
+            // Fill the file with the offset of every u32 so the reads can be verified.
+            char filePath[] = "/tmp/MemoryMappedReaderTestXXXXXX";
+            int fileHandle = ::mkstemp(filePath);
+            ASSERT_GE(fileHandle, 0);
+            for (u32 i = 0; i < FileSize; i += sizeof(u32))
+            {
+                ASSERT_EQ(sizeof(u32), ::write(fileHandle, &i, sizeof(u32)));
+            }
+            ::close(fileHandle);
+            m_path.InitFromAbsolutePath(filePath);
+
+            m_context = AZStd::make_unique<StreamerContext>();
+            CreateReader(true);
+        }
+
+        void CreateReader(bool copyResidentReads)
+        {
+            using ::testing::_;
+
+            // The file was just written so its pages are resident in the page cache.
+            m_reader = AZStd::make_shared<MemoryMappedReaderLinux>(4, 0, AZCORE_GLOBAL_NEW_ALIGNMENT, true, copyResidentReads);
+            m_mock = AZStd::make_shared<StreamStackEntryMock>();
+            m_reader->SetNext(m_mock);
+            EXPECT_CALL(*m_mock, SetContext(_)).Times(1);
+            m_reader->SetContext(*m_context);
+        }
+
+        void TearDown() override
+        {
+            ::unlink(m_path.GetAbsolutePath());
+
+            m_reader.reset();
+            m_mock.reset();
+            m_context.reset();
+
+            UnitTest::AllocatorsFixture::TearDown();
+        }
+
+        void ProcessRequests()
+        {
+            using ::testing::Return;
+
+            EXPECT_CALL(*m_mock, ExecuteRequests()).WillRepeatedly(Return(false));
+            while (m_reader->ExecuteRequests() || m_context->FinalizeCompletedRequests())
+            {
+            }
+        }
+
+        void VerifyBuffer(const void* buffer, u64 offset, u64 size)
+        {
+            const u32* values = reinterpret_cast<const u32*>(buffer);
+            for (u64 i = 0; i < size / sizeof(u32); ++i)
+            {
+                // Using assert here because in case of a problem EXPECT would cause a large amount of log noise.
+                ASSERT_EQ(offset + i * sizeof(u32), values[i]);
+            }
+        }
+
+    protected:
+        RequestPath m_path;
+        AZStd::unique_ptr<StreamerContext> m_context;
+        AZStd::shared_ptr<MemoryMappedReaderLinux> m_reader;
+        AZStd::shared_ptr<StreamStackEntryMock> m_mock;
+    };
+
+    TEST_F(Streamer_MemoryMappedReaderLinuxTest, QueueRequest_ReadWithBuffer_DataIsCopiedIntoBuffer)
+    {
+        constexpr u64 offset = 1_kib;
+        constexpr u64 size = 8_kib;
+        AZStd::unique_ptr<u8[]> buffer(new u8[size]);
+
+        IStreamerTypes::RequestStatus status = IStreamerTypes::RequestStatus::Pending;
+        FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateRead(nullptr, buffer.get(), size, m_path, offset, size);
+        request->SetCompletionCallback([&status](FileRequest& request)
+        {
+            status = request.GetStatus();
+        });
+
+        m_reader->QueueRequest(request);
+        ProcessRequests();
+
+        EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, status);
+        VerifyBuffer(buffer.get(), offset, size);
+    }
+
+    TEST_F(Streamer_MemoryMappedReaderLinuxTest, QueueRequest_ReadWithBufferAndCopyingDisabled_ReadIsForwarded)
+    {
+        CreateReader(false);
+
+        constexpr u64 size = 8_kib;
+        AZStd::unique_ptr<u8[]> buffer(new u8[size]);
+        FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateRead(nullptr, buffer.get(), size, m_path, 0, size);
+
+        EXPECT_CALL(*m_mock, QueueRequest(request)).Times(1)
+            .WillOnce([this](FileRequest* request)
+            {
+                request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+                m_context->MarkRequestAsCompleted(request);
+            });
+        m_reader->QueueRequest(request);
+        ProcessRequests();
+    }
+
+    TEST_F(Streamer_MemoryMappedReaderLinuxTest, QueueRequest_ReadAcceptingMappedViews_ReceivesViewIntoMappedFile)
+    {
+        constexpr u64 offset = 4_kib;
+        constexpr u64 size = 16_kib;
+
+        IStreamerTypes::DefaultRequestMemoryAllocator allocator;
+        allocator.SetAcceptsMappedViews(true);
+
+        bool callbackCalled = false;
+        FileRequest* readRequest = m_context->GetNewInternalRequest();
+        readRequest->CreateReadRequest(m_path, &allocator, offset, size,
+            AZStd::chrono::system_clock::time_point::max(), IStreamerTypes::s_priorityMedium);
+        readRequest->SetCompletionCallback([this, &callbackCalled, offset, size](FileRequest& request)
+        {
+            callbackCalled = true;
+            auto& readRequestData = AZStd::get<FileRequest::ReadRequestData>(request.GetCommand());
+            EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, request.GetStatus());
+            EXPECT_NE(nullptr, readRequestData.m_mappedView);
+            ASSERT_NE(nullptr, readRequestData.m_output);
+            EXPECT_EQ(size, readRequestData.m_outputSize);
+            VerifyBuffer(readRequestData.m_output, offset, size);
+        });
+        FileRequest* read = m_context->GetNewInternalRequest();
+        read->CreateRead(readRequest, nullptr, 0, m_path, offset, size);
+
+        m_reader->QueueRequest(read);
+        ProcessRequests();
+
+        EXPECT_TRUE(callbackCalled);
+    }
+
+    TEST_F(Streamer_MemoryMappedReaderLinuxTest, QueueRequest_FileCanNotBeMapped_ReadIsForwarded)
+    {
+        using ::testing::_;
+
+        RequestPath missingPath;
+        missingPath.InitFromAbsolutePath("/tmp/MemoryMappedReaderTest_DoesNotExist");
+        u8 buffer[64];
+
+        FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateRead(nullptr, buffer, sizeof(buffer), missingPath, 0, sizeof(buffer));
+
+        EXPECT_CALL(*m_mock, QueueRequest(request)).Times(1)
+            .WillOnce([this](FileRequest* request)
+            {
+                request->SetStatus(IStreamerTypes::RequestStatus::Failed);
+                m_context->MarkRequestAsCompleted(request);
+            });
+        m_reader->QueueRequest(request);
+        ProcessRequests();
+    }
+
+    TEST_F(Streamer_MemoryMappedReaderLinuxTest, QueueRequest_ReadBeyondEndOfFile_ReadFails)
+    {
+        u8 buffer[64];
+        IStreamerTypes::RequestStatus status = IStreamerTypes::RequestStatus::Pending;
+        FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateRead(nullptr, buffer, sizeof(buffer), m_path, FileSize - 32, sizeof(buffer));
+        request->SetCompletionCallback([&status](FileRequest& request)
+        {
+            status = request.GetStatus();
+        });
+
+        m_reader->QueueRequest(request);
+        ProcessRequests();
+
+        EXPECT_EQ(IStreamerTypes::RequestStatus::Failed, status);
+    }
+} // namespace AZ::IO
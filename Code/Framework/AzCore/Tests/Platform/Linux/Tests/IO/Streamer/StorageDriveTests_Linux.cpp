@@ -0,0 +1,589 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/IO/IStreamerTypes.h>
+#include <AzCore/IO/Streamer/FileRequest.h>
+#include <AzCore/IO/Streamer/Scheduler.h>
+#include <AzCore/IO/Streamer/StorageDrive_Linux.h>
+#include <AzCore/IO/Streamer/Streamer.h>
+#include <AzCore/IO/Streamer/StreamerContext.h>
+#include <AzCore/std/parallel/binary_semaphore.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+#include <Tests/FileIOBaseTestTypes.h>
+#include <Tests/Streamer/StreamStackEntryConformityTests.h>
+#include <Tests/Streamer/StreamStackEntryMock.h>
+
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace AZ::IO
+{
+    constexpr AZ::u32 TestMaxFileHandles = 1;
+    constexpr AZ::u32 TestMaxMetaDataEntries = 16;
+    constexpr size_t TestPhysicalSectorSize = 4_kib;
+    constexpr size_t TestLogicalSectorSize = 512;
+    constexpr AZ::u32 TestQueueDepth = 8;
+    constexpr AZ::s32 TestOverCommit = 0;
+    // io_uring doesn't accept more than 32768 entries, so this guarantees that setting up the ring fails.
+    constexpr AZ::u32 TestUnsupportedQueueDepth = 64 * 1024;
+
+    //
+    // StreamStackEntry API Conformity
+    //
+    class StorageDriveLinuxTestDescription :
+        public StreamStackEntryConformityTestsDescriptor<StorageDriveLinux>
+    {
+    public:
+        StorageDriveLinux CreateInstance() override
+        {
+            StorageDriveLinux::ConstructionOptions options;
+            options.m_minimalReporting = true;
+
+            return StorageDriveLinux({ "/" }, TestMaxFileHandles, TestMaxMetaDataEntries, TestPhysicalSectorSize,
+                TestLogicalSectorSize, TestQueueDepth, TestOverCommit, options);
+        }
+    };
+
+    INSTANTIATE_TYPED_TEST_CASE_P(
+        Streamer_StorageDriveLinuxConformityTests, StreamStackEntryConformityTests, StorageDriveLinuxTestDescription);
+
+    //
+    // StorageDriveLinux Tests
+    //
+
+    // Exposes the internal state of the drive so tests can verify in-flight behavior and create conditions, such as a full
+    // submission queue, that are hard to trigger otherwise.
+    class StorageDriveLinuxTestAccess
+        : public StorageDriveLinux
+    {
+    public:
+        using StorageDriveLinux::StorageDriveLinux;
+
+        bool IsRingAvailable() const
+        {
+            return !m_ringUnavailable;
+        }
+
+        size_t GetOpenFileHandleCount() const
+        {
+            size_t count = 0;
+            for (int handle : m_fileCache_handles)
+            {
+                count += (handle != InvalidFileHandle) ? 1 : 0;
+            }
+            return count;
+        }
+
+        size_t GetPendingResubmissionCount() const
+        {
+            return m_pendingResubmissions.size();
+        }
+
+        bool HasUnprocessedCompletions() const
+        {
+            return *m_ring.m_completionHead != __atomic_load_n(m_ring.m_completionTail, __ATOMIC_ACQUIRE);
+        }
+
+        //! Fills all remaining submission entries with operations that don't belong to a read, without submitting them.
+        void FillSubmissionQueue()
+        {
+            while (io_uring_sqe* entry = m_ring.GetSubmissionEntry())
+            {
+                entry->opcode = IORING_OP_NOP;
+                entry->user_data = IgnoredCompletion;
+            }
+        }
+
+        //! Submits an operation that doesn't belong to a read, similar to a cancel request.
+        void SubmitIgnoredOperation()
+        {
+            io_uring_sqe* entry = m_ring.GetSubmissionEntry();
+            ASSERT_NE(nullptr, entry);
+            entry->opcode = IORING_OP_NOP;
+            entry->user_data = IgnoredCompletion;
+            ASSERT_TRUE(SubmitEntries());
+        }
+    };
+
+    class Streamer_StorageDriveLinuxTestFixture
+        : public UnitTest::ScopedAllocatorSetupFixture
+        , public UnitTest::SetRestoreFileIOBaseRAII
+    {
+    public:
+        static constexpr u64 FileSize = 64_kib;
+
+        UnitTest::TestFileIOBase m_fileIO{};
+        AZStd::string m_directory;
+        AZStd::vector<AZStd::string> m_files;
+        RequestPath m_path;
+        AZStd::shared_ptr<StorageDriveLinuxTestAccess> m_drive;
+        StreamerContext* m_context{ nullptr };
+
+        Streamer_StorageDriveLinuxTestFixture()
+            : UnitTest::SetRestoreFileIOBaseRAII(m_fileIO)
+        {
+        }
+
+        void SetUp() override
+        {
+            // Use a directory in /var/tmp as /tmp is often a tmpfs, which doesn't support O_DIRECT. If the file system
+            // doesn't support O_DIRECT either way the drive falls back to buffered reads, which should produce the same results.
+            char directory[] = "/var/tmp/StorageDriveLinuxTestXXXXXX";
+            ASSERT_NE(nullptr, ::mkdtemp(directory));
+            m_directory = directory;
+
+            m_path.InitFromAbsolutePath(CreateFile("Data.bin"));
+
+            m_context = new StreamerContext();
+            CreateDrive(TestQueueDepth, true);
+        }
+
+        void TearDown() override
+        {
+            m_drive.reset();
+            delete m_context;
+            m_context = nullptr;
+
+            for (const AZStd::string& file : m_files)
+            {
+                ::unlink(file.c_str());
+            }
+            m_files.clear();
+            ::rmdir(m_directory.c_str());
+        }
+
+        virtual void CreateDrive(u32 queueDepth, bool enableUnbufferedReads)
+        {
+            StorageDriveLinux::ConstructionOptions options;
+            options.m_hasSeekPenalty = false;
+            options.m_enableUnbufferedReads = enableUnbufferedReads;
+            options.m_minimalReporting = true;
+
+            m_drive = AZStd::make_shared<StorageDriveLinuxTestAccess>(AZStd::vector<AZStd::string_view>{ "/" }, TestMaxFileHandles,
+                TestMaxMetaDataEntries, TestPhysicalSectorSize, TestLogicalSectorSize, queueDepth, TestOverCommit, options);
+            m_drive->SetContext(*m_context);
+        }
+
+        // Creates a file that's filled with the offset of every u32 so the reads can be verified.
+        AZStd::string CreateFile(const char* name)
+        {
+            AZStd::string path = AZStd::string::format("%s/%s", m_directory.c_str(), name);
+            int file = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, S_IRUSR | S_IWUSR);
+            EXPECT_GE(file, 0);
+            m_files.push_back(path);
+
+            AZStd::unique_ptr<u32[]> values(new u32[FileSize / sizeof(u32)]);
+            for (u32 i = 0; i < FileSize / sizeof(u32); ++i)
+            {
+                values[i] = i * sizeof(u32);
+            }
+            EXPECT_EQ(FileSize, ::write(file, values.get(), FileSize));
+            ::close(file);
+            return path;
+        }
+
+        // Creates a named pipe and returns a handle that can be used to write to it. Reads from a pipe return as soon as
+        // any data is available, which makes it possible to reliably create short reads.
+        int CreatePipe(const char* name, RequestPath& path)
+        {
+            AZStd::string pipePath = AZStd::string::format("%s/%s", m_directory.c_str(), name);
+            EXPECT_EQ(0, ::mkfifo(pipePath.c_str(), S_IRUSR | S_IWUSR));
+            m_files.push_back(pipePath);
+            path.InitFromAbsolutePath(pipePath);
+            // Opening for both reading and writing makes sure the drive can open the pipe without blocking.
+            return ::open(pipePath.c_str(), O_RDWR | O_NONBLOCK | O_CLOEXEC);
+        }
+
+        void WriteToPipe(int pipe, u64 offset, u64 size)
+        {
+            for (u64 i = offset; i < offset + size; i += sizeof(u32))
+            {
+                u32 value = aznumeric_cast<u32>(i);
+                ASSERT_EQ(sizeof(u32), ::write(pipe, &value, sizeof(u32)));
+            }
+        }
+
+        void WaitTillCompleted()
+        {
+            StreamStackEntry::Status status;
+            auto startTime = AZStd::chrono::system_clock::now();
+            do
+            {
+                m_drive->ExecuteRequests();
+                m_context->FinalizeCompletedRequests();
+
+                status.m_isIdle = true;
+                m_drive->UpdateStatus(status);
+
+                if (AZStd::chrono::system_clock::now() - startTime > AZStd::chrono::seconds(5))
+                {
+                    FAIL();
+                }
+            } while (!status.m_isIdle);
+        }
+
+        void WaitForCompletions()
+        {
+            auto startTime = AZStd::chrono::system_clock::now();
+            while (!m_drive->HasUnprocessedCompletions())
+            {
+                if (AZStd::chrono::system_clock::now() - startTime > AZStd::chrono::seconds(5))
+                {
+                    FAIL();
+                }
+                AZStd::this_thread::yield();
+            }
+        }
+
+        FileRequest* QueueRead(const RequestPath& path, void* buffer, u64 bufferSize, u64 offset, u64 size,
+            IStreamerTypes::RequestStatus& status)
+        {
+            FileRequest* request = m_context->GetNewInternalRequest();
+            request->CreateRead(nullptr, buffer, bufferSize, path, offset, size);
+            request->SetCompletionCallback([&status](FileRequest& request)
+            {
+                status = request.GetStatus();
+            });
+            m_drive->QueueRequest(request);
+            return request;
+        }
+
+        void VerifyBuffer(const void* buffer, u64 offset, u64 size)
+        {
+            const u32* values = reinterpret_cast<const u32*>(buffer);
+            for (u64 i = 0; i < size / sizeof(u32); ++i)
+            {
+                // Using assert here because in case of a problem EXPECT would cause a large amount of log noise.
+                ASSERT_EQ(offset + i * sizeof(u32), values[i]);
+            }
+        }
+    };
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, Constructor_RingSetupFails_RequestsAreForwarded)
+    {
+        using ::testing::_;
+        using ::testing::Return;
+
+        CreateDrive(TestUnsupportedQueueDepth, true);
+        EXPECT_FALSE(m_drive->IsRingAvailable());
+
+        auto mock = AZStd::make_shared<::testing::NiceMock<StreamStackEntryMock>>();
+        m_drive->SetNext(mock);
+
+        u8 buffer[64];
+        FileRequest* request = m_context->GetNewInternalRequest();
+        request->CreateRead(nullptr, buffer, sizeof(buffer), m_path, 0, sizeof(buffer));
+        EXPECT_CALL(*mock, QueueRequest(request)).Times(1)
+            .WillOnce([this](FileRequest* request)
+            {
+                request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+                m_context->MarkRequestAsCompleted(request);
+            });
+        EXPECT_CALL(*mock, ExecuteRequests()).WillRepeatedly(Return(false));
+
+        m_drive->QueueRequest(request);
+        WaitTillCompleted();
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadRequest_AlignedRead_DataIsCorrect)
+    {
+        constexpr u64 offset = 8_kib;
+        constexpr u64 size = 16_kib;
+        void* buffer = azmalloc(size, TestPhysicalSectorSize);
+
+        IStreamerTypes::RequestStatus status = IStreamerTypes::RequestStatus::Pending;
+        QueueRead(m_path, buffer, size, offset, size, status);
+        WaitTillCompleted();
+
+        EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, status);
+        VerifyBuffer(buffer, offset, size);
+
+        azfree(buffer);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadRequest_UnalignedOffsetSizeAndBuffer_DataIsCorrectAndDoesNotWriteMore)
+    {
+        constexpr u64 offset = 1028;
+        constexpr u64 size = 4100;
+        constexpr u64 bufferSize = size + 8;
+        constexpr char unexpectedChar = 'Z';
+
+        u8* memory = reinterpret_cast<u8*>(azmalloc(bufferSize + sizeof(u32), TestPhysicalSectorSize));
+        // Offset the buffer so it's not aligned to the sector size, but still aligned for the verification.
+        u8* buffer = memory + sizeof(u32);
+        ::memset(buffer, unexpectedChar, bufferSize);
+
+        IStreamerTypes::RequestStatus status = IStreamerTypes::RequestStatus::Pending;
+        QueueRead(m_path, buffer, bufferSize, offset, size, status);
+        WaitTillCompleted();
+
+        EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, status);
+        VerifyBuffer(buffer, offset, size);
+        for (u64 i = size; i < bufferSize; ++i)
+        {
+            ASSERT_EQ(unexpectedChar, buffer[i]);
+        }
+
+        azfree(memory);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadRequest_ReadBeyondEndOfFile_ReadFails)
+    {
+        // The first read returns fewer bytes than requested, after which the read for the remainder reaches the end of the file.
+        u8 buffer[64];
+        IStreamerTypes::RequestStatus status = IStreamerTypes::RequestStatus::Pending;
+        QueueRead(m_path, buffer, sizeof(buffer), FileSize - 32, sizeof(buffer), status);
+        WaitTillCompleted();
+
+        EXPECT_EQ(IStreamerTypes::RequestStatus::Failed, status);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadRequest_ShortRead_RemainderIsRead)
+    {
+        constexpr u64 size = 8_kib;
+        CreateDrive(TestQueueDepth, false);
+
+        RequestPath pipePath;
+        int pipe = CreatePipe("ShortRead.pipe", pipePath);
+        ASSERT_GE(pipe, 0);
+        WriteToPipe(pipe, 0, size / 2);
+
+        AZStd::unique_ptr<u8[]> buffer(new u8[size]);
+        IStreamerTypes::RequestStatus status = IStreamerTypes::RequestStatus::Pending;
+        QueueRead(pipePath, buffer.get(), size, 0, size, status);
+
+        // Submit the read and process the first half.
+        m_drive->ExecuteRequests();
+        WaitForCompletions();
+        m_drive->ExecuteRequests();
+        m_context->FinalizeCompletedRequests();
+        EXPECT_EQ(IStreamerTypes::RequestStatus::Pending, status);
+
+        WriteToPipe(pipe, size / 2, size / 2);
+        WaitTillCompleted();
+        ::close(pipe);
+
+        EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, status);
+        VerifyBuffer(buffer.get(), 0, size);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ReadRequest_ShortReadWithFullSubmissionQueue_RemainderIsReadOnNextUpdate)
+    {
+        constexpr u64 size = 8_kib;
+        CreateDrive(1, false);
+
+        RequestPath pipePath;
+        int pipe = CreatePipe("ShortReadFullQueue.pipe", pipePath);
+        ASSERT_GE(pipe, 0);
+        WriteToPipe(pipe, 0, size / 2);
+
+        AZStd::unique_ptr<u8[]> buffer(new u8[size]);
+        IStreamerTypes::RequestStatus status = IStreamerTypes::RequestStatus::Pending;
+        QueueRead(pipePath, buffer.get(), size, 0, size, status);
+
+        m_drive->ExecuteRequests();
+        WaitForCompletions();
+
+        // Processing the first half now has no room to submit the read for the remainder.
+        m_drive->FillSubmissionQueue();
+        m_drive->ExecuteRequests();
+        m_context->FinalizeCompletedRequests();
+        EXPECT_EQ(1u, m_drive->GetPendingResubmissionCount());
+        EXPECT_EQ(IStreamerTypes::RequestStatus::Pending, status);
+
+        WriteToPipe(pipe, size / 2, size / 2);
+        WaitTillCompleted();
+        ::close(pipe);
+
+        EXPECT_EQ(0u, m_drive->GetPendingResubmissionCount());
+        EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, status);
+        VerifyBuffer(buffer.get(), 0, size);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, FlushRequest_ReadInFlight_FileIsClosedAfterReadCompletes)
+    {
+        constexpr u64 size = 16_kib;
+        void* buffer = azmalloc(size, TestPhysicalSectorSize);
+
+        IStreamerTypes::RequestStatus status = IStreamerTypes::RequestStatus::Pending;
+        QueueRead(m_path, buffer, size, 0, size, status);
+        // Submit the read without finalizing it.
+        m_drive->ExecuteRequests();
+
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        FileRequest* flushRequest = m_context->GetNewInternalRequest();
+        flushRequest->CreateFlush(m_path);
+        m_drive->QueueRequest(flushRequest);
+        EXPECT_EQ(1u, m_drive->GetOpenFileHandleCount());
+
+        WaitTillCompleted();
+        AZ_TEST_STOP_TRACE_SUPPRESSION(0);
+
+        EXPECT_EQ(0u, m_drive->GetOpenFileHandleCount());
+        EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, status);
+        VerifyBuffer(buffer, 0, size);
+
+        azfree(buffer);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, FlushAllRequest_ReadInFlight_FileIsClosedAfterReadCompletes)
+    {
+        constexpr u64 size = 16_kib;
+        void* buffer = azmalloc(size, TestPhysicalSectorSize);
+
+        IStreamerTypes::RequestStatus status = IStreamerTypes::RequestStatus::Pending;
+        QueueRead(m_path, buffer, size, 0, size, status);
+        m_drive->ExecuteRequests();
+
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        FileRequest* flushRequest = m_context->GetNewInternalRequest();
+        flushRequest->CreateFlushAll();
+        m_drive->QueueRequest(flushRequest);
+        EXPECT_EQ(1u, m_drive->GetOpenFileHandleCount());
+
+        WaitTillCompleted();
+        AZ_TEST_STOP_TRACE_SUPPRESSION(0);
+
+        EXPECT_EQ(0u, m_drive->GetOpenFileHandleCount());
+        EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, status);
+
+        azfree(buffer);
+    }
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture, ExecuteRequests_CompletionWithoutActiveReads_CompletionIsConsumed)
+    {
+        // Completions for cancel requests can arrive after all reads have completed. These should still be removed from
+        // the completion queue, otherwise the queue eventually overflows.
+        constexpr u64 size = 4_kib;
+        void* buffer = azmalloc(size, TestPhysicalSectorSize);
+        IStreamerTypes::RequestStatus status = IStreamerTypes::RequestStatus::Pending;
+        QueueRead(m_path, buffer, size, 0, size, status);
+        WaitTillCompleted();
+        ASSERT_EQ(IStreamerTypes::RequestStatus::Completed, status);
+
+        m_drive->SubmitIgnoredOperation();
+        WaitForCompletions();
+        m_drive->ExecuteRequests();
+
+        EXPECT_FALSE(m_drive->HasUnprocessedCompletions());
+
+        azfree(buffer);
+    }
+
+    class Streamer_StorageDriveLinuxTestFixture_WithScheduler
+        : public Streamer_StorageDriveLinuxTestFixture
+    {
+    public:
+        void CreateDrive(u32 queueDepth, bool enableUnbufferedReads) override
+        {
+            if (m_streamer)
+            {
+                Interface<IStreamer>::Unregister(m_streamer);
+                delete m_streamer;
+                m_streamer = nullptr;
+            }
+
+            StorageDriveLinux::ConstructionOptions options;
+            options.m_hasSeekPenalty = false;
+            options.m_enableUnbufferedReads = enableUnbufferedReads;
+            options.m_minimalReporting = true;
+            m_drive = AZStd::make_shared<StorageDriveLinuxTestAccess>(AZStd::vector<AZStd::string_view>{ "/" }, TestMaxFileHandles,
+                TestMaxMetaDataEntries, TestPhysicalSectorSize, TestLogicalSectorSize, queueDepth, TestOverCommit, options);
+
+            AZStd::unique_ptr<Scheduler> stack = AZStd::make_unique<Scheduler>(m_drive);
+            m_streamer = aznew AZ::IO::Streamer(AZStd::thread_desc{}, AZStd::move(stack));
+            ASSERT_NE(m_streamer, nullptr);
+            Interface<IStreamer>::Register(m_streamer);
+        }
+
+        void TearDown() override
+        {
+            Interface<IStreamer>::Unregister(m_streamer);
+            delete m_streamer;
+            m_streamer = nullptr;
+
+            Streamer_StorageDriveLinuxTestFixture::TearDown();
+        }
+
+    protected:
+        Streamer* m_streamer{ nullptr };
+    };
+
+    TEST_F(Streamer_StorageDriveLinuxTestFixture_WithScheduler, CancelRequest_ReadsInFlight_AllReadsAndCancelsComplete)
+    {
+        constexpr size_t chunkSize = TestPhysicalSectorSize;
+        constexpr size_t numChunks = FileSize / chunkSize;
+
+        AZStd::array<void*, numChunks> buffers;
+        AZStd::vector<FileRequestPtr> requests;
+        AZStd::vector<FileRequestPtr> cancels;
+        requests.reserve(numChunks);
+        cancels.reserve(numChunks);
+
+        AZStd::binary_semaphore waitForReads;
+        AZStd::binary_semaphore waitForSingleRead;
+        AZStd::atomic_size_t numReadCallbacks = 0;
+        for (size_t i = 0; i < numChunks; ++i)
+        {
+            buffers[i] = azmalloc(chunkSize, TestPhysicalSectorSize);
+            requests.push_back(m_streamer->Read(m_path.GetAbsolutePath(), buffers[i], chunkSize, chunkSize,
+                IStreamerTypes::s_noDeadline, IStreamerTypes::s_priorityMedium, i * chunkSize));
+
+            auto callback = [&waitForReads, &waitForSingleRead, &numReadCallbacks]([[maybe_unused]] FileRequestHandle request)
+            {
+                size_t count = ++numReadCallbacks;
+                if (count == 1)
+                {
+                    waitForSingleRead.release();
+                }
+                if (count == numChunks)
+                {
+                    waitForReads.release();
+                }
+            };
+            m_streamer->SetRequestCompleteCallback(requests[i], AZStd::move(callback));
+        }
+
+        AZStd::binary_semaphore waitForCancels;
+        AZStd::atomic_size_t numCancelCallbacks = 0;
+        for (size_t i = 0; i < numChunks; ++i)
+        {
+            cancels.push_back(m_streamer->Cancel(requests[numChunks - i - 1]));
+            auto callback = [&numCancelCallbacks, &waitForCancels](FileRequestHandle request)
+            {
+                EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, Interface<IStreamer>::Get()->GetRequestStatus(request));
+                if (++numCancelCallbacks == numChunks)
+                {
+                    waitForCancels.release();
+                }
+            };
+            m_streamer->SetRequestCompleteCallback(cancels.back(), AZStd::move(callback));
+        }
+
+        m_streamer->QueueRequestBatch(AZStd::move(requests));
+        waitForSingleRead.try_acquire_for(AZStd::chrono::seconds(1));
+        m_streamer->QueueRequestBatch(AZStd::move(cancels));
+
+        waitForCancels.try_acquire_for(AZStd::chrono::seconds(5));
+        waitForReads.try_acquire_for(AZStd::chrono::seconds(5));
+
+        EXPECT_EQ(numChunks, numCancelCallbacks);
+        EXPECT_EQ(numChunks, numReadCallbacks);
+
+        for (void* buffer : buffers)
+        {
+            azfree(buffer);
+        }
+    }
+} // namespace AZ::IO
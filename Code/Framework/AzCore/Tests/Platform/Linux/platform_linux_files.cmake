@@ -7,6 +7,8 @@
 #
 
 set(FILES
+    Tests/IO/Streamer/MemoryMappedReaderTests_Linux.cpp
+    Tests/IO/Streamer/StorageDriveTests_Linux.cpp
     Tests/UtilsTests_Linux.cpp
     ../Common/UnixLike/Tests/UtilsTests_UnixLike.cpp
 )
@@ -8,6 +8,7 @@
 
 #include "FileIOBaseTestTypes.h"
 
+#include <AzCore/Asset/AssetDataStream.h>
 #include <AzCore/Asset/AssetManager.h>
 #include <AzCore/Asset/AssetSerializer.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
@@ -8153,3 +8154,309 @@ namespace UnitTest
     }
 }
 
+
+namespace UnitTest
+{
+    class ObjectStreamInPlaceReadTest
+        : public Serialization
+    {
+    public:
+        struct InPlaceReadData
+        {
+            AZ_TYPE_INFO(InPlaceReadData, "{5C3B2E8F-19A4-4C36-9E2D-7A41F0B8D6C5}");
+            AZ_CLASS_ALLOCATOR(InPlaceReadData, AZ::SystemAllocator, 0);
+
+            static void Reflect(AZ::SerializeContext& context)
+            {
+                context.Class<InPlaceReadData>()
+                    ->Version(1)
+                    ->Field("Name", &InPlaceReadData::m_name)
+                    ->Field("Bytes", &InPlaceReadData::m_bytes)
+                    ->Field("Floats", &InPlaceReadData::m_floats)
+                    ->Field("Positions", &InPlaceReadData::m_positions)
+                    ->Field("Value", &InPlaceReadData::m_value)
+                    ;
+            }
+
+            void Fill(size_t count)
+            {
+                m_name = AZStd::string::format("In place read data with %zu elements and a name long enough to not fit in a small string", count);
+                m_bytes.resize(count * 4);
+                for (size_t i = 0; i < m_bytes.size(); ++i)
+                {
+                    m_bytes[i] = static_cast<AZ::u8>(i * 7);
+                }
+                for (size_t i = 0; i < count; ++i)
+                {
+                    m_floats.push_back(static_cast<float>(i) * 0.5f);
+                    m_positions.emplace_back(static_cast<float>(i), -static_cast<float>(i), 2.0f);
+                }
+                m_value = 42;
+            }
+
+            bool operator==(const InPlaceReadData& rhs) const
+            {
+                return m_name == rhs.m_name && m_bytes == rhs.m_bytes && m_floats == rhs.m_floats &&
+                    m_positions == rhs.m_positions && m_value == rhs.m_value;
+            }
+
+            AZStd::string m_name;
+            AZStd::vector<AZ::u8> m_bytes;
+            AZStd::vector<float> m_floats;
+            AZStd::vector<AZ::Vector3> m_positions;
+            int m_value{ 0 };
+        };
+
+        //! Forwards all calls to another stream but doesn't provide access to the data in place, forcing values to be copied.
+        class CopyingStream
+            : public AZ::IO::GenericStream
+        {
+        public:
+            explicit CopyingStream(AZ::IO::GenericStream& stream)
+                : m_stream(stream)
+            {
+            }
+
+            bool IsOpen() const override { return m_stream.IsOpen(); }
+            bool CanSeek() const override { return m_stream.CanSeek(); }
+            bool CanRead() const override { return m_stream.CanRead(); }
+            bool CanWrite() const override { return false; }
+            void Seek(AZ::IO::OffsetType bytes, SeekMode mode) override { m_stream.Seek(bytes, mode); }
+            AZ::IO::SizeType Read(AZ::IO::SizeType bytes, void* oBuffer) override { return m_stream.Read(bytes, oBuffer); }
+            AZ::IO::SizeType Write(AZ::IO::SizeType, const void*) override { return 0; }
+            AZ::IO::SizeType GetCurPos() const override { return m_stream.GetCurPos(); }
+            AZ::IO::SizeType GetLength() const override { return m_stream.GetLength(); }
+
+        private:
+            AZ::IO::GenericStream& m_stream;
+        };
+
+        //! Forwards all calls to another stream, including access to its data in place, and counts the bytes that are read.
+        //! Values that are borrowed from the stream are skipped over instead of read, so they don't add to the count.
+        class ReadCountingStream
+            : public AZ::IO::GenericStream
+        {
+        public:
+            explicit ReadCountingStream(AZ::IO::GenericStream& stream)
+                : m_stream(stream)
+            {
+            }
+
+            bool IsOpen() const override { return m_stream.IsOpen(); }
+            bool CanSeek() const override { return m_stream.CanSeek(); }
+            bool CanRead() const override { return m_stream.CanRead(); }
+            bool CanWrite() const override { return false; }
+            void Seek(AZ::IO::OffsetType bytes, SeekMode mode) override { m_stream.Seek(bytes, mode); }
+            AZ::IO::SizeType Read(AZ::IO::SizeType bytes, void* oBuffer) override
+            {
+                const AZ::IO::SizeType bytesRead = m_stream.Read(bytes, oBuffer);
+                m_bytesRead += bytesRead;
+                return bytesRead;
+            }
+            AZ::IO::SizeType Write(AZ::IO::SizeType, const void*) override { return 0; }
+            AZ::IO::SizeType GetCurPos() const override { return m_stream.GetCurPos(); }
+            AZ::IO::SizeType GetLength() const override { return m_stream.GetLength(); }
+            const void* GetContiguousData() const override { return m_stream.GetContiguousData(); }
+
+            AZ::IO::SizeType GetBytesRead() const { return m_bytesRead; }
+
+        private:
+            AZ::IO::GenericStream& m_stream;
+            AZ::IO::SizeType m_bytesRead = 0;
+        };
+
+        void SetUp() override
+        {
+            Serialization::SetUp();
+            InPlaceReadData::Reflect(*m_serializeContext);
+
+            m_source.Fill(64);
+            AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&m_binaryData);
+            ASSERT_TRUE(AZ::Utils::SaveObjectToStream(stream, AZ::DataStream::ST_BINARY, &m_source, m_serializeContext.get()));
+        }
+
+        void TearDown() override
+        {
+            m_binaryData = {};
+            m_source = {};
+            Serialization::TearDown();
+        }
+
+    protected:
+        InPlaceReadData m_source;
+        AZStd::vector<char> m_binaryData;
+    };
+
+    TEST_F(ObjectStreamInPlaceReadTest, LoadBinary_FromMemoryStream_MatchesSource)
+    {
+        AZ::IO::MemoryStream stream(m_binaryData.data(), m_binaryData.size());
+        ASSERT_NE(nullptr, stream.GetContiguousData());
+
+        InPlaceReadData loaded;
+        EXPECT_TRUE(AZ::Utils::LoadObjectFromStreamInPlace(stream, loaded, m_serializeContext.get()));
+        EXPECT_EQ(m_source, loaded);
+        EXPECT_EQ(stream.GetLength(), stream.GetCurPos());
+    }
+
+    TEST_F(ObjectStreamInPlaceReadTest, LoadBinary_FromStreamWithoutContiguousData_MatchesSource)
+    {
+        AZ::IO::MemoryStream memoryStream(m_binaryData.data(), m_binaryData.size());
+        CopyingStream stream(memoryStream);
+        ASSERT_EQ(nullptr, stream.GetContiguousData());
+
+        InPlaceReadData loaded;
+        EXPECT_TRUE(AZ::Utils::LoadObjectFromStreamInPlace(stream, loaded, m_serializeContext.get()));
+        EXPECT_EQ(m_source, loaded);
+    }
+
+    TEST_F(ObjectStreamInPlaceReadTest, LoadBinary_FromAssetDataStream_MatchesSource)
+    {
+        AZStd::vector<AZ::u8> data(m_binaryData.begin(), m_binaryData.end());
+        AZ::Data::AssetDataStream stream;
+        stream.Open(AZStd::move(data));
+        ASSERT_NE(nullptr, stream.GetContiguousData());
+
+        InPlaceReadData loaded;
+        EXPECT_TRUE(AZ::Utils::LoadObjectFromStreamInPlace(stream, loaded, m_serializeContext.get()));
+        EXPECT_EQ(m_source, loaded);
+        stream.Close();
+    }
+
+    TEST_F(ObjectStreamInPlaceReadTest, LoadBinary_FromMemoryStream_ValuesAreBorrowed)
+    {
+        AZ::IO::MemoryStream memoryStream(m_binaryData.data(), m_binaryData.size());
+        ReadCountingStream stream(memoryStream);
+        ASSERT_NE(nullptr, stream.GetContiguousData());
+
+        InPlaceReadData loaded;
+        EXPECT_TRUE(AZ::Utils::LoadObjectFromStreamInPlace(stream, loaded, m_serializeContext.get()));
+        EXPECT_EQ(m_source, loaded);
+        EXPECT_EQ(stream.GetLength(), stream.GetCurPos());
+        EXPECT_LT(stream.GetBytesRead(), stream.GetLength());
+    }
+
+    TEST_F(ObjectStreamInPlaceReadTest, LoadBinary_FromByteContainerStream_ValuesAreBorrowed)
+    {
+        AZ::IO::ByteContainerStream<AZStd::vector<char>> byteStream(&m_binaryData);
+        ReadCountingStream stream(byteStream);
+        ASSERT_NE(nullptr, stream.GetContiguousData());
+
+        InPlaceReadData loaded;
+        EXPECT_TRUE(AZ::Utils::LoadObjectFromStreamInPlace(stream, loaded, m_serializeContext.get()));
+        EXPECT_EQ(m_source, loaded);
+        EXPECT_EQ(stream.GetLength(), stream.GetCurPos());
+        EXPECT_LT(stream.GetBytesRead(), stream.GetLength());
+    }
+
+    TEST_F(ObjectStreamInPlaceReadTest, LoadBinary_FromFileStream_ValuesAreCopied)
+    {
+        AZ::Test::ScopedAutoTempDirectory tempDir;
+        const AZStd::string filePath = tempDir.Resolve("ObjectStreamInPlaceRead.bin");
+        {
+            AZ::IO::SystemFile outFile;
+            ASSERT_TRUE(outFile.Open(filePath.c_str(), AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY));
+            ASSERT_EQ(m_binaryData.size(), outFile.Write(m_binaryData.data(), m_binaryData.size()));
+        }
+
+        AZ::IO::SystemFile inFile;
+        ASSERT_TRUE(inFile.Open(filePath.c_str(), AZ::IO::SystemFile::SF_OPEN_READ_ONLY));
+        AZ::IO::SystemFileStream fileStream(&inFile, false);
+        ReadCountingStream stream(fileStream);
+        ASSERT_EQ(nullptr, stream.GetContiguousData());
+
+        InPlaceReadData loaded;
+        EXPECT_TRUE(AZ::Utils::LoadObjectFromStreamInPlace(stream, loaded, m_serializeContext.get()));
+        EXPECT_EQ(m_source, loaded);
+        EXPECT_EQ(stream.GetLength(), stream.GetBytesRead());
+    }
+
+    TEST_F(ObjectStreamInPlaceReadTest, LoadBinary_SourceBufferChangedAfterLoad_LoadedObjectIsUnaffected)
+    {
+        InPlaceReadData loaded;
+        {
+            AZ::IO::MemoryStream stream(m_binaryData.data(), m_binaryData.size());
+            EXPECT_TRUE(AZ::Utils::LoadObjectFromStreamInPlace(stream, loaded, m_serializeContext.get()));
+        }
+        AZStd::fill(m_binaryData.begin(), m_binaryData.end(), '\0');
+        EXPECT_EQ(m_source, loaded);
+    }
+} // namespace UnitTest
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    class ObjectStreamBinaryLoadBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        using InPlaceReadData = UnitTest::ObjectStreamInPlaceReadTest::InPlaceReadData;
+        using CopyingStream = UnitTest::ObjectStreamInPlaceReadTest::CopyingStream;
+
+        void SetUp(const ::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+
+            m_serializeContext = AZStd::make_unique<AZ::SerializeContext>();
+            InPlaceReadData::Reflect(*m_serializeContext);
+
+            InPlaceReadData source;
+            source.Fill(aznumeric_cast<size_t>(state.range(0)));
+            AZ::IO::ByteContainerStream<AZStd::vector<char>> stream(&m_binaryData);
+            AZ::Utils::SaveObjectToStream(stream, AZ::DataStream::ST_BINARY, &source, m_serializeContext.get());
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            SetUp(static_cast<const ::benchmark::State&>(state));
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            m_binaryData = {};
+            m_serializeContext.reset();
+
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            TearDown(static_cast<const ::benchmark::State&>(state));
+        }
+
+    protected:
+        AZStd::unique_ptr<AZ::SerializeContext> m_serializeContext;
+        AZStd::vector<char> m_binaryData;
+    };
+
+    // Values are read directly from the memory of the stream.
+    BENCHMARK_DEFINE_F(ObjectStreamBinaryLoadBenchmarkFixture, LoadInPlace)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            AZ::IO::MemoryStream stream(m_binaryData.data(), m_binaryData.size());
+            InPlaceReadData loaded;
+            AZ::Utils::LoadObjectFromStreamInPlace(stream, loaded, m_serializeContext.get());
+            benchmark::DoNotOptimize(loaded.m_floats.data());
+        }
+    }
+    BENCHMARK_REGISTER_F(ObjectStreamBinaryLoadBenchmarkFixture, LoadInPlace)
+        ->RangeMultiplier(8)->Range(64, 4096)->Unit(benchmark::kMillisecond);
+
+    // Values are copied out of the stream before being passed to the serializers.
+    BENCHMARK_DEFINE_F(ObjectStreamBinaryLoadBenchmarkFixture, LoadWithCopies)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            AZ::IO::MemoryStream memoryStream(m_binaryData.data(), m_binaryData.size());
+            CopyingStream stream(memoryStream);
+            InPlaceReadData loaded;
+            AZ::Utils::LoadObjectFromStreamInPlace(stream, loaded, m_serializeContext.get());
+            benchmark::DoNotOptimize(loaded.m_floats.data());
+        }
+    }
+    BENCHMARK_REGISTER_F(ObjectStreamBinaryLoadBenchmarkFixture, LoadWithCopies)
+        ->RangeMultiplier(8)->Range(64, 4096)->Unit(benchmark::kMillisecond);
+} // namespace Benchmark
+#endif // HAVE_BENCHMARK
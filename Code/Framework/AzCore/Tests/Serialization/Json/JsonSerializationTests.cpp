@@ -9,8 +9,10 @@
 #include <AzCore/PlatformDef.h>
 
 #include <AzCore/JSON/pointer.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
+#include <AzCore/std/string/string.h>
 
 #include <Tests/SerializeContextFixture.h>
 #include <Tests/Serialization/Json/JsonSerializationTests.h>
@@ -205,6 +207,35 @@ namespace JsonSerializationTests
         EXPECT_TRUE(loadInstance.Equals(*description.m_instance, this->m_fullyReflected));
     }
 
+    TYPED_TEST(TypedJsonSerializationTests, LoadAndStore_SerializationPlansDisabled_ResultsMatchSerializationPlans)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        this->Reflect(true);
+        this->m_serializationSettings->m_keepDefaults = false;
+        auto description = TypeParam::GetInstanceWithSomeDefaults();
+        AZ::JsonSerializationPlanCache& planCache = this->m_jsonRegistrationContext->GetSerializationPlanCache();
+
+        rapidjson::Document storedWithPlans;
+        ResultCode storeWithPlansResult = AZ::JsonSerialization::Store(storedWithPlans, storedWithPlans.GetAllocator(),
+            *description.m_instance, *this->m_serializationSettings);
+        TypeParam loadedWithPlans;
+        ResultCode loadWithPlansResult = AZ::JsonSerialization::Load(loadedWithPlans, storedWithPlans, *this->m_deserializationSettings);
+
+        planCache.SetEnabled(false);
+        rapidjson::Document storedWithoutPlans;
+        ResultCode storeWithoutPlansResult = AZ::JsonSerialization::Store(storedWithoutPlans, storedWithoutPlans.GetAllocator(),
+            *description.m_instance, *this->m_serializationSettings);
+        TypeParam loadedWithoutPlans;
+        ResultCode loadWithoutPlansResult = AZ::JsonSerialization::Load(loadedWithoutPlans, storedWithoutPlans, *this->m_deserializationSettings);
+        planCache.SetEnabled(true);
+
+        EXPECT_EQ(storeWithoutPlansResult.GetOutcome(), storeWithPlansResult.GetOutcome());
+        EXPECT_EQ(loadWithoutPlansResult.GetOutcome(), loadWithPlansResult.GetOutcome());
+        this->Expect_DocStrEq(storedWithoutPlans, storedWithPlans);
+        EXPECT_TRUE(loadedWithPlans.Equals(loadedWithoutPlans, this->m_fullyReflected));
+    }
+
     // Load
 
     TEST_F(JsonSerializationTests, Load_PrimitiveAtTheRoot_SucceedsAndObjectMatches)
@@ -413,6 +444,33 @@ namespace JsonSerializationTests
         EXPECT_STRCASEEQ("{E7829F37-C577-4F2B-A85B-6F331548354C} Inherited", type);
     }
 
+    TEST_F(JsonSerializationTests, Load_ReflectionChangedAfterLoading_SerializationPlanIsRebuilt)
+    {
+        using namespace AZ::JsonSerializationResult;
+
+        m_jsonDocument->Parse(R"({ "var1": 88, "var2": 88.0 })");
+
+        m_serializeContext->Class<SimpleClass>()
+            ->Field("var1", &SimpleClass::m_var1);
+
+        SimpleClass partialInstance;
+        ResultCode partialResult = AZ::JsonSerialization::Load(partialInstance, *m_jsonDocument, *m_deserializationSettings);
+        EXPECT_EQ(Outcomes::PartialSkip, partialResult.GetOutcome());
+        EXPECT_EQ(88, partialInstance.m_var1);
+        EXPECT_EQ(42.0f, partialInstance.m_var2);
+
+        m_serializeContext->EnableRemoveReflection();
+        m_serializeContext->Class<SimpleClass>();
+        m_serializeContext->DisableRemoveReflection();
+        SimpleClass::Reflect(m_serializeContext, true);
+
+        SimpleClass fullInstance;
+        ResultCode fullResult = AZ::JsonSerialization::Load(fullInstance, *m_jsonDocument, *m_deserializationSettings);
+        EXPECT_EQ(Outcomes::Success, fullResult.GetOutcome());
+        EXPECT_EQ(88, fullInstance.m_var1);
+        EXPECT_EQ(88.0f, fullInstance.m_var2);
+    }
+
     TEST_F(JsonSerializationTests, Load_TemplatedClassWithRegisteredHandler_LoadOnHandlerCalled)
     {
         using namespace AZ::JsonSerializationResult;
@@ -566,3 +624,225 @@ namespace JsonSerializationTests
         EXPECT_EQ(Outcomes::Catastrophic, result.GetOutcome());
     }
 } // namespace JsonSerializationTests
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    // A set of classes that roughly resembles the layout of entities and components in a prefab.
+    struct PlanBenchmarkComponentBase
+    {
+        AZ_RTTI(PlanBenchmarkComponentBase, "{2C6A5B1E-8F0B-4E3A-9C1D-5A7E2B9F4D60}");
+        virtual ~PlanBenchmarkComponentBase() = default;
+
+        AZ::u64 m_id{ 0 };
+        bool m_isEnabled{ true };
+    };
+
+    struct PlanBenchmarkTransform
+        : public PlanBenchmarkComponentBase
+    {
+        AZ_RTTI(PlanBenchmarkTransform, "{7E9D0F3A-1B52-4C8E-A6F4-3D2B8C1E5A97}", PlanBenchmarkComponentBase);
+
+        float m_translationX{ 0.0f };
+        float m_translationY{ 0.0f };
+        float m_translationZ{ 0.0f };
+        float m_rotationX{ 0.0f };
+        float m_rotationY{ 0.0f };
+        float m_rotationZ{ 0.0f };
+        float m_rotationW{ 1.0f };
+        float m_scale{ 1.0f };
+        AZ::u64 m_parentId{ 0 };
+        bool m_isStatic{ false };
+    };
+
+    struct PlanBenchmarkMesh
+        : public PlanBenchmarkComponentBase
+    {
+        AZ_RTTI(PlanBenchmarkMesh, "{A4F1C7B2-6D3E-4A9B-8E05-9B7C2D1F6E38}", PlanBenchmarkComponentBase);
+
+        AZStd::string m_modelAsset;
+        AZStd::string m_material;
+        float m_lodDistance{ 100.0f };
+        int m_sortKey{ 0 };
+        bool m_castShadows{ true };
+        bool m_receiveShadows{ true };
+    };
+
+    struct PlanBenchmarkEntity
+    {
+        AZ_TYPE_INFO(PlanBenchmarkEntity, "{5D8B3E2F-0C4A-4F7D-B19E-6A2C8F3D7B41}");
+
+        AZ::u64 m_id{ 0 };
+        AZStd::string m_name;
+        PlanBenchmarkTransform m_transform;
+        PlanBenchmarkMesh m_mesh;
+        AZStd::vector<AZ::u64> m_children;
+    };
+
+    struct PlanBenchmarkPrefab
+    {
+        AZ_TYPE_INFO(PlanBenchmarkPrefab, "{E3C7A9D1-2F6B-4B8E-9D4A-1C5F7E3B9A26}");
+
+        AZStd::string m_name;
+        AZStd::vector<PlanBenchmarkEntity> m_entities;
+    };
+
+    class JsonSerializationPlanBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+
+            m_serializeContext = AZStd::make_unique<AZ::SerializeContext>();
+            m_registrationContext = AZStd::make_unique<AZ::JsonRegistrationContext>();
+            AZ::JsonSystemComponent::Reflect(m_registrationContext.get());
+            Reflect();
+
+            m_serializerSettings.m_serializeContext = m_serializeContext.get();
+            m_serializerSettings.m_registrationContext = m_registrationContext.get();
+            m_deserializerSettings.m_serializeContext = m_serializeContext.get();
+            m_deserializerSettings.m_registrationContext = m_registrationContext.get();
+
+            const int entityCount = aznumeric_cast<int>(state.range(0));
+            m_prefab.m_name = "BenchmarkPrefab";
+            m_prefab.m_entities.resize(entityCount);
+            for (int i = 0; i < entityCount; ++i)
+            {
+                PlanBenchmarkEntity& entity = m_prefab.m_entities[i];
+                entity.m_id = i + 1;
+                entity.m_name = AZStd::string::format("Entity_%i", i);
+                entity.m_transform.m_id = i * 2 + 1;
+                entity.m_transform.m_translationX = i * 0.5f;
+                entity.m_transform.m_translationZ = i * -0.25f;
+                entity.m_transform.m_parentId = i / 8;
+                entity.m_mesh.m_id = i * 2 + 2;
+                entity.m_mesh.m_modelAsset = AZStd::string::format("objects/model_%i.azmodel", i % 16);
+                entity.m_mesh.m_sortKey = i % 4;
+                for (int child = 0; child < i % 4; ++child)
+                {
+                    entity.m_children.push_back(i * 4 + child);
+                }
+            }
+
+            AZ::JsonSerialization::Store(m_document, m_document.GetAllocator(), m_prefab, m_serializerSettings);
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            SetUp(static_cast<const ::benchmark::State&>(state));
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            m_document = rapidjson::Document();
+            m_prefab = PlanBenchmarkPrefab();
+            m_serializerSettings = AZ::JsonSerializerSettings();
+            m_deserializerSettings = AZ::JsonDeserializerSettings();
+
+            m_registrationContext->EnableRemoveReflection();
+            AZ::JsonSystemComponent::Reflect(m_registrationContext.get());
+            m_registrationContext->DisableRemoveReflection();
+            m_registrationContext.reset();
+            m_serializeContext.reset();
+
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            TearDown(static_cast<const ::benchmark::State&>(state));
+        }
+
+    protected:
+        void Reflect()
+        {
+            m_serializeContext->Class<PlanBenchmarkComponentBase>()
+                ->Field("Id", &PlanBenchmarkComponentBase::m_id)
+                ->Field("IsEnabled", &PlanBenchmarkComponentBase::m_isEnabled);
+            m_serializeContext->Class<PlanBenchmarkTransform, PlanBenchmarkComponentBase>()
+                ->Field("TranslationX", &PlanBenchmarkTransform::m_translationX)
+                ->Field("TranslationY", &PlanBenchmarkTransform::m_translationY)
+                ->Field("TranslationZ", &PlanBenchmarkTransform::m_translationZ)
+                ->Field("RotationX", &PlanBenchmarkTransform::m_rotationX)
+                ->Field("RotationY", &PlanBenchmarkTransform::m_rotationY)
+                ->Field("RotationZ", &PlanBenchmarkTransform::m_rotationZ)
+                ->Field("RotationW", &PlanBenchmarkTransform::m_rotationW)
+                ->Field("Scale", &PlanBenchmarkTransform::m_scale)
+                ->Field("ParentId", &PlanBenchmarkTransform::m_parentId)
+                ->Field("IsStatic", &PlanBenchmarkTransform::m_isStatic);
+            m_serializeContext->Class<PlanBenchmarkMesh, PlanBenchmarkComponentBase>()
+                ->Field("ModelAsset", &PlanBenchmarkMesh::m_modelAsset)
+                ->Field("Material", &PlanBenchmarkMesh::m_material)
+                ->Field("LodDistance", &PlanBenchmarkMesh::m_lodDistance)
+                ->Field("SortKey", &PlanBenchmarkMesh::m_sortKey)
+                ->Field("CastShadows", &PlanBenchmarkMesh::m_castShadows)
+                ->Field("ReceiveShadows", &PlanBenchmarkMesh::m_receiveShadows);
+            m_serializeContext->Class<PlanBenchmarkEntity>()
+                ->Field("Id", &PlanBenchmarkEntity::m_id)
+                ->Field("Name", &PlanBenchmarkEntity::m_name)
+                ->Field("Transform", &PlanBenchmarkEntity::m_transform)
+                ->Field("Mesh", &PlanBenchmarkEntity::m_mesh)
+                ->Field("Children", &PlanBenchmarkEntity::m_children);
+            m_serializeContext->Class<PlanBenchmarkPrefab>()
+                ->Field("Name", &PlanBenchmarkPrefab::m_name)
+                ->Field("Entities", &PlanBenchmarkPrefab::m_entities);
+        }
+
+        void Load(benchmark::State& state, bool useSerializationPlans)
+        {
+            m_registrationContext->GetSerializationPlanCache().SetEnabled(useSerializationPlans);
+            for (auto _ : state)
+            {
+                PlanBenchmarkPrefab prefab;
+                AZ::JsonSerialization::Load(prefab, m_document, m_deserializerSettings);
+                benchmark::DoNotOptimize(prefab.m_entities.data());
+            }
+            state.SetItemsProcessed(state.iterations() * state.range(0));
+        }
+
+        void Store(benchmark::State& state, bool useSerializationPlans)
+        {
+            m_registrationContext->GetSerializationPlanCache().SetEnabled(useSerializationPlans);
+            for (auto _ : state)
+            {
+                rapidjson::Document document;
+                AZ::JsonSerialization::Store(document, document.GetAllocator(), m_prefab, m_serializerSettings);
+                benchmark::DoNotOptimize(document.MemberCount());
+            }
+            state.SetItemsProcessed(state.iterations() * state.range(0));
+        }
+
+        AZStd::unique_ptr<AZ::SerializeContext> m_serializeContext;
+        AZStd::unique_ptr<AZ::JsonRegistrationContext> m_registrationContext;
+        AZ::JsonSerializerSettings m_serializerSettings;
+        AZ::JsonDeserializerSettings m_deserializerSettings;
+        PlanBenchmarkPrefab m_prefab;
+        rapidjson::Document m_document;
+    };
+
+    BENCHMARK_DEFINE_F(JsonSerializationPlanBenchmarkFixture, Load_WithoutSerializationPlans)(benchmark::State& state)
+    {
+        Load(state, false);
+    }
+
+    BENCHMARK_DEFINE_F(JsonSerializationPlanBenchmarkFixture, Load_WithSerializationPlans)(benchmark::State& state)
+    {
+        Load(state, true);
+    }
+
+    BENCHMARK_DEFINE_F(JsonSerializationPlanBenchmarkFixture, Store_WithoutSerializationPlans)(benchmark::State& state)
+    {
+        Store(state, false);
+    }
+
+    BENCHMARK_DEFINE_F(JsonSerializationPlanBenchmarkFixture, Store_WithSerializationPlans)(benchmark::State& state)
+    {
+        Store(state, true);
+    }
+
+    BENCHMARK_REGISTER_F(JsonSerializationPlanBenchmarkFixture, Load_WithoutSerializationPlans)->RangeMultiplier(8)->Range(64, 4096)->Unit(benchmark::kMillisecond);
+    BENCHMARK_REGISTER_F(JsonSerializationPlanBenchmarkFixture, Load_WithSerializationPlans)->RangeMultiplier(8)->Range(64, 4096)->Unit(benchmark::kMillisecond);
+    BENCHMARK_REGISTER_F(JsonSerializationPlanBenchmarkFixture, Store_WithoutSerializationPlans)->RangeMultiplier(8)->Range(64, 4096)->Unit(benchmark::kMillisecond);
+    BENCHMARK_REGISTER_F(JsonSerializationPlanBenchmarkFixture, Store_WithSerializationPlans)->RangeMultiplier(8)->Range(64, 4096)->Unit(benchmark::kMillisecond);
+} // namespace Benchmark
+#endif // HAVE_BENCHMARK
@@ -294,6 +294,28 @@ namespace UnitTest
         EXPECT_TRUE(result.GetError().find("JSON parse error at line 5:") == 0);
     }
     
+    TEST_F(JsonSerializationUtilsTests, LoadJsonStream_LongAndEscapedStrings_MatchesReadJsonString)
+    {
+        // Strings of various lengths with escapes at different offsets to cover the vectorized string scanning.
+        AZStd::string jsonText = "{\n    // Comments are allowed.\n";
+        for (int i = 0; i < 48; ++i)
+        {
+            AZStd::string value(i, 'x');
+            value.insert(i / 2, "\\\"\\n\\u00e9");
+            jsonText += AZStd::string::format(R"(    "key%i":%*s"%s",)" "\n", i, i % 17 + 1, " ", value.c_str());
+        }
+        jsonText += R"(    "last": [ 1, 2.5, true, null ])" "\n}";
+
+        AZ::Outcome<rapidjson::Document, AZStd::string> expected = JsonSerializationUtils::ReadJsonString(jsonText);
+        ASSERT_TRUE(expected.IsSuccess());
+
+        IO::MemoryStream stream(jsonText.c_str(), jsonText.size());
+        AZ::Outcome<rapidjson::Document, AZStd::string> result = JsonSerializationUtils::ReadJsonStream(stream);
+        ASSERT_TRUE(result.IsSuccess());
+        EXPECT_TRUE(expected.GetValue() == result.GetValue());
+        EXPECT_EQ(49u, result.GetValue().MemberCount());
+    }
+
     TEST_F(JsonSerializationUtilsTests, LoadObjectFromStream_Failed_ParseError)
     {
         char buffer[1024] = "Not a Json";
@@ -490,3 +512,115 @@ namespace UnitTest
 
 } // namespace UnitTest
 
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    class JsonParseBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+
+            // Create text that resembles a prefab with a number of entities, each with a few components.
+            const int entityCount = aznumeric_cast<int>(state.range(0));
+            m_jsonText = R"({ "ContainerEntity": { "Id": "ContainerEntity", "Name": "Benchmark" }, "Entities": {)";
+            for (int i = 0; i < entityCount; ++i)
+            {
+                m_jsonText += AZStd::string::format(R"(%s
+        "Entity_[%i]": {
+            "Id": "Entity_[%i]",
+            "Name": "Entity number %i with a longer descriptive name",
+            "Components": {
+                "Component_[%i]": {
+                    "$type": "{27F1E1A1-8D9D-4C3B-BD3A-AFB9762449C0} TransformComponent",
+                    "Id": %i,
+                    "Parent Entity": "ContainerEntity",
+                    "Transform Data": { "Translate": [ %f, 0.0, %f ], "Rotate": [ 0.0, 0.0, 90.0 ], "UniformScale": 1.0 }
+                },
+                "Component_[%i]": {
+                    "$type": "AZ::Render::EditorMeshComponent",
+                    "Id": %i,
+                    "Controller": { "Configuration": { "ModelAsset": { "assetId": { "guid": "{8A9E7B2C-3D41-4F5A-9B6E-1C2D3E4F5A6B}", "subId": 268435456 }, "assetHint": "objects/props/model_%i.azmodel" } } }
+                }
+            }
+        })",
+                    i == 0 ? "" : ",", i, i, i, i * 2, i * 2, i * 0.5, i * -0.25, i * 2 + 1, i * 2 + 1, i % 32);
+            }
+            m_jsonText += "} }";
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            SetUp(static_cast<const ::benchmark::State&>(state));
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            m_jsonText = {};
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            TearDown(static_cast<const ::benchmark::State&>(state));
+        }
+
+    protected:
+        AZStd::string m_jsonText;
+    };
+
+    // Parsing with an explicit length, which reads the text through a memory stream one character at a time.
+    BENCHMARK_DEFINE_F(JsonParseBenchmarkFixture, ParseWithLength)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            rapidjson::Document document;
+            document.Parse<rapidjson::kParseCommentsFlag>(m_jsonText.data(), m_jsonText.size());
+            benchmark::DoNotOptimize(document.MemberCount());
+        }
+        state.SetBytesProcessed(state.iterations() * m_jsonText.size());
+    }
+
+    // Parsing zero terminated text, which allows the SIMD code paths to be used for whitespace and strings.
+    BENCHMARK_DEFINE_F(JsonParseBenchmarkFixture, ParseZeroTerminated)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            rapidjson::Document document;
+            document.Parse<rapidjson::kParseCommentsFlag>(m_jsonText.c_str());
+            benchmark::DoNotOptimize(document.MemberCount());
+        }
+        state.SetBytesProcessed(state.iterations() * m_jsonText.size());
+    }
+
+    // Parsing in place, which avoids copying strings but requires a writable copy of the text.
+    BENCHMARK_DEFINE_F(JsonParseBenchmarkFixture, ParseInsitu)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            AZStd::string buffer = m_jsonText;
+            rapidjson::Document document;
+            document.ParseInsitu<rapidjson::kParseCommentsFlag>(buffer.data());
+            benchmark::DoNotOptimize(document.MemberCount());
+        }
+        state.SetBytesProcessed(state.iterations() * m_jsonText.size());
+    }
+
+    // The full cost of reading json through JsonSerializationUtils, including copying it out of the stream.
+    BENCHMARK_DEFINE_F(JsonParseBenchmarkFixture, ReadJsonStream)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            AZ::IO::MemoryStream stream(m_jsonText.c_str(), m_jsonText.size());
+            auto result = AZ::JsonSerializationUtils::ReadJsonStream(stream);
+            benchmark::DoNotOptimize(result.IsSuccess());
+        }
+        state.SetBytesProcessed(state.iterations() * m_jsonText.size());
+    }
+
+    BENCHMARK_REGISTER_F(JsonParseBenchmarkFixture, ParseWithLength)->RangeMultiplier(8)->Range(64, 4096)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(JsonParseBenchmarkFixture, ParseZeroTerminated)->RangeMultiplier(8)->Range(64, 4096)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(JsonParseBenchmarkFixture, ParseInsitu)->RangeMultiplier(8)->Range(64, 4096)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(JsonParseBenchmarkFixture, ReadJsonStream)->RangeMultiplier(8)->Range(64, 4096)->Unit(benchmark::kMicrosecond);
+} // namespace Benchmark
+#endif // HAVE_BENCHMARK
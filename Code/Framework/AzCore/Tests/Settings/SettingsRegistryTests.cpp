@@ -13,6 +13,8 @@
 #include <AzCore/Serialization/Json/RegistrationContext.h>
 #include <AzCore/Serialization/Json/JsonSystemComponent.h>
 #include <AzCore/Settings/SettingsRegistryImpl.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/string/string.h>
@@ -1792,4 +1794,353 @@ namespace SettingsRegistryTests
         EXPECT_EQ(AZ::SettingsRegistryInterface::Type::String, m_registry->GetType(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/1/File1"));
         EXPECT_EQ(AZ::SettingsRegistryInterface::Type::String, m_registry->GetType(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/1/File2"));
     }
+
+    TEST_F(SettingsRegistryTest, MergeSettingsFolder_WithPlatform_PlatformIsStoredInHistory)
+    {
+        m_testFolder->push_back(AZ_CORRECT_DATABASE_SEPARATOR);
+        *m_testFolder += AZ::SettingsRegistryInterface::RegistryFolder;
+        bool result = m_registry->MergeSettingsFolder(*m_testFolder, { "editor", "test" }, "Special");
+        EXPECT_TRUE(result);
+
+        AZ::SettingsRegistryInterface::FixedValueString platform;
+        EXPECT_TRUE(m_registry->Get(platform, AZ_SETTINGS_REGISTRY_HISTORY_KEY "/0/Platform"));
+        EXPECT_STREQ("Special", platform.c_str());
+    }
+
+    class TaskGraphActive
+        : public AZ::TaskGraphActiveInterface
+    {
+    public:
+        bool IsTaskGraphActive() const override
+        {
+            return true;
+        }
+    };
+
+    TEST_F(SettingsRegistryTest, MergeSettingsFolder_LoadedOnTaskGraph_FilesAppliedInSpecializationOrder)
+    {
+        CreateTestFile("Memory.setreg", R"({ "Memory": 0, "MemoryRoot": true })");
+        CreateTestFile("Memory.editor.test.setreg", R"({ "Memory": 3, "MemoryEditorTest": true })");
+        CreateTestFile("Memory.editor.setreg", R"({ "Memory": 1, "MemoryEditor": true })");
+        CreateTestFile("Memory.test.setreg", R"({ "Memory": 2, "MemoryTest": true })");
+
+        AZ::TaskExecutor executor(4);
+        AZ::TaskExecutor::SetInstance(&executor);
+        TaskGraphActive taskGraphActive;
+        AZ::Interface<AZ::TaskGraphActiveInterface>::Register(&taskGraphActive);
+
+        size_t counter = 0;
+        auto callback = [this, &counter](AZStd::string_view path, AZ::SettingsRegistryInterface::Type)
+        {
+            const char* fileIds[] =
+            {
+                "/MemoryRoot",
+                "/MemoryEditor",
+                "/MemoryTest",
+                "/MemoryEditorTest"
+            };
+
+            MergeNotify(path, counter, AZ_ARRAY_SIZE(fileIds), "/Memory", fileIds);
+            counter++;
+        };
+        auto testNotifier1 = m_registry->RegisterNotifier(callback);
+
+        m_testFolder->push_back(AZ_CORRECT_DATABASE_SEPARATOR);
+        *m_testFolder += AZ::SettingsRegistryInterface::RegistryFolder;
+        bool result = m_registry->MergeSettingsFolder(*m_testFolder, { "editor", "test" }, {});
+        EXPECT_TRUE(result);
+        EXPECT_EQ(4, counter);
+
+        AZ::Interface<AZ::TaskGraphActiveInterface>::Unregister(&taskGraphActive);
+        AZ::TaskExecutor::SetInstance(nullptr);
+    }
+
+    TEST_F(SettingsRegistryTest, MergeSettingsFolder_LoadedOnTaskGraphWithInvalidFile_ErrorIsReportedInOrder)
+    {
+        CreateTestFile("Memory.setreg", R"({ "Memory": 0 })");
+        CreateTestFile("Memory.editor.setreg", R"({ "Memory": 1 )");
+
+        AZ::TaskExecutor executor(4);
+        AZ::TaskExecutor::SetInstance(&executor);
+        TaskGraphActive taskGraphActive;
+        AZ::Interface<AZ::TaskGraphActiveInterface>::Register(&taskGraphActive);
+
+        m_testFolder->push_back(AZ_CORRECT_DATABASE_SEPARATOR);
+        *m_testFolder += AZ::SettingsRegistryInterface::RegistryFolder;
+        AZ_TEST_START_TRACE_SUPPRESSION;
+        m_registry->MergeSettingsFolder(*m_testFolder, { "editor" }, {});
+        AZ_TEST_STOP_TRACE_SUPPRESSION(1);
+
+        AZ::Interface<AZ::TaskGraphActiveInterface>::Unregister(&taskGraphActive);
+        AZ::TaskExecutor::SetInstance(nullptr);
+
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::String, m_registry->GetType(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/1"));
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::String, m_registry->GetType(AZ_SETTINGS_REGISTRY_HISTORY_KEY "/2/Error"));
+        AZ::s64 value = -1;
+        EXPECT_TRUE(m_registry->Get(value, "/Memory"));
+        EXPECT_EQ(0, value);
+    }
+
+    TEST_F(SettingsRegistryTest, MergeSettingsFolder_LoadedBeforeTaskGraphIsActive_FilesAppliedInOrder)
+    {
+        // Without a task executor, folders with enough files are loaded on a temporary executor
+        ASSERT_FALSE(AZ::TaskExecutor::HasInstance());
+        constexpr int FileCount = 12;
+        for (int i = 0; i < FileCount; ++i)
+        {
+            CreateTestFile(
+                AZStd::string::format("Setting%02d.setreg", i),
+                AZStd::string::format(R"({ "Setting": %d, "Setting%02d": true })", i, i));
+        }
+
+        m_testFolder->push_back(AZ_CORRECT_DATABASE_SEPARATOR);
+        *m_testFolder += AZ::SettingsRegistryInterface::RegistryFolder;
+        EXPECT_TRUE(m_registry->MergeSettingsFolder(*m_testFolder, {}, {}));
+
+        AZ::s64 value = -1;
+        EXPECT_TRUE(m_registry->Get(value, "/Setting"));
+        EXPECT_EQ(FileCount - 1, value);
+        for (int i = 0; i < FileCount; ++i)
+        {
+            bool flag = false;
+            EXPECT_TRUE(m_registry->Get(flag, AZStd::string::format("/Setting%02d", i)));
+            EXPECT_TRUE(flag);
+        }
+    }
+
+    //
+    // Snapshots
+    //
+
+    class SettingsRegistrySnapshotTest
+        : public SettingsRegistryTest
+    {
+    public:
+        static constexpr AZ::u64 ContextKey = 42;
+
+        void SetUp() override
+        {
+            SettingsRegistryTest::SetUp();
+
+            CreateTestFile("Memory.setreg", R"({ "Memory": { "Size": 1024, "Name": "Default", "Enabled": true } })");
+            CreateTestFile("Memory.editor.setreg", R"({ "Memory": { "Scale": 1.5, "Offset": -2, "Pools": [ "Small", "Large" ] } })");
+            m_registryFolder = AZStd::string::format("%s/%s", m_testFolder->c_str(), AZ::SettingsRegistryInterface::RegistryFolder);
+            m_snapshotPath = AZStd::string::format("%s/Snapshot/settings.snapshot", m_testFolder->c_str());
+
+            EXPECT_TRUE(m_registry->MergeSettingsFolder(m_registryFolder, { "editor" }, {}));
+        }
+
+        AZStd::unique_ptr<AZ::SettingsRegistryImpl> CreateRegistry()
+        {
+            auto registry = AZStd::make_unique<AZ::SettingsRegistryImpl>();
+            registry->SetContext(m_serializeContext.get());
+            registry->SetContext(m_registrationContext.get());
+            return registry;
+        }
+
+    protected:
+        AZStd::string m_registryFolder;
+        AZStd::string m_snapshotPath;
+    };
+
+    TEST_F(SettingsRegistrySnapshotTest, LoadSnapshot_UnchangedInputs_SettingsAreRestored)
+    {
+        ASSERT_TRUE(m_registry->WriteSnapshot(m_snapshotPath, ContextKey));
+
+        auto registry = CreateRegistry();
+        ASSERT_TRUE(registry->LoadSnapshot(m_snapshotPath, ContextKey));
+
+        AZ::s64 size = 0;
+        EXPECT_TRUE(registry->Get(size, "/Memory/Size"));
+        EXPECT_EQ(1024, size);
+        AZ::SettingsRegistryInterface::FixedValueString name;
+        EXPECT_TRUE(registry->Get(name, "/Memory/Name"));
+        EXPECT_STREQ("Default", name.c_str());
+        bool enabled = false;
+        EXPECT_TRUE(registry->Get(enabled, "/Memory/Enabled"));
+        EXPECT_TRUE(enabled);
+        double scale = 0.0;
+        EXPECT_TRUE(registry->Get(scale, "/Memory/Scale"));
+        EXPECT_DOUBLE_EQ(1.5, scale);
+        AZ::s64 offset = 0;
+        EXPECT_TRUE(registry->Get(offset, "/Memory/Offset"));
+        EXPECT_EQ(-2, offset);
+        AZ::SettingsRegistryInterface::FixedValueString pool;
+        EXPECT_TRUE(registry->Get(pool, "/Memory/Pools/1"));
+        EXPECT_STREQ("Large", pool.c_str());
+
+        EXPECT_EQ(m_registry->CalculateHash(), registry->CalculateHash());
+    }
+
+    TEST_F(SettingsRegistrySnapshotTest, LoadSnapshot_ValueChangedAfterLoading_NewValueIsStored)
+    {
+        ASSERT_TRUE(m_registry->WriteSnapshot(m_snapshotPath, ContextKey));
+
+        auto registry = CreateRegistry();
+        ASSERT_TRUE(registry->LoadSnapshot(m_snapshotPath, ContextKey));
+        EXPECT_TRUE(registry->Set("/Memory/Name", "Changed"));
+
+        AZ::SettingsRegistryInterface::FixedValueString name;
+        EXPECT_TRUE(registry->Get(name, "/Memory/Name"));
+        EXPECT_STREQ("Changed", name.c_str());
+    }
+
+    TEST_F(SettingsRegistrySnapshotTest, LoadSnapshot_DifferentContextKey_SnapshotIsRejected)
+    {
+        ASSERT_TRUE(m_registry->WriteSnapshot(m_snapshotPath, ContextKey));
+
+        auto registry = CreateRegistry();
+        EXPECT_FALSE(registry->LoadSnapshot(m_snapshotPath, ContextKey + 1));
+        EXPECT_EQ(AZ::SettingsRegistryInterface::Type::NoType, registry->GetType("/Memory"));
+    }
+
+    TEST_F(SettingsRegistrySnapshotTest, LoadSnapshot_InputFileRemoved_SnapshotIsRejected)
+    {
+        ASSERT_TRUE(m_registry->WriteSnapshot(m_snapshotPath, ContextKey));
+        AZ::IO::SystemFile::Delete(AZStd::string::format("%s/Memory.editor.setreg", m_registryFolder.c_str()).c_str());
+
+        auto registry = CreateRegistry();
+        EXPECT_FALSE(registry->LoadSnapshot(m_snapshotPath, ContextKey));
+    }
+
+    TEST_F(SettingsRegistrySnapshotTest, LoadSnapshot_InputFileAdded_SnapshotIsRejected)
+    {
+        ASSERT_TRUE(m_registry->WriteSnapshot(m_snapshotPath, ContextKey));
+        CreateTestFile("Memory.test.setreg", R"({ "Memory": { "Size": 2048 } })");
+
+        auto registry = CreateRegistry();
+        EXPECT_FALSE(registry->LoadSnapshot(m_snapshotPath, ContextKey));
+    }
+
+    TEST_F(SettingsRegistrySnapshotTest, LoadSnapshot_MissingSnapshot_ReturnsFalse)
+    {
+        auto registry = CreateRegistry();
+        EXPECT_FALSE(registry->LoadSnapshot(m_snapshotPath, ContextKey));
+    }
 } // namespace SettingsRegistryTests
+
+#if defined(HAVE_BENCHMARK)
+namespace Benchmark
+{
+    class SettingsRegistrySnapshotBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        static constexpr AZ::u64 ContextKey = 1;
+
+        void SetUp(const ::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+
+            m_serializeContext = AZStd::make_unique<AZ::SerializeContext>();
+            m_registrationContext = AZStd::make_unique<AZ::JsonRegistrationContext>();
+            AZ::JsonSystemComponent::Reflect(m_registrationContext.get());
+
+            m_testFolder = AZStd::string::format("%sSettingsRegistrySnapshotBenchmark_%s", UnitTest::GetTestFolderPath().c_str(),
+                AZ::Uuid::CreateRandom().ToString<AZStd::string>(false, false).c_str());
+            m_registryFolder = AZStd::string::format("%s/%s", m_testFolder.c_str(), AZ::SettingsRegistryInterface::RegistryFolder);
+            m_snapshotPath = AZStd::string::format("%s/settings.snapshot", m_testFolder.c_str());
+
+            // Create a set of files that resembles the settings of a project with a number of gems.
+            const int fileCount = aznumeric_cast<int>(state.range(0));
+            for (int i = 0; i < fileCount; ++i)
+            {
+                AZStd::string content = AZStd::string::format(R"({ "Gem%i": { "Enabled": true, "Name": "Gem number %i", "Settings": {)", i, i);
+                for (int j = 0; j < 32; ++j)
+                {
+                    content += AZStd::string::format(R"(%s "Value%i": { "Scale": %f, "Count": %i, "Tags": [ "a", "b", "c" ] })",
+                        j == 0 ? "" : ",", j, j * 0.5, j);
+                }
+                content += "} } }";
+
+                AZStd::string path = AZStd::string::format("%s/gem%i.setreg", m_registryFolder.c_str(), i);
+                AZ::IO::SystemFile file;
+                file.Open(path.c_str(),
+                    AZ::IO::SystemFile::SF_OPEN_CREATE | AZ::IO::SystemFile::SF_OPEN_CREATE_PATH | AZ::IO::SystemFile::SF_OPEN_WRITE_ONLY);
+                file.Write(content.data(), content.size());
+            }
+
+            auto registry = CreateRegistry();
+            registry->MergeSettingsFolder(m_registryFolder, {}, {});
+            registry->WriteSnapshot(m_snapshotPath, ContextKey);
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            SetUp(static_cast<const ::benchmark::State&>(state));
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            AZ::IO::SystemFile::FindFiles(AZStd::string::format("%s/*", m_registryFolder.c_str()).c_str(),
+                [this](const char* fileName, bool isFile)
+                {
+                    if (isFile)
+                    {
+                        AZ::IO::SystemFile::Delete(AZStd::string::format("%s/%s", m_registryFolder.c_str(), fileName).c_str());
+                    }
+                    return true;
+                });
+            AZ::IO::SystemFile::DeleteDir(m_registryFolder.c_str());
+            AZ::IO::SystemFile::Delete(m_snapshotPath.c_str());
+            AZ::IO::SystemFile::DeleteDir(m_testFolder.c_str());
+
+            m_registrationContext->EnableRemoveReflection();
+            AZ::JsonSystemComponent::Reflect(m_registrationContext.get());
+            m_registrationContext->DisableRemoveReflection();
+            m_registrationContext.reset();
+            m_serializeContext.reset();
+            m_testFolder = {};
+            m_registryFolder = {};
+            m_snapshotPath = {};
+
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            TearDown(static_cast<const ::benchmark::State&>(state));
+        }
+
+    protected:
+        AZStd::unique_ptr<AZ::SettingsRegistryImpl> CreateRegistry()
+        {
+            auto registry = AZStd::make_unique<AZ::SettingsRegistryImpl>();
+            registry->SetContext(m_serializeContext.get());
+            registry->SetContext(m_registrationContext.get());
+            return registry;
+        }
+
+        AZStd::unique_ptr<AZ::SerializeContext> m_serializeContext;
+        AZStd::unique_ptr<AZ::JsonRegistrationContext> m_registrationContext;
+        AZStd::string m_testFolder;
+        AZStd::string m_registryFolder;
+        AZStd::string m_snapshotPath;
+    };
+
+    // Startup cost when all settings files are parsed and merged.
+    BENCHMARK_DEFINE_F(SettingsRegistrySnapshotBenchmarkFixture, ColdParse)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            auto registry = CreateRegistry();
+            registry->MergeSettingsFolder(m_registryFolder, {}, {});
+            benchmark::DoNotOptimize(registry.get());
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    // Startup cost when the merged settings are loaded from an up to date snapshot, including the validation of the inputs.
+    BENCHMARK_DEFINE_F(SettingsRegistrySnapshotBenchmarkFixture, SnapshotLoad)(benchmark::State& state)
+    {
+        for (auto _ : state)
+        {
+            auto registry = CreateRegistry();
+            bool loaded = registry->LoadSnapshot(m_snapshotPath, ContextKey);
+            benchmark::DoNotOptimize(loaded);
+        }
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+    }
+
+    BENCHMARK_REGISTER_F(SettingsRegistrySnapshotBenchmarkFixture, ColdParse)->RangeMultiplier(4)->Range(4, 64)->Unit(benchmark::kMicrosecond);
+    BENCHMARK_REGISTER_F(SettingsRegistrySnapshotBenchmarkFixture, SnapshotLoad)->RangeMultiplier(4)->Range(4, 64)->Unit(benchmark::kMicrosecond);
+} // namespace Benchmark
+#endif // HAVE_BENCHMARK
@@ -75,7 +75,8 @@ namespace AZ::IO
         {
             using ::testing::_;
 
-            m_cache = AZStd::make_shared<BlockCache>(m_cacheSize, m_blockSize, AZCORE_GLOBAL_NEW_ALIGNMENT, onlyEpilogWrites);
+            m_cache = AZStd::make_shared<BlockCache>(m_cacheSize, m_blockSize, AZCORE_GLOBAL_NEW_ALIGNMENT, onlyEpilogWrites,
+                m_readAheadBlocks, m_maxBlockSizeMultiplier);
             m_mock = AZStd::make_shared<StreamStackEntryMock>();
             m_cache->SetNext(m_mock);
             EXPECT_CALL(*m_mock, SetContext(_)).Times(1);
@@ -244,6 +245,8 @@ namespace AZ::IO
         u32 m_blockSize{ 64 * 1024 };
         u64 m_fakeFileLength{ 5 * m_blockSize };
         u64 m_readBufferLength{ 10 * 1024 * 1024 };
+        u32 m_readAheadBlocks{ 0 };
+        u32 m_maxBlockSizeMultiplier{ 1 };
         bool m_fakeFileFound{ true };
     };
 
@@ -1116,6 +1119,27 @@ namespace AZ::IO
         }
     };
 
+    TEST_F(Streamer_BlockCacheGenericTest, Statistics_ReadFromCache_HitRateAndCacheableRateAreRecordedOncePerLookup)
+    {
+        using ::testing::_;
+
+        CreateTestEnvironment();
+        RedirectReadCalls();
+
+        EXPECT_CALL(*this, ReadFile(_, _, _, _)).Times(1);
+        ProcessRead(m_buffer, m_path, 256, m_blockSize - 512, IStreamerTypes::RequestStatus::Completed);
+        ProcessRead(m_buffer, m_path, 512, m_blockSize - 1024, IStreamerTypes::RequestStatus::Completed);
+
+        EXPECT_EQ(2, m_cache->GetHitRateStatistic().GetNumSamples());
+        EXPECT_DOUBLE_EQ(0.5, m_cache->GetHitRateStatistic().GetAverage());
+        EXPECT_EQ(2, m_cache->GetCacheableStatistic().GetNumSamples());
+        EXPECT_DOUBLE_EQ(1.0, m_cache->GetCacheableStatistic().GetAverage());
+
+        m_cache->ResetStatistics();
+        EXPECT_EQ(0, m_cache->GetHitRateStatistic().GetNumSamples());
+        EXPECT_EQ(0, m_cache->GetCacheableStatistic().GetNumSamples());
+    }
+
     TEST_F(Streamer_BlockCacheGenericTest, Cancel_QueueReadAndCancel_SubRequestPushCanceledThroughCache)
     {
         using ::testing::_;
@@ -1177,4 +1201,169 @@ namespace AZ::IO
         EXPECT_CALL(*this, ReadFile(_, _, _, _)).Times(1);
         ProcessRead(m_buffer, m_path, 512, m_blockSize - 1024, IStreamerTypes::RequestStatus::Completed);
     }
+
+
+
+    /////////////////////////////////////////////////////////////
+    // Read-ahead
+    /////////////////////////////////////////////////////////////
+    class Streamer_BlockCacheReadAheadTest
+        : public BlockCacheTest
+    {
+    public:
+        void CreateTestEnvironment()
+        {
+            m_readAheadBlocks = 2;
+            CreateTestEnvironmentImplementation(false);
+        }
+    };
+
+    // File    |------------------------------------------------|
+    // Request |-||-||-|
+    // Cache   [   v    ][    v   ][   v    ][   x    ][   x    ]
+    TEST_F(Streamer_BlockCacheReadAheadTest, ReadFile_SequentialReads_NextBlocksAreReadAhead)
+    {
+        using ::testing::_;
+
+        CreateTestEnvironment();
+        RedirectReadCalls();
+
+        EXPECT_CALL(*this, ReadFile(_, _, 0, m_blockSize));
+        EXPECT_CALL(*this, ReadFile(_, _, m_blockSize, m_blockSize));
+        EXPECT_CALL(*this, ReadFile(_, _, 2 * m_blockSize, m_blockSize));
+
+        ProcessRead(m_buffer, m_path, 0, 1024, IStreamerTypes::RequestStatus::Completed);
+        ProcessRead(m_buffer, m_path, 1024, 1024, IStreamerTypes::RequestStatus::Completed);
+        ProcessRead(m_buffer, m_path, 2048, 1024, IStreamerTypes::RequestStatus::Completed);
+        VerifyReadBuffer(2048, 1024);
+
+        EXPECT_EQ(2, m_cache->GetNumReadAheadBlocks());
+    }
+
+    // File    |------------------------------------------------|
+    // Request |-||-||-||-------|
+    // Cache   [   v    ][    v   ][   v    ][   v    ][   x    ]
+    TEST_F(Streamer_BlockCacheReadAheadTest, ReadFile_ContinueSequentialReads_ReadAheadBlocksAreUsedAndExtended)
+    {
+        using ::testing::_;
+
+        CreateTestEnvironment();
+        RedirectReadCalls();
+
+        EXPECT_CALL(*this, ReadFile(_, _, 0, m_blockSize));
+        EXPECT_CALL(*this, ReadFile(_, _, m_blockSize, m_blockSize));
+        EXPECT_CALL(*this, ReadFile(_, _, 2 * m_blockSize, m_blockSize));
+        EXPECT_CALL(*this, ReadFile(_, _, 3 * m_blockSize, m_blockSize));
+
+        ProcessRead(m_buffer, m_path, 0, 1024, IStreamerTypes::RequestStatus::Completed);
+        ProcessRead(m_buffer, m_path, 1024, 1024, IStreamerTypes::RequestStatus::Completed);
+        ProcessRead(m_buffer, m_path, 2048, 1024, IStreamerTypes::RequestStatus::Completed);
+        // Both the prolog and the epilog of this request are serviced from the cache.
+        ProcessRead(m_buffer, m_path, 3072, m_blockSize, IStreamerTypes::RequestStatus::Completed);
+        VerifyReadBuffer(3072, m_blockSize);
+
+        EXPECT_EQ(3, m_cache->GetNumReadAheadBlocks());
+        EXPECT_EQ(5, m_cache->GetHitRateStatistic().GetNumSamples());
+        EXPECT_DOUBLE_EQ(0.8, m_cache->GetHitRateStatistic().GetAverage());
+    }
+
+    // File    |------------------------------------------------|
+    // Request |-|                |-|                |-|
+    // Cache   [   x    ][    x   ][   x    ][   x    ][   x    ]
+    TEST_F(Streamer_BlockCacheReadAheadTest, ReadFile_RandomReads_NoBlocksAreReadAhead)
+    {
+        using ::testing::_;
+
+        CreateTestEnvironment();
+        RedirectReadCalls();
+
+        EXPECT_CALL(*this, ReadFile(_, _, _, _)).Times(3);
+
+        ProcessRead(m_buffer, m_path, 0, 1024, IStreamerTypes::RequestStatus::Completed);
+        ProcessRead(m_buffer, m_path, 2 * m_blockSize + 256, 1024, IStreamerTypes::RequestStatus::Completed);
+        ProcessRead(m_buffer, m_path, 4 * m_blockSize + 512, 1024, IStreamerTypes::RequestStatus::Completed);
+        VerifyReadBuffer(4 * m_blockSize + 512, 1024);
+
+        EXPECT_EQ(0, m_cache->GetNumReadAheadBlocks());
+    }
+
+    /////////////////////////////////////////////////////////////
+    // Adaptive block size
+    /////////////////////////////////////////////////////////////
+    class Streamer_BlockCacheAdaptiveBlockSizeTest
+        : public BlockCacheTest
+    {
+    public:
+        void CreateTestEnvironment()
+        {
+            m_maxBlockSizeMultiplier = 4;
+            m_fakeFileLength = 16 * m_blockSize;
+            CreateTestEnvironmentImplementation(false);
+        }
+    };
+
+    // File    |------------------------------------------------|
+    // Request  |-|
+    // Cache   [   v    ][    x   ][   x    ][   x    ][   x    ]
+    TEST_F(Streamer_BlockCacheAdaptiveBlockSizeTest, ReadFile_SmallRequest_UsesBaseBlockSize)
+    {
+        using ::testing::_;
+
+        CreateTestEnvironment();
+        RedirectReadCalls();
+
+        EXPECT_CALL(*this, ReadFile(_, _, 0, m_blockSize));
+
+        ProcessRead(m_buffer, m_path, 256, 1024, IStreamerTypes::RequestStatus::Completed);
+        VerifyReadBuffer(256, 1024);
+    }
+
+    // File    |------------------------------------------------|
+    // Request  |-----------------|
+    // Cache   [        v        ][        v        ][        x        ]
+    TEST_F(Streamer_BlockCacheAdaptiveBlockSizeTest, ReadFile_LargeRequest_UsesLargerBlockSize)
+    {
+        using ::testing::_;
+
+        CreateTestEnvironment();
+        RedirectReadCalls();
+
+        EXPECT_CALL(*this, ReadFile(_, _, 0, 2 * m_blockSize));
+        EXPECT_CALL(*this, ReadFile(_, _, 2 * m_blockSize, 2 * m_blockSize));
+
+        ProcessRead(m_buffer, m_path, 256, 2 * m_blockSize, IStreamerTypes::RequestStatus::Completed);
+        VerifyReadBuffer(256, 2 * m_blockSize);
+
+        // The data around the first request is available in the larger blocks.
+        ProcessRead(m_buffer, m_path, 1024, 2 * m_blockSize, IStreamerTypes::RequestStatus::Completed);
+        VerifyReadBuffer(1024, 2 * m_blockSize);
+    }
+
+    // File    |------------------------------------------------|
+    // Request  |-----------------|  |-|  |-|     |-|
+    // Cache   [        v        ][        v        ][        x        ]
+    TEST_F(Streamer_BlockCacheAdaptiveBlockSizeTest, ReadFile_SmallRequestsAfterLargeRequest_ServicedFromLargerBlocks)
+    {
+        using ::testing::_;
+
+        CreateTestEnvironment();
+        RedirectReadCalls();
+
+        EXPECT_CALL(*this, ReadFile(_, _, 0, 2 * m_blockSize));
+        EXPECT_CALL(*this, ReadFile(_, _, 2 * m_blockSize, 2 * m_blockSize));
+
+        ProcessRead(m_buffer, m_path, 256, 2 * m_blockSize, IStreamerTypes::RequestStatus::Completed);
+
+        // The small requests bring the block span for the file back down to a single block, but the data is still found in the
+        // blocks that were read with the larger span.
+        ProcessRead(m_buffer, m_path, m_blockSize + 256, 256, IStreamerTypes::RequestStatus::Completed);
+        VerifyReadBuffer(m_blockSize + 256, 256);
+        ProcessRead(m_buffer, m_path, m_blockSize + 512, 256, IStreamerTypes::RequestStatus::Completed);
+        VerifyReadBuffer(m_blockSize + 512, 256);
+        ProcessRead(m_buffer, m_path, 3 * m_blockSize + 512, 256, IStreamerTypes::RequestStatus::Completed);
+        VerifyReadBuffer(3 * m_blockSize + 512, 256);
+
+        EXPECT_EQ(5, m_cache->GetHitRateStatistic().GetNumSamples());
+        EXPECT_DOUBLE_EQ(0.6, m_cache->GetHitRateStatistic().GetAverage());
+    }
 } // namespace AZ::IO
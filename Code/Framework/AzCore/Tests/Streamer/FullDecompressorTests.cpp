@@ -148,6 +148,9 @@ namespace AZ::IO
             auto data = AZStd::get_if<FileRequest::ReadData>(&request->GetCommand());
             ASSERT_NE(nullptr, data);
 
+            m_lastReadOffset = data->m_offset;
+            m_lastReadSize = data->m_size;
+
             u64 size = data->m_size >> 2;
             u32* buffer = reinterpret_cast<u32*>(data->m_output);
             for (u64 i = 0; i < size; ++i)
@@ -186,13 +189,27 @@ namespace AZ::IO
             return false;
         }
 
-        void ProcessCompressedRead(u64 offset, u64 size, CompressionState compressionState, IStreamerTypes::RequestStatus expectedResult)
+        AZStd::shared_ptr<const CompressionSeekPoints> CreateSeekPoints(u64 partSize) const
+        {
+            // The fake compression doesn't change the size, so the compressed and uncompressed offsets are the same.
+            auto seekPoints = AZStd::make_shared<CompressionSeekPoints>();
+            for (u64 offset = 0; offset < m_fakeFileLength; offset += partSize)
+            {
+                seekPoints->push_back({ offset, offset });
+            }
+            seekPoints->push_back({ m_fakeFileLength, m_fakeFileLength });
+            return seekPoints;
+        }
+
+        void ProcessCompressedRead(u64 offset, u64 size, CompressionState compressionState, IStreamerTypes::RequestStatus expectedResult,
+            AZStd::shared_ptr<const CompressionSeekPoints> seekPoints = {})
         {
             CompressionInfo compressionInfo;
             compressionInfo.m_compressedSize = m_fakeFileLength;
             compressionInfo.m_isCompressed = (compressionState == CompressionState::Compressed || compressionState == CompressionState::Corrupted);
             compressionInfo.m_offset = 0;
             compressionInfo.m_uncompressedSize = m_fakeFileLength;
+            compressionInfo.m_seekPoints = AZStd::move(seekPoints);
             if (compressionState == CompressionState::Corrupted)
             {
                 compressionInfo.m_decompressor = &Streamer_FullDecompressorTest::CorruptedDecompressor;
@@ -316,6 +333,8 @@ namespace AZ::IO
         AZStd::shared_ptr<FullFileDecompressor> m_decompressor;
         AZStd::shared_ptr<StreamStackEntryMock> m_mock;
         u64 m_fakeFileLength{ 1 * 1024 * 1024 };
+        u64 m_lastReadOffset{ 0 };
+        u64 m_lastReadSize{ 0 };
     };
 
     TEST_F(Streamer_FullDecompressorTest, DecompressedRead_FullReadAndDecompressData_SuccessfullyReadData)
@@ -334,6 +353,41 @@ namespace AZ::IO
         VerifyReadBuffer(256, m_fakeFileLength-512);
     }
 
+    TEST_F(Streamer_FullDecompressorTest, DecompressedRead_FullReadWithSeekPoints_SuccessfullyReadData)
+    {
+        SetupEnvironment(1, 4);
+        MockReadCalls(ReadResult::Success);
+        ProcessCompressedRead(0, m_fakeFileLength, CompressionState::Compressed, IStreamerTypes::RequestStatus::Completed,
+            CreateSeekPoints(64 * 1024));
+        VerifyReadBuffer(0, m_fakeFileLength);
+        EXPECT_EQ(0, m_lastReadOffset);
+        EXPECT_EQ(m_fakeFileLength, m_lastReadSize);
+    }
+
+    TEST_F(Streamer_FullDecompressorTest, DecompressedRead_PartialReadWithSeekPoints_OnlyReadsOverlappingParts)
+    {
+        constexpr u64 partSize = 64 * 1024;
+        SetupEnvironment(1, 4);
+        MockReadCalls(ReadResult::Success);
+        ProcessCompressedRead(3 * partSize + 256, 4 * partSize, CompressionState::Compressed, IStreamerTypes::RequestStatus::Completed,
+            CreateSeekPoints(partSize));
+        VerifyReadBuffer(3 * partSize + 256, 4 * partSize);
+        EXPECT_EQ(3 * partSize, m_lastReadOffset);
+        EXPECT_EQ(5 * partSize, m_lastReadSize);
+    }
+
+    TEST_F(Streamer_FullDecompressorTest, DecompressedRead_PartialReadWithinSingleSeekPoint_OnlyReadsOnePart)
+    {
+        constexpr u64 partSize = 64 * 1024;
+        SetupEnvironment();
+        MockReadCalls(ReadResult::Success);
+        ProcessCompressedRead(partSize + 256, 512, CompressionState::Compressed, IStreamerTypes::RequestStatus::Completed,
+            CreateSeekPoints(partSize));
+        VerifyReadBuffer(partSize + 256, 512);
+        EXPECT_EQ(partSize, m_lastReadOffset);
+        EXPECT_EQ(partSize, m_lastReadSize);
+    }
+
     TEST_F(Streamer_FullDecompressorTest, DecompressedRead_FullReadFromArchive_SuccessfullyReadData)
     {
         SetupEnvironment();
@@ -24,6 +24,9 @@ namespace AZ::IO
     {
     protected:
         StreamerContext* m_streamerContext{ nullptr };
+        //! Offsets of the reads in the order they were queued in the mock.
+        AZStd::vector<u64> m_readOrder;
+        char m_fakeBuffer[8];
 
     public:
         void SetUp() override
@@ -112,6 +115,67 @@ namespace AZ::IO
                     });
         }
 
+        void MockForReadOrder(int numReads)
+        {
+            using ::testing::_;
+            using ::testing::AtLeast;
+
+            EXPECT_CALL(*m_mock, UpdateStatus(_)).Times(AtLeast(1));
+            EXPECT_CALL(*m_mock, UpdateCompletionEstimates(_, _, _, _)).Times(AtLeast(1));
+            EXPECT_CALL(*m_mock, PrepareRequest(_))
+                .Times(numReads)
+                .WillRepeatedly([this](FileRequest* request)
+                    {
+                        auto readData = AZStd::get_if<FileRequest::ReadRequestData>(&request->GetCommand());
+                        AZ_Assert(readData, "Test didn't pass in the correct request.");
+                        FileRequest* read = m_streamerContext->GetNewInternalRequest();
+                        read->CreateRead(request, readData->m_output, readData->m_outputSize, readData->m_path,
+                            readData->m_offset, readData->m_size);
+                        m_streamerContext->PushPreparedRequest(read);
+                    });
+            EXPECT_CALL(*m_mock, ExecuteRequests()).Times(AtLeast(1));
+            EXPECT_CALL(*m_mock, QueueRequest(_))
+                .Times(numReads)
+                .WillRepeatedly([this](FileRequest* request)
+                    {
+                        auto readData = AZStd::get_if<FileRequest::ReadData>(&request->GetCommand());
+                        AZ_Assert(readData, "Test didn't pass in the correct request.");
+                        m_readOrder.push_back(readData->m_offset);
+                        request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+                        m_streamerContext->MarkRequestAsCompleted(request);
+                    });
+        }
+
+        //! Queues all reads at once so they're scheduled together and waits for them to complete.
+        void QueueReadsAndWait(AZStd::vector<FileRequestPtr> reads)
+        {
+            AZStd::atomic_int counter = aznumeric_cast<int>(reads.size());
+            AZStd::binary_semaphore sync;
+            auto wait = [&sync, &counter](FileRequestHandle)
+            {
+                if (--counter == 0)
+                {
+                    sync.release();
+                }
+            };
+
+            m_streamer->SuspendProcessing();
+            for (FileRequestPtr& read : reads)
+            {
+                m_streamer->SetRequestCompleteCallback(read, wait);
+                m_streamer->QueueRequest(read);
+            }
+            m_streamer->ResumeProcessing();
+
+            ASSERT_TRUE(sync.try_acquire_for(AZStd::chrono::seconds(5)));
+        }
+
+        FileRequestPtr CreateRead(const char* path, u64 offset, IStreamerTypes::Priority priority = IStreamerTypes::s_priorityMedium)
+        {
+            return m_streamer->Read(path, m_fakeBuffer, sizeof(m_fakeBuffer), sizeof(m_fakeBuffer), IStreamerTypes::s_noDeadline,
+                priority, offset);
+        }
+
         void MockAllocatorForUnclaimedMemory(IStreamerTypes::RequestMemoryAllocatorMock& mock, AZStd::binary_semaphore& sync)
         {
             using ::testing::_;
@@ -338,6 +402,200 @@ namespace AZ::IO
         EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, m_streamer->GetRequestStatus(reschedule));
     }
 
+    TEST_F(Streamer_SchedulerTest, QueueNextRequest_AdjacentReadsInSameFile_ReadsAreCombinedIntoSingleRead)
+    {
+        using ::testing::_;
+        using ::testing::AtLeast;
+
+        EXPECT_CALL(*m_mock, UpdateStatus(_)).Times(AtLeast(1));
+        EXPECT_CALL(*m_mock, UpdateCompletionEstimates(_, _, _, _)).Times(AtLeast(1));
+        EXPECT_CALL(*m_mock, PrepareRequest(_))
+            .Times(2)
+            .WillRepeatedly([this](FileRequest* request)
+                {
+                    auto readData = AZStd::get_if<FileRequest::ReadRequestData>(&request->GetCommand());
+                    AZ_Assert(readData, "Test didn't pass in the correct request.");
+                    FileRequest* read = m_streamerContext->GetNewInternalRequest();
+                    read->CreateRead(request, readData->m_output, readData->m_outputSize, readData->m_path,
+                        readData->m_offset, readData->m_size);
+                    m_streamerContext->PushPreparedRequest(read);
+                });
+        EXPECT_CALL(*m_mock, ExecuteRequests()).Times(AtLeast(1));
+        EXPECT_CALL(*m_mock, QueueRequest(_))
+            .Times(1)
+            .WillOnce([this](FileRequest* request)
+                {
+                    auto readData = AZStd::get_if<FileRequest::ReadData>(&request->GetCommand());
+                    ASSERT_NE(nullptr, readData);
+                    EXPECT_EQ(0, readData->m_offset);
+                    EXPECT_EQ(16, readData->m_size);
+                    auto output = reinterpret_cast<uint8_t*>(readData->m_output);
+                    for (size_t i = 0; i < readData->m_size; ++i)
+                    {
+                        output[i] = azlossy_cast<uint8_t>(readData->m_offset + i);
+                    }
+                    request->SetStatus(IStreamerTypes::RequestStatus::Completed);
+                    m_streamerContext->MarkRequestAsCompleted(request);
+                });
+
+        AZStd::atomic_int counter = 2;
+        AZStd::binary_semaphore sync;
+        auto wait = [&sync, &counter](FileRequestHandle)
+        {
+            if (--counter == 0)
+            {
+                sync.release();
+            }
+        };
+
+        char firstBuffer[8];
+        char secondBuffer[8];
+        FileRequestPtr firstRead = m_streamer->Read("TestPath", firstBuffer, sizeof(firstBuffer), 8, IStreamerTypes::s_noDeadline,
+            IStreamerTypes::s_priorityMedium, 0);
+        FileRequestPtr secondRead = m_streamer->Read("TestPath", secondBuffer, sizeof(secondBuffer), 8, IStreamerTypes::s_noDeadline,
+            IStreamerTypes::s_priorityMedium, 8);
+        m_streamer->SetRequestCompleteCallback(firstRead, wait);
+        m_streamer->SetRequestCompleteCallback(secondRead, wait);
+
+        m_streamer->SuspendProcessing();
+        m_streamer->QueueRequest(firstRead);
+        m_streamer->QueueRequest(secondRead);
+        m_streamer->ResumeProcessing();
+
+        ASSERT_TRUE(sync.try_acquire_for(AZStd::chrono::seconds(5)));
+        EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, m_streamer->GetRequestStatus(firstRead));
+        EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, m_streamer->GetRequestStatus(secondRead));
+        for (size_t i = 0; i < 8; ++i)
+        {
+            EXPECT_EQ(azlossy_cast<char>(i), firstBuffer[i]);
+            EXPECT_EQ(azlossy_cast<char>(i + 8), secondBuffer[i]);
+        }
+    }
+
+    TEST_F(Streamer_SchedulerTest, ProcessCancelRequest_CancelCombinedRead_CanceledReadCompletesWithoutReceivingData)
+    {
+        using ::testing::_;
+        using ::testing::AtLeast;
+
+        EXPECT_CALL(*m_mock, UpdateStatus(_)).Times(AtLeast(1));
+        EXPECT_CALL(*m_mock, UpdateCompletionEstimates(_, _, _, _)).Times(AtLeast(1));
+        EXPECT_CALL(*m_mock, PrepareRequest(_))
+            .Times(3)
+            .WillRepeatedly([this](FileRequest* request)
+                {
+                    if (auto readData = AZStd::get_if<FileRequest::ReadRequestData>(&request->GetCommand()); readData != nullptr)
+                    {
+                        FileRequest* read = m_streamerContext->GetNewInternalRequest();
+                        read->CreateRead(request, readData->m_output, readData->m_outputSize, readData->m_path,
+                            readData->m_offset, readData->m_size);
+                        m_streamerContext->PushPreparedRequest(read);
+                    }
+                    else
+                    {
+                        m_mock->ForwardPrepareRequest(request);
+                    }
+                });
+        EXPECT_CALL(*m_mock, ExecuteRequests()).Times(AtLeast(1));
+
+        // Hold on to the combined read until the cancel request has reached the mock, so the cancel is processed while the
+        // combined read is in flight.
+        FileRequest* combinedRead = nullptr;
+        AZStd::binary_semaphore combinedReadQueued;
+        EXPECT_CALL(*m_mock, QueueRequest(_))
+            .Times(2)
+            .WillOnce([&combinedRead, &combinedReadQueued](FileRequest* request)
+                {
+                    combinedRead = request;
+                    combinedReadQueued.release();
+                })
+            .WillOnce([this, &combinedRead](FileRequest* request)
+                {
+                    ASSERT_NE(nullptr, AZStd::get_if<FileRequest::CancelData>(&request->GetCommand()));
+                    m_mock->ForwardQueueRequest(request);
+
+                    auto readData = AZStd::get_if<FileRequest::ReadData>(&combinedRead->GetCommand());
+                    ASSERT_NE(nullptr, readData);
+                    auto output = reinterpret_cast<uint8_t*>(readData->m_output);
+                    for (size_t i = 0; i < readData->m_size; ++i)
+                    {
+                        output[i] = azlossy_cast<uint8_t>(readData->m_offset + i);
+                    }
+                    combinedRead->SetStatus(IStreamerTypes::RequestStatus::Completed);
+                    m_streamerContext->MarkRequestAsCompleted(combinedRead);
+                });
+
+        AZStd::atomic_int counter = 3;
+        AZStd::binary_semaphore sync;
+        auto wait = [&sync, &counter](FileRequestHandle)
+        {
+            if (--counter == 0)
+            {
+                sync.release();
+            }
+        };
+
+        char firstBuffer[8];
+        char secondBuffer[8];
+        memset(secondBuffer, 0xff, sizeof(secondBuffer));
+        FileRequestPtr firstRead = m_streamer->Read("TestPath", firstBuffer, sizeof(firstBuffer), 8, IStreamerTypes::s_noDeadline,
+            IStreamerTypes::s_priorityMedium, 0);
+        FileRequestPtr secondRead = m_streamer->Read("TestPath", secondBuffer, sizeof(secondBuffer), 8, IStreamerTypes::s_noDeadline,
+            IStreamerTypes::s_priorityMedium, 8);
+        m_streamer->SetRequestCompleteCallback(firstRead, wait);
+        m_streamer->SetRequestCompleteCallback(secondRead, wait);
+
+        m_streamer->SuspendProcessing();
+        m_streamer->QueueRequest(firstRead);
+        m_streamer->QueueRequest(secondRead);
+        m_streamer->ResumeProcessing();
+
+        ASSERT_TRUE(combinedReadQueued.try_acquire_for(AZStd::chrono::seconds(5)));
+        FileRequestPtr cancel = m_streamer->Cancel(secondRead);
+        m_streamer->SetRequestCompleteCallback(cancel, wait);
+        m_streamer->QueueRequest(cancel);
+
+        ASSERT_TRUE(sync.try_acquire_for(AZStd::chrono::seconds(5)));
+        EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, m_streamer->GetRequestStatus(cancel));
+        EXPECT_EQ(IStreamerTypes::RequestStatus::Completed, m_streamer->GetRequestStatus(firstRead));
+        EXPECT_EQ(IStreamerTypes::RequestStatus::Canceled, m_streamer->GetRequestStatus(secondRead));
+        for (size_t i = 0; i < 8; ++i)
+        {
+            EXPECT_EQ(azlossy_cast<char>(i), firstBuffer[i]);
+            EXPECT_EQ(azlossy_cast<char>(0xff), secondBuffer[i]);
+        }
+    }
+
+    TEST_F(Streamer_SchedulerTest, ScheduleRequests_ReadsInActiveFile_ReadsContinueSweepThroughFileBeforeOtherFiles)
+    {
+        constexpr u64 Step = 64 * 1024;
+        MockForReadOrder(5);
+
+        // Make "FileA" the active file with the last read ending just after 2 * Step.
+        QueueReadsAndWait({ CreateRead("FileA", 2 * Step) });
+        m_readOrder.clear();
+
+        QueueReadsAndWait({ CreateRead("FileA", 3 * Step), CreateRead("FileA", 1 * Step), CreateRead("FileB", 5 * Step),
+            CreateRead("FileA", 4 * Step) });
+
+        // Reads ahead of the last read are done first in increasing order, after which the sweep restarts for the reads
+        // that were skipped over. The read in the other file is done last.
+        AZStd::vector<u64> expectedOrder = { 3 * Step, 4 * Step, 1 * Step, 5 * Step };
+        EXPECT_EQ(expectedOrder, m_readOrder);
+    }
+
+    TEST_F(Streamer_SchedulerTest, ScheduleRequests_ReadsInDifferentFiles_OrderedByPriorityThenQueueOrder)
+    {
+        MockForReadOrder(4);
+
+        // The offsets identify the reads as each read is in a different file.
+        QueueReadsAndWait({ CreateRead("FileD", 1, IStreamerTypes::s_priorityLow), CreateRead("FileC", 2, IStreamerTypes::s_priorityMedium),
+            CreateRead("FileB", 3, IStreamerTypes::s_priorityHigh), CreateRead("FileA", 4, IStreamerTypes::s_priorityMedium) });
+
+        // Reads with the same priority keep the order they were queued in, regardless of the file they're in.
+        AZStd::vector<u64> expectedOrder = { 3, 2, 4, 1 };
+        EXPECT_EQ(expectedOrder, m_readOrder);
+    }
+
     TEST_F(Streamer_SchedulerTest, ProcessTillIdle_ShutDownIsDelayedUntilIdle_SchedulerThreadDoesNotImmediatelyShutDown)
     {
         using::testing::_;
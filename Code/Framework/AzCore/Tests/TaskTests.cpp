@@ -11,6 +11,8 @@
 #include <AzCore/Memory/PoolAllocator.h>
 
 #include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/chrono/clocks.h>
+#include <AzCore/std/sort.h>
 
 #include <random>
 
@@ -23,6 +25,15 @@ using AZ::TaskPriority;
 
 static TaskDescriptor defaultTD{ "TaskGraphTestTask", "TaskGraphTests" };
 
+// Busy-waits for the requested duration to simulate a task doing actual work
+static void SpinFor(AZStd::chrono::microseconds duration)
+{
+    const auto start = AZStd::chrono::high_resolution_clock::now();
+    while (AZStd::chrono::high_resolution_clock::now() - start < duration)
+    {
+    }
+}
+
 namespace UnitTest
 {
     class TaskGraphTestFixture : public AllocatorsTestFixture
@@ -623,6 +634,441 @@ namespace UnitTest
 
         EXPECT_EQ(3 | 0b100000, x);
     }
+
+    TEST_F(TaskGraphTestFixture, IdleWorkerStealsQueuedTasks)
+    {
+        // The blocking task does not finish until every other task has run (or a timeout elapses). Tasks that
+        // were distributed to the queue of the worker running the blocking task can only run if they are
+        // stolen by the other worker.
+        constexpr int otherTaskCount = 16;
+        AZStd::atomic<int> completed = 0;
+        bool allCompleted = false;
+
+        TaskExecutor executor{ 2 };
+        TaskGraph graph;
+        graph.AddTask(
+            defaultTD,
+            [&]
+            {
+                const auto start = AZStd::chrono::high_resolution_clock::now();
+                while (completed < otherTaskCount &&
+                       AZStd::chrono::high_resolution_clock::now() - start < AZStd::chrono::seconds(5))
+                {
+                    AZStd::this_thread::yield();
+                }
+                allCompleted = completed == otherTaskCount;
+            });
+        for (int i = 0; i != otherTaskCount; ++i)
+        {
+            graph.AddTask(
+                defaultTD,
+                [&]
+                {
+                    ++completed;
+                });
+        }
+
+        TaskGraphEvent ev;
+        graph.SubmitOnExecutor(executor, &ev);
+        ev.Wait();
+
+        EXPECT_TRUE(allCompleted);
+        EXPECT_EQ(otherTaskCount, completed);
+    }
+
+    TEST_F(TaskGraphTestFixture, StolenTasksRespectDependencies)
+    {
+        constexpr int chainCount = 32;
+        AZStd::vector<int> values(chainCount, 0);
+        int* data = values.data();
+
+        TaskGraph graph;
+        for (int i = 0; i != chainCount; ++i)
+        {
+            auto a = graph.AddTask(
+                defaultTD,
+                [data, i]
+                {
+                    SpinFor(AZStd::chrono::microseconds(i % 4 == 0 ? 200 : 10));
+                    data[i] = 1;
+                });
+            auto b = graph.AddTask(
+                defaultTD,
+                [data, i]
+                {
+                    // Only advance if the predecessor ran first
+                    data[i] = data[i] == 1 ? 2 : -1;
+                });
+            a.Precedes(b);
+        }
+
+        TaskGraphEvent ev;
+        graph.SubmitOnExecutor(*m_executor, &ev);
+        ev.Wait();
+
+        for (int value : values)
+        {
+            EXPECT_EQ(2, value);
+        }
+    }
+
+    TEST_F(TaskGraphTestFixture, ParallelForVisitsEachIndexOnce)
+    {
+        constexpr size_t count = 10000;
+        AZStd::vector<int> visits(count, 0);
+
+        TaskDescriptor descriptor = defaultTD;
+        descriptor.grainSize = 16;
+
+        TaskGraph graph;
+        graph.AddParallelFor(
+            descriptor, 0, count,
+            [&visits](size_t begin, size_t end)
+            {
+                EXPECT_LT(begin, end);
+                for (size_t i = begin; i != end; ++i)
+                {
+                    ++visits[i];
+                }
+            });
+
+        TaskGraphEvent ev;
+        graph.SubmitOnExecutor(*m_executor, &ev);
+        ev.Wait();
+
+        for (size_t i = 0; i != count; ++i)
+        {
+            EXPECT_EQ(1, visits[i]) << "Index " << i << " was visited an unexpected number of times";
+        }
+    }
+
+    TEST_F(TaskGraphTestFixture, ParallelForRespectsDependencies)
+    {
+        constexpr size_t count = 4096;
+        AZStd::vector<int> values(count, 0);
+        AZStd::atomic<int> sum = 0;
+
+        TaskGraph graph;
+        auto fill = graph.AddTask(
+            defaultTD,
+            [&values]
+            {
+                AZStd::fill(values.begin(), values.end(), 1);
+            });
+        auto loop = graph.AddParallelFor(
+            defaultTD, 0, count,
+            [&values](size_t begin, size_t end)
+            {
+                for (size_t i = begin; i != end; ++i)
+                {
+                    values[i] *= 2;
+                }
+            });
+        auto total = graph.AddTask(
+            defaultTD,
+            [&]
+            {
+                for (int value : values)
+                {
+                    sum += value;
+                }
+            });
+
+        loop.Follows(fill);
+        loop.Precedes(total);
+
+        TaskGraphEvent ev;
+        graph.SubmitOnExecutor(*m_executor, &ev);
+        ev.Wait();
+
+        EXPECT_EQ(static_cast<int>(count) * 2, sum);
+    }
+
+    TEST_F(TaskGraphTestFixture, ParallelForEmptyRange)
+    {
+        AZStd::atomic<int> calls = 0;
+        AZStd::atomic<int> x = 0;
+
+        TaskGraph graph;
+        auto loop = graph.AddParallelFor(
+            defaultTD, 5, 5,
+            [&calls](size_t, size_t)
+            {
+                ++calls;
+            });
+        auto after = graph.AddTask(
+            defaultTD,
+            [&x]
+            {
+                x = 1;
+            });
+        loop.Precedes(after);
+
+        TaskGraphEvent ev;
+        graph.SubmitOnExecutor(*m_executor, &ev);
+        ev.Wait();
+
+        EXPECT_EQ(0, calls);
+        EXPECT_EQ(1, x);
+    }
+
+    TEST_F(TaskGraphTestFixture, ParallelRangeTaskCountBoundedByWorkersAndGrains)
+    {
+        // Large ranges are split across one task per worker
+        AZ::Internal::ParallelRange wide{ 0, 100000, 64, 3 };
+        EXPECT_EQ(3u, wide.GetTaskCount());
+
+        // Small ranges never get more tasks than there are grains
+        AZ::Internal::ParallelRange narrow{ 0, 100, 64, 8 };
+        EXPECT_EQ(2u, narrow.GetTaskCount());
+
+        AZ::Internal::ParallelRange empty{ 5, 5, 64, 8 };
+        EXPECT_EQ(1u, empty.GetTaskCount());
+    }
+
+    TEST_F(TaskGraphTestFixture, ParallelReduce)
+    {
+        constexpr size_t count = 100000;
+        uint64_t result = 0;
+
+        TaskDescriptor descriptor = defaultTD;
+        descriptor.grainSize = 128;
+
+        TaskGraph graph;
+        graph.AddParallelReduce(
+            descriptor, 0, count, uint64_t{ 0 },
+            [](size_t begin, size_t end, uint64_t& partial)
+            {
+                for (size_t i = begin; i != end; ++i)
+                {
+                    partial += i;
+                }
+            },
+            [](uint64_t lhs, uint64_t rhs)
+            {
+                return lhs + rhs;
+            },
+            &result);
+
+        TaskGraphEvent ev;
+        graph.SubmitOnExecutor(*m_executor, &ev);
+        ev.Wait();
+
+        EXPECT_EQ(uint64_t{ count } * (count - 1) / 2, result);
+    }
+
+    TEST_F(TaskGraphTestFixture, RetainedParallelReduceIsResubmittable)
+    {
+        constexpr size_t count = 1000;
+        AZStd::vector<int> values(count, 1);
+        int result = 0;
+
+        TaskGraph graph;
+        graph.AddParallelReduce(
+            defaultTD, 0, count, 0,
+            [&values](size_t begin, size_t end, int& partial)
+            {
+                for (size_t i = begin; i != end; ++i)
+                {
+                    partial += values[i];
+                }
+            },
+            [](int lhs, int rhs)
+            {
+                return lhs + rhs;
+            },
+            &result);
+
+        TaskGraphEvent ev1;
+        graph.SubmitOnExecutor(*m_executor, &ev1);
+        ev1.Wait();
+        EXPECT_EQ(static_cast<int>(count), result);
+
+        // Partial results and the range are reset on every submission
+        AZStd::fill(values.begin(), values.end(), 3);
+        TaskGraphEvent ev2;
+        graph.SubmitOnExecutor(*m_executor, &ev2);
+        ev2.Wait();
+        EXPECT_EQ(static_cast<int>(count) * 3, result);
+    }
+
+    TEST_F(TaskGraphTestFixture, ChildGraphDefersSuccessors)
+    {
+        constexpr int childCount = 16;
+        AZStd::atomic<int> childrenDone = 0;
+        int childrenDoneInSuccessor = -1;
+
+        TaskGraph graph;
+        auto a = graph.AddTask(
+            defaultTD,
+            [&]
+            {
+                TaskGraph children;
+                for (int i = 0; i != childCount; ++i)
+                {
+                    children.AddTask(
+                        defaultTD,
+                        [&childrenDone]
+                        {
+                            SpinFor(AZStd::chrono::microseconds(100));
+                            ++childrenDone;
+                        });
+                }
+                // Returns immediately, the children are still running when this task returns
+                children.SubmitAsChildOnExecutor(*m_executor);
+            });
+        auto b = graph.AddTask(
+            defaultTD,
+            [&]
+            {
+                childrenDoneInSuccessor = childrenDone;
+            });
+        a.Precedes(b);
+
+        TaskGraphEvent ev;
+        graph.SubmitOnExecutor(*m_executor, &ev);
+        ev.Wait();
+
+        EXPECT_EQ(childCount, childrenDoneInSuccessor);
+    }
+
+    // Builds a binary tree of tasks while it executes. Each node spawns its two children as a child graph
+    // with a continuation that sums the results of the children.
+    struct RecursiveTreeSum
+    {
+        static void Spawn(TaskExecutor& executor, int depth, int* result)
+        {
+            if (depth == 0)
+            {
+                *result = 1;
+                return;
+            }
+
+            // The partial results must outlive this task, the continuation releases them
+            int* partials = new int[2]{ 0, 0 };
+            TaskGraph children;
+            children.AddTask(
+                defaultTD,
+                [&executor, depth, partials]
+                {
+                    Spawn(executor, depth - 1, &partials[0]);
+                });
+            children.AddTask(
+                defaultTD,
+                [&executor, depth, partials]
+                {
+                    Spawn(executor, depth - 1, &partials[1]);
+                });
+            children.AddContinuation(
+                defaultTD,
+                [partials, result]
+                {
+                    *result = partials[0] + partials[1];
+                    delete[] partials;
+                });
+            children.SubmitAsChildOnExecutor(executor);
+        }
+    };
+
+    TEST_F(TaskGraphTestFixture, RecursiveChildGraphs)
+    {
+        constexpr int depth = 8;
+        int leafCount = 0;
+        int leafCountInSuccessor = 0;
+
+        TaskGraph graph;
+        auto root = graph.AddTask(
+            defaultTD,
+            [&]
+            {
+                RecursiveTreeSum::Spawn(*m_executor, depth, &leafCount);
+            });
+        auto after = graph.AddTask(
+            defaultTD,
+            [&]
+            {
+                leafCountInSuccessor = leafCount;
+            });
+        root.Precedes(after);
+
+        TaskGraphEvent ev;
+        graph.SubmitOnExecutor(*m_executor, &ev);
+        ev.Wait();
+
+        EXPECT_EQ(1 << depth, leafCount);
+        EXPECT_EQ(1 << depth, leafCountInSuccessor);
+    }
+
+    TEST_F(TaskGraphTestFixture, ContinuationFollowsAllSinks)
+    {
+        AZStd::atomic<int> x = 0;
+        int xInContinuation = 0;
+
+        TaskGraph graph;
+        auto a = graph.AddTask(
+            defaultTD,
+            [&x]
+            {
+                x += 1;
+            });
+        auto b = graph.AddTask(
+            defaultTD,
+            [&x]
+            {
+                x += 2;
+            });
+        graph.AddTask(
+            defaultTD,
+            [&x]
+            {
+                x += 4;
+            });
+        a.Precedes(b);
+        graph.AddContinuation(
+            defaultTD,
+            [&]
+            {
+                xInContinuation = x;
+            });
+
+        TaskGraphEvent ev;
+        graph.SubmitOnExecutor(*m_executor, &ev);
+        ev.Wait();
+
+        EXPECT_EQ(7, xInContinuation);
+    }
+
+    TEST_F(TaskGraphTestFixture, RetainedGraphWithChildGraphIsResubmittable)
+    {
+        AZStd::atomic<int> x = 0;
+
+        TaskGraph graph;
+        graph.AddTask(
+            defaultTD,
+            [&]
+            {
+                TaskGraph children;
+                children.AddTasks(
+                    defaultTD,
+                    [&x]
+                    {
+                        ++x;
+                    },
+                    [&x]
+                    {
+                        ++x;
+                    });
+                children.SubmitAsChildOnExecutor(*m_executor);
+            });
+
+        for (int i = 1; i <= 3; ++i)
+        {
+            TaskGraphEvent ev;
+            graph.SubmitOnExecutor(*m_executor, &ev);
+            ev.Wait();
+            EXPECT_EQ(2 * i, x);
+        }
+    }
 } // namespace UnitTest
 
 #if defined(HAVE_BENCHMARK)
@@ -736,5 +1182,94 @@ namespace Benchmark
             ev.Wait();
         }
     }
+
+    // A graph where a handful of tasks are much longer than the rest. Without work stealing, short tasks that
+    // are queued behind a long task wait for it to finish even if other workers are idle. The p50/p99 counters
+    // report the distribution of the graph completion latency in microseconds.
+    static void UnbalancedGraph(benchmark::State& state, TaskGraph& graph, TaskExecutor& executor)
+    {
+        const int taskCount = static_cast<int>(state.range(0));
+        const int longTaskStride = static_cast<int>(state.range(1));
+
+        for (int i = 0; i != taskCount; ++i)
+        {
+            const AZStd::chrono::microseconds duration(i % longTaskStride == 0 ? 500 : 10);
+            graph.AddTask(
+                { "unbalanced", "benchmark" },
+                [duration]
+                {
+                    SpinFor(duration);
+                });
+        }
+
+        AZStd::vector<double> latencies;
+        for (auto _ : state)
+        {
+            const auto start = AZStd::chrono::high_resolution_clock::now();
+            TaskGraphEvent ev;
+            graph.SubmitOnExecutor(executor, &ev);
+            ev.Wait();
+            const AZStd::chrono::microseconds elapsed = AZStd::chrono::high_resolution_clock::now() - start;
+            latencies.push_back(static_cast<double>(elapsed.count()));
+        }
+
+        if (!latencies.empty())
+        {
+            AZStd::sort(latencies.begin(), latencies.end());
+            state.counters["p50_us"] = latencies[latencies.size() / 2];
+            state.counters["p99_us"] = latencies[(latencies.size() * 99) / 100];
+        }
+    }
+
+    BENCHMARK_DEFINE_F(TaskGraphBenchmarkFixture, UnbalancedGraphTailLatency)(benchmark::State& state)
+    {
+        UnbalancedGraph(state, *graph, *executor);
+    }
+
+    BENCHMARK_REGISTER_F(TaskGraphBenchmarkFixture, UnbalancedGraphTailLatency)
+        ->ArgNames({ "Tasks", "LongTaskStride" })
+        ->Args({ 64, 16 })
+        ->Args({ 256, 32 })
+        ->Unit(::benchmark::kMicrosecond);
+
+    BENCHMARK_DEFINE_F(TaskGraphBenchmarkFixture, ParallelReduceSum)(benchmark::State& state)
+    {
+        const size_t count = static_cast<size_t>(state.range(0));
+        AZStd::vector<float> values(count, 1.0f);
+        float result = 0.0f;
+
+        TaskDescriptor descriptor{ "reduce", "benchmark" };
+        descriptor.grainSize = static_cast<uint16_t>(state.range(1));
+        graph->AddParallelReduce(
+            descriptor, 0, count, 0.0f,
+            [&values](size_t begin, size_t end, float& partial)
+            {
+                for (size_t i = begin; i != end; ++i)
+                {
+                    partial += values[i];
+                }
+            },
+            [](float lhs, float rhs)
+            {
+                return lhs + rhs;
+            },
+            &result);
+
+        for (auto _ : state)
+        {
+            TaskGraphEvent ev;
+            graph->SubmitOnExecutor(*executor, &ev);
+            ev.Wait();
+            benchmark::DoNotOptimize(result);
+        }
+        state.SetItemsProcessed(state.iterations() * count);
+    }
+
+    BENCHMARK_REGISTER_F(TaskGraphBenchmarkFixture, ParallelReduceSum)
+        ->ArgNames({ "Count", "Grain" })
+        ->Args({ 1 << 16, 0 })
+        ->Args({ 1 << 20, 0 })
+        ->Args({ 1 << 20, 4096 })
+        ->Unit(::benchmark::kMicrosecond);
 } // namespace Benchmark
 #endif
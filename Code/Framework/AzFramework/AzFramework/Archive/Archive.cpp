@@ -2023,6 +2023,7 @@ namespace AZ::IO
                 info.m_uncompressedSize = entry->desc.lSizeUncompressed;
                 info.m_isCompressed = entry->IsCompressed();
                 info.m_isSharedPak = true;
+                info.m_seekPoints = archive->GetSeekPoints(entry);
 
                 switch (GetPakPriority())
                 {
@@ -2037,10 +2038,11 @@ namespace AZ::IO
                     break;
                 }
 
-                info.m_decompressor = []([[maybe_unused]] const AZ::IO::CompressionInfo& info, const void* compressed, size_t compressedSize, void* uncompressed, size_t uncompressedBufferSize)->bool
+                // The dictionary is captured so it stays alive for as long as there are requests that need it.
+                info.m_decompressor = [dictionary = archive->GetZStdDictionary()]([[maybe_unused]] const AZ::IO::CompressionInfo& info, const void* compressed, size_t compressedSize, void* uncompressed, size_t uncompressedBufferSize)->bool
                 {
                     size_t nSizeUncompressed = uncompressedBufferSize;
-                    return ZipDir::ZipRawUncompress(uncompressed, &nSizeUncompressed, compressed, compressedSize) == 0;
+                    return ZipDir::ZipRawUncompress(uncompressed, &nSizeUncompressed, compressed, compressedSize, dictionary.get()) == 0;
                 };
             }
         }
@@ -88,6 +88,13 @@ namespace AZ::IO
 
         using Handle = void*;
 
+        struct FileUpdate
+        {
+            AZStd::string_view m_relativePath;
+            const void* m_uncompressed{};
+            uint64_t m_size{};
+        };
+
         virtual ~INestedArchive() = default;
 
         // Get archive's root folder
@@ -105,6 +112,22 @@ namespace AZ::IO
         virtual int UpdateFile(AZStd::string_view szRelativePath, const void* pUncompressed, uint64_t nSize, uint32_t nCompressionMethod = 0,
             int nCompressionLevel = -1, CompressionCodec::Codec codec = CompressionCodec::Codec::ZLIB) = 0;
 
+        // Summary:
+        //   Adds multiple new files to the zip or updates existing ones.
+        // Description:
+        //   Works the same as UpdateFile, except that the files are compressed in parallel before they're written
+        //   in the order they're provided. Stops at the first file that can't be added.
+        virtual int UpdateFiles(const AZStd::vector<FileUpdate>& files, uint32_t nCompressionMethod = 0,
+            int nCompressionLevel = -1, CompressionCodec::Codec codec = CompressionCodec::Codec::ZLIB) = 0;
+
+        // Summary:
+        //   Trains a zstd dictionary from the sample files and stores it in the archive.
+        // Description:
+        //   All files that are added with the ZSTD codec afterwards are compressed with the dictionary, which
+        //   works considerably better for small files that resemble the samples. The samples themselves aren't
+        //   added to the archive. An archive can only have one dictionary.
+        virtual int TrainZStdDictionary(const AZStd::vector<FileUpdate>& samples) = 0;
+
         // Summary:
         //   Adds a new file to the zip or update an existing one if it is not compressed - just stored  - start a big file
         //   ( name might be misleading as if nOverwriteSeekPos is used the update is not continuous )
@@ -153,6 +153,59 @@ namespace AZ::IO
         return m_pCache->UpdateFile(fullPath, pUncompressed, nSize, nCompressionMethod, nCompressionLevel, codec);
     }
 
+    //////////////////////////////////////////////////////////////////////////
+    int NestedArchive::UpdateFiles(const AZStd::vector<FileUpdate>& files, uint32_t nCompressionMethod, int nCompressionLevel, CompressionCodec::Codec codec)
+    {
+        if (m_nFlags & FLAGS_READ_ONLY)
+        {
+            return ZipDir::ZD_ERROR_INVALID_CALL;
+        }
+
+        // the adjusted paths need to outlive the update as the cache only references them, so reserve up front to make sure
+        // they don't move
+        AZStd::vector<AZStd::string> fullPaths;
+        fullPaths.reserve(files.size());
+        AZStd::vector<ZipDir::Cache::FileUpdate> cacheFiles;
+        cacheFiles.reserve(files.size());
+        for (const FileUpdate& file : files)
+        {
+            const AZStd::string& fullPath = fullPaths.emplace_back(AdjustPath(file.m_relativePath));
+            if (fullPath.empty())
+            {
+                return ZipDir::ZD_ERROR_INVALID_PATH;
+            }
+            cacheFiles.push_back({ fullPath, file.m_uncompressed, file.m_size });
+        }
+        return m_pCache->UpdateFiles(cacheFiles, nCompressionMethod, nCompressionLevel, codec);
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    int NestedArchive::TrainZStdDictionary(const AZStd::vector<FileUpdate>& samples)
+    {
+        if ((m_nFlags & FLAGS_READ_ONLY) || m_pCache->GetZStdDictionary())
+        {
+            return ZipDir::ZD_ERROR_INVALID_CALL;
+        }
+
+        // zstd expects the samples to be stored back to back
+        AZStd::vector<uint8_t> samplesBuffer;
+        AZStd::vector<size_t> sampleSizes;
+        sampleSizes.reserve(samples.size());
+        for (const FileUpdate& sample : samples)
+        {
+            const uint8_t* data = reinterpret_cast<const uint8_t*>(sample.m_uncompressed);
+            samplesBuffer.insert(samplesBuffer.end(), data, data + sample.m_size);
+            sampleSizes.push_back(aznumeric_cast<size_t>(sample.m_size));
+        }
+
+        ZipDir::ZStdDictionaryPtr dictionary = ZipDir::ZStdDictionary::Train(samplesBuffer.data(), sampleSizes.data(), sampleSizes.size());
+        if (!dictionary)
+        {
+            return ZipDir::ZD_ERROR_UNEXPECTED;
+        }
+        return m_pCache->SetZStdDictionary(AZStd::move(dictionary));
+    }
+
     //////////////////////////////////////////////////////////////////////////
     //   Adds a new file to the zip or update an existing one if it is not compressed - just stored  - start a big file
     int NestedArchive::StartContinuousFileUpdate(AZStd::string_view szRelativePath, uint64_t nSize)
@@ -48,6 +48,13 @@ namespace AZ::IO
         int UpdateFile(AZStd::string_view szRelativePath, const void* pUncompressed, uint64_t nSize, uint32_t nCompressionMethod = ZipFile::METHOD_STORE,
             int nCompressionLevel = -1, CompressionCodec::Codec codec = CompressionCodec::Codec::ZLIB) override;
 
+        // Adds multiple new files to the zip or updates existing ones, compressing them in parallel
+        int UpdateFiles(const AZStd::vector<FileUpdate>& files, uint32_t nCompressionMethod = ZipFile::METHOD_STORE,
+            int nCompressionLevel = -1, CompressionCodec::Codec codec = CompressionCodec::Codec::ZLIB) override;
+
+        // Trains a zstd dictionary from the samples and stores it in the archive
+        int TrainZStdDictionary(const AZStd::vector<FileUpdate>& samples) override;
+
         // Adds a new file to the zip or update an existing one if it is not compressed - just stored  - start a big file
         int StartContinuousFileUpdate(AZStd::string_view szRelativePath, uint64_t nSize) override;
 
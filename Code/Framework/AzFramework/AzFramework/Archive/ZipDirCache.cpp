@@ -8,7 +8,13 @@
 
 
 #include <AzCore/Console/Console.h>
+#include <AzCore/Interface/Interface.h>
 #include <AzCore/IO/FileIO.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
 #include <AzCore/std/string/conversions.h>
 
 #include <AzFramework/Archive/ZipFileFormat.h>
@@ -61,6 +67,22 @@ namespace AZ::IO::ZipDir
             return memoryBlock;
         }
 
+        // The zstd dictionary entry is owned by the cache, as the files that are compressed with it can't be read if it
+        // changes or goes missing. Returns true and reports an error if the path refers to it.
+        static bool IsReservedPath(AZStd::string_view relativePath, const char* operation)
+        {
+            const size_t start = relativePath.find_first_not_of(R"(/\)");
+            relativePath = start == AZStd::string_view::npos ? AZStd::string_view{} : relativePath.substr(start);
+            if (relativePath.size() == ZStdDictionary::ArchiveFileName.size() &&
+                azstrnicmp(relativePath.data(), ZStdDictionary::ArchiveFileName.data(), relativePath.size()) == 0)
+            {
+                AZ_Error("Archive", false, "Unable to %s \"%.*s\" as it's reserved for the zstd dictionary of the archive.",
+                    operation, AZ_STRING_ARG(relativePath));
+                return true;
+            }
+            return false;
+        }
+
         // generates random file name
         static AZStd::fixed_string<8> GetRandomName(int nAttempt)
         {
@@ -104,6 +126,8 @@ namespace AZ::IO::ZipDir
             , m_szRelativePath(AZ::IO::PosixPathSeparator)
             , m_bCommitted(false)
         {
+            // the file index doesn't include new files
+            m_pCache->m_fileIndex.reset();
             // Update the cache string pool with the relative path to the file
             auto pathIt = m_pCache->m_relativePathPool.emplace(AZ::IO::PathView(szRelativePath, AZ::IO::PosixPathSeparator).LexicallyNormal());
             m_szRelativePath = *pathIt.first;
@@ -179,7 +203,9 @@ namespace AZ::IO::ZipDir
             }
         }
         m_allocator = nullptr;
+        m_fileIndex.reset();
         m_treeDir.Clear();
+        m_zstdDictionary.reset();
     }
 
     bool Cache::WriteCompressedData(uint8_t* data, size_t size, bool)
@@ -256,55 +282,309 @@ namespace AZ::IO::ZipDir
     // adds a directory (creates several nested directories if needed)
     ErrorEnum Cache::UpdateFile(AZStd::string_view szRelativePathSrc, const void* pUncompressed, uint64_t nSize, uint32_t nCompressionMethod, int nCompressionLevel, CompressionCodec::Codec codec)
     {
-        AZStd::intrusive_ptr<AZ::IO::MemoryBlock> memoryBlock;
+        return UpdateFiles({ FileUpdate{ szRelativePathSrc, pUncompressed, nSize } }, nCompressionMethod, nCompressionLevel, codec);
+    }
 
-        // we'll need the compressed data
-        void* pCompressed = nullptr;
-        const void* dataBuffer{};
-        size_t nSizeCompressed;
-        int nError = Z_ERRNO;
+    ErrorEnum Cache::UpdateFiles(const AZStd::vector<FileUpdate>& files, uint32_t nCompressionMethod, int nCompressionLevel, CompressionCodec::Codec codec)
+    {
+        if (nCompressionMethod != ZipFile::METHOD_STORE && nCompressionMethod != ZipFile::METHOD_DEFLATE)
+        {
+            return ZD_ERROR_UNSUPPORTED;
+        }
 
-        if (nSize == 0)
+        for (const FileUpdate& file : files)
         {
-            nCompressionMethod = ZipFile::METHOD_STORE;
+            if (ZipDirCacheInternal::IsReservedPath(file.m_relativePath, "update"))
+            {
+                return ZD_ERROR_INVALID_CALL;
+            }
         }
-        switch (nCompressionMethod)
+
+        // Split the files into blocks that are compressed independently. Files compressed with zstd are split into multiple
+        // frames so a single large file can be compressed in parallel as well.
+        struct CompressedBlock
         {
-        case ZipFile::METHOD_DEFLATE:
-            nSizeCompressed = GetCompressedSizeEstimate(nSize, codec);
-            memoryBlock = ZipDirCacheInternal::CreateMemoryBlock(nSizeCompressed, "Cache::UpdateFile");
-            pCompressed = memoryBlock->m_address.get();
-            dataBuffer = pCompressed;
+            size_t m_fileIndex{};
+            uint64_t m_offset{};
+            uint64_t m_size{};
+            AZStd::intrusive_ptr<AZ::IO::MemoryBlock> m_memoryBlock;
+            size_t m_compressedSize{};
+            int m_error{ Z_ERRNO };
+        };
+        AZStd::vector<CompressedBlock> blocks;
+        if (nCompressionMethod == ZipFile::METHOD_DEFLATE)
+        {
+            const uint64_t blockSize = codec == CompressionCodec::Codec::ZSTD ? ZStdFrameSize : AZStd::numeric_limits<uint64_t>::max();
+            for (size_t fileIndex = 0; fileIndex < files.size(); ++fileIndex)
+            {
+                // empty files don't get any blocks as they're always stored
+                const uint64_t fileSize = files[fileIndex].m_size;
+                for (uint64_t offset = 0; offset < fileSize; offset += AZStd::min(blockSize, fileSize - offset))
+                {
+                    CompressedBlock& block = blocks.emplace_back();
+                    block.m_fileIndex = fileIndex;
+                    block.m_offset = offset;
+                    block.m_size = AZStd::min(blockSize, fileSize - offset);
+                }
+            }
+        }
+
+        auto CompressBlock = [this, &files, nCompressionLevel, codec](CompressedBlock& block)
+        {
+            const void* pUncompressed = reinterpret_cast<const uint8_t*>(files[block.m_fileIndex].m_uncompressed) + block.m_offset;
+            block.m_compressedSize = GetCompressedSizeEstimate(block.m_size, codec);
+            block.m_memoryBlock = ZipDirCacheInternal::CreateMemoryBlock(block.m_compressedSize, "Cache::UpdateFiles");
+            void* pCompressed = block.m_memoryBlock->m_address.get();
 
             switch (codec)
             {
             case CompressionCodec::Codec::ZSTD:
-                nError = ZipRawCompressZSTD(pUncompressed, &nSizeCompressed, pCompressed, nSize, nCompressionLevel);
+                block.m_error = ZipRawCompressZSTD(pUncompressed, &block.m_compressedSize, pCompressed, block.m_size, nCompressionLevel, m_zstdDictionary.get());
                 break;
 
             case CompressionCodec::Codec::ZLIB:
-                nError = ZipRawCompress(pUncompressed, &nSizeCompressed, pCompressed, nSize, nCompressionLevel);
+                block.m_error = ZipRawCompress(pUncompressed, &block.m_compressedSize, pCompressed, block.m_size, nCompressionLevel);
                 break;
 
             case CompressionCodec::Codec::LZ4:
-                nError = ZipRawCompressLZ4(pUncompressed, &nSizeCompressed, pCompressed, nSize, nCompressionLevel);
+                block.m_error = ZipRawCompressLZ4(pUncompressed, &block.m_compressedSize, pCompressed, block.m_size, nCompressionLevel);
                 break;
             }
-            if (Z_OK != nError)
+        };
+
+        auto taskGraphActive = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        if (blocks.size() > 1 && taskGraphActive != nullptr && taskGraphActive->IsTaskGraphActive() &&
+            !AZ::TaskExecutor::Instance().IsTaskWorkerThread())
+        {
+            AZ::TaskDescriptor descriptor{ "AZ::IO::ZipDir::Cache::UpdateFiles", "Archive" };
+            descriptor.grainSize = 1;
+
+            AZ::TaskGraph graph;
+            graph.AddParallelFor(descriptor, 0, blocks.size(), [&blocks, &CompressBlock](size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    CompressBlock(blocks[i]);
+                }
+            });
+            AZ::TaskGraphEvent finished;
+            graph.Submit(&finished);
+            finished.Wait();
+        }
+        else
+        {
+            for (CompressedBlock& block : blocks)
             {
-                return ZD_ERROR_ZLIB_FAILED;
+                CompressBlock(block);
             }
-            break;
+        }
 
-        case ZipFile::METHOD_STORE:
-            dataBuffer = pUncompressed;
-            nSizeCompressed = nSize;
-            break;
+        // Write the files in order so the layout of the archive doesn't depend on how the compression was scheduled.
+        auto fileBlocksBegin = blocks.begin();
+        for (size_t fileIndex = 0; fileIndex < files.size(); ++fileIndex)
+        {
+            const FileUpdate& file = files[fileIndex];
+            ErrorEnum e;
+            if (nCompressionMethod == ZipFile::METHOD_STORE || file.m_size == 0)
+            {
+                e = WriteFileData(file.m_relativePath, file.m_uncompressed, file.m_size, file.m_uncompressed, file.m_size, ZipFile::METHOD_STORE);
+            }
+            else
+            {
+                auto fileBlocksEnd = AZStd::find_if(fileBlocksBegin, blocks.end(),
+                    [fileIndex](const CompressedBlock& block) { return block.m_fileIndex != fileIndex; });
 
-        default:
-            return ZD_ERROR_UNSUPPORTED;
+                size_t nSizeCompressed = 0;
+                for (auto block = fileBlocksBegin; block != fileBlocksEnd; ++block)
+                {
+                    if (Z_OK != block->m_error)
+                    {
+                        return ZD_ERROR_ZLIB_FAILED;
+                    }
+                    nSizeCompressed += block->m_compressedSize;
+                }
+
+                AZStd::intrusive_ptr<AZ::IO::MemoryBlock> memoryBlock = fileBlocksBegin->m_memoryBlock;
+                const size_t frameCount = AZStd::distance(fileBlocksBegin, fileBlocksEnd);
+                AZStd::vector<ZStdSeekTableEntry> seekTable;
+                if (frameCount > 1)
+                {
+                    // only zstd splits files into multiple frames, so end the file with a seek table to allow parts of it to
+                    // be decompressed
+                    const size_t seekTableSize = GetZStdSeekTableSize(frameCount);
+                    seekTable.reserve(frameCount);
+
+                    memoryBlock = ZipDirCacheInternal::CreateMemoryBlock(nSizeCompressed + seekTableSize, "Cache::UpdateFiles");
+                    uint8_t* pFrame = memoryBlock->m_address.get();
+                    for (auto block = fileBlocksBegin; block != fileBlocksEnd; ++block)
+                    {
+                        memcpy(pFrame, block->m_memoryBlock->m_address.get(), block->m_compressedSize);
+                        pFrame += block->m_compressedSize;
+                        seekTable.push_back({ aznumeric_cast<uint32_t>(block->m_compressedSize), aznumeric_cast<uint32_t>(block->m_size) });
+                    }
+                    WriteZStdSeekTable(pFrame, seekTable.data(), frameCount);
+                    nSizeCompressed += seekTableSize;
+                }
+
+                e = WriteFileData(file.m_relativePath, file.m_uncompressed, file.m_size, memoryBlock->m_address.get(), nSizeCompressed, nCompressionMethod);
+                if (FileEntry* pFileEntry = e == ZD_ERROR_SUCCESS && !seekTable.empty() ? FindFile(file.m_relativePath) : nullptr)
+                {
+                    SetSeekPoints(pFileEntry, seekTable.data(), seekTable.size());
+                }
+
+                // release the compressed data as soon as possible as batches can be large
+                for (; fileBlocksBegin != fileBlocksEnd; ++fileBlocksBegin)
+                {
+                    fileBlocksBegin->m_memoryBlock.reset();
+                }
+            }
+
+            if (e != ZD_ERROR_SUCCESS)
+            {
+                return e;
+            }
+        }
+        return ZD_ERROR_SUCCESS;
+    }
+
+    ErrorEnum Cache::SetZStdDictionary(ZStdDictionaryPtr dictionary)
+    {
+        if (!dictionary || m_zstdDictionary)
+        {
+            return ZD_ERROR_INVALID_CALL;
+        }
+
+        // the dictionary is always stored so it can be read without needing a dictionary
+        const AZStd::vector<uint8_t>& data = dictionary->GetData();
+        ErrorEnum e = WriteFileData(ZStdDictionary::ArchiveFileName, data.data(), data.size(), data.data(), data.size(), ZipFile::METHOD_STORE);
+        if (e == ZD_ERROR_SUCCESS)
+        {
+            m_zstdDictionary = AZStd::move(dictionary);
+        }
+        return e;
+    }
+
+    bool Cache::LoadZStdDictionary()
+    {
+        FileEntry* pFileEntry = FindFile(ZStdDictionary::ArchiveFileName);
+        if (!pFileEntry)
+        {
+            return true;
         }
 
+        AZStd::vector<uint8_t> data(pFileEntry->desc.lSizeUncompressed);
+        if (ReadFile(pFileEntry, nullptr, data.data()) != ZD_ERROR_SUCCESS)
+        {
+            return false;
+        }
+        m_zstdDictionary = ZStdDictionary::Create(data.data(), data.size());
+        return m_zstdDictionary != nullptr;
+    }
+
+    AZStd::shared_ptr<const AZ::IO::CompressionSeekPoints> Cache::GetSeekPoints(FileEntry* pFileEntry)
+    {
+        if (!pFileEntry)
+        {
+            return {};
+        }
+
+        // The lock also keeps other reads of the entry from moving the file position while the seek table is read
+        AZStd::scoped_lock lock(pFileEntry->m_readLock);
+        if (!pFileEntry->m_seekPointsLoaded)
+        {
+            pFileEntry->m_seekPoints = LoadSeekPoints(pFileEntry);
+            pFileEntry->m_seekPointsLoaded = true;
+        }
+        return pFileEntry->m_seekPoints;
+    }
+
+    AZStd::shared_ptr<const AZ::IO::CompressionSeekPoints> Cache::LoadSeekPoints(FileEntry* pFileEntry)
+    {
+        // only files that are larger than a single zstd frame can have a seek table
+        if (!pFileEntry->IsCompressed() || pFileEntry->desc.lSizeUncompressed <= ZStdFrameSize ||
+            pFileEntry->desc.lSizeCompressed < GetZStdSeekTableSize(2) || Refresh(pFileEntry) != ZD_ERROR_SUCCESS)
+        {
+            return {};
+        }
+
+        // zlib and zstd files share the compression method, only zstd files start with the zstd magic number
+        AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetDirectInstance();
+        uint8_t magic[sizeof(uint32_t)];
+        if (!fileIO->Seek(m_fileHandle, pFileEntry->nFileDataOffset, AZ::IO::SeekType::SeekFromStart) ||
+            !fileIO->Read(m_fileHandle, magic, sizeof(magic), true) ||
+            !CompressionCodec::TestForZSTDMagic(magic))
+        {
+            return {};
+        }
+
+        const uint64_t dataEnd = uint64_t{ pFileEntry->nFileDataOffset } + pFileEntry->desc.lSizeCompressed;
+        uint8_t footer[ZStdSeekTableFooterSize];
+        if (!fileIO->Seek(m_fileHandle, dataEnd - sizeof(footer), AZ::IO::SeekType::SeekFromStart) ||
+            !fileIO->Read(m_fileHandle, footer, sizeof(footer), true))
+        {
+            return {};
+        }
+
+        const size_t seekTableSize = GetZStdSeekTableSizeFromFooter(footer);
+        if (seekTableSize == 0 || seekTableSize >= pFileEntry->desc.lSizeCompressed)
+        {
+            return {};
+        }
+
+        AZStd::vector<uint8_t> seekTableData(seekTableSize);
+        AZStd::vector<ZStdSeekTableEntry> seekTable;
+        if (!fileIO->Seek(m_fileHandle, dataEnd - seekTableSize, AZ::IO::SeekType::SeekFromStart) ||
+            !fileIO->Read(m_fileHandle, seekTableData.data(), seekTableSize, true) ||
+            !ReadZStdSeekTable(seekTable, seekTableData.data(), seekTableSize))
+        {
+            return {};
+        }
+
+        return CreateSeekPoints(pFileEntry, seekTable.data(), seekTable.size());
+    }
+
+    AZStd::shared_ptr<const AZ::IO::CompressionSeekPoints> Cache::CreateSeekPoints(
+        const FileEntry* pFileEntry, const ZStdSeekTableEntry* frames, size_t frameCount) const
+    {
+        if (frameCount == 0)
+        {
+            return {};
+        }
+
+        auto seekPoints = AZStd::make_shared<AZ::IO::CompressionSeekPoints>();
+        seekPoints->reserve(frameCount + 1);
+        seekPoints->push_back({ 0, 0 });
+        for (size_t i = 0; i < frameCount; ++i)
+        {
+            const AZ::IO::CompressionSeekPoint& previous = seekPoints->back();
+            seekPoints->push_back({ previous.m_compressedOffset + frames[i].m_compressedSize, previous.m_uncompressedOffset + frames[i].m_uncompressedSize });
+        }
+
+        if (seekPoints->back().m_compressedOffset + GetZStdSeekTableSize(frameCount) != pFileEntry->desc.lSizeCompressed ||
+            seekPoints->back().m_uncompressedOffset != pFileEntry->desc.lSizeUncompressed)
+        {
+            AZ_Warning("Archive", false, "The zstd seek table of a file in archive %s doesn't match the size of the file and will be ignored.",
+                m_strFilePath.c_str());
+            return {};
+        }
+        return seekPoints;
+    }
+
+    void Cache::SetSeekPoints(FileEntry* pFileEntry, const ZStdSeekTableEntry* frames, size_t frameCount)
+    {
+        auto seekPoints = CreateSeekPoints(pFileEntry, frames, frameCount);
+        AZStd::scoped_lock lock(pFileEntry->m_readLock);
+        pFileEntry->m_seekPoints = AZStd::move(seekPoints);
+        pFileEntry->m_seekPointsLoaded = true;
+    }
+
+    void Cache::BuildFileIndex()
+    {
+        m_fileIndex = AZStd::make_unique<FileEntryIndex>(m_treeDir);
+    }
+
+    ErrorEnum Cache::WriteFileData(AZStd::string_view szRelativePathSrc, const void* pUncompressed, uint64_t nSize, const void* dataBuffer, size_t nSizeCompressed, uint32_t nCompressionMethod)
+    {
         // create or find the file entry.. this object will rollback (delete the object
         // if the operation fails) if needed.
         FileEntryTransactionAdd pFileEntry(this, szRelativePathSrc);
@@ -401,6 +681,11 @@ namespace AZ::IO::ZipDir
     //   Adds a new file to the zip or update an existing one if it is not compressed - just stored  - start a big file
     ErrorEnum Cache::StartContinuousFileUpdate(AZStd::string_view szRelativePathSrc, uint64_t nSize)
     {
+        if (ZipDirCacheInternal::IsReservedPath(szRelativePathSrc, "update"))
+        {
+            return ZD_ERROR_INVALID_CALL;
+        }
+
         AZ::IO::MemoryBlock memoryBlock;
 
         // create or find the file entry.. this object will rollback (delete the object
@@ -486,6 +771,11 @@ namespace AZ::IO::ZipDir
     // adds a directory (creates several nested directories if needed)
     ErrorEnum Cache::UpdateFileContinuousSegment(AZStd::string_view szRelativePathSrc, [[maybe_unused]] uint64_t nSize, const void* pUncompressed, uint64_t nSegmentSize, uint64_t nOverwriteSeekPos)
     {
+        if (ZipDirCacheInternal::IsReservedPath(szRelativePathSrc, "update"))
+        {
+            return ZD_ERROR_INVALID_CALL;
+        }
+
         const bool shouldOverwriteSeekOffset = nOverwriteSeekPos != (std::numeric_limits<uint64_t>::max)();
         AZ::IO::MemoryBlock memoryBlock;
 
@@ -549,6 +839,11 @@ namespace AZ::IO::ZipDir
 
     ErrorEnum Cache::UpdateFileCRC(AZStd::string_view szRelativePathSrc, AZ::Crc32 dwCRC32)
     {
+        if (ZipDirCacheInternal::IsReservedPath(szRelativePathSrc, "update"))
+        {
+            return ZD_ERROR_INVALID_CALL;
+        }
+
         // create or find the file entry.. this object will rollback (delete the object
         // if the operation fails) if needed.
         FileEntryTransactionAdd pFileEntry(this, szRelativePathSrc);
@@ -584,6 +879,11 @@ namespace AZ::IO::ZipDir
     // deletes the file from the archive
     ErrorEnum Cache::RemoveFile(AZStd::string_view szRelativePathSrc)
     {
+        if (ZipDirCacheInternal::IsReservedPath(szRelativePathSrc, "remove"))
+        {
+            return ZD_ERROR_INVALID_CALL;
+        }
+
         AZ::IO::PathView szRelativePath{ szRelativePathSrc };
 
         AZStd::string_view fileName; // the name of the file to delete
@@ -611,6 +911,7 @@ namespace AZ::IO::ZipDir
         if (e == ZD_ERROR_SUCCESS)
         {
             m_nFlags |= FLAGS_UNCOMPACTED | FLAGS_CDR_DIRTY;
+            m_fileIndex.reset();
 
             if (az_archive_zip_directory_cache_verbosity)
             {
@@ -652,6 +953,7 @@ namespace AZ::IO::ZipDir
         if (e == ZD_ERROR_SUCCESS)
         {
             m_nFlags |= FLAGS_UNCOMPACTED | FLAGS_CDR_DIRTY;
+            m_fileIndex.reset();
 
             if (az_archive_zip_directory_cache_verbosity)
             {
@@ -669,6 +971,9 @@ namespace AZ::IO::ZipDir
         if (e == ZD_ERROR_SUCCESS)
         {
             m_nFlags |= FLAGS_UNCOMPACTED | FLAGS_CDR_DIRTY;
+            m_fileIndex.reset();
+            // there are no files left that were compressed with the dictionary, so a new one can be used
+            m_zstdDictionary.reset();
         }
         return e;
     }
@@ -737,7 +1042,7 @@ namespace AZ::IO::ZipDir
             else
             {
                 size_t nSizeUncompressed = pFileEntry->desc.lSizeUncompressed;
-                if (Z_OK != ZipRawUncompress(pUncompressed, &nSizeUncompressed, pBuffer, pFileEntry->desc.lSizeCompressed))
+                if (Z_OK != ZipRawUncompress(pUncompressed, &nSizeUncompressed, pBuffer, pFileEntry->desc.lSizeCompressed, m_zstdDictionary.get()))
                 {
                     return ZD_ERROR_CORRUPTED_DATA;
                 }
@@ -764,8 +1069,16 @@ namespace AZ::IO::ZipDir
     {
         AZ::IO::PathView szPath{ szPathSrc };
 
-        ZipDir::FindFile fd(GetRoot());
-        FileEntry* fileEntry = fd.FindExact(szPath);
+        FileEntry* fileEntry;
+        if (m_fileIndex)
+        {
+            fileEntry = m_fileIndex->Find(szPath);
+        }
+        else
+        {
+            ZipDir::FindFile fd(GetRoot());
+            fileEntry = fd.FindExact(szPath);
+        }
         if (!fileEntry)
         {
             if (az_archive_zip_directory_cache_verbosity)
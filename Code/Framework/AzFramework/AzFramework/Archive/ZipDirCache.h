@@ -21,6 +21,7 @@
 #include <AzCore/std/containers/unordered_set.h>
 #include <AzCore/std/smart_ptr/intrusive_base.h>
 #include <AzFramework/Archive/Codec.h>
+#include <AzFramework/Archive/ZipDirIndex.h>
 #include <AzFramework/Archive/ZipDirStructures.h>
 #include <AzFramework/Archive/ZipDirTree.h>
 
@@ -52,10 +53,31 @@ namespace AZ::IO::ZipDir
             return m_fileHandle != AZ::IO::InvalidHandle;
         }
 
+        struct FileUpdate
+        {
+            AZStd::string_view m_relativePath;
+            const void* m_uncompressed{};
+            uint64_t m_size{};
+        };
+
         // Adds a new file to the zip or update an existing one
         // adds a directory (creates several nested directories if needed)
         ErrorEnum UpdateFile(AZStd::string_view szRelativePath, const void* pUncompressed, uint64_t nSize, uint32_t nCompressionMethod = ZipFile::METHOD_STORE, int nCompressionLevel = -1, CompressionCodec::Codec codec = CompressionCodec::Codec::ZLIB);
 
+        // Adds or updates multiple files at once. The files are compressed in parallel and then written in the order they're
+        // provided. Stops at the first file that can't be written and returns its error.
+        ErrorEnum UpdateFiles(const AZStd::vector<FileUpdate>& files, uint32_t nCompressionMethod = ZipFile::METHOD_STORE, int nCompressionLevel = -1, CompressionCodec::Codec codec = CompressionCodec::Codec::ZLIB);
+
+        // Stores the zstd dictionary in the archive and uses it for all files that are compressed with zstd from now on.
+        // An archive can only have one dictionary, as files that were compressed with a dictionary can't be read without it.
+        ErrorEnum SetZStdDictionary(ZStdDictionaryPtr dictionary);
+
+        // returns the zstd dictionary of the archive or null if it doesn't have one
+        const ZStdDictionaryPtr& GetZStdDictionary() const
+        {
+            return m_zstdDictionary;
+        }
+
         //   Adds a new file to the zip or update an existing one if it is not compressed - just stored  - start a big file
         ErrorEnum StartContinuousFileUpdate(AZStd::string_view szRelativePath, uint64_t nSize);
 
@@ -79,6 +101,8 @@ namespace AZ::IO::ZipDir
         // closes the current zip file
         void Close();
 
+        // Finds the file with the given path. Uses the file index if the archive has one, in which case it's safe to call
+        // from multiple threads at the same time.
         FileEntry* FindFile(AZStd::string_view szPath, bool bFullInfo = false);
 
         ErrorEnum ReadFile(FileEntry* pFileEntry, void* pCompressed, void* pUncompressed);
@@ -91,6 +115,11 @@ namespace AZ::IO::ZipDir
         // refreshes information about the given file entry into this file entry
         ErrorEnum Refresh(FileEntryBase* pFileEntry);
 
+        // Returns the seek points of a file that's compressed as multiple zstd frames followed by a seek table, or null if the
+        // file can only be decompressed as a whole. The seek table of a file is read from the archive the first time it's
+        // requested and kept afterwards.
+        AZStd::shared_ptr<const AZ::IO::CompressionSeekPoints> GetSeekPoints(FileEntry* pFileEntry);
+
         // QUICK check to determine whether the file entry belongs to this object
         bool IsOwnerOf(const FileEntry* pFileEntry) const
         {
@@ -128,6 +157,23 @@ namespace AZ::IO::ZipDir
 
         size_t GetCompressedSizeEstimate(size_t uncompressedSize, CompressionCodec::Codec codec);
 
+        // writes the already compressed data of a file to the archive
+        ErrorEnum WriteFileData(AZStd::string_view szRelativePath, const void* pUncompressed, uint64_t nSize, const void* dataBuffer, size_t nSizeCompressed, uint32_t nCompressionMethod);
+
+        // loads the zstd dictionary if the archive has one
+        bool LoadZStdDictionary();
+
+        // reads the seek table of a file that's split into multiple zstd frames, returns null if the file doesn't have one
+        AZStd::shared_ptr<const AZ::IO::CompressionSeekPoints> LoadSeekPoints(FileEntry* pFileEntry);
+        // converts the frames of the file into seek points, returns null if they don't match the size of the file
+        AZStd::shared_ptr<const AZ::IO::CompressionSeekPoints> CreateSeekPoints(const FileEntry* pFileEntry, const ZStdSeekTableEntry* frames, size_t frameCount) const;
+        // stores the seek points for the frames of a file that was just written
+        void SetSeekPoints(FileEntry* pFileEntry, const ZStdSeekTableEntry* frames, size_t frameCount);
+
+        // Builds an index of all the files for fast lookups. This is only done for read-only archives as the index isn't
+        // updated when files are added or removed, and is discarded instead.
+        void BuildFileIndex();
+
     protected:
         friend class CacheFactory;
         friend class FileEntryTransactionAdd;
@@ -167,6 +213,10 @@ namespace AZ::IO::ZipDir
         ZipFile::CryCustomEncryptionHeader m_headerEncryption;
         ZipFile::CrySignedCDRHeader m_headerSignature;
         ZipFile::CryCustomExtendedHeader m_headerExtended;
+
+        ZStdDictionaryPtr m_zstdDictionary;
+
+        AZStd::unique_ptr<FileEntryIndex> m_fileIndex;
     };
 
     using CachePtr = AZStd::intrusive_ptr<Cache>;
@@ -147,6 +147,18 @@ namespace AZ::IO::ZipDir
         // the factory doesn't own it after that
         m_fileExt.m_fileHandle = AZ::IO::InvalidHandle;
 
+        if (!pCache->LoadZStdDictionary())
+        {
+            AZ_Warning("Archive", false, R"(ZD_ERROR_CORRUPTED_DATA: Could not load the zstd dictionary of the pack file "%s".)", szFileName);
+            return {};
+        }
+
+        // read-only archives never change, so their files can be looked up through an index without locking
+        if (m_nFlags & FLAGS_READ_ONLY)
+        {
+            pCache->BuildFileIndex();
+        }
+
         return pCache;
     }
 
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzFramework/Archive/ZipFileFormat.h>
+#include <AzFramework/Archive/ZipDirStructures.h>
+#include <AzFramework/Archive/ZipDirTree.h>
+#include <AzFramework/Archive/ZipDirList.h>
+#include <AzFramework/Archive/ZipDirIndex.h>
+
+namespace AZ::IO::ZipDir
+{
+    FileEntryIndex::FileEntryIndex(FileEntryTree& tree)
+    {
+        FileRecordList files(&tree);
+
+        // keep the load factor at or below one half so probe sequences stay short
+        size_t numSlots = 16;
+        while (numSlots < files.size() * 2)
+        {
+            numSlots *= 2;
+        }
+        m_slots.resize(numSlots);
+
+        size_t pathsLength = 0;
+        for (const FileRecord& file : files)
+        {
+            pathsLength += file.strPath.size();
+        }
+        m_paths.reserve(pathsLength);
+
+        for (const FileRecord& file : files)
+        {
+            // the tree only stores FileEntry objects, FileRecord only refers to their base
+            Insert(AZStd::hash<AZ::IO::PathView>{}(AZ::IO::PathView(file.strPath)), static_cast<FileEntry*>(file.pFileEntryBase), file.strPath);
+        }
+    }
+
+    FileEntry* FileEntryIndex::Find(AZ::IO::PathView path) const
+    {
+        const size_t hash = AZStd::hash<AZ::IO::PathView>{}(path);
+        const size_t mask = m_slots.size() - 1;
+        for (size_t index = hash & mask; m_slots[index].m_fileEntry; index = (index + 1) & mask)
+        {
+            const Slot& slot = m_slots[index];
+            if (slot.m_hash == hash &&
+                AZ::IO::PathView(AZStd::string_view(m_paths.data() + slot.m_pathOffset, slot.m_pathLength)) == path)
+            {
+                return slot.m_fileEntry;
+            }
+        }
+        return nullptr;
+    }
+
+    void FileEntryIndex::Insert(size_t hash, FileEntry* fileEntry, AZStd::string_view path)
+    {
+        const size_t mask = m_slots.size() - 1;
+        size_t index = hash & mask;
+        while (m_slots[index].m_fileEntry)
+        {
+            index = (index + 1) & mask;
+        }
+
+        Slot& slot = m_slots[index];
+        slot.m_hash = hash;
+        slot.m_fileEntry = fileEntry;
+        slot.m_pathOffset = aznumeric_cast<uint32_t>(m_paths.size());
+        slot.m_pathLength = aznumeric_cast<uint32_t>(path.size());
+        m_paths.append(path.data(), path.size());
+        ++m_numFiles;
+    }
+}
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+
+#pragma once
+
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+
+namespace AZ::IO::ZipDir
+{
+    struct FileEntry;
+    class FileEntryTree;
+
+    // Index of all the files in a FileEntryTree by the hash of their path, so a file can be found with a single
+    // lookup instead of a search per directory. The index uses open addressing with linear probing and stores the
+    // paths of the files to resolve hash collisions.
+    // The index never changes after it's been built, so it can be used from multiple threads without locking as long
+    // as the tree it was built from doesn't change either.
+    class FileEntryIndex
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(FileEntryIndex, AZ::SystemAllocator, 0);
+
+        explicit FileEntryIndex(FileEntryTree& tree);
+
+        // returns the file with the given path, using the same path comparison as the FileEntryTree, or null if there's no such file
+        FileEntry* Find(AZ::IO::PathView path) const;
+
+        size_t NumFiles() const { return m_numFiles; }
+
+    private:
+        struct Slot
+        {
+            size_t m_hash{};
+            FileEntry* m_fileEntry{}; // null if the slot is empty
+            uint32_t m_pathOffset{};
+            uint32_t m_pathLength{};
+        };
+
+        void Insert(size_t hash, FileEntry* fileEntry, AZStd::string_view path);
+
+        // the number of slots is always a power of two, so the slot for a hash can be found with a mask
+        AZStd::vector<Slot> m_slots;
+        // the paths of all files, stored back to back
+        AZStd::string m_paths;
+        size_t m_numFiles{};
+    };
+}
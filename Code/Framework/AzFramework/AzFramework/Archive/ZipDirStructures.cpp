@@ -18,6 +18,8 @@
 #include <time.h>
 #include <stdlib.h>
 #include <zstd.h>
+#include <zstd_errors.h>
+#include <zdict.h>
 #include <lz4frame.h>
 #include <zlib.h>
 
@@ -314,10 +316,226 @@ namespace AZ::IO::ZipDir::ZipDirStructuresInternal
 
         return memoryBlock;
     }
+
+    // The zstd compression level used when the default level is requested.
+    static constexpr int ZStdCompressionLevel = 1;
+
+    // Archives use the zlib compression levels, so those are mapped on to the zstd range. zstd already matches the ratio of
+    // zlib at its lowest levels while compressing several times faster, so everything up to LEVEL_NORMAL maps to the fast
+    // levels. The slow high levels are only used for LEVEL_BEST, which maps to the strongest level that still decompresses
+    // at full speed.
+    static int GetZStdCompressionLevel(int zlibLevel)
+    {
+        static constexpr int ZStdLevels[] = { 1, 1, 1, 2, 2, 2, 3, 3, 3, ZStdDictionary::MaxCompressionLevel };
+        if (zlibLevel < 0)
+        {
+            return ZStdCompressionLevel;
+        }
+        return ZStdLevels[AZStd::min(zlibLevel, aznumeric_cast<int>(AZ_ARRAY_SIZE(ZStdLevels)) - 1)];
+    }
+
+    // zstd contexts are relatively expensive to create, so every thread that compresses or decompresses keeps its own
+    // around for reuse.
+    struct ZStdContexts
+    {
+        ~ZStdContexts()
+        {
+            ZSTD_freeCCtx(m_compressionContext);
+            ZSTD_freeDCtx(m_decompressionContext);
+        }
+
+        ZSTD_CCtx* GetCompressionContext()
+        {
+            if (!m_compressionContext)
+            {
+                m_compressionContext = ZSTD_createCCtx();
+            }
+            return m_compressionContext;
+        }
+
+        ZSTD_DCtx* GetDecompressionContext()
+        {
+            if (!m_decompressionContext)
+            {
+                m_decompressionContext = ZSTD_createDCtx();
+            }
+            return m_decompressionContext;
+        }
+
+        ZSTD_CCtx* m_compressionContext{};
+        ZSTD_DCtx* m_decompressionContext{};
+    };
+    static thread_local ZStdContexts s_zstdContexts;
+
+    static size_t ZStdDecompress(void* pUncompressed, size_t nDestSize, const void* pCompressed, size_t nSrcSize, const ZStdDictionary* dictionary)
+    {
+        ZSTD_DCtx* context = s_zstdContexts.GetDecompressionContext();
+        if (!context)
+        {
+            return ZSTD_decompress(pUncompressed, nDestSize, pCompressed, nSrcSize);
+        }
+
+        // Only the first frame needs to be checked as all frames of a file are compressed with the same settings.
+        const unsigned dictionaryId = ZSTD_getDictID_fromFrame(pCompressed, nSrcSize);
+        if (dictionaryId == 0)
+        {
+            return ZSTD_decompressDCtx(context, pUncompressed, nDestSize, pCompressed, nSrcSize);
+        }
+        if (!dictionary || dictionary->GetId() != dictionaryId)
+        {
+            AZ_Error("ZipDirStructures", false, "Data was compressed with zstd dictionary %u, but %s.", dictionaryId,
+                dictionary ? "a different dictionary was provided" : "no dictionary was provided");
+            return static_cast<size_t>(-ZSTD_error_dictionary_wrong);
+        }
+        return ZSTD_decompress_usingDDict(context, pUncompressed, nDestSize, pCompressed, nSrcSize, dictionary->GetDecompressionDictionary());
+    }
+
+    // Magic numbers of the zstd seekable format. The seek table is stored in a skippable frame with the first magic number and
+    // ends with the second one.
+    static constexpr uint32_t ZStdSkippableFrameMagic = 0x184D2A5E;
+    static constexpr uint32_t ZStdSeekableMagic = 0x8F92EAB1;
+    static constexpr size_t ZStdSkippableFrameHeaderSize = 8;
+    static constexpr size_t ZStdSeekTableEntrySize = 8;
+    // The seek table descriptor in the footer. Checksums aren't stored and the reserved bits need to be zero.
+    static constexpr uint8_t ZStdSeekTableDescriptor = 0;
+
+    // Values in the seek table are always little endian.
+    static uint8_t* WriteUInt32LE(uint8_t* buffer, uint32_t value)
+    {
+        buffer[0] = static_cast<uint8_t>(value);
+        buffer[1] = static_cast<uint8_t>(value >> 8);
+        buffer[2] = static_cast<uint8_t>(value >> 16);
+        buffer[3] = static_cast<uint8_t>(value >> 24);
+        return buffer + 4;
+    }
+
+    static uint32_t ReadUInt32LE(const uint8_t* buffer)
+    {
+        return static_cast<uint32_t>(buffer[0]) | (static_cast<uint32_t>(buffer[1]) << 8) |
+            (static_cast<uint32_t>(buffer[2]) << 16) | (static_cast<uint32_t>(buffer[3]) << 24);
+    }
 }
 
 namespace AZ::IO::ZipDir
 {
+    ZStdDictionaryPtr ZStdDictionary::Create(const void* data, size_t size)
+    {
+        const uint32_t id = aznumeric_cast<uint32_t>(ZDICT_getDictID(data, size));
+        if (id == 0)
+        {
+            AZ_Error("ZipDirStructures", false, "The provided data isn't a zstd dictionary.");
+            return {};
+        }
+
+        ZStdDictionaryPtr dictionary{ aznew ZStdDictionary };
+        dictionary->m_data.assign(reinterpret_cast<const uint8_t*>(data), reinterpret_cast<const uint8_t*>(data) + size);
+        dictionary->m_id = id;
+        dictionary->m_decompressionDictionary = ZSTD_createDDict(dictionary->m_data.data(), dictionary->m_data.size());
+        if (!dictionary->GetCompressionDictionary(ZipDirStructuresInternal::ZStdCompressionLevel) ||
+            !dictionary->m_decompressionDictionary)
+        {
+            AZ_Error("ZipDirStructures", false, "Unable to create zstd dictionary %u.", id);
+            return {};
+        }
+        return dictionary;
+    }
+
+    ZStdDictionaryPtr ZStdDictionary::Train(const void* samplesBuffer, const size_t* sampleSizes, size_t sampleCount, size_t maxSize)
+    {
+        AZStd::vector<uint8_t> data(maxSize);
+        const size_t result = ZDICT_trainFromBuffer(data.data(), data.size(), samplesBuffer, sampleSizes, aznumeric_cast<unsigned>(sampleCount));
+        if (ZDICT_isError(result))
+        {
+            AZ_Warning("ZipDirStructures", false, "Unable to train zstd dictionary from %zu samples: %s", sampleCount, ZDICT_getErrorName(result));
+            return {};
+        }
+        return Create(data.data(), result);
+    }
+
+    ZStdDictionary::~ZStdDictionary()
+    {
+        for (ZSTD_CDict_s* compressionDictionary : m_compressionDictionaries)
+        {
+            ZSTD_freeCDict(compressionDictionary);
+        }
+        ZSTD_freeDDict(m_decompressionDictionary);
+    }
+
+    const ZSTD_CDict_s* ZStdDictionary::GetCompressionDictionary(int zstdLevel) const
+    {
+        const size_t index = aznumeric_cast<size_t>(AZStd::clamp(zstdLevel, 1, MaxCompressionLevel));
+        AZStd::scoped_lock lock(m_compressionDictionariesMutex);
+        if (!m_compressionDictionaries[index])
+        {
+            m_compressionDictionaries[index] = ZSTD_createCDict(m_data.data(), m_data.size(), aznumeric_cast<int>(index));
+        }
+        return m_compressionDictionaries[index];
+    }
+
+    size_t GetZStdSeekTableSize(size_t frameCount)
+    {
+        using namespace ZipDirStructuresInternal;
+        return ZStdSkippableFrameHeaderSize + frameCount * ZStdSeekTableEntrySize + ZStdSeekTableFooterSize;
+    }
+
+    void WriteZStdSeekTable(void* buffer, const ZStdSeekTableEntry* frames, size_t frameCount)
+    {
+        using namespace ZipDirStructuresInternal;
+
+        uint8_t* output = reinterpret_cast<uint8_t*>(buffer);
+        output = WriteUInt32LE(output, ZStdSkippableFrameMagic);
+        output = WriteUInt32LE(output, aznumeric_cast<uint32_t>(GetZStdSeekTableSize(frameCount) - ZStdSkippableFrameHeaderSize));
+        for (size_t i = 0; i < frameCount; ++i)
+        {
+            output = WriteUInt32LE(output, frames[i].m_compressedSize);
+            output = WriteUInt32LE(output, frames[i].m_uncompressedSize);
+        }
+        output = WriteUInt32LE(output, aznumeric_cast<uint32_t>(frameCount));
+        *output++ = ZStdSeekTableDescriptor;
+        WriteUInt32LE(output, ZStdSeekableMagic);
+    }
+
+    size_t GetZStdSeekTableSizeFromFooter(const void* footer)
+    {
+        using namespace ZipDirStructuresInternal;
+
+        const uint8_t* input = reinterpret_cast<const uint8_t*>(footer);
+        if (ReadUInt32LE(input + 5) != ZStdSeekableMagic || input[4] != ZStdSeekTableDescriptor)
+        {
+            return 0;
+        }
+        return GetZStdSeekTableSize(ReadUInt32LE(input));
+    }
+
+    bool ReadZStdSeekTable(AZStd::vector<ZStdSeekTableEntry>& frames, const void* seekTable, size_t seekTableSize)
+    {
+        using namespace ZipDirStructuresInternal;
+
+        if (seekTableSize < GetZStdSeekTableSize(0))
+        {
+            return false;
+        }
+
+        const uint8_t* input = reinterpret_cast<const uint8_t*>(seekTable);
+        const uint8_t* footer = input + seekTableSize - ZStdSeekTableFooterSize;
+        if (GetZStdSeekTableSizeFromFooter(footer) != seekTableSize ||
+            ReadUInt32LE(input) != ZStdSkippableFrameMagic ||
+            ReadUInt32LE(input + 4) != seekTableSize - ZStdSkippableFrameHeaderSize)
+        {
+            return false;
+        }
+
+        input += ZStdSkippableFrameHeaderSize;
+        frames.resize(ReadUInt32LE(footer));
+        for (ZStdSeekTableEntry& frame : frames)
+        {
+            frame.m_compressedSize = ReadUInt32LE(input);
+            frame.m_uncompressedSize = ReadUInt32LE(input + 4);
+            input += ZStdSeekTableEntrySize;
+        }
+        return true;
+    }
+
 
     //////////////////////////////////////////////////////////////////////////
     void CZipFile::LoadToMemory(AZStd::intrusive_ptr<AZ::IO::MemoryBlock> pData)
@@ -516,14 +734,14 @@ namespace AZ::IO::ZipDir
     // with 2 differences: there are no 16-bit checks, and
     // it initializes the inflation to start without waiting for compression method byte, as this is the
     // way it's stored into zip file
-    int ZipRawUncompress(void* pUncompressed, size_t* pDestSize, const void* pCompressed, size_t nSrcSize)
+    int ZipRawUncompress(void* pUncompressed, size_t* pDestSize, const void* pCompressed, size_t nSrcSize, const ZStdDictionary* dictionary)
     {
         int nReturnCode = Z_OK;
 
         //check first 4 bytes to see what compression codec was used
         if (CompressionCodec::TestForZSTDMagic(pCompressed))
         {
-            size_t result = ZSTD_decompress(pUncompressed, *pDestSize, pCompressed, nSrcSize);
+            size_t result = ZipDirStructuresInternal::ZStdDecompress(pUncompressed, *pDestSize, pCompressed, nSrcSize, dictionary);
 
             if (ZSTD_isError(result))
             {
@@ -614,9 +832,26 @@ namespace AZ::IO::ZipDir
         return err;
     }
 
-    int ZipRawCompressZSTD(const void* pUncompressed, size_t* pDestSize, void* pCompressed, size_t nSrcSize, [[maybe_unused]] int nLevel)
+    int ZipRawCompressZSTD(const void* pUncompressed, size_t* pDestSize, void* pCompressed, size_t nSrcSize, int nLevel, const ZStdDictionary* dictionary)
     {
-        size_t result = ZSTD_compress(pCompressed, *pDestSize, pUncompressed, nSrcSize, 1);
+        using namespace ZipDirStructuresInternal;
+
+        const int zstdLevel = GetZStdCompressionLevel(nLevel);
+        size_t result;
+        ZSTD_CCtx* context = s_zstdContexts.GetCompressionContext();
+        const ZSTD_CDict_s* compressionDictionary = dictionary ? dictionary->GetCompressionDictionary(zstdLevel) : nullptr;
+        if (!context || (dictionary && !compressionDictionary))
+        {
+            result = static_cast<size_t>(-ZSTD_error_memory_allocation);
+        }
+        else if (compressionDictionary)
+        {
+            result = ZSTD_compress_usingCDict(context, pCompressed, *pDestSize, pUncompressed, nSrcSize, compressionDictionary);
+        }
+        else
+        {
+            result = ZSTD_compressCCtx(context, pCompressed, *pDestSize, pUncompressed, nSrcSize, zstdLevel);
+        }
 
         int err = Z_OK;
 
@@ -876,6 +1111,10 @@ namespace AZ::IO::ZipDir
         this->desc.lCRC32 = AZ::Crc32(pUncompressed, nSize);
 
         this->nMethod = static_cast<uint16_t>(nCompressionMethod);
+
+        // the seek table of the previous data no longer applies, the new data has one only if the writer sets it
+        this->m_seekPoints.reset();
+        this->m_seekPointsLoaded = true;
     }
 
     uint64_t FileEntry::GetModificationTime()
@@ -13,9 +13,16 @@
 #pragma once
 
 #include <AzCore/base.h>
+#include <AzCore/IO/CompressionBus.h>
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/IO/SystemFile.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/intrusive_base.h>
 #include <AzCore/std/smart_ptr/intrusive_ptr.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <AzFramework/Archive/ZipFileFormat.h>
 
 #if AZ_TRAIT_USE_WINDOWS_FILE_API && AZ_TRAIT_OS_IS_HOST_OS_PLATFORM
@@ -24,6 +31,8 @@
 
 
 struct z_stream_s;
+struct ZSTD_CDict_s;
+struct ZSTD_DDict_s;
 
 namespace AZ::IO
 {
@@ -143,14 +152,90 @@ namespace AZ::IO::ZipDir
         FullValidation,
     };
 
+    // A trained zstd dictionary. An archive stores its dictionary uncompressed in a reserved entry and uses it for all
+    // files it compresses with zstd. Small files that share a lot of structure, such as json files and materials, compress
+    // considerably better with a dictionary than on their own.
+    class ZStdDictionary
+        : public AZStd::intrusive_base
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(ZStdDictionary, AZ::SystemAllocator, 0);
+
+        // name of the archive entry the dictionary is stored in
+        inline static constexpr AZStd::string_view ArchiveFileName = "$zstd.dictionary";
+        // the maximum size of a trained dictionary, same as the default of the zstd command line tool
+        inline static constexpr size_t DefaultMaxSize = 112 * 1024;
+
+        // Creates a dictionary from previously trained data. Returns null if the data isn't a zstd dictionary.
+        static AZStd::intrusive_ptr<ZStdDictionary> Create(const void* data, size_t size);
+        // Trains a dictionary from samples that are stored back to back in samplesBuffer. Returns null if training failed,
+        // which happens for instance when there aren't enough samples.
+        static AZStd::intrusive_ptr<ZStdDictionary> Train(const void* samplesBuffer, const size_t* sampleSizes, size_t sampleCount,
+            size_t maxSize = DefaultMaxSize);
+
+        ~ZStdDictionary();
+
+        // the id zstd stores in every frame that's compressed with this dictionary
+        uint32_t GetId() const { return m_id; }
+        const AZStd::vector<uint8_t>& GetData() const { return m_data; }
+
+        // Returns the dictionary prepared for the given zstd compression level. The dictionary for a level is created
+        // the first time it's requested. Returns null if the dictionary couldn't be created.
+        const ZSTD_CDict_s* GetCompressionDictionary(int zstdLevel) const;
+        const ZSTD_DDict_s* GetDecompressionDictionary() const { return m_decompressionDictionary; }
+
+        // the highest zstd compression level that's used for archives
+        inline static constexpr int MaxCompressionLevel = 19;
+
+    private:
+        ZStdDictionary() = default;
+
+        AZStd::vector<uint8_t> m_data;
+        // Compression dictionaries indexed by compression level. Preparing a dictionary is expensive, so only the
+        // levels that are actually used are created.
+        mutable AZStd::array<ZSTD_CDict_s*, MaxCompressionLevel + 1> m_compressionDictionaries{};
+        mutable AZStd::mutex m_compressionDictionariesMutex;
+        ZSTD_DDict_s* m_decompressionDictionary{};
+        uint32_t m_id{};
+    };
+    using ZStdDictionaryPtr = AZStd::intrusive_ptr<ZStdDictionary>;
+
+    // zstd compressed files larger than this are split into independent frames so they can be compressed in parallel.
+    // The frames are stored back to back, which zstd decompresses as if it was a single frame.
+    inline constexpr size_t ZStdFrameSize = 1024 * 1024;
+
+    // Files that are split into multiple zstd frames end with a seek table in the zstd seekable format. The seek table is
+    // stored in a skippable frame, so it's ignored when the file is decompressed as a whole, but it allows a range of the
+    // file to be decompressed by only decompressing the frames that overlap the range.
+    struct ZStdSeekTableEntry
+    {
+        uint32_t m_compressedSize{};
+        uint32_t m_uncompressedSize{};
+    };
+
+    // the footer is stored at the very end of the seek table and stores the number of frames
+    inline constexpr size_t ZStdSeekTableFooterSize = 9;
+
+    // returns the size in bytes of the seek table for the given number of frames, including the skippable frame header
+    size_t GetZStdSeekTableSize(size_t frameCount);
+    // writes the seek table for the frames into the buffer, which needs to be at least GetZStdSeekTableSize(frameCount) bytes
+    void WriteZStdSeekTable(void* buffer, const ZStdSeekTableEntry* frames, size_t frameCount);
+    // returns the size of the entire seek table, based on the last ZStdSeekTableFooterSize bytes of a file, or 0 if the file
+    // doesn't end with a seek table
+    size_t GetZStdSeekTableSizeFromFooter(const void* footer);
+    // reads the frames from a complete seek table. Returns false if the data isn't a valid seek table.
+    bool ReadZStdSeekTable(AZStd::vector<ZStdSeekTableEntry>& frames, const void* seekTable, size_t seekTableSize);
+
     // Uncompresses raw (without wrapping) data that is compressed with method 8 (deflated) in the Zip file
     // returns one of the Z_* errors (Z_OK upon success)
-    int ZipRawUncompress(void* pUncompressed, size_t* pDestSize, const void* pCompressed, size_t nSrcSize);
+    // zstd data that was compressed with a dictionary can only be uncompressed if that dictionary is provided.
+    int ZipRawUncompress(void* pUncompressed, size_t* pDestSize, const void* pCompressed, size_t nSrcSize, const ZStdDictionary* dictionary = nullptr);
 
     // compresses the raw data into raw data. The buffer for compressed data itself with the heap passed. Uses method 8 (deflate)
     // returns one of the Z_* errors (Z_OK upon success), and the size in *pDestSize. the pCompressed buffer must be at least nSrcSize*1.001+12 size
     int ZipRawCompress(const void* pUncompressed, size_t* pDestSize, void* pCompressed, size_t nSrcSize, int nLevel);
-    int ZipRawCompressZSTD(const void* pUncompressed, size_t* pDestSize, void* pCompressed, size_t nSrcSize, int nLevel);
+    // nLevel uses the same 0-9 range as zlib, or -1 for the default level, and is mapped to the matching zstd level.
+    int ZipRawCompressZSTD(const void* pUncompressed, size_t* pDestSize, void* pCompressed, size_t nSrcSize, int nLevel, const ZStdDictionary* dictionary = nullptr);
     int ZipRawCompressLZ4(const void* pUncompressed, size_t* pDestSize, void* pCompressed, size_t nSrcSize, int nLevel);
 
     // fseek wrapper with memory in file support.
@@ -207,6 +292,12 @@ namespace AZ::IO::ZipDir
         // mutex that can be used to product reads for the current file entry
         AZStd::mutex m_readLock;
 
+        // the seek points of a file that's split into multiple zstd frames, loaded the first time they're requested or when the
+        // file is written and protected by m_readLock
+        AZStd::shared_ptr<const AZ::IO::CompressionSeekPoints> m_seekPoints;
+        // whether m_seekPoints is up to date, protected by m_readLock
+        bool m_seekPointsLoaded{};
+
         using FileEntryBase::FileEntryBase;
 
         FileEntry(const FileEntry&) = delete;
@@ -9,6 +9,7 @@
 #include "TerrainDataRequestBus.h"
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/Casting/numeric_cast.h>
 
 namespace AzFramework::Terrain
 {
@@ -37,4 +38,157 @@ namespace AzFramework::Terrain
         }
 
     }
+
+    AZStd::pair<size_t, size_t> TerrainDataRequests::GetNumSamplesFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2& stepSize)
+    {
+        if (!inRegion.IsValid() || (stepSize.GetX() <= 0.0f) || (stepSize.GetY() <= 0.0f))
+        {
+            return { 0, 0 };
+        }
+
+        const size_t numSamplesX = aznumeric_cast<size_t>((inRegion.GetMax().GetX() - inRegion.GetMin().GetX()) / stepSize.GetX());
+        const size_t numSamplesY = aznumeric_cast<size_t>((inRegion.GetMax().GetY() - inRegion.GetMin().GetY()) / stepSize.GetY());
+        return { numSamplesX, numSamplesY };
+    }
+
+    void TerrainDataRequests::ProcessHeightsFromList(
+        const AZStd::vector<AZ::Vector3>& inPositions, SurfacePointListFillCallback perPositionCallback, Sampler sampleFilter) const
+    {
+        if (!perPositionCallback)
+        {
+            return;
+        }
+
+        SurfaceData::SurfacePoint surfacePoint;
+        for (const AZ::Vector3& position : inPositions)
+        {
+            bool terrainExists = false;
+            const float height = GetHeightFromFloats(position.GetX(), position.GetY(), sampleFilter, &terrainExists);
+            surfacePoint.m_position.Set(position.GetX(), position.GetY(), height);
+            perPositionCallback(surfacePoint, terrainExists);
+        }
+    }
+
+    void TerrainDataRequests::ProcessNormalsFromList(
+        const AZStd::vector<AZ::Vector3>& inPositions, SurfacePointListFillCallback perPositionCallback, Sampler sampleFilter) const
+    {
+        if (!perPositionCallback)
+        {
+            return;
+        }
+
+        SurfaceData::SurfacePoint surfacePoint;
+        for (const AZ::Vector3& position : inPositions)
+        {
+            bool terrainExists = false;
+            surfacePoint.m_position = position;
+            surfacePoint.m_normal = GetNormalFromFloats(position.GetX(), position.GetY(), sampleFilter, &terrainExists);
+            perPositionCallback(surfacePoint, terrainExists);
+        }
+    }
+
+    void TerrainDataRequests::ProcessSurfaceWeightsFromList(
+        const AZStd::vector<AZ::Vector3>& inPositions, SurfacePointListFillCallback perPositionCallback, Sampler sampleFilter) const
+    {
+        if (!perPositionCallback)
+        {
+            return;
+        }
+
+        SurfaceData::SurfacePoint surfacePoint;
+        for (const AZ::Vector3& position : inPositions)
+        {
+            bool terrainExists = false;
+            surfacePoint.m_position = position;
+            GetSurfaceWeightsFromFloats(position.GetX(), position.GetY(), surfacePoint.m_surfaceTags, sampleFilter, &terrainExists);
+            perPositionCallback(surfacePoint, terrainExists);
+        }
+    }
+
+    void TerrainDataRequests::ProcessSurfacePointsFromList(
+        const AZStd::vector<AZ::Vector3>& inPositions, SurfacePointListFillCallback perPositionCallback, Sampler sampleFilter) const
+    {
+        if (!perPositionCallback)
+        {
+            return;
+        }
+
+        SurfaceData::SurfacePoint surfacePoint;
+        for (const AZ::Vector3& position : inPositions)
+        {
+            bool terrainExists = false;
+            GetSurfacePointFromFloats(position.GetX(), position.GetY(), surfacePoint, sampleFilter, &terrainExists);
+            perPositionCallback(surfacePoint, terrainExists);
+        }
+    }
+
+    namespace
+    {
+        using ListQueryFn = void (TerrainDataRequests::*)(
+            const AZStd::vector<AZ::Vector3>&, TerrainDataRequests::SurfacePointListFillCallback, TerrainDataRequests::Sampler) const;
+
+        // Runs one of the list queries over the grid of positions in a region, and maps the results back to columns and rows.
+        void ProcessRegion(
+            const TerrainDataRequests& terrain,
+            ListQueryFn listQuery,
+            const AZ::Aabb& inRegion,
+            const AZ::Vector2& stepSize,
+            TerrainDataRequests::SurfacePointRegionFillCallback& perPositionCallback,
+            TerrainDataRequests::Sampler sampleFilter)
+        {
+            if (!perPositionCallback)
+            {
+                return;
+            }
+
+            const auto [numSamplesX, numSamplesY] = TerrainDataRequests::GetNumSamplesFromRegion(inRegion, stepSize);
+
+            AZStd::vector<AZ::Vector3> inPositions;
+            inPositions.reserve(numSamplesX * numSamplesY);
+            for (size_t y = 0; y < numSamplesY; y++)
+            {
+                const float fy = inRegion.GetMin().GetY() + (y * stepSize.GetY());
+                for (size_t x = 0; x < numSamplesX; x++)
+                {
+                    const float fx = inRegion.GetMin().GetX() + (x * stepSize.GetX());
+                    inPositions.emplace_back(fx, fy, inRegion.GetMin().GetZ());
+                }
+            }
+
+            // The list queries call back in the order of the input positions, so the sample index can just be counted.
+            size_t index = 0;
+            (terrain.*listQuery)(
+                inPositions,
+                [&index, numSamplesX = numSamplesX, &perPositionCallback](const SurfaceData::SurfacePoint& surfacePoint, bool terrainExists)
+                {
+                    perPositionCallback(index % numSamplesX, index / numSamplesX, surfacePoint, terrainExists);
+                    index++;
+                },
+                sampleFilter);
+        }
+    } // namespace
+
+    void TerrainDataRequests::ProcessHeightsFromRegion(
+        const AZ::Aabb& inRegion, const AZ::Vector2& stepSize, SurfacePointRegionFillCallback perPositionCallback, Sampler sampleFilter) const
+    {
+        ProcessRegion(*this, &TerrainDataRequests::ProcessHeightsFromList, inRegion, stepSize, perPositionCallback, sampleFilter);
+    }
+
+    void TerrainDataRequests::ProcessNormalsFromRegion(
+        const AZ::Aabb& inRegion, const AZ::Vector2& stepSize, SurfacePointRegionFillCallback perPositionCallback, Sampler sampleFilter) const
+    {
+        ProcessRegion(*this, &TerrainDataRequests::ProcessNormalsFromList, inRegion, stepSize, perPositionCallback, sampleFilter);
+    }
+
+    void TerrainDataRequests::ProcessSurfaceWeightsFromRegion(
+        const AZ::Aabb& inRegion, const AZ::Vector2& stepSize, SurfacePointRegionFillCallback perPositionCallback, Sampler sampleFilter) const
+    {
+        ProcessRegion(*this, &TerrainDataRequests::ProcessSurfaceWeightsFromList, inRegion, stepSize, perPositionCallback, sampleFilter);
+    }
+
+    void TerrainDataRequests::ProcessSurfacePointsFromRegion(
+        const AZ::Aabb& inRegion, const AZ::Vector2& stepSize, SurfacePointRegionFillCallback perPositionCallback, Sampler sampleFilter) const
+    {
+        ProcessRegion(*this, &TerrainDataRequests::ProcessSurfacePointsFromList, inRegion, stepSize, perPositionCallback, sampleFilter);
+    }
 } // namespace AzFramework::Terrain
@@ -11,6 +11,9 @@
 #include <AzCore/Math/Vector2.h>
 #include <AzCore/Math/Vector3.h>
 #include <AzCore/Math/Aabb.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/utils.h>
 #include <AzFramework/SurfaceData/SurfaceData.h>
 
 namespace AzFramework
@@ -130,6 +133,67 @@ namespace AzFramework
                 SurfaceData::SurfacePoint& outSurfacePoint,
                 Sampler sampleFilter = Sampler::DEFAULT,
                 bool* terrainExistsPtr = nullptr) const = 0;
+
+            //! Callback for the list queries. It's called once per input position, in the same order as the input positions.
+            //! Only the fields of the surface point that the query computes are filled in, see the query functions below.
+            using SurfacePointListFillCallback =
+                AZStd::function<void(const SurfaceData::SurfacePoint& surfacePoint, bool terrainExists)>;
+            //! Callback for the region queries. It's called once per sample, with the column and row of the sample in the region.
+            using SurfacePointRegionFillCallback =
+                AZStd::function<void(size_t xIndex, size_t yIndex, const SurfaceData::SurfacePoint& surfacePoint, bool terrainExists)>;
+
+            //! Batched versions of the queries above for a list of positions, which ignore the input Z values.
+            //! These give the same results as calling the per-position queries, but let the terrain system share the work
+            //! between positions, so they should be preferred whenever more than a few positions are needed.
+            //! ProcessHeightsFromList fills in the position, with the terrain height as Z.
+            //! ProcessNormalsFromList fills in the normal, and the input position.
+            //! ProcessSurfaceWeightsFromList fills in the surface tags, and the input position.
+            //! ProcessSurfacePointsFromList fills in all the fields of the surface point.
+            //! The default implementations call the per-position queries.
+            virtual void ProcessHeightsFromList(
+                const AZStd::vector<AZ::Vector3>& inPositions,
+                SurfacePointListFillCallback perPositionCallback,
+                Sampler sampleFilter = Sampler::DEFAULT) const;
+            virtual void ProcessNormalsFromList(
+                const AZStd::vector<AZ::Vector3>& inPositions,
+                SurfacePointListFillCallback perPositionCallback,
+                Sampler sampleFilter = Sampler::DEFAULT) const;
+            virtual void ProcessSurfaceWeightsFromList(
+                const AZStd::vector<AZ::Vector3>& inPositions,
+                SurfacePointListFillCallback perPositionCallback,
+                Sampler sampleFilter = Sampler::DEFAULT) const;
+            virtual void ProcessSurfacePointsFromList(
+                const AZStd::vector<AZ::Vector3>& inPositions,
+                SurfacePointListFillCallback perPositionCallback,
+                Sampler sampleFilter = Sampler::DEFAULT) const;
+
+            //! Batched versions of the queries above for a grid of positions covering a region.
+            //! The region is sampled at (min + index * stepSize) for each column and row given by GetNumSamplesFromRegion,
+            //! and the samples are returned row by row. The fields that are filled in match the list versions.
+            //! The default implementations call the list versions.
+            virtual void ProcessHeightsFromRegion(
+                const AZ::Aabb& inRegion,
+                const AZ::Vector2& stepSize,
+                SurfacePointRegionFillCallback perPositionCallback,
+                Sampler sampleFilter = Sampler::DEFAULT) const;
+            virtual void ProcessNormalsFromRegion(
+                const AZ::Aabb& inRegion,
+                const AZ::Vector2& stepSize,
+                SurfacePointRegionFillCallback perPositionCallback,
+                Sampler sampleFilter = Sampler::DEFAULT) const;
+            virtual void ProcessSurfaceWeightsFromRegion(
+                const AZ::Aabb& inRegion,
+                const AZ::Vector2& stepSize,
+                SurfacePointRegionFillCallback perPositionCallback,
+                Sampler sampleFilter = Sampler::DEFAULT) const;
+            virtual void ProcessSurfacePointsFromRegion(
+                const AZ::Aabb& inRegion,
+                const AZ::Vector2& stepSize,
+                SurfacePointRegionFillCallback perPositionCallback,
+                Sampler sampleFilter = Sampler::DEFAULT) const;
+
+            //! Returns the number of columns and rows of samples that the region queries use for the given region and step size.
+            static AZStd::pair<size_t, size_t> GetNumSamplesFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2& stepSize);
         };
         using TerrainDataRequestBus = AZ::EBus<TerrainDataRequests>;
 
@@ -94,8 +94,9 @@ namespace AzFramework
             IVisibilitySystem* visibilitySystem = AZ::Interface<IVisibilitySystem>::Get();
             if (visibilitySystem && !worldEntityBoundsUnion.IsClose(instance.m_visibilityEntry.m_boundingVolume))
             {
+                // entities move a lot, so queue the update to apply all of them at once instead of locking the scene for each one
                 instance.m_visibilityEntry.m_boundingVolume = worldEntityBoundsUnion;
-                visibilitySystem->GetDefaultVisibilityScene()->InsertOrUpdateEntry(instance.m_visibilityEntry);
+                visibilitySystem->GetDefaultVisibilityScene()->QueueInsertOrUpdateEntry(instance.m_visibilityEntry);
             }
         }
     }
@@ -163,6 +164,12 @@ namespace AzFramework
 
         // clear dirty entities once the visibility system has been updated
         m_entityBoundsDirty.clear();
+
+        // apply the queued bounds of all entities that changed, so the visibility system is up to date once this returns
+        if (IVisibilitySystem* visibilitySystem = AZ::Interface<IVisibilitySystem>::Get())
+        {
+            visibilitySystem->GetDefaultVisibilityScene()->ProcessQueuedEntries();
+        }
     }
 
     void EntityVisibilityBoundsUnionSystem::OnTransformUpdated(AZ::Entity* entity)
@@ -53,6 +53,9 @@ namespace AzFramework
         m_octreeDebug.Clear();
         m_visibleEntityIds.clear();
 
+        // entities that moved since the last tick only queued their new bounds, apply them so the query doesn't see stale positions
+        visSystem->GetDefaultVisibilityScene()->ProcessQueuedEntries();
+
         visSystem->GetDefaultVisibilityScene()->Enumerate(
             viewFrustum,
             [&viewFrustum, &visibleEntityIdsOut = m_visibleEntityIds,
@@ -72,6 +72,19 @@ namespace AzFramework
         //! @param visibilityEntry data for the object being added/updated
         virtual void InsertOrUpdateEntry(VisibilityEntry& visibilityEntry) = 0;
 
+        //! Queue an insert or update of an entry, to be applied together with all other queued entries.
+        //! Queueing doesn't lock the spatial hash, so many threads can queue entries without waiting on each other or on queries.
+        //! The bounding volume of the entry is read when the queue is processed, so the entry has to stay alive until it's
+        //! either processed or removed with RemoveEntry.
+        //! Queued entries are only applied by ProcessQueuedEntries and RemoveEntry, enumerations see the entries as they were
+        //! before they were queued.
+        //! @param visibilityEntry data for the object being added/updated
+        virtual void QueueInsertOrUpdateEntry(VisibilityEntry& visibilityEntry) = 0;
+
+        //! Apply all entries queued with QueueInsertOrUpdateEntry.
+        //! This is intended to be called once per frame, at a point where the queued entries are no longer being changed.
+        virtual void ProcessQueuedEntries() = 0;
+
         //! Removes an entry from the visibility system.
         //! @param visibilityEntry data for the object being removed
         virtual void RemoveEntry(VisibilityEntry& visibilityEntry) = 0;
@@ -94,11 +107,17 @@ namespace AzFramework
         //! @return the intersection result of the frustum against the visibility system
         virtual void Enumerate(const AZ::Frustum& frustum, const EnumerateCallback& callback) const = 0;
 
+        //! Intersects a frustum against the visibility system, splitting the work across the task graph when it's active.
+        //! The same nodes are visited as with Enumerate, but in no particular order.
+        //! @param frustum the frustum to test against
+        //! @param callback the callback to invoke when a node is visible, which may be invoked from multiple threads at the same time
+        virtual void EnumerateParallel(const AZ::Frustum& frustum, const EnumerateCallback& callback) const = 0;
+
         //! Enumerate *all* OctreeNodes that have any entries in them (without any culling).
         //! @param callback the callback to invoke when a node is visible
         virtual void EnumerateNoCull(const EnumerateCallback& callback) const = 0;
 
-        //! Return the number of VisibilityEntries that have been added to the system
+        //! Return the number of VisibilityEntries that have been added to the system, not counting new entries that are still queued
         virtual uint32_t GetEntryCount() const = 0;
     };
 
@@ -7,8 +7,16 @@
  */
 
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Interface/Interface.h>
 #include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/Math/SimdMath.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
+#include <AzCore/std/sort.h>
+
+AZ_DECLARE_BUDGET(AzFramework);
 
 namespace AzFramework
 {
@@ -16,6 +24,7 @@ namespace AzFramework
     AZ_CVAR(float,    bg_octreeMaxWorldExtents, 16384.0f, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum supported world size by the world octreeSystemComponent");
     AZ_CVAR(uint32_t, bg_octreeNodeMaxEntries,        64, nullptr, AZ::ConsoleFunctorFlags::Null, "Maximum number of entries to allow in any node before forcing a split");
     AZ_CVAR(uint32_t, bg_octreeNodeMinEntries,        32, nullptr, AZ::ConsoleFunctorFlags::Null, "Minimum number of entries to allow in a node resulting from a merge operation");
+    AZ_CVAR(uint32_t, bg_octreeParallelUpdateMinEntries, 1024, nullptr, AZ::ConsoleFunctorFlags::Null, "Minimum number of queued entries before the octree looks up their destination nodes in parallel");
 
     static uint32_t GetChildNodeCount()
     {
@@ -24,6 +33,35 @@ namespace AzFramework
         return (bg_octreeUseQuadtree) ? QuadtreeNodeChildCount : OctreeNodeChildCount;
     }
 
+    //! The planes of a frustum with each component splatted across a SIMD register, so four child nodes can be tested at once.
+    struct OctreeNode::FrustumPlanes
+    {
+        explicit FrustumPlanes(const AZ::Frustum& frustum)
+        {
+            for (AZ::Frustum::PlaneId planeId = AZ::Frustum::PlaneId::Near; planeId < AZ::Frustum::PlaneId::MAX; ++planeId)
+            {
+                const AZ::Plane plane = frustum.GetPlane(planeId);
+                const AZ::Vector3 normal = plane.GetNormal();
+                const AZ::Vector3 absNormal = normal.GetAbs();
+                m_normalX[planeId] = AZ::Simd::Vec4::Splat(normal.GetX());
+                m_normalY[planeId] = AZ::Simd::Vec4::Splat(normal.GetY());
+                m_normalZ[planeId] = AZ::Simd::Vec4::Splat(normal.GetZ());
+                m_distance[planeId] = AZ::Simd::Vec4::Splat(plane.GetDistance());
+                m_absNormalX[planeId] = AZ::Simd::Vec4::Splat(absNormal.GetX());
+                m_absNormalY[planeId] = AZ::Simd::Vec4::Splat(absNormal.GetY());
+                m_absNormalZ[planeId] = AZ::Simd::Vec4::Splat(absNormal.GetZ());
+            }
+        }
+
+        AZ::Simd::Vec4::FloatType m_normalX[AZ::Frustum::PlaneId::MAX];
+        AZ::Simd::Vec4::FloatType m_normalY[AZ::Frustum::PlaneId::MAX];
+        AZ::Simd::Vec4::FloatType m_normalZ[AZ::Frustum::PlaneId::MAX];
+        AZ::Simd::Vec4::FloatType m_distance[AZ::Frustum::PlaneId::MAX];
+        AZ::Simd::Vec4::FloatType m_absNormalX[AZ::Frustum::PlaneId::MAX];
+        AZ::Simd::Vec4::FloatType m_absNormalY[AZ::Frustum::PlaneId::MAX];
+        AZ::Simd::Vec4::FloatType m_absNormalZ[AZ::Frustum::PlaneId::MAX];
+    };
+
     OctreeNode::OctreeNode(const AZ::Aabb& bounds)
         : m_bounds(bounds)
     {
@@ -34,6 +72,7 @@ namespace AzFramework
         : m_bounds(rhs.m_bounds)
         , m_parent(rhs.m_parent)
         , m_children(rhs.m_children)
+        , m_childBounds(AZStd::move(rhs.m_childBounds))
         , m_entries(AZStd::move(rhs.m_entries))
     {
         // Correct internal node pointers
@@ -48,6 +87,7 @@ namespace AzFramework
         m_bounds = rhs.m_bounds;
         m_parent = rhs.m_parent;
         m_children = rhs.m_children;
+        m_childBounds = AZStd::move(rhs.m_childBounds);
         m_entries = AZStd::move(rhs.m_entries);
 
         // Correct internal node pointers
@@ -145,6 +185,47 @@ namespace AzFramework
         }
     }
 
+    const OctreeNode* OctreeNode::FindUpdateDestination(const AZ::Aabb& boundingVolume) const
+    {
+        // Matches the early out in Update
+        if (IsLeaf() && AZ::ShapeIntersection::Contains(m_bounds, boundingVolume))
+        {
+            return this;
+        }
+
+        const OctreeNode* insertCheck = this;
+        while (insertCheck->m_parent != nullptr && !AZ::ShapeIntersection::Contains(insertCheck->m_bounds, boundingVolume))
+        {
+            insertCheck = insertCheck->m_parent;
+        }
+        return insertCheck->FindInsertDestination(boundingVolume);
+    }
+
+    const OctreeNode* OctreeNode::FindInsertDestination(const AZ::Aabb& boundingVolume) const
+    {
+        const OctreeNode* node = this;
+        const uint32_t childCount = GetChildNodeCount();
+        while (node->m_children != nullptr)
+        {
+            const OctreeNode* containingChild = nullptr;
+            for (uint32_t child = 0; child < childCount; ++child)
+            {
+                if (AZ::ShapeIntersection::Contains(node->m_children[child].m_bounds, boundingVolume))
+                {
+                    containingChild = &node->m_children[child];
+                    break;
+                }
+            }
+
+            if (containingChild == nullptr)
+            {
+                break;
+            }
+            node = containingChild;
+        }
+        return node;
+    }
+
     void OctreeNode::Enumerate(const AZ::Aabb& aabb, const IVisibilityScene::EnumerateCallback& callback) const
     {
         if (AZ::ShapeIntersection::Overlaps(aabb, m_bounds))
@@ -165,7 +246,106 @@ namespace AzFramework
     {
         if (AZ::ShapeIntersection::Overlaps(frustum, m_bounds))
         {
-            EnumerateHelper(frustum, callback);
+            if (AZ::ShapeIntersection::Contains(frustum, m_bounds))
+            {
+                EnumerateNoCull(callback);
+            }
+            else
+            {
+                EnumerateHelper(FrustumPlanes(frustum), callback);
+            }
+        }
+    }
+
+    void OctreeNode::EnumerateParallel(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        if (!AZ::ShapeIntersection::Overlaps(frustum, m_bounds))
+        {
+            return;
+        }
+
+        struct Subtree
+        {
+            const OctreeNode* m_node;
+            bool m_contained; //< The subtree is fully inside the frustum, so its nodes don't need to be tested
+        };
+
+        // Split the visible part of the tree into enough subtrees to keep the workers busy even if the subtrees are uneven.
+        // The nodes above the subtrees are enumerated while splitting.
+        constexpr size_t MinSubtreeCount = 64;
+        const FrustumPlanes frustumPlanes(frustum);
+        const uint32_t childCount = GetChildNodeCount();
+        const uint32_t allChildrenMask = (1u << childCount) - 1;
+        AZStd::vector<Subtree> subtrees{ { this, AZ::ShapeIntersection::Contains(frustum, m_bounds) } };
+        AZStd::vector<Subtree> nextSubtrees;
+        bool splitSubtree = true;
+        while (splitSubtree && subtrees.size() < MinSubtreeCount)
+        {
+            splitSubtree = false;
+            nextSubtrees.clear();
+            for (const Subtree& subtree : subtrees)
+            {
+                const OctreeNode* node = subtree.m_node;
+                if (node->IsLeaf())
+                {
+                    nextSubtrees.push_back(subtree);
+                    continue;
+                }
+
+                splitSubtree = true;
+                if (!node->m_entries.empty())
+                {
+                    callback({node->m_bounds, node->m_entries});
+                }
+
+                uint32_t overlapMask = allChildrenMask;
+                uint32_t containMask = allChildrenMask;
+                if (!subtree.m_contained)
+                {
+                    node->ClassifyChildren(frustumPlanes, overlapMask, containMask);
+                }
+                for (uint32_t child = 0; child < childCount; ++child)
+                {
+                    if (overlapMask & (1u << child))
+                    {
+                        nextSubtrees.push_back({ &node->m_children[child], (containMask & (1u << child)) != 0 });
+                    }
+                }
+            }
+            AZStd::swap(subtrees, nextSubtrees);
+        }
+
+        auto enumerateSubtrees = [&subtrees, &frustumPlanes, &callback](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                if (subtrees[i].m_contained)
+                {
+                    subtrees[i].m_node->EnumerateNoCull(callback);
+                }
+                else
+                {
+                    subtrees[i].m_node->EnumerateHelper(frustumPlanes, callback);
+                }
+            }
+        };
+
+        auto taskGraphActive = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        if (subtrees.size() > 1 && taskGraphActive != nullptr && taskGraphActive->IsTaskGraphActive() &&
+            !AZ::TaskExecutor::Instance().IsTaskWorkerThread())
+        {
+            AZ::TaskDescriptor descriptor{ "AzFramework::OctreeNode::EnumerateParallel", "AzFramework" };
+            descriptor.grainSize = 1;
+
+            AZ::TaskGraph graph;
+            graph.AddParallelFor(descriptor, 0, subtrees.size(), enumerateSubtrees);
+            AZ::TaskGraphEvent finished;
+            graph.Submit(&finished);
+            finished.Wait();
+        }
+        else
+        {
+            enumerateSubtrees(0, subtrees.size());
         }
     }
 
@@ -255,6 +435,86 @@ namespace AzFramework
         }
     }
 
+    void OctreeNode::EnumerateHelper(const FrustumPlanes& frustum, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        // Invoke the callback for the current node
+        if (!m_entries.empty())
+        {
+            callback({m_bounds, m_entries});
+        }
+
+        if (m_children != nullptr)
+        {
+            // If this is not a leaf node, recurse into the children, skipping any further tests for children fully inside the frustum
+            uint32_t overlapMask;
+            uint32_t containMask;
+            ClassifyChildren(frustum, overlapMask, containMask);
+
+            const uint32_t childCount = GetChildNodeCount();
+            for (uint32_t child = 0; child < childCount; ++child)
+            {
+                if (containMask & (1u << child))
+                {
+                    m_children[child].EnumerateNoCull(callback);
+                }
+                else if (overlapMask & (1u << child))
+                {
+                    m_children[child].EnumerateHelper(frustum, callback);
+                }
+            }
+        }
+    }
+
+    void OctreeNode::ClassifyChildren(const FrustumPlanes& frustum, uint32_t& overlapMask, uint32_t& containMask) const
+    {
+        using AZ::Simd::Vec4;
+        AZ_Assert(m_childBounds != nullptr, "ClassifyChildren invoked on an octreeScene node that does not have children");
+
+        overlapMask = 0;
+        containMask = 0;
+        const Vec4::FloatType zero = Vec4::ZeroFloat();
+        const uint32_t childCount = GetChildNodeCount();
+        for (uint32_t firstChild = 0; firstChild < childCount; firstChild += Vec4::ElementCount)
+        {
+            const Vec4::FloatType centerX = Vec4::LoadAligned(&m_childBounds->m_centerX[firstChild]);
+            const Vec4::FloatType centerY = Vec4::LoadAligned(&m_childBounds->m_centerY[firstChild]);
+            const Vec4::FloatType centerZ = Vec4::LoadAligned(&m_childBounds->m_centerZ[firstChild]);
+            const Vec4::FloatType extentX = Vec4::LoadAligned(&m_childBounds->m_extentX[firstChild]);
+            const Vec4::FloatType extentY = Vec4::LoadAligned(&m_childBounds->m_extentY[firstChild]);
+            const Vec4::FloatType extentZ = Vec4::LoadAligned(&m_childBounds->m_extentZ[firstChild]);
+
+            // Same tests as ShapeIntersection::Overlaps and ShapeIntersection::Contains for an Aabb against a frustum, compare the
+            // center-to-plane distance with the projection interval radius of the box onto the plane normal
+            Vec4::FloatType outside = zero;
+            Vec4::FloatType intersecting = zero;
+            for (uint32_t plane = 0; plane < AZ::Frustum::PlaneId::MAX; ++plane)
+            {
+                const Vec4::FloatType distance = Vec4::Madd(frustum.m_normalX[plane], centerX,
+                    Vec4::Madd(frustum.m_normalY[plane], centerY, Vec4::Madd(frustum.m_normalZ[plane], centerZ, frustum.m_distance[plane])));
+                const Vec4::FloatType radius = Vec4::Madd(frustum.m_absNormalX[plane], extentX,
+                    Vec4::Madd(frustum.m_absNormalY[plane], extentY, Vec4::Mul(frustum.m_absNormalZ[plane], extentZ)));
+                outside = Vec4::Or(outside, Vec4::CmpLtEq(Vec4::Add(distance, radius), zero));
+                intersecting = Vec4::Or(intersecting, Vec4::CmpLt(Vec4::Sub(distance, radius), zero));
+            }
+
+            alignas(16) int32_t outsideLanes[Vec4::ElementCount];
+            alignas(16) int32_t intersectingLanes[Vec4::ElementCount];
+            Vec4::StoreAligned(outsideLanes, Vec4::CastToInt(outside));
+            Vec4::StoreAligned(intersectingLanes, Vec4::CastToInt(intersecting));
+            for (uint32_t lane = 0; lane < Vec4::ElementCount; ++lane)
+            {
+                if (outsideLanes[lane] == 0)
+                {
+                    overlapMask |= 1u << (firstChild + lane);
+                    if (intersectingLanes[lane] == 0)
+                    {
+                        containMask |= 1u << (firstChild + lane);
+                    }
+                }
+            }
+        }
+    }
+
     void OctreeNode::Split(OctreeScene& octreeScene)
     {
         AZ_Assert(m_children == nullptr, "Split invoked on an octreeScene node that has already been split");
@@ -292,6 +552,20 @@ namespace AzFramework
                 m_children[child].m_bounds = childBound.GetTranslated(childOffset);
                 m_children[child].m_parent = this;
             }
+
+            m_childBounds = AZStd::make_unique<ChildBounds>();
+            for (uint32_t child = 0; child < childCount; ++child)
+            {
+                const AZ::Aabb& bounds = m_children[child].m_bounds;
+                const AZ::Vector3 center = bounds.GetCenter();
+                const AZ::Vector3 extents = (0.5f * bounds.GetMax()) - (0.5f * bounds.GetMin());
+                m_childBounds->m_centerX[child] = center.GetX();
+                m_childBounds->m_centerY[child] = center.GetY();
+                m_childBounds->m_centerZ[child] = center.GetZ();
+                m_childBounds->m_extentX[child] = extents.GetX();
+                m_childBounds->m_extentY[child] = extents.GetY();
+                m_childBounds->m_extentZ[child] = extents.GetZ();
+            }
         }
 
         // Re-partition our entry set across ourself and our child nodes
@@ -324,6 +598,7 @@ namespace AzFramework
         octreeScene.ReleaseChildNodes(m_childNodeIndex);
         m_childNodeIndex = InvalidChildNodeIndex;
         m_children = nullptr;
+        m_childBounds.reset();
     }
 
     OctreeScene::OctreeScene(const AZ::Name& sceneName)
@@ -362,9 +637,119 @@ namespace AzFramework
         }
     }
 
+    void OctreeScene::QueueInsertOrUpdateEntry(VisibilityEntry& entry)
+    {
+        // Threads are spread over the queues in the order they first queue an entry
+        static AZStd::atomic<size_t> s_nextQueueIndex{ 0 };
+        static thread_local const size_t t_queueIndex = s_nextQueueIndex.fetch_add(1, AZStd::memory_order_relaxed) % EntryQueueCount;
+
+        EntryQueue& queue = m_entryQueues[t_queueIndex];
+        AZStd::scoped_lock lock(queue.m_mutex);
+        queue.m_entries.push_back(&entry);
+        m_queuedEntryCount.fetch_add(1, AZStd::memory_order_relaxed);
+    }
+
+    void OctreeScene::ProcessQueuedEntries()
+    {
+        AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+        ProcessQueuedEntriesLocked();
+    }
+
+    void OctreeScene::ProcessQueuedEntriesLocked()
+    {
+        AZ_PROFILE_FUNCTION(AzFramework);
+
+        m_queuedEntryUpdates.clear();
+        for (EntryQueue& queue : m_entryQueues)
+        {
+            AZStd::scoped_lock queueLock(queue.m_mutex);
+            for (VisibilityEntry* entry : queue.m_entries)
+            {
+                m_queuedEntryUpdates.push_back({ entry, nullptr });
+            }
+            m_queuedEntryCount.fetch_sub(aznumeric_cast<uint32_t>(queue.m_entries.size()), AZStd::memory_order_relaxed);
+            queue.m_entries.clear();
+        }
+
+        if (m_queuedEntryUpdates.empty())
+        {
+            return;
+        }
+
+        // Find where every entry is going without modifying the tree, which can be done in parallel
+        auto findDestinations = [this](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                QueuedEntryUpdate& update = m_queuedEntryUpdates[i];
+                const VisibilityEntry* entry = update.m_entry;
+                update.m_destination = (entry->m_internalNode != nullptr)
+                    ? static_cast<const OctreeNode*>(entry->m_internalNode)->FindUpdateDestination(entry->m_boundingVolume)
+                    : m_root.FindInsertDestination(entry->m_boundingVolume);
+            }
+        };
+
+        auto taskGraphActive = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+        if (m_queuedEntryUpdates.size() >= bg_octreeParallelUpdateMinEntries && taskGraphActive != nullptr &&
+            taskGraphActive->IsTaskGraphActive() && !AZ::TaskExecutor::Instance().IsTaskWorkerThread())
+        {
+            AZ::TaskDescriptor descriptor{ "AzFramework::OctreeScene::ProcessQueuedEntries", "AzFramework" };
+            descriptor.grainSize = 256;
+
+            AZ::TaskGraph graph;
+            graph.AddParallelFor(descriptor, 0, m_queuedEntryUpdates.size(), findDestinations);
+            AZ::TaskGraphEvent finished;
+            graph.Submit(&finished);
+            finished.Wait();
+        }
+        else
+        {
+            findDestinations(0, m_queuedEntryUpdates.size());
+        }
+
+        // Drop entries that stay in their current node, which is the common case for entries that only moved a little
+        auto firstMovedEntry = AZStd::remove_if(m_queuedEntryUpdates.begin(), m_queuedEntryUpdates.end(),
+            [](const QueuedEntryUpdate& update) { return update.m_destination == update.m_entry->m_internalNode; });
+        m_queuedEntryUpdates.erase(firstMovedEntry, m_queuedEntryUpdates.end());
+
+        // Group the remaining entries by destination so each node is visited in one go, and so duplicates of an entry
+        // that was queued multiple times end up next to each other
+        AZStd::sort(m_queuedEntryUpdates.begin(), m_queuedEntryUpdates.end(),
+            [](const QueuedEntryUpdate& lhs, const QueuedEntryUpdate& rhs)
+            {
+                return (lhs.m_destination != rhs.m_destination) ? (lhs.m_destination < rhs.m_destination) : (lhs.m_entry < rhs.m_entry);
+            });
+        auto lastUniqueEntry = AZStd::unique(m_queuedEntryUpdates.begin(), m_queuedEntryUpdates.end(),
+            [](const QueuedEntryUpdate& lhs, const QueuedEntryUpdate& rhs) { return lhs.m_entry == rhs.m_entry; });
+        m_queuedEntryUpdates.erase(lastUniqueEntry, m_queuedEntryUpdates.end());
+
+        // Splits and merges caused by earlier entries can invalidate the destinations, so apply the entries the regular way
+        for (const QueuedEntryUpdate& update : m_queuedEntryUpdates)
+        {
+            VisibilityEntry* entry = update.m_entry;
+            if (entry->m_internalNode != nullptr)
+            {
+                static_cast<OctreeNode*>(entry->m_internalNode)->Update(*this, entry);
+            }
+            else
+            {
+                m_root.Insert(*this, entry);
+                ++m_entryCount;
+            }
+        }
+    }
+
     void OctreeScene::RemoveEntry(VisibilityEntry& entry)
     {
         AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+
+        // The entry may still be queued, which would leave a dangling pointer in the queues once it's destroyed. Applying all
+        // queued entries is cheaper than searching the queues on every removal, and empties them for any following removals.
+        if (m_queuedEntryCount.load(AZStd::memory_order_relaxed) > 0)
+        {
+            ProcessQueuedEntriesLocked();
+        }
+
         if (entry.m_internalNode)
         {
             static_cast<OctreeNode*>(entry.m_internalNode)->Remove(*this, &entry);
@@ -390,6 +775,12 @@ namespace AzFramework
         m_root.Enumerate(frustum, callback);
     }
 
+    void OctreeScene::EnumerateParallel(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
+        m_root.EnumerateParallel(frustum, callback);
+    }
+
     void OctreeScene::EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const
     {
         AZStd::shared_lock<AZStd::shared_mutex> lock(m_sharedMutex);
@@ -14,7 +14,10 @@
 #include <AzCore/std/containers/stack.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/containers/fixed_vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzCore/std/parallel/shared_mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 
 namespace AzFramework
 {
@@ -47,6 +50,14 @@ namespace AzFramework
         //! The provided entry must be bound to this node.
         void Remove(OctreeScene& octreeScene, VisibilityEntry* entry);
 
+        //! Returns the node an entry bound to this node would be stored in after updating it to the provided bounding volume.
+        //! This ignores any split the update might cause and returns this node if the entry doesn't need to move.
+        //! Doesn't modify the tree, so it can be called from multiple threads at once.
+        const OctreeNode* FindUpdateDestination(const AZ::Aabb& boundingVolume) const;
+
+        //! Returns the deepest node below and including this one that fully contains the provided bounding volume.
+        const OctreeNode* FindInsertDestination(const AZ::Aabb& boundingVolume) const;
+
         //! Recursively enumerates any OctreeNodes and their children that intersect the provided bounding volume.
         //! @{
         void Enumerate(const AZ::Aabb& aabb, const IVisibilityScene::EnumerateCallback& callback) const;
@@ -57,6 +68,10 @@ namespace AzFramework
         //! Recursively enumerate *all* OctreeNodes that have any entries in them (without any culling).
         void EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const;
 
+        //! Enumerates the same nodes as Enumerate, but splits the tree into subtrees that are enumerated in parallel on the task graph.
+        //! The callback may be invoked from multiple threads at the same time.
+        void EnumerateParallel(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const;
+
         //! Returns the set of entries bound to this node.
         const AZStd::vector<VisibilityEntry*>& GetEntries() const;
 
@@ -67,11 +82,31 @@ namespace AzFramework
         bool IsLeaf() const;
 
     private:
+        //! Bounds of the child nodes as a structure of arrays, so they can be tested against the planes of a frustum four at a time.
+        //! The bounds are stored as center and half extents, which is what the plane tests need.
+        struct alignas(16) ChildBounds
+        {
+            AZ_CLASS_ALLOCATOR(ChildBounds, AZ::SystemAllocator, 0);
+
+            static constexpr uint32_t MaxChildCount = 8;
+            float m_centerX[MaxChildCount];
+            float m_centerY[MaxChildCount];
+            float m_centerZ[MaxChildCount];
+            float m_extentX[MaxChildCount];
+            float m_extentY[MaxChildCount];
+            float m_extentZ[MaxChildCount];
+        };
+        struct FrustumPlanes;
 
         void TryMerge(OctreeScene& octreeScene);
 
         template <typename T>
         void EnumerateHelper(const T& boundingVolume, const IVisibilityScene::EnumerateCallback& callback) const;
+        void EnumerateHelper(const FrustumPlanes& frustum, const IVisibilityScene::EnumerateCallback& callback) const;
+
+        //! Tests the child nodes against the frustum and returns a bit mask of the children that overlap it, and one of the children
+        //! that are fully contained by it.
+        void ClassifyChildren(const FrustumPlanes& frustum, uint32_t& overlapMask, uint32_t& containMask) const;
 
         void Split(OctreeScene& octreeScene);
         void Merge(OctreeScene& octreeScene);
@@ -83,6 +118,7 @@ namespace AzFramework
         AZ::Aabb m_bounds;
         OctreeNode* m_parent = nullptr; //< This is a pointer to an array of GetChildNodeCount() nodes, or nullptr if this is a leaf node
         OctreeNode* m_children = nullptr;
+        AZStd::unique_ptr<ChildBounds> m_childBounds; //< The bounds of m_children, or nullptr if this is a leaf node
         AZStd::vector<VisibilityEntry*> m_entries;
     };
 
@@ -103,10 +139,13 @@ namespace AzFramework
         //! @{
         const AZ::Name& GetName() const override;
         void InsertOrUpdateEntry(VisibilityEntry& entry) override;
+        void QueueInsertOrUpdateEntry(VisibilityEntry& entry) override;
+        void ProcessQueuedEntries() override;
         void RemoveEntry(VisibilityEntry& entry) override;
         void Enumerate(const AZ::Aabb& aabb, const IVisibilityScene::EnumerateCallback& callback) const override;
         void Enumerate(const AZ::Sphere& sphere, const IVisibilityScene::EnumerateCallback& callback) const override;
         void Enumerate(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const override;
+        void EnumerateParallel(const AZ::Frustum& frustum, const IVisibilityScene::EnumerateCallback& callback) const override;
         void EnumerateNoCull(const IVisibilityScene::EnumerateCallback& callback) const override;
         uint32_t GetEntryCount() const override;
         //! @}
@@ -121,6 +160,9 @@ namespace AzFramework
         //! @}
 
     private:
+        //! Applies the queued entries, m_sharedMutex needs to be locked exclusively.
+        void ProcessQueuedEntriesLocked();
+
         uint32_t AllocateChildNodes();
         void ReleaseChildNodes(uint32_t nodeIndex);
         OctreeNode* GetChildNodesAtIndex(uint32_t nodeIndex) const;
@@ -140,6 +182,23 @@ namespace AzFramework
         AZStd::vector<OctreeNodePage*> m_nodeCache; //< Array of contiguous memory blocks for all allocated nodes within the tree.
         AZStd::stack<uint32_t> m_freeOctreeNodes; //< Indices of free nodes, each entry represents a contiguous block of free OctreeNodeChildCount nodes.
 
+        //! Queues for QueueInsertOrUpdateEntry. Each thread always uses the same queue, so threads rarely wait on each other.
+        static constexpr size_t EntryQueueCount = 16;
+        struct alignas(64) EntryQueue
+        {
+            AZStd::mutex m_mutex;
+            AZStd::vector<VisibilityEntry*> m_entries;
+        };
+        EntryQueue m_entryQueues[EntryQueueCount];
+        AZStd::atomic<uint32_t> m_queuedEntryCount{ 0 }; //< Total number of entries in m_entryQueues.
+
+        struct QueuedEntryUpdate
+        {
+            VisibilityEntry* m_entry;
+            const OctreeNode* m_destination;
+        };
+        AZStd::vector<QueuedEntryUpdate> m_queuedEntryUpdates; //< Scratch buffer for ProcessQueuedEntries, kept to avoid reallocating every frame.
+
         friend class OctreeNode; // For access to the node allocator methods
     };
 
@@ -31,12 +31,14 @@ set(FILES
     Archive/ZipDirCache.cpp
     Archive/ZipDirCacheFactory.cpp
     Archive/ZipDirFind.cpp
+    Archive/ZipDirIndex.cpp
     Archive/ZipDirList.cpp
     Archive/ZipDirStructures.cpp
     Archive/ZipDirTree.cpp
     Archive/ZipDirCache.h
     Archive/ZipDirCacheFactory.h
     Archive/ZipDirFind.h
+    Archive/ZipDirIndex.h
     Archive/ZipDirList.h
     Archive/ZipDirStructures.h
     Archive/ZipDirTree.h
@@ -17,6 +17,9 @@
 #include <AzFramework/Archive/ArchiveFileIO.h>
 #include <AzFramework/Archive/Archive.h>
 #include <AzFramework/Archive/INestedArchive.h>
+#include <AzFramework/Archive/NestedArchive.h>
+#include <AzFramework/Archive/ZipDirCache.h>
+#include <AzFramework/Archive/ZipDirStructures.h>
 
 namespace UnitTest
 {
@@ -441,6 +444,98 @@ namespace UnitTest
         EXPECT_TRUE(IsPackValid(testArchivePath.c_str()));
     }
 
+    TEST_P(ArchiveCompressionTestFixture, TestArchivePacking_UpdateFilesWithZStdDictionary_FilesReadBack)
+    {
+        AZStd::string testArchivePath = "@usercache@/archivetest.pak";
+        AZ::IO::IArchive* archive = AZ::Interface<AZ::IO::IArchive>::Get();
+
+        auto openFlags = AZStd::get<0>(GetParam());
+        auto compressionMethod = AZStd::get<1>(GetParam());
+        auto compressionLevel = AZStd::get<2>(GetParam());
+
+        // many small files that mostly share the same content, plus one file that's large enough to be split into multiple frames
+        AZStd::vector<AZStd::string> contents;
+        for (int i = 0; i < 1000; ++i)
+        {
+            contents.push_back(AZStd::string::format(
+                R"({ "Type": "JsonSerialization", "Version": 1, "ClassName": "Material", "ClassData": { "id": %i, "roughness": %f, "name": "material_%i" } })",
+                i, i * 0.001f, i));
+        }
+        AZStd::string largeFile;
+        while (largeFile.size() < 2 * AZ::IO::ZipDir::ZStdFrameSize + 1234)
+        {
+            largeFile += contents[largeFile.size() % contents.size()];
+        }
+        contents.push_back(AZStd::move(largeFile));
+
+        AZStd::vector<AZStd::string> fileNames;
+        fileNames.reserve(contents.size());
+        AZStd::vector<AZ::IO::INestedArchive::FileUpdate> files;
+        for (size_t i = 0; i < contents.size(); ++i)
+        {
+            fileNames.push_back(AZStd::string::format("file-%zu.json", i));
+            files.push_back({ fileNames.back(), contents[i].data(), contents[i].size() });
+        }
+
+        auto pArchive = archive->OpenArchive(testArchivePath.c_str(), {}, AZ::IO::INestedArchive::FLAGS_CREATE_NEW);
+        ASSERT_NE(nullptr, pArchive);
+        EXPECT_EQ(0, pArchive->TrainZStdDictionary(files));
+        // an archive can only have a single dictionary
+        EXPECT_NE(0, pArchive->TrainZStdDictionary(files));
+        EXPECT_EQ(0, pArchive->UpdateFiles(files, compressionMethod, compressionLevel, CompressionCodec::Codec::ZSTD));
+        pArchive.reset();
+        EXPECT_TRUE(IsPackValid(testArchivePath.c_str()));
+
+        // read it back and verify
+        pArchive = archive->OpenArchive(testArchivePath.c_str(), {}, openFlags);
+        ASSERT_NE(nullptr, pArchive);
+
+        AZStd::vector<char> buffer;
+        for (size_t i = 0; i < contents.size(); ++i)
+        {
+            AZ::IO::INestedArchive::Handle hand = pArchive->FindFile(fileNames[i]);
+            ASSERT_NE(nullptr, hand);
+            ASSERT_EQ(contents[i].size(), pArchive->GetFileSize(hand));
+            buffer.resize(contents[i].size());
+            EXPECT_EQ(0, pArchive->ReadFile(hand, buffer.data()));
+            EXPECT_EQ(contents[i], AZStd::string_view(buffer.data(), buffer.size()));
+        }
+
+        // the large file ends with a seek table that allows parts of it to be decompressed
+        if (compressionMethod != AZ::IO::INestedArchive::METHOD_STORE)
+        {
+            auto fileEntry = reinterpret_cast<AZ::IO::ZipDir::FileEntry*>(pArchive->FindFile(fileNames.back()));
+            ASSERT_NE(nullptr, fileEntry);
+            // seek tables are only read from the archive when they're first requested
+            EXPECT_FALSE(fileEntry->m_seekPointsLoaded);
+            auto seekPoints = static_cast<AZ::IO::NestedArchive*>(pArchive.get())->GetCache()->GetSeekPoints(fileEntry);
+            EXPECT_TRUE(fileEntry->m_seekPointsLoaded);
+            ASSERT_NE(nullptr, seekPoints);
+            ASSERT_EQ(4, seekPoints->size());
+            EXPECT_EQ(AZ::IO::ZipDir::ZStdFrameSize, (*seekPoints)[1].m_uncompressedOffset);
+            EXPECT_EQ(contents.back().size(), seekPoints->back().m_uncompressedOffset);
+            EXPECT_LT(seekPoints->back().m_compressedOffset, fileEntry->desc.lSizeCompressed);
+
+            // files that fit in a single frame don't have a seek table
+            auto smallFileEntry = reinterpret_cast<AZ::IO::ZipDir::FileEntry*>(pArchive->FindFile(fileNames.front()));
+            EXPECT_EQ(nullptr, static_cast<AZ::IO::NestedArchive*>(pArchive.get())->GetCache()->GetSeekPoints(smallFileEntry));
+        }
+
+        // the dictionary is needed to read the files back, so it can't be replaced or removed
+        if ((openFlags & AZ::IO::INestedArchive::FLAGS_READ_ONLY) == 0)
+        {
+            const AZStd::string_view dictionaryFileName = AZ::IO::ZipDir::ZStdDictionary::ArchiveFileName;
+            AZ_TEST_START_TRACE_SUPPRESSION;
+            EXPECT_NE(0, pArchive->UpdateFile(dictionaryFileName, contents[0].data(), contents[0].size(), compressionMethod, compressionLevel));
+            EXPECT_NE(0, pArchive->RemoveFile(dictionaryFileName));
+            AZ_TEST_STOP_TRACE_SUPPRESSION(2);
+            EXPECT_NE(nullptr, pArchive->FindFile(dictionaryFileName));
+        }
+
+        pArchive.reset();
+        EXPECT_TRUE(IsPackValid(testArchivePath.c_str()));
+    }
+
     INSTANTIATE_TEST_CASE_P(
         ArchiveCompression,
         ArchiveCompressionTestFixture,
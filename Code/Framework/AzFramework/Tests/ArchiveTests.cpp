@@ -589,6 +589,54 @@ namespace UnitTest
         fileIo->Remove(testArchivePath_withMountPoint);
     }
 
+    TEST_F(ArchiveTestFixture, FilesInReadOnlyArchive_FoundThroughFileIndex_MatchWritableArchive)
+    {
+        AZ::IO::IArchive* archive = AZ::Interface<AZ::IO::IArchive>::Get();
+        ASSERT_NE(nullptr, archive);
+
+        constexpr const char* testArchivePath = "@usercache@/indexedarchive.pak";
+        AZStd::vector<AZStd::string> fileNames;
+        for (int i = 0; i < 200; ++i)
+        {
+            fileNames.push_back(AZStd::string::format("folder%i/subfolder%i/file%i.txt", i % 7, i % 3, i));
+        }
+
+        AZStd::intrusive_ptr<AZ::IO::INestedArchive> pArchive = archive->OpenArchive(testArchivePath, {}, AZ::IO::INestedArchive::FLAGS_CREATE_NEW);
+        ASSERT_NE(nullptr, pArchive);
+        for (const AZStd::string& fileName : fileNames)
+        {
+            EXPECT_EQ(0, pArchive->UpdateFile(fileName, fileName.data(), fileName.size(), AZ::IO::INestedArchive::METHOD_STORE));
+        }
+        pArchive.reset();
+
+        AZStd::intrusive_ptr<AZ::IO::INestedArchive> readOnlyArchive = archive->OpenArchive(testArchivePath, {}, AZ::IO::INestedArchive::FLAGS_READ_ONLY);
+        ASSERT_NE(nullptr, readOnlyArchive);
+        AZStd::string buffer;
+        for (const AZStd::string& fileName : fileNames)
+        {
+            AZ::IO::INestedArchive::Handle handle = readOnlyArchive->FindFile(fileName);
+            ASSERT_NE(nullptr, handle);
+            buffer.resize(readOnlyArchive->GetFileSize(handle));
+            EXPECT_EQ(0, readOnlyArchive->ReadFile(handle, buffer.data()));
+            EXPECT_EQ(fileName, buffer);
+        }
+
+        // the index and the directory tree agree on files that don't exist
+        AZStd::intrusive_ptr<AZ::IO::INestedArchive> writableArchive = archive->OpenArchive(testArchivePath);
+        ASSERT_NE(nullptr, writableArchive);
+        for (const char* missingFile : { "folder0", "folder0/subfolder0", "folder0/subfolder0/file1.txt", "file0.txt", "folder0/subfolder0/file0" })
+        {
+            EXPECT_EQ(nullptr, readOnlyArchive->FindFile(missingFile));
+            EXPECT_EQ(nullptr, writableArchive->FindFile(missingFile));
+        }
+        EXPECT_NE(nullptr, readOnlyArchive->FindFile("folder0//subfolder0/file0.txt"));
+        EXPECT_NE(nullptr, writableArchive->FindFile("folder0//subfolder0/file0.txt"));
+
+        readOnlyArchive.reset();
+        writableArchive.reset();
+        AZ::IO::FileIOBase::GetInstance()->Remove(testArchivePath);
+    }
+
     // test that ArchiveFileIO class works as expected
     TEST_F(ArchiveTestFixture, TestArchiveViaFileIO)
     {
@@ -8,6 +8,7 @@
 
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/Name/NameDictionary.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
 
 #if defined(HAVE_BENCHMARK)
@@ -55,6 +56,16 @@ namespace Benchmark
                 return data;
             });
 
+            // Entries mostly move a small distance between frames
+            m_boundsArray.reserve(m_dataArray.size());
+            m_movedBoundsArray.reserve(m_dataArray.size());
+            for (const AzFramework::VisibilityEntry& data : m_dataArray)
+            {
+                AZ::Vector3 offset = AZ::Vector3(unif(rng), unif(rng), unif(rng)) * 10.0f - AZ::Vector3(5.0f);
+                m_boundsArray.push_back(data.m_boundingVolume);
+                m_movedBoundsArray.push_back(data.m_boundingVolume.GetTranslated(offset));
+            }
+
             std::generate(m_queryDataArray.begin(), m_queryDataArray.end(), [&unif, &rng]()
             {
                 QueryData data;
@@ -80,6 +91,11 @@ namespace Benchmark
             m_dataArray.clear();
             m_dataArray.shrink_to_fit();
 
+            m_boundsArray.clear();
+            m_boundsArray.shrink_to_fit();
+            m_movedBoundsArray.clear();
+            m_movedBoundsArray.shrink_to_fit();
+
             m_queryDataArray.clear();
             m_queryDataArray.shrink_to_fit();
 
@@ -125,6 +141,72 @@ namespace Benchmark
             }
         }
 
+        //! Moves entries in [begin, end) either to their moved or their original bounds, applying each update immediately
+        //! or queueing it.
+        void UpdateEntries(uint32_t begin, uint32_t end, bool moved, bool queued)
+        {
+            const AZStd::vector<AZ::Aabb>& bounds = moved ? m_movedBoundsArray : m_boundsArray;
+            for (uint32_t i = begin; i < end; ++i)
+            {
+                m_dataArray[i].m_boundingVolume = bounds[i];
+                if (queued)
+                {
+                    m_visScene->QueueInsertOrUpdateEntry(m_dataArray[i]);
+                }
+                else
+                {
+                    m_visScene->InsertOrUpdateEntry(m_dataArray[i]);
+                }
+            }
+        }
+
+        //! Moves entries like UpdateEntries, splitting them over several threads
+        void UpdateEntriesOnThreads(uint32_t entryCount, bool moved, bool queued)
+        {
+            constexpr uint32_t ThreadCount = 4;
+            const uint32_t entriesPerThread = entryCount / ThreadCount;
+            AZStd::vector<AZStd::thread> threads;
+            for (uint32_t thread = 0; thread < ThreadCount; ++thread)
+            {
+                const uint32_t begin = thread * entriesPerThread;
+                const uint32_t end = (thread == ThreadCount - 1) ? entryCount : begin + entriesPerThread;
+                threads.emplace_back([this, begin, end, moved, queued]()
+                {
+                    UpdateEntries(begin, end, moved, queued);
+                });
+            }
+            for (AZStd::thread& thread : threads)
+            {
+                thread.join();
+            }
+        }
+
+        void UpdateEntriesBenchmark(benchmark::State& state, uint32_t entryCount, bool queued, bool threaded)
+        {
+            InsertEntries(entryCount);
+            bool moved = false;
+            for (auto _ : state)
+            {
+                moved = !moved;
+                if (threaded)
+                {
+                    UpdateEntriesOnThreads(entryCount, moved, queued);
+                }
+                else
+                {
+                    UpdateEntries(0, entryCount, moved, queued);
+                }
+                m_visScene->ProcessQueuedEntries();
+            }
+            RemoveEntries(entryCount);
+
+            // Restore the original bounds for other benchmarks
+            for (uint32_t i = 0; i < entryCount; ++i)
+            {
+                m_dataArray[i].m_boundingVolume = m_boundsArray[i];
+            }
+        }
+
         struct QueryData
         {
             AZ::Aabb aabb;
@@ -134,6 +216,8 @@ namespace Benchmark
 
         bool m_ownsSystemAllocator = false;
         AZStd::vector<AzFramework::VisibilityEntry> m_dataArray;
+        AZStd::vector<AZ::Aabb> m_boundsArray;
+        AZStd::vector<AZ::Aabb> m_movedBoundsArray;
         AZStd::vector<QueryData> m_queryDataArray;
         AzFramework::OctreeSystemComponent* m_octreeSystemComponent = nullptr;
         AzFramework::IVisibilityScene* m_visScene = nullptr;
@@ -179,6 +263,36 @@ namespace Benchmark
         }
     }
 
+    BENCHMARK_F(BM_Octree, UpdateImmediate10000)(benchmark::State& state)
+    {
+        UpdateEntriesBenchmark(state, 10000, false, false);
+    }
+
+    BENCHMARK_F(BM_Octree, UpdateQueued10000)(benchmark::State& state)
+    {
+        UpdateEntriesBenchmark(state, 10000, true, false);
+    }
+
+    BENCHMARK_F(BM_Octree, UpdateImmediate100000)(benchmark::State& state)
+    {
+        UpdateEntriesBenchmark(state, 100000, false, false);
+    }
+
+    BENCHMARK_F(BM_Octree, UpdateQueued100000)(benchmark::State& state)
+    {
+        UpdateEntriesBenchmark(state, 100000, true, false);
+    }
+
+    BENCHMARK_F(BM_Octree, UpdateImmediateThreaded100000)(benchmark::State& state)
+    {
+        UpdateEntriesBenchmark(state, 100000, false, true);
+    }
+
+    BENCHMARK_F(BM_Octree, UpdateQueuedThreaded100000)(benchmark::State& state)
+    {
+        UpdateEntriesBenchmark(state, 100000, true, true);
+    }
+
     BENCHMARK_F(BM_Octree, EnumerateAabb1000)(benchmark::State& state)
     {
         constexpr uint32_t EntryCount = 1000;
@@ -346,6 +460,34 @@ namespace Benchmark
         }
         RemoveEntries(EntryCount);
     }
+
+    BENCHMARK_F(BM_Octree, EnumerateFrustumParallel100000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 100000;
+        InsertEntries(EntryCount);
+        for (auto _ : state)
+        {
+            for (auto& queryData : m_queryDataArray)
+            {
+                m_visScene->EnumerateParallel(queryData.frustum, [](const AzFramework::IVisibilityScene::NodeData&) {});
+            }
+        }
+        RemoveEntries(EntryCount);
+    }
+
+    BENCHMARK_F(BM_Octree, EnumerateFrustumParallel1000000)(benchmark::State& state)
+    {
+        constexpr uint32_t EntryCount = 1000000;
+        InsertEntries(EntryCount);
+        for (auto _ : state)
+        {
+            for (auto& queryData : m_queryDataArray)
+            {
+                m_visScene->EnumerateParallel(queryData.frustum, [](const AzFramework::IVisibilityScene::NodeData&) {});
+            }
+        }
+        RemoveEntries(EntryCount);
+    }
 }
 
 #endif
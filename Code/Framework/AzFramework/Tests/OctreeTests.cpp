@@ -11,6 +11,9 @@
 #include <AzCore/Console/Console.h>
 #include <AzCore/Name/NameDictionary.h>
 #include <AzCore/Console/IConsole.h>
+#include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/sort.h>
 #include <AzFramework/Visibility/OctreeSystemComponent.h>
 #include <random>
 
@@ -236,6 +239,100 @@ namespace UnitTest
         EXPECT_TRUE(m_octreeScene->GetNodeCount() == 1);
     }
 
+    TEST_F(OctreeTests, QueueInsertOrUpdateEntry_ProcessQueuedEntries_MatchesImmediateUpdates)
+    {
+        AzFramework::VisibilityEntry visEntry[3];
+        visEntry[0].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.9f), AZ::Vector3(-0.6f));
+        visEntry[1].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3( 0.1f), AZ::Vector3( 0.4f));
+        visEntry[2].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3( 0.6f), AZ::Vector3( 0.9f));
+
+        // Queueing an entry multiple times only inserts it once
+        m_octreeScene->QueueInsertOrUpdateEntry(visEntry[0]);
+        m_octreeScene->QueueInsertOrUpdateEntry(visEntry[1]);
+        m_octreeScene->QueueInsertOrUpdateEntry(visEntry[2]);
+        m_octreeScene->QueueInsertOrUpdateEntry(visEntry[2]);
+        EXPECT_TRUE(visEntry[0].m_internalNode == nullptr);
+        EXPECT_EQ(m_octreeScene->GetEntryCount(), 0u);
+
+        m_octreeScene->ProcessQueuedEntries();
+        EXPECT_TRUE(visEntry[0].m_internalNode != nullptr);
+        EXPECT_TRUE(visEntry[1].m_internalNode != nullptr);
+        EXPECT_TRUE(visEntry[2].m_internalNode != nullptr);
+        ValidateEntryCountEqualsExpectedCount(m_octreeScene, 3);
+        EXPECT_TRUE(m_octreeScene->GetNodeCount() == 1 + (2 * m_octreeScene->GetChildNodeCount()));
+
+        // Entries that stay within their node are left in place
+        AzFramework::VisibilityNode* unmovedNode = visEntry[0].m_internalNode;
+        visEntry[0].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.8f), AZ::Vector3(-0.5f));
+        m_octreeScene->QueueInsertOrUpdateEntry(visEntry[0]);
+        m_octreeScene->ProcessQueuedEntries();
+        EXPECT_EQ(visEntry[0].m_internalNode, unmovedNode);
+
+        // Swapping the entries around gives the same tree as updating them one by one
+        visEntry[1].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.9f), AZ::Vector3(-0.6f));
+        visEntry[2].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3( 0.1f), AZ::Vector3( 0.4f));
+        visEntry[0].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3( 0.6f), AZ::Vector3( 0.9f));
+        m_octreeScene->QueueInsertOrUpdateEntry(visEntry[0]);
+        m_octreeScene->QueueInsertOrUpdateEntry(visEntry[1]);
+        m_octreeScene->QueueInsertOrUpdateEntry(visEntry[2]);
+        m_octreeScene->ProcessQueuedEntries();
+        ValidateEntryCountEqualsExpectedCount(m_octreeScene, 3);
+        EXPECT_TRUE(m_octreeScene->GetNodeCount() == 1 + (2 * m_octreeScene->GetChildNodeCount()));
+
+        m_octreeScene->RemoveEntry(visEntry[2]);
+        m_octreeScene->RemoveEntry(visEntry[1]);
+        m_octreeScene->RemoveEntry(visEntry[0]);
+        ValidateEntryCountEqualsExpectedCount(m_octreeScene, 0);
+        EXPECT_TRUE(m_octreeScene->GetNodeCount() == 1);
+    }
+
+    TEST_F(OctreeTests, QueueInsertOrUpdateEntry_EnumerateBeforeProcessing_QueuedEntriesNotApplied)
+    {
+        AzFramework::VisibilityEntry visEntry[2];
+        visEntry[0].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.9f), AZ::Vector3(-0.6f));
+        visEntry[1].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3( 0.6f), AZ::Vector3( 0.9f));
+        m_octreeScene->InsertOrUpdateEntry(visEntry[0]);
+
+        // Enumerating from inside an enumeration callback with entries queued only needs shared access to the scene
+        m_octreeScene->QueueInsertOrUpdateEntry(visEntry[1]);
+        AZStd::vector<VisibilityEntry*> gatheredEntries;
+        m_octreeScene->EnumerateNoCull([this, &gatheredEntries](const AzFramework::IVisibilityScene::NodeData&)
+        {
+            m_octreeScene->EnumerateNoCull([&gatheredEntries](const AzFramework::IVisibilityScene::NodeData& nodeData)
+            {
+                gatheredEntries.insert(gatheredEntries.end(), nodeData.m_entries.begin(), nodeData.m_entries.end());
+            });
+        });
+        ASSERT_EQ(gatheredEntries.size(), 1u);
+        EXPECT_EQ(gatheredEntries[0], &visEntry[0]);
+        EXPECT_TRUE(visEntry[1].m_internalNode == nullptr);
+
+        m_octreeScene->ProcessQueuedEntries();
+        ValidateEntryCountEqualsExpectedCount(m_octreeScene, 2);
+        m_octreeScene->RemoveEntry(visEntry[1]);
+        m_octreeScene->RemoveEntry(visEntry[0]);
+        ValidateEntryCountEqualsExpectedCount(m_octreeScene, 0);
+    }
+
+    TEST_F(OctreeTests, QueueInsertOrUpdateEntry_RemoveBeforeProcessing_EntryNotLeftInQueue)
+    {
+        AzFramework::VisibilityEntry visEntry[2];
+        visEntry[0].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.9f), AZ::Vector3(-0.6f));
+        visEntry[1].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3( 0.6f), AZ::Vector3( 0.9f));
+
+        // Removing an entry that's still queued must not leave it in the queue
+        m_octreeScene->QueueInsertOrUpdateEntry(visEntry[0]);
+        m_octreeScene->QueueInsertOrUpdateEntry(visEntry[1]);
+        m_octreeScene->RemoveEntry(visEntry[1]);
+        EXPECT_TRUE(visEntry[1].m_internalNode == nullptr);
+        m_octreeScene->ProcessQueuedEntries();
+        EXPECT_TRUE(visEntry[1].m_internalNode == nullptr);
+        ValidateEntryCountEqualsExpectedCount(m_octreeScene, 1);
+
+        m_octreeScene->RemoveEntry(visEntry[0]);
+        ValidateEntryCountEqualsExpectedCount(m_octreeScene, 0);
+    }
+
     void AppendEntries(AZStd::vector<VisibilityEntry*>& gatheredEntries, const AzFramework::IVisibilityScene::NodeData& nodeData)
     {
         gatheredEntries.insert(gatheredEntries.end(), nodeData.m_entries.begin(), nodeData.m_entries.end());
@@ -377,6 +474,65 @@ namespace UnitTest
         EnumerateMultipleEntriesHelper(m_octreeScene, bound1, bound2, bound3);
     }
 
+    TEST_F(OctreeTests, EnumerateFrustum_ManyEntries_MatchesNodesOverlappingFrustum)
+    {
+        const unsigned int seed = 1;
+        std::mt19937_64 rng(seed);
+        std::uniform_real_distribution<float> unif(-1.0f, 1.0f);
+
+        AZStd::vector<AzFramework::VisibilityEntry> visEntries(500);
+        for (AzFramework::VisibilityEntry& entry : visEntries)
+        {
+            const AZ::Vector3 aabbMin = AZ::Vector3(unif(rng), unif(rng), unif(rng)) * 0.95f;
+            entry.m_boundingVolume = AZ::Aabb::CreateFromMinMax(aabbMin, aabbMin + AZ::Vector3(0.05f));
+            m_octreeScene->InsertOrUpdateEntry(entry);
+        }
+
+        for (int i = 0; i < 20; ++i)
+        {
+            const AZ::Vector3 frustumOrigin = AZ::Vector3(unif(rng), unif(rng), unif(rng)) * 2.0f;
+            const AZ::Quaternion frustumDirection =
+                AZ::Quaternion::CreateFromAxisAngle(AZ::Vector3(unif(rng), unif(rng), unif(rng)).GetNormalized(), unif(rng) * 3.0f);
+            const AZ::Transform frustumTransform = AZ::Transform::CreateFromQuaternionAndTranslation(frustumDirection, frustumOrigin);
+            const AZ::Frustum frustum = AZ::Frustum(AZ::ViewFrustumAttributes(frustumTransform, 1.0f, 2.0f * atanf(0.5f), 0.1f, 3.0f));
+
+            // Every node with entries that overlaps the frustum, using the scalar intersection test
+            AZStd::vector<VisibilityEntry*> expectedEntries;
+            m_octreeScene->EnumerateNoCull([&expectedEntries, &frustum](const AzFramework::IVisibilityScene::NodeData& nodeData)
+            {
+                if (AZ::ShapeIntersection::Overlaps(frustum, nodeData.m_bounds))
+                {
+                    AppendEntries(expectedEntries, nodeData);
+                }
+            });
+            AZStd::sort(expectedEntries.begin(), expectedEntries.end());
+
+            AZStd::vector<VisibilityEntry*> gatheredEntries;
+            m_octreeScene->Enumerate(frustum, [&gatheredEntries](const AzFramework::IVisibilityScene::NodeData& nodeData)
+            {
+                AppendEntries(gatheredEntries, nodeData);
+            });
+            AZStd::sort(gatheredEntries.begin(), gatheredEntries.end());
+            EXPECT_EQ(gatheredEntries, expectedEntries);
+
+            AZStd::mutex gatheredEntriesMutex;
+            gatheredEntries.clear();
+            m_octreeScene->EnumerateParallel(frustum, [&gatheredEntries, &gatheredEntriesMutex](const AzFramework::IVisibilityScene::NodeData& nodeData)
+            {
+                AZStd::scoped_lock lock(gatheredEntriesMutex);
+                AppendEntries(gatheredEntries, nodeData);
+            });
+            AZStd::sort(gatheredEntries.begin(), gatheredEntries.end());
+            EXPECT_EQ(gatheredEntries, expectedEntries);
+        }
+
+        for (AzFramework::VisibilityEntry& entry : visEntries)
+        {
+            m_octreeScene->RemoveEntry(entry);
+        }
+        ValidateEntryCountEqualsExpectedCount(m_octreeScene, 0);
+    }
+
     TEST_F(OctreeTests, InsertOrUpdateEntry_OverFillRootNodeWithLargeEntries_EntriesAreNotLost)
     {
         // Validate that the octree works if you exceed the max entry count with large entries,
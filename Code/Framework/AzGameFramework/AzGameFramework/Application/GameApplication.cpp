@@ -69,6 +69,20 @@ namespace AzGameFramework
         Application::SetSettingsRegistrySpecializations(specializations);
         specializations.Append("game");
 
+        // If a snapshot has been configured, try to load the settings from it instead of merging all the settings files.
+        SettingsRegistrySnapshotInfo snapshotInfo;
+        if (LoadSettingsRegistrySnapshot(registry, specializations, snapshotInfo))
+        {
+            // The command line always has the final say, including over the settings stored in the snapshot.
+#if defined(AZ_DEBUG_BUILD) || defined(AZ_PROFILE_BUILD)
+            AZ::SettingsRegistryMergeUtils::MergeSettingsToRegistry_CommandLine(registry, m_commandLine, true);
+#else
+            AZ::SettingsRegistryMergeUtils::MergeSettingsToRegistry_CommandLine(registry, m_commandLine, false);
+#endif
+            AZ::SettingsRegistryMergeUtils::MergeSettingsToRegistry_AddRuntimeFilePaths(registry);
+            return;
+        }
+
         AZStd::vector<char> scratchBuffer;
 
 #if defined(AZ_DEBUG_BUILD) || defined(AZ_PROFILE_BUILD)
@@ -108,6 +122,8 @@ namespace AzGameFramework
 #endif
         // Update the Runtime file paths in case the "{BootstrapSettingsRootKey}/assets" key was overriden by a setting registry
         AZ::SettingsRegistryMergeUtils::MergeSettingsToRegistry_AddRuntimeFilePaths(registry);
+
+        WriteSettingsRegistrySnapshot(snapshotInfo);
     }
 
     AZ::ComponentTypeList GameApplication::GetRequiredSystemComponents() const
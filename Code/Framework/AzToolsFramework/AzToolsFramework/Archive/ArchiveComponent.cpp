@@ -10,6 +10,7 @@
 
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Serialization/EditContext.h>
 
 #include <AzFramework/Archive/INestedArchive.h>
@@ -24,7 +25,20 @@ namespace AzToolsFramework
     [[maybe_unused]] constexpr const char s_traceName[] = "ArchiveComponent";
     constexpr AZ::u32 s_compressionMethod = AZ::IO::INestedArchive::METHOD_DEFLATE;
     constexpr AZ::s32 s_compressionLevel = AZ::IO::INestedArchive::LEVEL_NORMAL;
-    constexpr CompressionCodec::Codec s_compressionCodec = CompressionCodec::Codec::ZLIB;
+
+    AZ_CVAR(bool, az_archive_compress_with_zstd, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Compress files that are added to archives with zstd instead of zlib. zstd splits large files into frames followed\n"
+        "by a seek table, which allows Streamer to decompress parts of a file.");
+
+    AZ_CVAR(bool, az_archive_train_zstd_dictionary, false, nullptr, AZ::ConsoleFunctorFlags::Null,
+        "Train a zstd dictionary from the small files of the first batch that's added to an archive and compress all files\n"
+        "with it. This improves the compression ratio of small, similar files considerably. Only used together with\n"
+        "az_archive_compress_with_zstd.");
+
+    static CompressionCodec::Codec GetCompressionCodec()
+    {
+        return az_archive_compress_with_zstd ? CompressionCodec::Codec::ZSTD : CompressionCodec::Codec::ZLIB;
+    }
 
     namespace ArchiveUtils
     {
@@ -73,6 +87,100 @@ namespace AzToolsFramework
             }
         }
 
+        // Collects files so they can be added to an archive in batches. The files in a batch are compressed in parallel.
+        // Batches are limited in size so only part of the files needs to be kept in memory at a time.
+        class FileBatch
+        {
+        public:
+            static constexpr size_t MaxSize = 64 * 1024 * 1024;
+            // Files up to this size are used to train the zstd dictionary. Dictionaries make little difference for larger files.
+            static constexpr size_t MaxDictionarySampleSize = 128 * 1024;
+
+            explicit FileBatch(AZ::IO::INestedArchive& archive)
+                : m_archive(archive)
+            {
+            }
+
+            // Takes ownership of the file's data and adds the batch to the archive once it's full.
+            // returns false if the batch was added and that failed.
+            bool Add(AZStd::string_view relativePath, AZStd::vector<char>&& data)
+            {
+                m_size += data.size();
+                m_files.push_back({ AZStd::string(relativePath), AZStd::move(data) });
+                return m_size < MaxSize || Flush();
+            }
+
+            // Adds all collected files to the archive.
+            // returns true if successful or there was nothing to add, false otherwise.
+            bool Flush()
+            {
+                if (m_files.empty())
+                {
+                    return true;
+                }
+
+                AZStd::vector<AZ::IO::INestedArchive::FileUpdate> updates;
+                updates.reserve(m_files.size());
+                for (const File& file : m_files)
+                {
+                    updates.push_back({ file.m_relativePath, file.m_data.data(), file.m_data.size() });
+                }
+
+                if (!m_dictionaryTrainingAttempted && GetCompressionCodec() == CompressionCodec::Codec::ZSTD && az_archive_train_zstd_dictionary)
+                {
+                    TrainDictionary(updates);
+                }
+
+                int result = m_archive.UpdateFiles(updates, s_compressionMethod, s_compressionLevel, GetCompressionCodec());
+                bool success = (result == AZ::IO::ZipDir::ZD_ERROR_SUCCESS);
+                AZ_Error(
+                    s_traceName, success, "Error %d encountered while adding %zu files to archive '%.*s'", result, m_files.size(),
+                    AZ_STRING_ARG(m_archive.GetFullPath().Native()));
+
+                m_files.clear();
+                m_size = 0;
+                return success;
+            }
+
+        private:
+            struct File
+            {
+                AZStd::string m_relativePath;
+                AZStd::vector<char> m_data;
+            };
+
+            // Trains the dictionary from the first batch only, so every file in the archive is compressed with the same
+            // dictionary. If the archive already has a dictionary it's kept.
+            void TrainDictionary(const AZStd::vector<AZ::IO::INestedArchive::FileUpdate>& updates)
+            {
+                m_dictionaryTrainingAttempted = true;
+
+                AZStd::vector<AZ::IO::INestedArchive::FileUpdate> samples;
+                for (const AZ::IO::INestedArchive::FileUpdate& update : updates)
+                {
+                    if (update.m_size <= MaxDictionarySampleSize)
+                    {
+                        samples.push_back(update);
+                    }
+                }
+                if (samples.empty())
+                {
+                    return;
+                }
+
+                [[maybe_unused]] int result = m_archive.TrainZStdDictionary(samples);
+                AZ_Warning(
+                    s_traceName, result == AZ::IO::ZipDir::ZD_ERROR_SUCCESS || result == AZ::IO::ZipDir::ZD_ERROR_INVALID_CALL,
+                    "Unable to train a zstd dictionary from %zu files for archive '%.*s' (error %d), files are compressed without one",
+                    samples.size(), AZ_STRING_ARG(m_archive.GetFullPath().Native()), result);
+            }
+
+            AZ::IO::INestedArchive& m_archive;
+            AZStd::vector<File> m_files;
+            size_t m_size = 0;
+            bool m_dictionaryTrainingAttempted = false;
+        };
+
     } // namespace ArchiveUtils
 
     void ArchiveComponent::Activate()
@@ -157,8 +265,8 @@ namespace AzToolsFramework
             }
 
             bool success = true;
-            AZStd::vector<char> fileBuffer;
             const AZ::IO::Path workingPath{ dirToArchive };
+            ArchiveUtils::FileBatch batch(*archive);
 
             for (const auto& fileName : foundFiles.GetValue())
             {
@@ -167,16 +275,10 @@ namespace AzToolsFramework
                 AZ::IO::PathView relativePath = AZ::IO::PathView{ fileName }.LexicallyRelative(workingPath);
 
                 AZ::IO::Path fullPath = (workingPath / relativePath);
+                AZStd::vector<char> fileBuffer;
                 if (ArchiveUtils::ReadFile(fullPath, AZ::IO::OpenMode::ModeRead, fileBuffer))
                 {
-                    int result = archive->UpdateFile(
-                        relativePath.Native(), fileBuffer.data(), fileBuffer.size(), s_compressionMethod,
-                        s_compressionLevel, s_compressionCodec);
-
-                    thisSuccess = (result == AZ::IO::ZipDir::ZD_ERROR_SUCCESS);
-                    AZ_Error(
-                        s_traceName, thisSuccess, "Error %d encountered while adding '%s' to archive '%.*s'", result, fileName.c_str(),
-                        AZ_STRING_ARG(archive->GetFullPath().Native()));
+                    thisSuccess = batch.Add(relativePath.Native(), AZStd::move(fileBuffer));
                 }
                 else
                 {
@@ -187,6 +289,7 @@ namespace AzToolsFramework
 
                 success = (success && thisSuccess);
             }
+            success = (batch.Flush() && success);
 
             archive.reset();
             p.set_value(success);
@@ -428,7 +531,7 @@ namespace AzToolsFramework
             {
                 int result = archive->UpdateFile(
                     relativePath.Native(), fileBuffer.data(), fileBuffer.size(), s_compressionMethod,
-                    s_compressionLevel, s_compressionCodec);
+                    s_compressionLevel, GetCompressionCodec());
 
                 success = (result == AZ::IO::ZipDir::ZD_ERROR_SUCCESS);
                 AZ_Error(
@@ -482,21 +585,16 @@ namespace AzToolsFramework
             bool success = true; // starts true and turns false when any error is encountered.
             AZ::IO::Path basePath{ workingDirectory };
 
-            auto PerLineCallback = [&success, &basePath, &archive](AZStd::string_view filePathLine) -> void
+            ArchiveUtils::FileBatch batch(*archive);
+
+            auto PerLineCallback = [&success, &basePath, &archive, &batch](AZStd::string_view filePathLine) -> void
             {
                 AZStd::vector<char> fileBuffer;
                 AZ::IO::Path fullPath = (basePath / filePathLine);
                 if (ArchiveUtils::ReadFile(fullPath, AZ::IO::OpenMode::ModeRead, fileBuffer))
                 {
-                    int result = archive->UpdateFile(
-                        filePathLine, fileBuffer.data(), fileBuffer.size(), s_compressionMethod,
-                        s_compressionLevel, s_compressionCodec);
-
-                    bool thisSuccess = (result == AZ::IO::ZipDir::ZD_ERROR_SUCCESS);
+                    bool thisSuccess = batch.Add(filePathLine, AZStd::move(fileBuffer));
                     success = (success && thisSuccess);
-                    AZ_Error(
-                        s_traceName, thisSuccess, "Error %d encountered while adding '%.*s' to archive '%.*s'", result,
-                        AZ_STRING_ARG(filePathLine), AZ_STRING_ARG(archive->GetFullPath().Native()));
                 }
                 else
                 {
@@ -507,6 +605,7 @@ namespace AzToolsFramework
             };
 
             ArchiveUtils::ProcessFileList(listFilePath, PerLineCallback);
+            success = (batch.Flush() && success);
 
             archive.reset();
             p.set_value(success);
@@ -8,6 +8,7 @@
 
 #include <AzCore/UnitTest/TestTypes.h>
 #include <AzCore/Asset/AssetManagerBus.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Math/Uuid.h>
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/std/smart_ptr/unique_ptr.h>
@@ -15,6 +16,9 @@
 #include <AzCore/IO/FileIO.h>
 #include <Tests/AZTestShared/Utils/Utils.h>
 #include <AzToolsFramework/Archive/ArchiveAPI.h>
+#include <AzFramework/Archive/IArchive.h>
+#include <AzFramework/Archive/INestedArchive.h>
+#include <AzFramework/Archive/ZipDirStructures.h>
 #include <AzFramework/StringFunc/StringFunc.h>
 #include <AzToolsFramework/Archive/ArchiveAPI.h>
 #include <AzToolsFramework/AssetBundle/AssetBundleAPI.h>
@@ -233,6 +237,48 @@ namespace UnitTest
             EXPECT_TRUE(result);
         }
 
+#if AZ_TRAIT_DISABLE_FAILED_ARCHIVE_TESTS
+        TEST_F(ArchiveComponentTest, DISABLED_CreateArchive_ZStdDictionaryEnabled_DictionaryStoredInArchive)
+#else
+        TEST_F(ArchiveComponentTest, CreateArchive_ZStdDictionaryEnabled_DictionaryStoredInArchive)
+#endif // AZ_TRAIT_DISABLE_FAILED_ARCHIVE_TESTS
+        {
+            // The dictionary trainer needs a fair amount of similar samples
+            QStringList fileList;
+            QDir archiveFolder(GetArchiveFolder());
+            for (int i = 0; i < 256; ++i)
+            {
+                const QString fileName = QString("material_%1.json").arg(i);
+                const QString content = QString(
+                    R"({ "Type": "JsonSerialization", "Version": 1, "ClassName": "Material", "ClassData": { "id": %1, "roughness": %2, "name": "material_%1" } })")
+                    .arg(i).arg(i * 0.001);
+                EXPECT_TRUE(CreateDummyFile(archiveFolder.absoluteFilePath(fileName), content));
+                fileList.append(fileName);
+            }
+
+            auto console = AZ::Interface<AZ::IConsole>::Get();
+            ASSERT_NE(nullptr, console);
+            console->PerformCommand("az_archive_compress_with_zstd true");
+            console->PerformCommand("az_archive_train_zstd_dictionary true");
+
+            AZ_TEST_START_TRACE_SUPPRESSION;
+            bool createResult = CreateArchive();
+            AZ_TEST_STOP_TRACE_SUPPRESSION_NO_COUNT;
+
+            console->PerformCommand("az_archive_train_zstd_dictionary false");
+            console->PerformCommand("az_archive_compress_with_zstd false");
+            ASSERT_TRUE(createResult);
+
+            auto archive = AZ::Interface<AZ::IO::IArchive>::Get()->OpenArchive(
+                GetArchivePath().toUtf8().constData(), {}, AZ::IO::INestedArchive::FLAGS_READ_ONLY);
+            ASSERT_NE(nullptr, archive);
+            EXPECT_NE(nullptr, archive->FindFile(AZ::IO::ZipDir::ZStdDictionary::ArchiveFileName));
+            for (const QString& fileName : fileList)
+            {
+                EXPECT_NE(nullptr, archive->FindFile(fileName.toUtf8().constData()));
+            }
+        }
+
 #if AZ_TRAIT_DISABLE_FAILED_ARCHIVE_TESTS
         TEST_F(ArchiveComponentTest, DISABLED_ExtractArchive_AllFiles_Success)
 #else
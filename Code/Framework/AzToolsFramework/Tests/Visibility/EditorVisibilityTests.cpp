@@ -176,6 +176,44 @@ namespace UnitTest
         EXPECT_THAT(visibleEditorEntityIds, UnorderedElementsAreArray(expectedEditorEntities));
     }
 
+    TEST_F(EditorVisibilityFixture, TranslatedEntityIsRemovedFromVisibilityQueryWithoutTicking)
+    {
+        using ::testing::Contains;
+        using ::testing::Not;
+
+        constexpr size_t EditorEntityCount = 21;
+
+        // setup row of editor entities
+        CreateEditorEntities(EditorEntityCount);
+        SetupRowOfEntities(AZ::Vector3::CreateAxisX(-20.0f), AZ::Vector3::CreateAxisX(2.0f));
+
+        // request the entity union bounds system to update
+        AzFramework::IEntityBoundsUnionRequestBus::Broadcast(
+            &AzFramework::IEntityBoundsUnionRequestBus::Events::ProcessEntityBoundsUnionRequests);
+
+        // move an entity out of view, its new bounds are only queued until the next tick
+        const AZ::EntityId entityIdToMove = m_editorEntityIds[10];
+        AZ::TransformBus::Event(
+            entityIdToMove, &AZ::TransformBus::Events::SetWorldTranslation, AZ::Vector3::CreateAxisZ(100.0f));
+
+        // create default camera looking down the negative y-axis moved just back from the origin
+        AzFramework::CameraState cameraState = AzFramework::CreateDefaultCamera(
+            AZ::Transform::CreateTranslation(AZ::Vector3::CreateAxisY(-5.0f)), ScreenDimensions);
+
+        // perform a visibility query without ticking or processing the entity bounds union requests
+        AzFramework::EntityVisibilityQuery entityVisibilityQuery;
+        entityVisibilityQuery.UpdateVisibility(cameraState);
+
+        // build a vector of visible entities
+        AZStd::vector<AZ::EntityId> visibleEditorEntityIds;
+        AZStd::copy(
+            entityVisibilityQuery.Begin(), entityVisibilityQuery.End(), AZStd::back_inserter(visibleEditorEntityIds));
+
+        // the query must not see the stale position of the moved entity
+        EXPECT_THAT(visibleEditorEntityIds, Not(Contains(entityIdToMove)));
+        EXPECT_THAT(visibleEditorEntityIds, Contains(m_editorEntityIds[9]));
+    }
+
     class TestBoundComponent
         : public AZ::Component
         , public AzFramework::BoundsRequestBus::Handler
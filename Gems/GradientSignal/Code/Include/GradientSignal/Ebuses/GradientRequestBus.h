@@ -10,6 +10,7 @@
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/Component/EntityId.h>
 #include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/vector.h>
 
 namespace GradientSignal
 {
@@ -49,6 +50,26 @@ namespace GradientSignal
         */
         virtual float GetValue(const GradientSampleParams& sampleParams) const = 0;
 
+        /**
+        * Given a list of positions, generate a value for each of them. This gives the same results as calling GetValue for each
+        * position, but lets gradients share the work between positions, so it should be preferred whenever more than a few
+        * values are needed. The same thread-safety rules as GetValue apply.
+        * The default implementation calls GetValue for each position.
+        * @param positions the positions to generate values for
+        * @param outValues the generated values, which needs to be the same size as the list of positions
+        */
+        virtual void GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+        {
+            AZ_Assert(positions.size() == outValues.size(), "The position list and the value list need to be the same size.");
+
+            GradientSampleParams sampleParams;
+            for (size_t index = 0; index < positions.size(); index++)
+            {
+                sampleParams.m_position = positions[index];
+                outValues[index] = GetValue(sampleParams);
+            }
+        }
+
         /**
         * Call to check the hierarchy to see if a given entityId exists in the gradient signal chain
         */
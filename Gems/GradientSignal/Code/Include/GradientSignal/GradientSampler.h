@@ -34,6 +34,11 @@ namespace GradientSignal
 
         inline float GetValue(const GradientSampleParams& sampleParams) const;
 
+        //! Batched version of GetValue, which samples the gradient with a single request for all the positions.
+        //! @param positions the positions to sample
+        //! @param outValues the sampled values, which needs to be the same size as the list of positions
+        void GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const;
+
         bool IsEntityInHierarchy(const AZ::EntityId& entityId) const;
 
         AZ::EntityId m_gradientId;
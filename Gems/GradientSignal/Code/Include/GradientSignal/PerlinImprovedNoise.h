@@ -7,7 +7,9 @@
  */
 #pragma once
 
+#include <AzCore/Math/Vector3.h>
 #include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Memory/SystemAllocator.h>
 
@@ -32,6 +34,15 @@ namespace GradientSignal
         */
         float GenerateOctaveNoise(float x, float y, float z, int octaves, float persistence, float initialFrequency = 1.0f);
 
+        /**
+        * Batched version of GenerateOctaveNoise, which generates the noise for four positions at a time with SIMD
+        * and gives the same values as generating them one at a time.
+        * @param positions the positions to generate noise for
+        * @param outValues the generated noise values, which needs to be the same size as the list of positions
+        */
+        void GenerateOctaveNoise(
+            const AZStd::vector<AZ::Vector3>& positions, int octaves, float persistence, float initialFrequency, AZStd::vector<float>& outValues);
+
         /**
         * Creates a Perlin noise factor value based on a position
         */
@@ -12,6 +12,7 @@
 #include <AzCore/Component/EntityId.h>
 #include <AzCore/Math/Matrix3x4.h>
 #include <AzCore/Math/Transform.h>
+#include <AzCore/std/containers/vector.h>
 #include <LmbrCentral/Shape/ShapeComponentBus.h>
 
 namespace LmbrCentral
@@ -120,4 +121,7 @@ namespace GradientSignal
 
         return AZ::Lerp(outputMin, outputMax, inputCorrected);
     }
+
+    //! Applies GetLevels to every value in the list, four values at a time with SIMD.
+    void GetLevels(AZStd::vector<float>& values, float inputMid, float inputMin, float inputMax, float outputMin, float outputMax);
 } // namespace GradientSignal
@@ -10,6 +10,7 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/algorithm.h>
 #include <LmbrCentral/Dependency/DependencyMonitor.h>
 
 namespace GradientSignal
@@ -134,6 +135,12 @@ namespace GradientSignal
         return m_configuration.m_value;
     }
 
+    void ConstantGradientComponent::GetValues(
+        [[maybe_unused]] const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        AZStd::fill(outValues.begin(), outValues.end(), m_configuration.m_value);
+    }
+
     float ConstantGradientComponent::GetConstantValue() const
     {
         return m_configuration.m_value;
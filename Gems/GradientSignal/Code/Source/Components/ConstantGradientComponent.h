@@ -62,6 +62,7 @@ namespace GradientSignal
         //////////////////////////////////////////////////////////////////////////
         // GradientRequestBus
         float GetValue(const GradientSampleParams& sampleParams) const override;
+        void GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const override;
 
     protected:
         //////////////////////////////////////////////////////////////////////////
@@ -209,6 +209,29 @@ namespace GradientSignal
         return 0.0f;
     }
 
+    void ImageGradientComponent::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        AZ_Assert(positions.size() == outValues.size(), "The position list and the value list need to be the same size.");
+
+        // Positions are used as-is if there's no gradient transform to change them.
+        AZStd::vector<AZ::Vector3> uvws(positions);
+        AZStd::vector<bool> wasPointRejected(positions.size(), false);
+        const bool shouldNormalizeOutput = true;
+        GradientTransformRequestBus::Event(
+            GetEntityId(), &GradientTransformRequestBus::Events::TransformPositionsToUVW, positions, uvws, shouldNormalizeOutput, wasPointRejected);
+
+        // Texel lookups can't be vectorized, but the image only needs to be locked once for the whole list.
+        AZStd::lock_guard<decltype(m_imageMutex)> imageLock(m_imageMutex);
+        for (size_t index = 0; index < positions.size(); ++index)
+        {
+            outValues[index] = wasPointRejected[index]
+                ? 0.0f
+                : GetValueFromImageAsset(m_configuration.m_imageAsset, uvws[index], m_configuration.m_tilingX, m_configuration.m_tilingY, 0.0f);
+        }
+    }
+
     AZStd::string ImageGradientComponent::GetImageAssetPath() const
     {
         AZStd::string assetPathString;
@@ -11,9 +11,26 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/algorithm.h>
 
 namespace GradientSignal
 {
+    namespace
+    {
+        // Combines the unpremultiplied layer values with the results using the given operation, then blends the combined
+        // values back into the results with the layer opacity, the same way as MixedGradientComponent::GetValue.
+        template<typename Operation>
+        void MixLayerValues(AZStd::vector<float>& results, const AZStd::vector<float>& layerValues, float opacity, Operation operation)
+        {
+            for (size_t index = 0; index < results.size(); index++)
+            {
+                const float currentUnpremultiplied = layerValues[index] / opacity;
+                const float operationResult = operation(results[index], currentUnpremultiplied);
+                results[index] = (results[index] * (1.0f - opacity)) + (operationResult * opacity);
+            }
+        }
+    } // namespace
+
     void MixedGradientLayer::Reflect(AZ::ReflectContext* context)
     {
         AZ::SerializeContext* serialize = azrtti_cast<AZ::SerializeContext*>(context);
@@ -313,6 +330,72 @@ namespace GradientSignal
         return AZ::GetClamp(result, 0.0f, 1.0f);
     }
 
+    void MixedGradientComponent::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        //accumulate the mixed/combined result of all layers and operations, one layer at a time for all the positions
+        AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+        AZStd::vector<float> layerValues(positions.size());
+
+        for (const auto& layer : m_configuration.m_layers)
+        {
+            // added check to prevent opacity of 0.0, which will bust when we unpremultiply the alpha out
+            if (layer.m_enabled && layer.m_gradientSampler.m_opacity != 0.0f)
+            {
+                // this includes leveling and opacity result, we need unpremultiplied opacity to combine properly
+                layer.m_gradientSampler.GetValues(positions, layerValues);
+
+                // The operation is chosen once per layer, so the loops over the values don't need to branch.
+                const float opacity = layer.m_gradientSampler.m_opacity;
+                switch (layer.m_operation)
+                {
+                default:
+                case MixedGradientLayer::MixingOperation::Initialize:
+                    // the result is reset to 0 before blending, so only the current layer remains
+                    for (size_t index = 0; index < outValues.size(); index++)
+                    {
+                        outValues[index] = (layerValues[index] / opacity) * opacity;
+                    }
+                    break;
+                case MixedGradientLayer::MixingOperation::Multiply:
+                    MixLayerValues(outValues, layerValues, opacity, [](float result, float current) { return result * current; });
+                    break;
+                case MixedGradientLayer::MixingOperation::Add:
+                    MixLayerValues(outValues, layerValues, opacity, [](float result, float current) { return result + current; });
+                    break;
+                case MixedGradientLayer::MixingOperation::Subtract:
+                    MixLayerValues(outValues, layerValues, opacity, [](float result, float current) { return result - current; });
+                    break;
+                case MixedGradientLayer::MixingOperation::Min:
+                    MixLayerValues(outValues, layerValues, opacity, [](float result, float current) { return AZStd::min(current, result); });
+                    break;
+                case MixedGradientLayer::MixingOperation::Max:
+                    MixLayerValues(outValues, layerValues, opacity, [](float result, float current) { return AZStd::max(current, result); });
+                    break;
+                case MixedGradientLayer::MixingOperation::Average:
+                    MixLayerValues(outValues, layerValues, opacity, [](float result, float current) { return (result + current) / 2.0f; });
+                    break;
+                case MixedGradientLayer::MixingOperation::Normal:
+                    MixLayerValues(outValues, layerValues, opacity, []([[maybe_unused]] float result, float current) { return current; });
+                    break;
+                case MixedGradientLayer::MixingOperation::Overlay:
+                    MixLayerValues(outValues, layerValues, opacity,
+                        [](float result, float current)
+                        {
+                            return (result >= 0.5f) ? (1.0f - (2.0f * (1.0f - result) * (1.0f - current))) : (2.0f * result * current);
+                        });
+                    break;
+                }
+            }
+        }
+
+        for (float& value : outValues)
+        {
+            value = AZ::GetClamp(value, 0.0f, 1.0f);
+        }
+    }
+
     bool MixedGradientComponent::IsEntityInHierarchy(const AZ::EntityId& entityId) const
     {
         for (const auto& layer : m_configuration.m_layers)
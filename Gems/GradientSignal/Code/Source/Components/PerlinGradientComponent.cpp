@@ -15,6 +15,7 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/algorithm.h>
 #include <LmbrCentral/Dependency/DependencyNotificationBus.h>
 #include <GradientSignal/Ebuses/GradientTransformRequestBus.h>
 
@@ -192,6 +193,36 @@ namespace GradientSignal
         return 0.0f;
     }
 
+    void PerlinGradientComponent::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        AZ_Assert(positions.size() == outValues.size(), "The position list and the value list need to be the same size.");
+
+        if (!m_perlinImprovedNoise)
+        {
+            AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+            return;
+        }
+
+        // Positions are used as-is if there's no gradient transform to change them.
+        AZStd::vector<AZ::Vector3> uvws(positions);
+        AZStd::vector<bool> wasPointRejected(positions.size(), false);
+        const bool shouldNormalizeOutput = false;
+        GradientTransformRequestBus::Event(
+            GetEntityId(), &GradientTransformRequestBus::Events::TransformPositionsToUVW, positions, uvws, shouldNormalizeOutput, wasPointRejected);
+
+        m_perlinImprovedNoise->GenerateOctaveNoise(uvws, m_configuration.m_octave, m_configuration.m_amplitude, m_configuration.m_frequency, outValues);
+
+        for (size_t index = 0; index < positions.size(); ++index)
+        {
+            if (wasPointRejected[index])
+            {
+                outValues[index] = 0.0f;
+            }
+        }
+    }
+
     int PerlinGradientComponent::GetRandomSeed() const
     {
         return m_configuration.m_randomSeed;
@@ -140,6 +140,13 @@ namespace GradientSignal
         return output;
     }
 
+    void ReferenceGradientComponent::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        m_configuration.m_gradientSampler.GetValues(positions, outValues);
+    }
+
     bool ReferenceGradientComponent::IsEntityInHierarchy(const AZ::EntityId& entityId) const
     {
         return m_configuration.m_gradientSampler.IsEntityInHierarchy(entityId);
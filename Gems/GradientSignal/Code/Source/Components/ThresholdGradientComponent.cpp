@@ -8,6 +8,7 @@
 
 #include "ThresholdGradientComponent.h"
 #include <AzCore/Math/MathUtils.h>
+#include <AzCore/Math/SimdMath.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
@@ -145,6 +146,27 @@ namespace GradientSignal
         return output;
     }
 
+    void ThresholdGradientComponent::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        using Vec4 = AZ::Simd::Vec4;
+
+        m_configuration.m_gradientSampler.GetValues(positions, outValues);
+
+        const size_t simdCount = outValues.size() - (outValues.size() % Vec4::ElementCount);
+        const Vec4::FloatType threshold = Vec4::Splat(m_configuration.m_threshold);
+        const Vec4::FloatType zero = Vec4::ZeroFloat();
+        const Vec4::FloatType one = Vec4::Splat(1.0f);
+        for (size_t index = 0; index < simdCount; index += Vec4::ElementCount)
+        {
+            const Vec4::FloatType value = Vec4::LoadUnaligned(outValues.data() + index);
+            Vec4::StoreUnaligned(outValues.data() + index, Vec4::Select(zero, one, Vec4::CmpLtEq(value, threshold)));
+        }
+        for (size_t index = simdCount; index < outValues.size(); index++)
+        {
+            outValues[index] = outValues[index] <= m_configuration.m_threshold ? 0.0f : 1.0f;
+        }
+    }
+
     bool ThresholdGradientComponent::IsEntityInHierarchy(const AZ::EntityId& entityId) const
     {
         return m_configuration.m_gradientSampler.IsEntityInHierarchy(entityId);
@@ -8,10 +8,12 @@
 
 #include <GradientSignal/GradientSampler.h>
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/Math/SimdMath.h>
 #include <AzCore/Math/Vector3.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/algorithm.h>
 #include <GradientSignal/Ebuses/GradientRequestBus.h>
 #include <GradientSignal/Ebuses/GradientTransformRequestBus.h>
 #include <GradientSignal/Util.h>
@@ -124,6 +126,92 @@ namespace GradientSignal
         }
     }
 
+    void GradientSampler::GetValues(const AZStd::vector<AZ::Vector3>& positions, AZStd::vector<float>& outValues) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        AZ_Assert(positions.size() == outValues.size(), "The position list and the value list need to be the same size.");
+
+        // Values are left at zero if there's no gradient to sample, or nothing handles the request.
+        AZStd::fill(outValues.begin(), outValues.end(), 0.0f);
+
+        if (m_opacity <= 0.0f || !m_gradientId.IsValid())
+        {
+            return;
+        }
+
+        //apply transform if set
+        AZStd::vector<AZ::Vector3> transformedPositions;
+        const bool applyTransform = m_enableTransform && GradientSamplerUtil::AreTransformParamsSet(*this);
+        if (applyTransform)
+        {
+            AZ::Matrix3x4 matrix3x4;
+            matrix3x4.SetFromEulerDegrees(m_rotate);
+            matrix3x4.MultiplyByScale(m_scale);
+            matrix3x4.SetTranslation(m_translate);
+
+            transformedPositions.reserve(positions.size());
+            for (const AZ::Vector3& position : positions)
+            {
+                transformedPositions.emplace_back(matrix3x4 * position);
+            }
+        }
+
+        {
+            // See GetValue for why the surface data mutex is locked around the cyclic dependency check.
+            auto& surfaceDataContext = SurfaceData::SurfaceDataSystemRequestBus::GetOrCreateContext(false);
+            typename SurfaceData::SurfaceDataSystemRequestBus::Context::DispatchLockGuard scopeLock(surfaceDataContext.m_contextMutex);
+
+            if (m_isRequestInProgress)
+            {
+                AZ_ErrorOnce("GradientSignal", !m_isRequestInProgress, "Detected cyclic dependences with gradient entity references");
+                return;
+            }
+
+            m_isRequestInProgress = true;
+
+            GradientRequestBus::Event(
+                m_gradientId, &GradientRequestBus::Events::GetValues, applyTransform ? transformedPositions : positions, outValues);
+
+            m_isRequestInProgress = false;
+        }
+
+        using Vec4 = AZ::Simd::Vec4;
+        const size_t simdCount = outValues.size() - (outValues.size() % Vec4::ElementCount);
+
+        if (m_invertInput)
+        {
+            const Vec4::FloatType one = Vec4::Splat(1.0f);
+            for (size_t index = 0; index < simdCount; index += Vec4::ElementCount)
+            {
+                Vec4::StoreUnaligned(outValues.data() + index, Vec4::Sub(one, Vec4::LoadUnaligned(outValues.data() + index)));
+            }
+            for (size_t index = simdCount; index < outValues.size(); index++)
+            {
+                outValues[index] = 1.0f - outValues[index];
+            }
+        }
+
+        //apply levels if set
+        if (m_enableLevels && GradientSamplerUtil::AreLevelParamsSet(*this))
+        {
+            GetLevels(outValues, m_inputMid, m_inputMin, m_inputMax, m_outputMin, m_outputMax);
+        }
+
+        if (m_opacity != 1.0f)
+        {
+            const Vec4::FloatType opacity = Vec4::Splat(m_opacity);
+            for (size_t index = 0; index < simdCount; index += Vec4::ElementCount)
+            {
+                Vec4::StoreUnaligned(outValues.data() + index, Vec4::Mul(opacity, Vec4::LoadUnaligned(outValues.data() + index)));
+            }
+            for (size_t index = simdCount; index < outValues.size(); index++)
+            {
+                outValues[index] *= m_opacity;
+            }
+        }
+    }
+
     GradientSampler* GradientSampler::GetSampler()
     {
         return this;
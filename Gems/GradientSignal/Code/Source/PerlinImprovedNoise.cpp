@@ -8,6 +8,7 @@
 
 
 #include <GradientSignal/PerlinImprovedNoise.h>
+#include <AzCore/Math/SimdMath.h>
 
 #include <numeric>
 #include <random> // std::mt19937 std::random_device
@@ -60,6 +61,100 @@ namespace GradientSignal
         {
             return a + x * (b - a);
         }
+
+        // SIMD versions of the helpers above, which work on four values at a time.
+        // They use the same operations in the same order as the scalar versions, so they give the same results.
+        using Vec4 = AZ::Simd::Vec4;
+
+        AZ_FORCE_INLINE Vec4::FloatType Gradient(Vec4::Int32ArgType hash, Vec4::FloatArgType x, Vec4::FloatArgType y, Vec4::FloatArgType z)
+        {
+            // Branchless form of the switch in the scalar Gradient: the low 4 bits of the hash pick the two terms
+            // to add, and bits 0 and 1 pick their signs.
+            const Vec4::Int32Type h = Vec4::And(hash, Vec4::Splat(0xF));
+            const Vec4::FloatType firstIsX = Vec4::CastToFloat(Vec4::CmpLt(h, Vec4::Splat(0x8)));
+            const Vec4::FloatType secondIsY = Vec4::CastToFloat(Vec4::CmpLt(h, Vec4::Splat(0x4)));
+            const Vec4::FloatType secondIsX =
+                Vec4::CastToFloat(Vec4::Or(Vec4::CmpEq(h, Vec4::Splat(0xC)), Vec4::CmpEq(h, Vec4::Splat(0xE))));
+            const Vec4::FloatType negateFirst = Vec4::CastToFloat(Vec4::CmpNeq(Vec4::And(h, Vec4::Splat(0x1)), Vec4::ZeroInt()));
+            const Vec4::FloatType negateSecond = Vec4::CastToFloat(Vec4::CmpNeq(Vec4::And(h, Vec4::Splat(0x2)), Vec4::ZeroInt()));
+
+            const Vec4::FloatType first = Vec4::Select(x, y, firstIsX);
+            const Vec4::FloatType second = Vec4::Select(y, Vec4::Select(x, z, secondIsX), secondIsY);
+
+            // -a + b and a - b are computed as (0 - a) + b and a + (0 - b), which round the same way.
+            const Vec4::FloatType zero = Vec4::ZeroFloat();
+            return Vec4::Add(
+                Vec4::Select(Vec4::Sub(zero, first), first, negateFirst), Vec4::Select(Vec4::Sub(zero, second), second, negateSecond));
+        }
+
+        AZ_FORCE_INLINE Vec4::FloatType Fade(Vec4::FloatArgType t)
+        {
+            // t * t * t * (t * (t * 6 - 15) + 10)
+            const Vec4::FloatType inner = Vec4::Add(Vec4::Mul(t, Vec4::Sub(Vec4::Mul(t, Vec4::Splat(6.0f)), Vec4::Splat(15.0f))), Vec4::Splat(10.0f));
+            return Vec4::Mul(Vec4::Mul(Vec4::Mul(t, t), t), inner);
+        }
+
+        AZ_FORCE_INLINE Vec4::FloatType Lerp(Vec4::FloatArgType a, Vec4::FloatArgType b, Vec4::FloatArgType x)
+        {
+            return Vec4::Add(a, Vec4::Mul(x, Vec4::Sub(b, a)));
+        }
+
+        Vec4::FloatType GenerateNoise(const AZStd::array<int, 512>& p, Vec4::FloatArgType x, Vec4::FloatArgType y, Vec4::FloatArgType z)
+        {
+            const Vec4::FloatType floorX = Vec4::Floor(x);
+            const Vec4::FloatType floorY = Vec4::Floor(y);
+            const Vec4::FloatType floorZ = Vec4::Floor(z);
+            const Vec4::FloatType xf = Vec4::Sub(x, floorX);
+            const Vec4::FloatType yf = Vec4::Sub(y, floorY);
+            const Vec4::FloatType zf = Vec4::Sub(z, floorZ);
+
+            const Vec4::Int32Type mask = Vec4::Splat(255);
+            alignas(16) int32_t xi0[Vec4::ElementCount];
+            alignas(16) int32_t yi0[Vec4::ElementCount];
+            alignas(16) int32_t zi0[Vec4::ElementCount];
+            Vec4::StoreAligned(xi0, Vec4::And(Vec4::ConvertToInt(floorX), mask));
+            Vec4::StoreAligned(yi0, Vec4::And(Vec4::ConvertToInt(floorY), mask));
+            Vec4::StoreAligned(zi0, Vec4::And(Vec4::ConvertToInt(floorZ), mask));
+
+            // The permutation table lookups can't be done with SIMD, so they're done per lane.
+            alignas(16) int32_t aaa[Vec4::ElementCount], aba[Vec4::ElementCount], aab[Vec4::ElementCount], abb[Vec4::ElementCount];
+            alignas(16) int32_t baa[Vec4::ElementCount], bba[Vec4::ElementCount], bab[Vec4::ElementCount], bbb[Vec4::ElementCount];
+            for (int lane = 0; lane < Vec4::ElementCount; ++lane)
+            {
+                const int a = p[xi0[lane]];
+                const int b = p[xi0[lane] + 1];
+                const int aa = p[a + yi0[lane]];
+                const int ab = p[a + yi0[lane] + 1];
+                const int ba = p[b + yi0[lane]];
+                const int bb = p[b + yi0[lane] + 1];
+                aaa[lane] = p[aa + zi0[lane]];
+                aab[lane] = p[aa + zi0[lane] + 1];
+                aba[lane] = p[ab + zi0[lane]];
+                abb[lane] = p[ab + zi0[lane] + 1];
+                baa[lane] = p[ba + zi0[lane]];
+                bab[lane] = p[ba + zi0[lane] + 1];
+                bba[lane] = p[bb + zi0[lane]];
+                bbb[lane] = p[bb + zi0[lane] + 1];
+            }
+
+            const Vec4::FloatType u = Fade(xf);
+            const Vec4::FloatType v = Fade(yf);
+            const Vec4::FloatType w = Fade(zf);
+
+            const Vec4::FloatType one = Vec4::Splat(1.0f);
+            const Vec4::FloatType xf1 = Vec4::Sub(xf, one);
+            const Vec4::FloatType yf1 = Vec4::Sub(yf, one);
+            const Vec4::FloatType zf1 = Vec4::Sub(zf, one);
+
+            Vec4::FloatType x1 = Lerp(Gradient(Vec4::LoadAligned(aaa), xf, yf, zf), Gradient(Vec4::LoadAligned(baa), xf1, yf, zf), u);
+            Vec4::FloatType x2 = Lerp(Gradient(Vec4::LoadAligned(aba), xf, yf1, zf), Gradient(Vec4::LoadAligned(bba), xf1, yf1, zf), u);
+            const Vec4::FloatType y1 = Lerp(x1, x2, v);
+            x1 = Lerp(Gradient(Vec4::LoadAligned(aab), xf, yf, zf1), Gradient(Vec4::LoadAligned(bab), xf1, yf, zf1), u);
+            x2 = Lerp(Gradient(Vec4::LoadAligned(abb), xf, yf1, zf1), Gradient(Vec4::LoadAligned(bbb), xf1, yf1, zf1), u);
+            const Vec4::FloatType y2 = Lerp(x1, x2, v);
+
+            return Vec4::Div(Vec4::Add(Lerp(y1, y2, w), one), Vec4::Splat(2.0f));
+        }
     }
 
     PerlinImprovedNoise::PerlinImprovedNoise(int seed)
@@ -87,6 +182,55 @@ namespace GradientSignal
         return total / maxValue;
     }
 
+    void PerlinImprovedNoise::GenerateOctaveNoise(
+        const AZStd::vector<AZ::Vector3>& positions, int octaves, float persistence, float initialFrequency, AZStd::vector<float>& outValues)
+    {
+        AZ_Assert(positions.size() == outValues.size(), "The position list and the value list need to be the same size.");
+
+        using Vec4 = PerlinImprovedNoiseDetails::Vec4;
+
+        // The positions are processed in groups of four. The last group is padded with zeros, and its padding is dropped.
+        for (size_t start = 0; start < positions.size(); start += Vec4::ElementCount)
+        {
+            const size_t count = AZStd::min<size_t>(Vec4::ElementCount, positions.size() - start);
+
+            alignas(16) float xs[Vec4::ElementCount] = {};
+            alignas(16) float ys[Vec4::ElementCount] = {};
+            alignas(16) float zs[Vec4::ElementCount] = {};
+            for (size_t lane = 0; lane < count; ++lane)
+            {
+                xs[lane] = positions[start + lane].GetX();
+                ys[lane] = positions[start + lane].GetY();
+                zs[lane] = positions[start + lane].GetZ();
+            }
+            const Vec4::FloatType x = Vec4::LoadAligned(xs);
+            const Vec4::FloatType y = Vec4::LoadAligned(ys);
+            const Vec4::FloatType z = Vec4::LoadAligned(zs);
+
+            Vec4::FloatType total = Vec4::ZeroFloat();
+            float frequency = initialFrequency;
+            float amplitude = 1.0f;
+            float maxValue = 0.0f;
+            for (int i = 0; i < octaves; ++i)
+            {
+                const Vec4::FloatType frequencies = Vec4::Splat(frequency);
+                const Vec4::FloatType noise = PerlinImprovedNoiseDetails::GenerateNoise(
+                    m_permutationTable, Vec4::Mul(x, frequencies), Vec4::Mul(y, frequencies), Vec4::Mul(z, frequencies));
+                total = Vec4::Add(total, Vec4::Mul(noise, Vec4::Splat(amplitude)));
+                maxValue += amplitude;
+                amplitude *= persistence;
+                frequency *= 2.0f;
+            }
+
+            alignas(16) float values[Vec4::ElementCount];
+            Vec4::StoreAligned(values, (maxValue <= 0.0f) ? Vec4::ZeroFloat() : Vec4::Div(total, Vec4::Splat(maxValue)));
+            for (size_t lane = 0; lane < count; ++lane)
+            {
+                outValues[start + lane] = values[lane];
+            }
+        }
+    }
+
     float PerlinImprovedNoise::GenerateNoise(float x, float y, float z)
     {
         const int fx = (int)std::floor(x);
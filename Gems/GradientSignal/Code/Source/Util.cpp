@@ -10,6 +10,7 @@
 #include <AzCore/Component/TransformBus.h>
 #include <AzCore/Debug/Profiler.h>
 #include <AzCore/Math/MathUtils.h>
+#include <AzCore/Math/SimdMath.h>
 #include <LmbrCentral/Shape/ShapeComponentBus.h>
 #include <GradientSignal/Util.h>
 
@@ -74,4 +75,62 @@ namespace GradientSignal
     {
         return point - bounds.GetMin();
     }
+
+    void GetLevels(AZStd::vector<float>& values, float inputMid, float inputMin, float inputMax, float outputMin, float outputMax)
+    {
+        using Vec4 = AZ::Simd::Vec4;
+
+        // The values that don't fill a whole SIMD vector at the end of the list use the single-value version.
+        const size_t simdCount = values.size() - (values.size() % Vec4::ElementCount);
+        for (size_t index = simdCount; index < values.size(); index++)
+        {
+            values[index] = GetLevels(values[index], inputMid, inputMin, inputMax, outputMin, outputMax);
+        }
+
+        // Clamp the parameters the same way as the single-value version, but only once for all the values.
+        inputMid = AZ::GetClamp(inputMid, 0.01f, 10.0f);
+        inputMin = AZ::GetClamp(inputMin, 0.0f, 1.0f);
+        inputMax = AZ::GetClamp(inputMax, 0.0f, 1.0f);
+        outputMin = AZ::GetClamp(outputMin, 0.0f, 1.0f);
+        outputMax = AZ::GetClamp(outputMax, 0.0f, 1.0f);
+
+        const float inverseMid = 1.0f / inputMid;
+        const Vec4::FloatType zero = Vec4::ZeroFloat();
+        const Vec4::FloatType one = Vec4::Splat(1.0f);
+        const Vec4::FloatType minInput = Vec4::Splat(inputMin);
+        const Vec4::FloatType inputRange = Vec4::Splat(inputMax - inputMin);
+        const Vec4::FloatType minOutput = Vec4::Splat(outputMin);
+        const Vec4::FloatType outputRange = Vec4::Splat(outputMax - outputMin);
+
+        for (size_t index = 0; index < simdCount; index += Vec4::ElementCount)
+        {
+            const Vec4::FloatType input = Vec4::Clamp(Vec4::LoadUnaligned(values.data() + index), zero, one);
+
+            Vec4::FloatType inputCorrected;
+            if (inputMin == inputMax)
+            {
+                inputCorrected = Vec4::Select(one, zero, Vec4::CmpGt(input, minInput));
+            }
+            else
+            {
+                inputCorrected = Vec4::Min(Vec4::Div(Vec4::Max(Vec4::Sub(input, minInput), zero), inputRange), one);
+
+                // There's no SIMD pow, so the midpoint correction is done per value, and skipped entirely for the
+                // default midpoint, where it doesn't change the value.
+                if (inverseMid != 1.0f)
+                {
+                    alignas(16) float corrected[Vec4::ElementCount];
+                    Vec4::StoreAligned(corrected, inputCorrected);
+                    for (float& value : corrected)
+                    {
+                        value = powf(value, inverseMid);
+                    }
+                    inputCorrected = Vec4::LoadAligned(corrected);
+                }
+            }
+
+            // Lerp(outputMin, outputMax, inputCorrected)
+            Vec4::StoreUnaligned(values.data() + index, Vec4::Add(minOutput, Vec4::Mul(outputRange, inputCorrected)));
+        }
+    }
 }
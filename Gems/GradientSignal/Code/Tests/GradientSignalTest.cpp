@@ -13,6 +13,7 @@
 #include <GradientSignal/Ebuses/GradientRequestBus.h>
 #include <Source/Components/PerlinGradientComponent.h>
 #include <Source/Components/RandomGradientComponent.h>
+#include <Source/Components/InvertGradientComponent.h>
 #include <Source/Components/LevelsGradientComponent.h>
 #include <Source/Components/PosterizeGradientComponent.h>
 #include <Source/Components/SmoothStepGradientComponent.h>
@@ -549,6 +550,78 @@ namespace UnitTest
 
         TestThresholdGradientComponent(dataSize, inputData, expectedOutput, 1.0f);
     }
+
+    TEST_F(GradientSignalTestGeneratorFixture, GetValues_PartialSimdGroup_MatchesGetValue)
+    {
+        // The batched path processes four values at a time, so use a position count that isn't a multiple of four to
+        // also cover the scalar tails and the padded Perlin group. The chain goes Perlin -> Invert -> Levels, plus a
+        // Threshold on the Perlin gradient, and is sampled with non-default levels and opacity.
+        GradientSignal::PerlinGradientConfig perlinConfig;
+        perlinConfig.m_randomSeed = 7878;
+        perlinConfig.m_octave = 3;
+        perlinConfig.m_frequency = 0.37f;
+
+        auto perlinEntity = CreateEntity();
+        CreateComponent<GradientSignal::PerlinGradientComponent>(perlinEntity.get(), perlinConfig);
+        GradientSignal::GradientTransformConfig gradientTransformConfig;
+        CreateComponent<GradientSignal::GradientTransformComponent>(perlinEntity.get(), gradientTransformConfig);
+        CreateComponent<MockShapeComponent>(perlinEntity.get());
+        MockShapeComponentHandler mockShapeHandler(perlinEntity->GetId());
+        ActivateEntity(perlinEntity.get());
+
+        GradientSignal::InvertGradientConfig invertConfig;
+        invertConfig.m_gradientSampler.m_gradientId = perlinEntity->GetId();
+        auto invertEntity = CreateEntity();
+        CreateComponent<GradientSignal::InvertGradientComponent>(invertEntity.get(), invertConfig);
+        ActivateEntity(invertEntity.get());
+
+        GradientSignal::LevelsGradientConfig levelsConfig;
+        levelsConfig.m_gradientSampler.m_gradientId = invertEntity->GetId();
+        levelsConfig.m_inputMin = 0.1f;
+        levelsConfig.m_inputMid = 0.8f;
+        levelsConfig.m_inputMax = 0.9f;
+        levelsConfig.m_outputMin = 0.05f;
+        levelsConfig.m_outputMax = 0.95f;
+        auto levelsEntity = CreateEntity();
+        CreateComponent<GradientSignal::LevelsGradientComponent>(levelsEntity.get(), levelsConfig);
+        ActivateEntity(levelsEntity.get());
+
+        GradientSignal::ThresholdGradientConfig thresholdConfig;
+        thresholdConfig.m_gradientSampler.m_gradientId = perlinEntity->GetId();
+        thresholdConfig.m_threshold = 0.5f;
+        auto thresholdEntity = CreateEntity();
+        CreateComponent<GradientSignal::ThresholdGradientComponent>(thresholdEntity.get(), thresholdConfig);
+        ActivateEntity(thresholdEntity.get());
+
+        AZStd::vector<AZ::Vector3> positions;
+        for (int i = 0; i < 7; ++i)
+        {
+            positions.emplace_back(1.3f * i, 0.7f * i + 0.25f, 0.0f);
+        }
+
+        for (const AZ::EntityId gradientId : { levelsEntity->GetId(), thresholdEntity->GetId() })
+        {
+            GradientSignal::GradientSampler gradientSampler;
+            gradientSampler.m_gradientId = gradientId;
+            gradientSampler.m_invertInput = true;
+            gradientSampler.m_enableLevels = true;
+            gradientSampler.m_inputMin = 0.05f;
+            gradientSampler.m_inputMid = 1.4f;
+            gradientSampler.m_inputMax = 0.95f;
+            gradientSampler.m_outputMin = 0.1f;
+            gradientSampler.m_outputMax = 0.8f;
+            gradientSampler.m_opacity = 0.6f;
+
+            AZStd::vector<float> values(positions.size());
+            gradientSampler.GetValues(positions, values);
+            for (size_t index = 0; index < positions.size(); ++index)
+            {
+                GradientSignal::GradientSampleParams params;
+                params.m_position = positions[index];
+                EXPECT_NEAR(gradientSampler.GetValue(params), values[index], 0.0001f);
+            }
+        }
+    }
 }
 
 AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV);
@@ -32,6 +32,19 @@ namespace SurfaceData
         using MutexType = AZStd::recursive_mutex;
 
         virtual void ModifySurfacePoints(SurfacePointList& surfacePointList) const = 0;
+
+        // Modify the surface points of many input positions with a single request.  The default implementation calls
+        // ModifySurfacePoints for each non-empty list; modifiers that can share work between lists should override it.
+        virtual void ModifySurfacePointsFromList(AZStd::vector<SurfacePointList>& surfacePointLists) const
+        {
+            for (SurfacePointList& surfacePointList : surfacePointLists)
+            {
+                if (!surfacePointList.empty())
+                {
+                    ModifySurfacePoints(surfacePointList);
+                }
+            }
+        }
     };
 
     typedef AZ::EBus<SurfaceDataModifierRequests> SurfaceDataModifierRequestBus;
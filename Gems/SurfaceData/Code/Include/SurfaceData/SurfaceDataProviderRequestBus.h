@@ -31,6 +31,19 @@ namespace SurfaceData
         using MutexType = AZStd::recursive_mutex;
 
         virtual void GetSurfacePoints(const AZ::Vector3& inPosition, SurfacePointList& surfacePointList) const = 0;
+
+        // Get the surface points for a whole list of positions with a single request.  The points for inPositions[n] are added to
+        // surfacePointLists[n], so the two lists need to be the same size.  The default implementation calls GetSurfacePoints for
+        // each position; providers that can share work between positions should override it.
+        virtual void GetSurfacePointsFromList(const AZStd::vector<AZ::Vector3>& inPositions, AZStd::vector<SurfacePointList>& surfacePointLists) const
+        {
+            AZ_Assert(inPositions.size() == surfacePointLists.size(), "The position list and the surface point lists need to be the same size.");
+
+            for (size_t index = 0; index < inPositions.size(); index++)
+            {
+                GetSurfacePoints(inPositions[index], surfacePointLists[index]);
+            }
+        }
     };
 
     typedef AZ::EBus<SurfaceDataProviderRequests> SurfaceDataProviderRequestBus;
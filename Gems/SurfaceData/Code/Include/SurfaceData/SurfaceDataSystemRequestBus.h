@@ -41,6 +41,12 @@ namespace SurfaceData
         virtual void GetSurfacePointsFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2 stepSize, const SurfaceTagVector& desiredTags,
                                                 SurfacePointListPerPosition& surfacePointListPerPosition) const = 0;
 
+        // Get the same surface points as GetSurfacePointsFromRegion, but stored in a flat SurfacePointBuffer instead of a list per position.
+        // This is the preferred way to query large regions, since the points can be read in a single pass over a few contiguous arrays,
+        // and a buffer that's reused between queries keeps its allocations.
+        virtual void GetSurfacePointBufferFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2 stepSize, const SurfaceTagVector& desiredTags,
+                                                     SurfacePointBuffer& surfacePointBuffer) const = 0;
+
         virtual SurfaceDataRegistryHandle RegisterSurfaceDataProvider(const SurfaceDataRegistryEntry& entry) = 0;
         virtual void UnregisterSurfaceDataProvider(const SurfaceDataRegistryHandle& handle) = 0;
         virtual void UpdateSurfaceDataProvider(const SurfaceDataRegistryHandle& handle, const SurfaceDataRegistryEntry& entry) = 0;
@@ -36,6 +36,46 @@ namespace SurfaceData
     using SurfacePointList = AZStd::vector<SurfacePoint>;
     using SurfacePointListPerPosition = AZStd::vector<AZStd::pair<AZ::Vector3, SurfacePointList>>;
 
+    //! The surface points for every input position of a region query, stored as flat arrays of point data instead of a
+    //! SurfacePointList per input position.  The points for input position n are the ones from m_pointOffsets[n] up to
+    //! (but not including) m_pointOffsets[n + 1].
+    struct SurfacePointBuffer final
+    {
+        AZ_CLASS_ALLOCATOR(SurfacePointBuffer, AZ::SystemAllocator, 0);
+
+        void Clear()
+        {
+            m_inputPositions.clear();
+            m_pointOffsets.clear();
+            m_entityIds.clear();
+            m_positions.clear();
+            m_normals.clear();
+            m_masks.clear();
+        }
+
+        size_t GetInputPositionCount() const
+        {
+            return m_inputPositions.size();
+        }
+
+        size_t GetPointCount(size_t inputPositionIndex) const
+        {
+            return m_pointOffsets[inputPositionIndex + 1] - m_pointOffsets[inputPositionIndex];
+        }
+
+        size_t GetTotalPointCount() const
+        {
+            return m_positions.size();
+        }
+
+        AZStd::vector<AZ::Vector3> m_inputPositions;
+        AZStd::vector<size_t> m_pointOffsets;
+        AZStd::vector<AZ::EntityId> m_entityIds;
+        AZStd::vector<AZ::Vector3> m_positions;
+        AZStd::vector<AZ::Vector3> m_normals;
+        AZStd::vector<SurfaceTagWeightMap> m_masks;
+    };
+
     struct SurfaceDataRegistryEntry
     {
         AZ::EntityId m_entityId;
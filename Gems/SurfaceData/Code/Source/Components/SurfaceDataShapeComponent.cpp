@@ -149,23 +149,45 @@ namespace SurfaceData
 
         if (m_shapeBoundsIsValid)
         {
-            const AZ::Vector3 rayOrigin = AZ::Vector3(inPosition.GetX(), inPosition.GetY(), m_shapeBounds.GetMax().GetZ());
-            const AZ::Vector3 rayDirection = -AZ::Vector3::CreateAxisZ();
-            float intersectionDistance = 0.0f;
-            bool hitShape = false;
-            LmbrCentral::ShapeComponentRequestsBus::EventResult(hitShape, GetEntityId(), &LmbrCentral::ShapeComponentRequestsBus::Events::IntersectRay, rayOrigin, rayDirection, intersectionDistance);
-            if (hitShape)
+            GetSurfacePointsLocked(inPosition, surfacePointList);
+        }
+    }
+
+    void SurfaceDataShapeComponent::GetSurfacePointsFromList(const AZStd::vector<AZ::Vector3>& inPositions, AZStd::vector<SurfacePointList>& surfacePointLists) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        AZ_Assert(inPositions.size() == surfacePointLists.size(), "The position list and the surface point lists need to be the same size.");
+
+        AZStd::lock_guard<decltype(m_cacheMutex)> lock(m_cacheMutex);
+
+        if (m_shapeBoundsIsValid)
+        {
+            for (size_t index = 0; index < inPositions.size(); index++)
             {
-                SurfacePoint point;
-                point.m_entityId = GetEntityId();
-                point.m_position = rayOrigin + intersectionDistance * rayDirection;
-                point.m_normal = AZ::Vector3::CreateAxisZ();
-                AddMaxValueForMasks(point.m_masks, m_configuration.m_providerTags, 1.0f);
-                surfacePointList.push_back(point);
+                GetSurfacePointsLocked(inPositions[index], surfacePointLists[index]);
             }
         }
     }
 
+    void SurfaceDataShapeComponent::GetSurfacePointsLocked(const AZ::Vector3& inPosition, SurfacePointList& surfacePointList) const
+    {
+        const AZ::Vector3 rayOrigin = AZ::Vector3(inPosition.GetX(), inPosition.GetY(), m_shapeBounds.GetMax().GetZ());
+        const AZ::Vector3 rayDirection = -AZ::Vector3::CreateAxisZ();
+        float intersectionDistance = 0.0f;
+        bool hitShape = false;
+        LmbrCentral::ShapeComponentRequestsBus::EventResult(hitShape, GetEntityId(), &LmbrCentral::ShapeComponentRequestsBus::Events::IntersectRay, rayOrigin, rayDirection, intersectionDistance);
+        if (hitShape)
+        {
+            SurfacePoint point;
+            point.m_entityId = GetEntityId();
+            point.m_position = rayOrigin + intersectionDistance * rayDirection;
+            point.m_normal = AZ::Vector3::CreateAxisZ();
+            AddMaxValueForMasks(point.m_masks, m_configuration.m_providerTags, 1.0f);
+            surfacePointList.push_back(AZStd::move(point));
+        }
+    }
+
     void SurfaceDataShapeComponent::ModifySurfacePoints(SurfacePointList& surfacePointList) const
     {
         AZ_PROFILE_FUNCTION(Entity);
@@ -174,17 +196,37 @@ namespace SurfaceData
 
         if (m_shapeBoundsIsValid && !m_configuration.m_modifierTags.empty())
         {
-            const AZ::EntityId entityId = GetEntityId();
-            for (auto& point : surfacePointList)
+            ModifySurfacePointsLocked(surfacePointList);
+        }
+    }
+
+    void SurfaceDataShapeComponent::ModifySurfacePointsFromList(AZStd::vector<SurfacePointList>& surfacePointLists) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        AZStd::lock_guard<decltype(m_cacheMutex)> lock(m_cacheMutex);
+
+        if (m_shapeBoundsIsValid && !m_configuration.m_modifierTags.empty())
+        {
+            for (auto& surfacePointList : surfacePointLists)
+            {
+                ModifySurfacePointsLocked(surfacePointList);
+            }
+        }
+    }
+
+    void SurfaceDataShapeComponent::ModifySurfacePointsLocked(SurfacePointList& surfacePointList) const
+    {
+        const AZ::EntityId entityId = GetEntityId();
+        for (auto& point : surfacePointList)
+        {
+            if (point.m_entityId != entityId && m_shapeBounds.Contains(point.m_position))
             {
-                if (point.m_entityId != entityId && m_shapeBounds.Contains(point.m_position))
+                bool inside = false;
+                LmbrCentral::ShapeComponentRequestsBus::EventResult(inside, entityId, &LmbrCentral::ShapeComponentRequestsBus::Events::IsPointInside, point.m_position);
+                if (inside)
                 {
-                    bool inside = false;
-                    LmbrCentral::ShapeComponentRequestsBus::EventResult(inside, GetEntityId(), &LmbrCentral::ShapeComponentRequestsBus::Events::IsPointInside, point.m_position);
-                    if (inside)
-                    {
-                        AddMaxValueForMasks(point.m_masks, m_configuration.m_modifierTags, 1.0f);
-                    }
+                    AddMaxValueForMasks(point.m_masks, m_configuration.m_modifierTags, 1.0f);
                 }
             }
         }
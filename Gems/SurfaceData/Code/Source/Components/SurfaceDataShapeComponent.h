@@ -65,10 +65,12 @@ namespace SurfaceData
         //////////////////////////////////////////////////////////////////////////
         // SurfaceDataProviderRequestBus
         void GetSurfacePoints(const AZ::Vector3& inPosition, SurfacePointList& surfacePointList) const override;
+        void GetSurfacePointsFromList(const AZStd::vector<AZ::Vector3>& inPositions, AZStd::vector<SurfacePointList>& surfacePointLists) const override;
 
         //////////////////////////////////////////////////////////////////////////
         // SurfaceDataModifierRequestBus
         void ModifySurfacePoints(SurfacePointList& surfacePointList) const override;
+        void ModifySurfacePointsFromList(AZStd::vector<SurfacePointList>& surfacePointLists) const override;
 
         //////////////////////////////////////////////////////////////////////////
         // AZ::TransformNotificationBus
@@ -85,6 +87,10 @@ namespace SurfaceData
         void OnCompositionChanged();
         void UpdateShapeData();
 
+        // These expect m_cacheMutex to be locked and m_shapeBounds to be valid.
+        void GetSurfacePointsLocked(const AZ::Vector3& inPosition, SurfacePointList& surfacePointList) const;
+        void ModifySurfacePointsLocked(SurfacePointList& surfacePointList) const;
+
         SurfaceDataShapeConfig m_configuration;
 
         SurfaceDataRegistryHandle m_providerHandle = InvalidSurfaceDataRegistryHandle;
@@ -7,9 +7,12 @@
  */
 
 #include <AzCore/Debug/Profiler.h>
+#include <AzCore/Interface/Interface.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/EditContext.h>
+#include <AzCore/Task/TaskExecutor.h>
+#include <AzCore/Task/TaskGraph.h>
 #include <AzCore/std/sort.h>
 
 #include "SurfaceDataSystemComponent.h"
@@ -23,6 +26,40 @@
 
 namespace SurfaceData
 {
+    namespace
+    {
+        // Regions with fewer input positions than this are processed on the calling thread, since splitting them into tiles
+        // would cost more than it saves.  This is low enough that a default vegetation sector (20 x 20 positions) is split.
+        constexpr size_t MinPositionsForParallelRegion = 256;
+
+        // The smallest number of input positions in a tile when a region is processed in parallel.
+        constexpr uint16_t PositionsPerRegionTile = 64;
+
+        // Calls tileFunction(begin, end) on ranges covering [0, count), in parallel tiles on the task graph when it's active.
+        // tileFunction must not call into any EBus, since the caller may be holding bus locks that the tiles would wait on.
+        template<typename TileFunction>
+        void ProcessRegionTiles(size_t count, TileFunction&& tileFunction)
+        {
+            auto taskGraphActive = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+            if (count >= MinPositionsForParallelRegion && taskGraphActive != nullptr && taskGraphActive->IsTaskGraphActive() &&
+                !AZ::TaskExecutor::Instance().IsTaskWorkerThread())
+            {
+                AZ::TaskDescriptor descriptor{ "SurfaceData::SurfaceDataSystemComponent::ProcessRegionTiles", "SurfaceData" };
+                descriptor.grainSize = PositionsPerRegionTile;
+
+                AZ::TaskGraph graph;
+                graph.AddParallelFor(descriptor, 0, count, tileFunction);
+                AZ::TaskGraphEvent finished;
+                graph.Submit(&finished);
+                finished.Wait();
+            }
+            else
+            {
+                tileFunction(size_t{ 0 }, count);
+            }
+        }
+    } // namespace
+
     void SurfaceDataSystemComponent::Reflect(AZ::ReflectContext* context)
     {
         SurfaceTag::Reflect(context);
@@ -223,33 +260,103 @@ namespace SurfaceData
             // same XY coordinates and extremely similar Z values.  This produces results that are sorted in decreasing Z order.
             // Also, this filters out any remaining points that don't match the desired tag list.  This can happen when a surface provider
             // doesn't add a desired tag, and a surface modifier has the *potential* to add it, but then doesn't.
-            CombineSortAndFilterNeighboringPoints(surfacePointList, hasDesiredTags, desiredTags);
+            CombineSortAndFilterNeighboringPoints(surfacePointList, hasDesiredTags, desiredTags, m_targetPointList);
         }
     }
 
     void SurfaceDataSystemComponent::GetSurfacePointsFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2 stepSize, const SurfaceTagVector& desiredTags, SurfacePointListPerPosition& surfacePointListPerPosition) const
     {
+        AZ_PROFILE_FUNCTION(Entity);
+
         AZStd::lock_guard<decltype(m_registrationMutex)> registrationLock(m_registrationMutex);
 
+        AZStd::vector<AZ::Vector3> inPositions;
+        AZStd::vector<SurfacePointList> surfacePointLists;
+        GetSurfacePointListsFromRegion(inRegion, stepSize, desiredTags, inPositions, surfacePointLists);
+
         surfacePointListPerPosition.clear();
-        surfacePointListPerPosition.reserve(aznumeric_cast<uint32_t>(ceil(inRegion.GetXExtent() / stepSize.GetX())) * aznumeric_cast<uint32_t>(ceil(inRegion.GetYExtent() / stepSize.GetY())));
+        surfacePointListPerPosition.reserve(inPositions.size());
+        for (size_t index = 0; index < inPositions.size(); index++)
+        {
+            surfacePointListPerPosition.emplace_back(inPositions[index], AZStd::move(surfacePointLists[index]));
+        }
+    }
 
-        // Initialize our list-per-position list with every input position to query from the region.
+    void SurfaceDataSystemComponent::GetSurfacePointBufferFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2 stepSize, const SurfaceTagVector& desiredTags, SurfacePointBuffer& surfacePointBuffer) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        AZStd::lock_guard<decltype(m_registrationMutex)> registrationLock(m_registrationMutex);
+
+        surfacePointBuffer.Clear();
+
+        AZStd::vector<SurfacePointList> surfacePointLists;
+        GetSurfacePointListsFromRegion(inRegion, stepSize, desiredTags, surfacePointBuffer.m_inputPositions, surfacePointLists);
+
+        // Find where the points for each input position start in the flat arrays, then move the points into place tile by tile.
+        const size_t inputPositionCount = surfacePointLists.size();
+        surfacePointBuffer.m_pointOffsets.resize(inputPositionCount + 1);
+        surfacePointBuffer.m_pointOffsets[0] = 0;
+        for (size_t index = 0; index < inputPositionCount; index++)
+        {
+            surfacePointBuffer.m_pointOffsets[index + 1] = surfacePointBuffer.m_pointOffsets[index] + surfacePointLists[index].size();
+        }
+
+        const size_t totalPointCount = surfacePointBuffer.m_pointOffsets[inputPositionCount];
+        surfacePointBuffer.m_entityIds.resize(totalPointCount);
+        surfacePointBuffer.m_positions.resize(totalPointCount);
+        surfacePointBuffer.m_normals.resize(totalPointCount);
+        surfacePointBuffer.m_masks.resize(totalPointCount);
+
+        ProcessRegionTiles(inputPositionCount, [&surfacePointBuffer, &surfacePointLists](size_t begin, size_t end)
+        {
+            for (size_t index = begin; index < end; index++)
+            {
+                size_t pointIndex = surfacePointBuffer.m_pointOffsets[index];
+                for (SurfacePoint& point : surfacePointLists[index])
+                {
+                    surfacePointBuffer.m_entityIds[pointIndex] = point.m_entityId;
+                    surfacePointBuffer.m_positions[pointIndex] = point.m_position;
+                    surfacePointBuffer.m_normals[pointIndex] = point.m_normal;
+                    surfacePointBuffer.m_masks[pointIndex] = AZStd::move(point.m_masks);
+                    pointIndex++;
+                }
+            }
+        });
+    }
+
+    void SurfaceDataSystemComponent::GetSurfacePointListsFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2 stepSize, const SurfaceTagVector& desiredTags,
+        AZStd::vector<AZ::Vector3>& inPositions, AZStd::vector<SurfacePointList>& surfacePointLists) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        inPositions.clear();
+        inPositions.reserve(aznumeric_cast<uint32_t>(ceil(inRegion.GetXExtent() / stepSize.GetX())) * aznumeric_cast<uint32_t>(ceil(inRegion.GetYExtent() / stepSize.GetY())));
+
+        // Initialize our position list with every input position to query from the region.
         // This is inclusive on the min sides of inRegion, and exclusive on the max sides.
         for (float y = inRegion.GetMin().GetY(); y < inRegion.GetMax().GetY(); y += stepSize.GetY())
         {
             for (float x = inRegion.GetMin().GetX(); x < inRegion.GetMax().GetX(); x += stepSize.GetX())
             {
-                surfacePointListPerPosition.emplace_back(AZ::Vector3(x, y, AZ::Constants::FloatMax), SurfaceData::SurfacePointList{});
+                inPositions.emplace_back(x, y, AZ::Constants::FloatMax);
             }
         }
 
+        surfacePointLists.clear();
+        surfacePointLists.resize(inPositions.size());
+
         const bool hasDesiredTags = HasValidTags(desiredTags);
         const bool hasModifierTags = hasDesiredTags && HasMatchingTags(desiredTags, m_registeredModifierTags);
 
+        // Each provider and modifier gets a single request for all of the input positions within its bounds.  The point lists for those
+        // positions are swapped into entryPointLists for the request, and swapped back afterwards, so no points are copied.
+        AZStd::vector<size_t> entryIndices;
+        AZStd::vector<AZ::Vector3> entryPositions;
+        AZStd::vector<SurfacePointList> entryPointLists;
+
         // Loop through each data provider, and query all the points for each one.  This allows us to check the tags and the overall
-        // AABB bounds just once per provider, instead of once per point.  It also allows for an eventual optimization in which we could send
-        // the list of points directly into each SurfaceDataProvider.
+        // AABB bounds just once per provider, instead of once per point.
         for (const auto& entryPair : m_registeredSurfaceDataProviders)
         {
             const SurfaceDataRegistryEntry& entry = entryPair.second;
@@ -259,14 +366,31 @@ namespace SurfaceData
                 ( alwaysApplies || AabbOverlaps2D(entry.m_bounds, inRegion) )
                 )
             {
-                for (auto& surfacePointListAndPoint : surfacePointListPerPosition)
+                entryIndices.clear();
+                entryPositions.clear();
+                for (size_t index = 0; index < inPositions.size(); index++)
                 {
-                    const auto& point2d = surfacePointListAndPoint.first;
-                    SurfacePointList& surfacePointList = surfacePointListAndPoint.second;
-                    AZ::Vector3 point3d(point2d.GetX(), point2d.GetY(), entry.m_bounds.GetMax().GetZ());
+                    AZ::Vector3 point3d(inPositions[index].GetX(), inPositions[index].GetY(), entry.m_bounds.GetMax().GetZ());
                     if (alwaysApplies || entry.m_bounds.Contains(point3d))
                     {
-                        SurfaceDataProviderRequestBus::Event(entryPair.first, &SurfaceDataProviderRequestBus::Events::GetSurfacePoints, point3d, surfacePointList);
+                        entryIndices.push_back(index);
+                        entryPositions.push_back(point3d);
+                    }
+                }
+
+                if (!entryIndices.empty())
+                {
+                    entryPointLists.resize(entryIndices.size());
+                    for (size_t index = 0; index < entryIndices.size(); index++)
+                    {
+                        AZStd::swap(entryPointLists[index], surfacePointLists[entryIndices[index]]);
+                    }
+
+                    SurfaceDataProviderRequestBus::Event(entryPair.first, &SurfaceDataProviderRequestBus::Events::GetSurfacePointsFromList, entryPositions, entryPointLists);
+
+                    for (size_t index = 0; index < entryIndices.size(); index++)
+                    {
+                        AZStd::swap(entryPointLists[index], surfacePointLists[entryIndices[index]]);
                     }
                 }
             }
@@ -284,19 +408,34 @@ namespace SurfaceData
 
             if (alwaysApplies || AabbOverlaps2D(entry.m_bounds, inRegion))
             {
-                for (auto& surfacePointListAndPoint : surfacePointListPerPosition)
+                entryIndices.clear();
+                for (size_t index = 0; index < inPositions.size(); index++)
                 {
-                    const auto& point2d = surfacePointListAndPoint.first;
-                    SurfacePointList& surfacePointList = surfacePointListAndPoint.second;
-                    if (!surfacePointList.empty())
+                    if (!surfacePointLists[index].empty())
                     {
-                        AZ::Vector3 point3d(point2d.GetX(), point2d.GetY(), entry.m_bounds.GetMax().GetZ());
+                        AZ::Vector3 point3d(inPositions[index].GetX(), inPositions[index].GetY(), entry.m_bounds.GetMax().GetZ());
                         if (alwaysApplies || entry.m_bounds.Contains(point3d))
                         {
-                            SurfaceDataModifierRequestBus::Event(entryPair.first, &SurfaceDataModifierRequestBus::Events::ModifySurfacePoints, surfacePointList);
+                            entryIndices.push_back(index);
                         }
                     }
                 }
+
+                if (!entryIndices.empty())
+                {
+                    entryPointLists.resize(entryIndices.size());
+                    for (size_t index = 0; index < entryIndices.size(); index++)
+                    {
+                        AZStd::swap(entryPointLists[index], surfacePointLists[entryIndices[index]]);
+                    }
+
+                    SurfaceDataModifierRequestBus::Event(entryPair.first, &SurfaceDataModifierRequestBus::Events::ModifySurfacePointsFromList, entryPointLists);
+
+                    for (size_t index = 0; index < entryIndices.size(); index++)
+                    {
+                        AZStd::swap(entryPointLists[index], surfacePointLists[entryIndices[index]]);
+                    }
+                }
             }
         }
 
@@ -304,17 +443,22 @@ namespace SurfaceData
         // same XY coordinates and extremely similar Z values.  This produces results that are sorted in decreasing Z order.
         // Also, this filters out any remaining points that don't match the desired tag list.  This can happen when a surface provider
         // doesn't add a desired tag, and a surface modifier has the *potential* to add it, but then doesn't.
-        for (auto& surfacePointListAndPoint : surfacePointListPerPosition)
+        // This only touches the point lists, so large regions are split into tiles that are processed in parallel.
+        ProcessRegionTiles(surfacePointLists.size(), [this, &surfacePointLists, hasDesiredTags, &desiredTags](size_t begin, size_t end)
         {
-            auto& surfacePointList = surfacePointListAndPoint.second;
-            if (!surfacePointList.empty())
+            SurfacePointList targetPointList;
+            for (size_t index = begin; index < end; index++)
             {
-                CombineSortAndFilterNeighboringPoints(surfacePointList, hasDesiredTags, desiredTags);
+                if (!surfacePointLists[index].empty())
+                {
+                    CombineSortAndFilterNeighboringPoints(surfacePointLists[index], hasDesiredTags, desiredTags, targetPointList);
+                }
             }
-        }
+        });
     }
 
-    void SurfaceDataSystemComponent::CombineSortAndFilterNeighboringPoints(SurfacePointList& sourcePointList, bool hasDesiredTags, const SurfaceTagVector& desiredTags) const
+    void SurfaceDataSystemComponent::CombineSortAndFilterNeighboringPoints(SurfacePointList& sourcePointList, bool hasDesiredTags, const SurfaceTagVector& desiredTags,
+        SurfacePointList& targetPointList) const
     {
         AZ_PROFILE_FUNCTION(Entity);
 
@@ -339,8 +483,8 @@ namespace SurfaceData
         size_t targetPointIndex = 0;
         size_t sourcePointIndex = 0;
 
-        m_targetPointList.clear();
-        m_targetPointList.reserve(sourcePointCount);
+        targetPointList.clear();
+        targetPointList.reserve(sourcePointCount);
 
         // Locate the first point that matches our desired tags, if one exists.
         for (sourcePointIndex = 0; sourcePointIndex < sourcePointCount; sourcePointIndex++)
@@ -354,7 +498,7 @@ namespace SurfaceData
         if (sourcePointIndex < sourcePointCount)
         {
             // We found a point that matches our tags, so add it to our target list as the first point.
-            m_targetPointList.push_back(sourcePointList[sourcePointIndex++]);
+            targetPointList.push_back(sourcePointList[sourcePointIndex++]);
 
             //iterate over subsequent source points for comparison and consolidation with the last added target/unique point
             for (; sourcePointIndex < sourcePointCount; ++sourcePointIndex)
@@ -363,7 +507,7 @@ namespace SurfaceData
 
                 if (!hasDesiredTags || (HasMatchingTags(sourcePoint.m_masks, desiredTags)))
                 {
-                    auto& targetPoint = m_targetPointList[targetPointIndex];
+                    auto& targetPoint = targetPointList[targetPointIndex];
 
                     // [LY-90907] need to add a configurable tolerance for comparison
                     if (targetPoint.m_position.IsClose(sourcePoint.m_position) &&
@@ -375,12 +519,12 @@ namespace SurfaceData
                     }
 
                     //if the points were too different, we have to add a new target point to compare against
-                    m_targetPointList.push_back(sourcePoint);
+                    targetPointList.push_back(sourcePoint);
                     ++targetPointIndex;
                 }
             }
 
-            AZStd::swap(sourcePointList, m_targetPointList);
+            AZStd::swap(sourcePointList, targetPointList);
         }
     }
 
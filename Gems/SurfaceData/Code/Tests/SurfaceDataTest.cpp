@@ -13,11 +13,13 @@
 
 #include <AzCore/Component/ComponentApplication.h>
 #include <AzCore/Component/Entity.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Math/Random.h>
 #include <AzCore/Memory/Memory.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Script/ScriptContext.h>
+#include <AzCore/Task/TaskGraph.h>
 #include <AzCore/std/chrono/clocks.h>
 #include <SurfaceDataSystemComponent.h>
 #include <SurfaceDataModule.h>
@@ -740,4 +742,118 @@ TEST_F(SurfaceDataTestApp, SurfaceData_TestSurfacePointsFromRegion_DissimilarPoi
     }
 }
 
+TEST_F(SurfaceDataTestApp, SurfaceData_TestSurfacePointBufferFromRegion_MatchesSurfacePointsFromRegion)
+{
+    // This test verifies that GetSurfacePointBufferFromRegion returns the same input positions and surface points,
+    // in the same order, as GetSurfacePointsFromRegion, including the tags added by surface modifiers.
+
+    // Create a mock Surface Provider that covers from (0,0) - (8, 8) in space, with heights of 0 and 4, and with the tag "test_surface1".
+    SurfaceData::SurfaceTagVector providerTags = { SurfaceData::SurfaceTag(m_testSurface1Crc) };
+    MockSurfaceProvider mockProvider(MockSurfaceProvider::ProviderType::SURFACE_PROVIDER, providerTags,
+                                     AZ::Vector3(0.0f), AZ::Vector3(8.0f), AZ::Vector3(0.25f, 0.25f, 4.0f));
+
+    // Create a mock Surface Modifier that only covers from (0,0) - (4, 8) in space, so that only some of the points get its tag.
+    SurfaceData::SurfaceTagVector modifierTags = { SurfaceData::SurfaceTag(m_testSurface2Crc) };
+    MockSurfaceProvider mockModifier(MockSurfaceProvider::ProviderType::SURFACE_MODIFIER, modifierTags,
+                                     AZ::Vector3(0.0f), AZ::Vector3(4.0f, 8.0f, 8.0f), AZ::Vector3(0.25f, 0.25f, 4.0f));
+
+    // Query for all the surface points from (-2, -2) - (10, 10) with a step size of 0.5, so that some positions have no points.
+    AZ::Vector2 stepSize(0.5f, 0.5f);
+    AZ::Aabb regionBounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-2.0f), AZ::Vector3(10.0f));
+    SurfaceData::SurfaceTagVector testTags = { SurfaceData::SurfaceTag(m_testSurface1Crc), SurfaceData::SurfaceTag(m_testSurface2Crc) };
+
+    SurfaceData::SurfacePointListPerPosition availablePointsPerPosition;
+    SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+        &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointsFromRegion,
+        regionBounds, stepSize, testTags, availablePointsPerPosition);
+
+    SurfaceData::SurfacePointBuffer availablePoints;
+    SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+        &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointBufferFromRegion,
+        regionBounds, stepSize, testTags, availablePoints);
+
+    ASSERT_EQ(availablePoints.GetInputPositionCount(), availablePointsPerPosition.size());
+    ASSERT_EQ(availablePoints.m_pointOffsets.size(), availablePointsPerPosition.size() + 1);
+
+    size_t pointIndex = 0;
+    for (size_t positionIndex = 0; positionIndex < availablePointsPerPosition.size(); positionIndex++)
+    {
+        const SurfaceData::SurfacePointList& pointList = availablePointsPerPosition[positionIndex].second;
+        EXPECT_EQ(availablePoints.m_inputPositions[positionIndex], availablePointsPerPosition[positionIndex].first);
+        ASSERT_EQ(availablePoints.GetPointCount(positionIndex), pointList.size());
+        EXPECT_EQ(availablePoints.m_pointOffsets[positionIndex], pointIndex);
+
+        for (const auto& point : pointList)
+        {
+            EXPECT_EQ(availablePoints.m_entityIds[pointIndex], point.m_entityId);
+            EXPECT_EQ(availablePoints.m_positions[pointIndex], point.m_position);
+            EXPECT_EQ(availablePoints.m_normals[pointIndex], point.m_normal);
+            EXPECT_EQ(availablePoints.m_masks[pointIndex], point.m_masks);
+            pointIndex++;
+        }
+    }
+
+    EXPECT_EQ(availablePoints.GetTotalPointCount(), pointIndex);
+}
+
+TEST_F(SurfaceDataTestApp, SurfaceData_TestSurfacePointBufferFromRegion_LargeRegionOnTaskGraph_ReturnsExpectedPoints)
+{
+    // This test verifies that a region that's large enough to be split into tiles that are processed in parallel on the
+    // task graph returns the expected points, in the same order as the input positions.
+
+    AZ::Interface<AZ::IConsole>::Get()->PerformCommand("cl_activateTaskGraph true");
+    auto taskGraphActive = AZ::Interface<AZ::TaskGraphActiveInterface>::Get();
+    const bool isTaskGraphActive = taskGraphActive != nullptr && taskGraphActive->IsTaskGraphActive();
+
+    // Create a mock Surface Provider that covers from (0,0) - (64, 64) in space.
+    // It defines points spaced 1 apart, with heights of 0 and 4, and with the tag "test_surface1".
+    SurfaceData::SurfaceTagVector providerTags = { SurfaceData::SurfaceTag(m_testSurface1Crc) };
+    MockSurfaceProvider mockProvider(MockSurfaceProvider::ProviderType::SURFACE_PROVIDER, providerTags,
+                                     AZ::Vector3(0.0f), AZ::Vector3(64.0f, 64.0f, 8.0f), AZ::Vector3(1.0f, 1.0f, 4.0f));
+
+    // Create a mock Surface Modifier that only covers from (0,0) - (32, 64) in space, and adds the tag "test_surface2".
+    SurfaceData::SurfaceTagVector modifierTags = { SurfaceData::SurfaceTag(m_testSurface2Crc) };
+    MockSurfaceProvider mockModifier(MockSurfaceProvider::ProviderType::SURFACE_MODIFIER, modifierTags,
+                                     AZ::Vector3(0.0f), AZ::Vector3(32.0f, 64.0f, 8.0f), AZ::Vector3(1.0f, 1.0f, 4.0f));
+
+    // Query for all the surface points from (0, 0) - (64, 64) with a step size of 1, which gives 4096 input positions.
+    AZ::Vector2 stepSize(1.0f, 1.0f);
+    AZ::Aabb regionBounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f), AZ::Vector3(64.0f));
+    SurfaceData::SurfaceTagVector testTags = { SurfaceData::SurfaceTag(m_testSurface1Crc), SurfaceData::SurfaceTag(m_testSurface2Crc) };
+
+    SurfaceData::SurfacePointBuffer availablePoints;
+    SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+        &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointBufferFromRegion,
+        regionBounds, stepSize, testTags, availablePoints);
+
+    AZ::Interface<AZ::IConsole>::Get()->PerformCommand("cl_activateTaskGraph false");
+
+    ASSERT_TRUE(isTaskGraphActive);
+    ASSERT_EQ(availablePoints.GetInputPositionCount(), 64u * 64u);
+    ASSERT_EQ(availablePoints.GetTotalPointCount(), 64u * 64u * 2u);
+
+    // We expect every input position to have two surface points, with heights 4 and 0 in that order. Every point has the
+    // "test_surface1" tag, and the points in the left half of the region also have the "test_surface2" tag.
+    size_t positionIndex = 0;
+    for (float y = 0.0f; y < 64.0f; y += 1.0f)
+    {
+        for (float x = 0.0f; x < 64.0f; x += 1.0f)
+        {
+            EXPECT_EQ(availablePoints.m_inputPositions[positionIndex], AZ::Vector3(x, y, AZ::Constants::FloatMax));
+            ASSERT_EQ(availablePoints.GetPointCount(positionIndex), 2u);
+
+            const size_t expectedMaskCount = (x < 32.0f) ? 2u : 1u;
+            const float heights[] = { 4.0f, 0.0f };
+            for (size_t heightIndex = 0; heightIndex < AZ_ARRAY_SIZE(heights); heightIndex++)
+            {
+                const size_t pointIndex = availablePoints.m_pointOffsets[positionIndex] + heightIndex;
+                EXPECT_EQ(availablePoints.m_positions[pointIndex], AZ::Vector3(x, y, heights[heightIndex]));
+                EXPECT_EQ(availablePoints.m_normals[pointIndex], AZ::Vector3::CreateAxisZ());
+                EXPECT_EQ(availablePoints.m_masks[pointIndex].size(), expectedMaskCount);
+            }
+            positionIndex++;
+        }
+    }
+}
+
 AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV);
@@ -183,6 +183,59 @@ namespace Terrain
         outPosition.SetZ(AZ::GetClamp(height, m_cachedMinWorldHeight, m_cachedMaxWorldHeight));
     }
 
+    void TerrainHeightGradientListComponent::GetHeights(
+        const AZStd::vector<AZ::Vector3>& inPositions, AZStd::vector<float>& outHeights, AZStd::vector<bool>& outTerrainExists)
+    {
+        AZ_Assert(
+            (outHeights.size() == inPositions.size()) && (outTerrainExists.size() == inPositions.size()),
+            "Output vectors need to be sized to match the input positions.");
+
+        const size_t numPositions = inPositions.size();
+        AZStd::vector<float> maxSamples(numPositions, 0.0f);
+        bool terrainExists = false;
+        AZ_WarningOnce("Terrain", !m_isRequestInProgress, "Detected cyclic dependences with terrain height entity references");
+        if (!m_isRequestInProgress)
+        {
+            m_isRequestInProgress = true;
+
+            // Flatten the positions the same way GetHeight does, so that every gradient gets sampled in one batched call.
+            AZStd::vector<AZ::Vector3> samplePositions;
+            samplePositions.reserve(numPositions);
+            for (const AZ::Vector3& position : inPositions)
+            {
+                samplePositions.emplace_back(position.GetX(), position.GetY(), 0.0f);
+            }
+
+            // See GetHeight for why the highest sample from all the gradients is used.
+            AZStd::vector<float> samples(numPositions, 0.0f);
+            for (auto& gradientId : m_configuration.m_gradientEntities)
+            {
+                if (gradientId.IsValid())
+                {
+                    terrainExists = true;
+
+                    AZStd::fill(samples.begin(), samples.end(), 0.0f);
+                    GradientSignal::GradientRequestBus::Event(
+                        gradientId, &GradientSignal::GradientRequestBus::Events::GetValues, samplePositions, samples);
+                    for (size_t index = 0; index < numPositions; index++)
+                    {
+                        maxSamples[index] = AZ::GetMax(maxSamples[index], samples[index]);
+                    }
+                }
+            }
+            m_isRequestInProgress = false;
+        }
+
+        const float minHeight = m_cachedShapeBounds.GetMin().GetZ();
+        const float maxHeight = m_cachedShapeBounds.GetMax().GetZ();
+        for (size_t index = 0; index < numPositions; index++)
+        {
+            const float height = AZ::Lerp(minHeight, maxHeight, maxSamples[index]);
+            outHeights[index] = AZ::GetClamp(height, m_cachedMinWorldHeight, m_cachedMaxWorldHeight);
+            outTerrainExists[index] = terrainExists;
+        }
+    }
+
     void TerrainHeightGradientListComponent::OnCompositionChanged()
     {
         RefreshMinMaxHeights();
@@ -230,23 +230,18 @@ namespace Terrain
         GetHeightfieldGridSize(gridWidth, gridHeight);
 
         heights.clear();
-        heights.reserve(gridWidth * gridHeight);
+        heights.resize(gridWidth * gridHeight, 0.0f);
 
-        for (int32_t row = 0; row < gridHeight; row++)
+        // Query the whole grid at once, which lets the terrain system share the work between the heights.
+        auto perPositionCallback = [&heights, gridWidth, worldCenterZ](
+            size_t xIndex, size_t yIndex, const AzFramework::SurfaceData::SurfacePoint& surfacePoint, [[maybe_unused]] bool terrainExists)
         {
-            const float y = row * gridResolution.GetY() + worldSize.GetMin().GetY();
-            for (int32_t col = 0; col < gridWidth; col++)
-            {
-                const float x = col * gridResolution.GetX() + worldSize.GetMin().GetX();
-                float height = 0.0f;
-
-                AzFramework::Terrain::TerrainDataRequestBus::BroadcastResult(
-                    height, &AzFramework::Terrain::TerrainDataRequests::GetHeightFromFloats, x, y,
-                    AzFramework::Terrain::TerrainDataRequests::Sampler::DEFAULT, nullptr);
+            heights[yIndex * gridWidth + xIndex] = surfacePoint.m_position.GetZ() - worldCenterZ;
+        };
 
-                heights.emplace_back(height - worldCenterZ);
-            }
-        }
+        AzFramework::Terrain::TerrainDataRequestBus::Broadcast(
+            &AzFramework::Terrain::TerrainDataRequests::ProcessHeightsFromRegion, worldSize, gridResolution, perPositionCallback,
+            AzFramework::Terrain::TerrainDataRequests::Sampler::DEFAULT);
     }
 
     void TerrainPhysicsColliderComponent::GenerateHeightsAndMaterialsInBounds(
@@ -264,34 +259,28 @@ namespace Terrain
         GetHeightfieldGridSize(gridWidth, gridHeight);
 
         heightMaterials.clear();
-        heightMaterials.reserve(gridWidth * gridHeight);
+        heightMaterials.resize(gridWidth * gridHeight);
 
-        for (int32_t row = 0; row < gridHeight; row++)
+        auto perPositionCallback = [&heightMaterials, gridWidth, worldCenterZ, worldHeightBoundsMin, worldHeightBoundsMax](
+            size_t xIndex, size_t yIndex, const AzFramework::SurfaceData::SurfacePoint& surfacePoint, bool terrainExists)
         {
-            const float y = row * gridResolution.GetY() + worldSize.GetMin().GetY();
-            for (int32_t col = 0; col < gridWidth; col++)
+            float height = surfacePoint.m_position.GetZ();
+
+            // Any heights that fall outside the range of our bounding box will get turned into holes.
+            if ((height < worldHeightBoundsMin) || (height > worldHeightBoundsMax))
             {
-                const float x = col * gridResolution.GetX() + worldSize.GetMin().GetX();
-                float height = 0.0f;
-
-                bool terrainExists = true;
-                AzFramework::Terrain::TerrainDataRequestBus::BroadcastResult(
-                    height, &AzFramework::Terrain::TerrainDataRequests::GetHeightFromFloats, x, y,
-                    AzFramework::Terrain::TerrainDataRequests::Sampler::DEFAULT, &terrainExists);
-
-                // Any heights that fall outside the range of our bounding box will get turned into holes.
-                if ((height < worldHeightBoundsMin) || (height > worldHeightBoundsMax))
-                {
-                    height = worldHeightBoundsMin;
-                    terrainExists = false;
-                }
-
-                Physics::HeightMaterialPoint point;
-                point.m_height = height - worldCenterZ;
-                point.m_quadMeshType = terrainExists ? Physics::QuadMeshType::SubdivideUpperLeftToBottomRight : Physics::QuadMeshType::Hole;
-                heightMaterials.emplace_back(point);
+                height = worldHeightBoundsMin;
+                terrainExists = false;
             }
-        }
+
+            Physics::HeightMaterialPoint& point = heightMaterials[yIndex * gridWidth + xIndex];
+            point.m_height = height - worldCenterZ;
+            point.m_quadMeshType = terrainExists ? Physics::QuadMeshType::SubdivideUpperLeftToBottomRight : Physics::QuadMeshType::Hole;
+        };
+
+        AzFramework::Terrain::TerrainDataRequestBus::Broadcast(
+            &AzFramework::Terrain::TerrainDataRequests::ProcessHeightsFromRegion, worldSize, gridResolution, perPositionCallback,
+            AzFramework::Terrain::TerrainDataRequests::Sampler::DEFAULT);
     }
 
     AZ::Vector2 TerrainPhysicsColliderComponent::GetHeightfieldGridSpacing() const
@@ -9,6 +9,7 @@
 #include <TerrainSystem/TerrainSystem.h>
 #include <AzCore/std/parallel/shared_mutex.h>
 #include <AzCore/std/sort.h>
+#include <AzCore/Math/SimdMath.h>
 #include <SurfaceData/SurfaceDataTypes.h>
 #include <SurfaceData/SurfaceDataSystemRequestBus.h>
 #include <LmbrCentral/Shape/ShapeComponentBus.h>
@@ -227,8 +228,6 @@ float TerrainSystem::GetTerrainAreaHeight(float x, float y, bool& terrainExists)
     float height = worldMin;
     terrainExists = false;
 
-    AZStd::shared_lock<AZStd::shared_mutex> lock(m_areaMutex);
-
     for (auto& [areaId, areaData] : m_registeredAreas)
     {
         const float areaMin = areaData.m_areaBounds.GetMin().GetZ();
@@ -254,6 +253,198 @@ float TerrainSystem::GetTerrainAreaHeight(float x, float y, bool& terrainExists)
     return height;
 }
 
+void TerrainSystem::GetTerrainAreaHeights(
+    const AZStd::vector<AZ::Vector3>& inPositions,
+    AZStd::vector<float>& outHeights,
+    AZStd::vector<bool>& outTerrainExists) const
+{
+    // Batched version of GetTerrainAreaHeight. Each position goes to the first area containing it, as in the single
+    // position query, but each area only gets one request for all of its positions.
+    const size_t numPositions = inPositions.size();
+    const float worldMin = m_currentSettings.m_worldBounds.GetMin().GetZ();
+    outHeights.assign(numPositions, worldMin);
+    outTerrainExists.assign(numPositions, false);
+
+    AZStd::vector<bool> positionAssigned(numPositions, false);
+    size_t numUnassigned = numPositions;
+
+    AZStd::vector<size_t> areaIndices;
+    AZStd::vector<AZ::Vector3> areaPositions;
+    AZStd::vector<float> areaHeights;
+    AZStd::vector<bool> areaTerrainExists;
+
+    for (auto& [areaId, areaData] : m_registeredAreas)
+    {
+        if (numUnassigned == 0)
+        {
+            break;
+        }
+
+        const float areaMin = areaData.m_areaBounds.GetMin().GetZ();
+        areaIndices.clear();
+        areaPositions.clear();
+        for (size_t index = 0; index < numPositions; index++)
+        {
+            if (!positionAssigned[index])
+            {
+                const AZ::Vector3 inPosition(inPositions[index].GetX(), inPositions[index].GetY(), areaMin);
+                if (areaData.m_areaBounds.Contains(inPosition))
+                {
+                    positionAssigned[index] = true;
+                    areaIndices.emplace_back(index);
+                    areaPositions.emplace_back(inPosition);
+                }
+            }
+        }
+
+        if (areaIndices.empty())
+        {
+            continue;
+        }
+        numUnassigned -= areaIndices.size();
+
+        areaHeights.assign(areaIndices.size(), worldMin);
+        areaTerrainExists.assign(areaIndices.size(), false);
+        Terrain::TerrainAreaHeightRequestBus::Event(
+            areaId, &Terrain::TerrainAreaHeightRequestBus::Events::GetHeights, areaPositions, areaHeights, areaTerrainExists);
+
+        for (size_t areaIndex = 0; areaIndex < areaIndices.size(); areaIndex++)
+        {
+            const size_t index = areaIndices[areaIndex];
+            if (areaTerrainExists[areaIndex])
+            {
+                outHeights[index] = areaHeights[areaIndex];
+                outTerrainExists[index] = true;
+            }
+            else
+            {
+                // See GetTerrainAreaHeight for how the "use ground plane" setting is applied.
+                outHeights[index] = areaData.m_useGroundPlane ? areaMin : worldMin;
+                outTerrainExists[index] = areaData.m_useGroundPlane;
+            }
+        }
+    }
+}
+
+void TerrainSystem::GetHeightsSynchronous(
+    const AZStd::vector<AZ::Vector3>& inPositions,
+    Sampler sampler,
+    AZStd::vector<float>& outHeights,
+    AZStd::vector<bool>& outTerrainExists) const
+{
+    const size_t numPositions = inPositions.size();
+    const float worldMin = m_currentSettings.m_worldBounds.GetMin().GetZ();
+    const float worldMax = m_currentSettings.m_worldBounds.GetMax().GetZ();
+
+    outHeights.resize(numPositions);
+    outTerrainExists.resize(numPositions);
+
+    switch (sampler)
+    {
+    case AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR:
+        {
+            // Fetch the four corner heights and the interpolation weights for every position first, so that the
+            // interpolation can be done for several positions at a time. The arrays are padded to a whole number of
+            // SIMD vectors, and the padding is interpolated along with the rest and then ignored.
+            using Vec4 = AZ::Simd::Vec4;
+            const size_t paddedCount = AZ::SizeAlignUp(numPositions, Vec4::ElementCount);
+            AZStd::vector<float> sampleData(paddedCount * 6, 0.0f);
+            float* heightsX0Y0 = sampleData.data();
+            float* heightsX1Y0 = heightsX0Y0 + paddedCount;
+            float* heightsX0Y1 = heightsX1Y0 + paddedCount;
+            float* heightsX1Y1 = heightsX0Y1 + paddedCount;
+            float* deltasX = heightsX1Y1 + paddedCount;
+            float* deltasY = deltasX + paddedCount;
+
+            // The corner positions are laid out one corner after another, so that all of them can be fetched from the
+            // terrain areas in a single batched query.
+            AZStd::vector<AZ::Vector3> cornerPositions(numPositions * 4);
+            for (size_t index = 0; index < numPositions; index++)
+            {
+                // See GetHeightSynchronous for how the corners and the deltas are computed.
+                AZ::Vector2 normalizedDelta;
+                AZ::Vector2 pos0;
+                ClampPosition(inPositions[index].GetX(), inPositions[index].GetY(), pos0, normalizedDelta);
+                const AZ::Vector2 pos1 = pos0 + m_currentSettings.m_heightQueryResolution;
+
+                cornerPositions[index] = AZ::Vector3(pos0.GetX(), pos0.GetY(), 0.0f);
+                cornerPositions[numPositions + index] = AZ::Vector3(pos1.GetX(), pos0.GetY(), 0.0f);
+                cornerPositions[(numPositions * 2) + index] = AZ::Vector3(pos0.GetX(), pos1.GetY(), 0.0f);
+                cornerPositions[(numPositions * 3) + index] = AZ::Vector3(pos1.GetX(), pos1.GetY(), 0.0f);
+                deltasX[index] = normalizedDelta.GetX();
+                deltasY[index] = normalizedDelta.GetY();
+            }
+
+            AZStd::vector<float> cornerHeights;
+            AZStd::vector<bool> cornerTerrainExists;
+            GetTerrainAreaHeights(cornerPositions, cornerHeights, cornerTerrainExists);
+
+            AZStd::copy(cornerHeights.begin(), cornerHeights.begin() + numPositions, heightsX0Y0);
+            AZStd::copy(cornerHeights.begin() + numPositions, cornerHeights.begin() + (numPositions * 2), heightsX1Y0);
+            AZStd::copy(cornerHeights.begin() + (numPositions * 2), cornerHeights.begin() + (numPositions * 3), heightsX0Y1);
+            AZStd::copy(cornerHeights.begin() + (numPositions * 3), cornerHeights.end(), heightsX1Y1);
+
+            // Like the single position query, existence comes from the last corner that was sampled.
+            for (size_t index = 0; index < numPositions; index++)
+            {
+                outTerrainExists[index] = cornerTerrainExists[(numPositions * 3) + index];
+            }
+
+            const Vec4::FloatType minHeight = Vec4::Splat(worldMin);
+            const Vec4::FloatType maxHeight = Vec4::Splat(worldMax);
+            for (size_t index = 0; index < paddedCount; index += Vec4::ElementCount)
+            {
+                const Vec4::FloatType heightX0Y0 = Vec4::LoadUnaligned(heightsX0Y0 + index);
+                const Vec4::FloatType heightX1Y0 = Vec4::LoadUnaligned(heightsX1Y0 + index);
+                const Vec4::FloatType heightX0Y1 = Vec4::LoadUnaligned(heightsX0Y1 + index);
+                const Vec4::FloatType heightX1Y1 = Vec4::LoadUnaligned(heightsX1Y1 + index);
+                const Vec4::FloatType deltaX = Vec4::LoadUnaligned(deltasX + index);
+                const Vec4::FloatType deltaY = Vec4::LoadUnaligned(deltasY + index);
+
+                // Lerp(a, b, t) == a + (b - a) * t
+                const Vec4::FloatType heightXY0 = Vec4::Madd(Vec4::Sub(heightX1Y0, heightX0Y0), deltaX, heightX0Y0);
+                const Vec4::FloatType heightXY1 = Vec4::Madd(Vec4::Sub(heightX1Y1, heightX0Y1), deltaX, heightX0Y1);
+                const Vec4::FloatType height = Vec4::Madd(Vec4::Sub(heightXY1, heightXY0), deltaY, heightXY0);
+
+                // The results overwrite the first corner, which isn't needed anymore.
+                Vec4::StoreUnaligned(heightsX0Y0 + index, Vec4::Clamp(height, minHeight, maxHeight));
+            }
+
+            AZStd::copy(heightsX0Y0, heightsX0Y0 + numPositions, outHeights.begin());
+        }
+        return;
+
+    case AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP:
+        {
+            AZStd::vector<AZ::Vector3> clampedPositions(numPositions);
+            for (size_t index = 0; index < numPositions; index++)
+            {
+                AZ::Vector2 normalizedDelta;
+                AZ::Vector2 clampedPosition;
+                ClampPosition(inPositions[index].GetX(), inPositions[index].GetY(), clampedPosition, normalizedDelta);
+                clampedPositions[index] = AZ::Vector3(clampedPosition.GetX(), clampedPosition.GetY(), 0.0f);
+            }
+
+            GetTerrainAreaHeights(clampedPositions, outHeights, outTerrainExists);
+            for (float& height : outHeights)
+            {
+                height = AZ::GetClamp(height, worldMin, worldMax);
+            }
+        }
+        return;
+
+    case AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT:
+        [[fallthrough]];
+    default:
+        GetTerrainAreaHeights(inPositions, outHeights, outTerrainExists);
+        for (float& height : outHeights)
+        {
+            height = AZ::GetClamp(height, worldMin, worldMax);
+        }
+        return;
+    }
+}
+
 float TerrainSystem::GetHeight(const AZ::Vector3& position, Sampler sampler, bool* terrainExistsPtr) const
 {
     return GetHeightSynchronous(position.GetX(), position.GetY(), sampler, terrainExistsPtr);
@@ -319,6 +510,48 @@ AZ::Vector3 TerrainSystem::GetNormalSynchronous(float x, float y, Sampler sample
     return outNormal;
 }
 
+void TerrainSystem::GetNormalsSynchronous(
+    const AZStd::vector<AZ::Vector3>& inPositions,
+    Sampler sampler,
+    AZStd::vector<AZ::Vector3>& outNormals,
+    AZStd::vector<bool>& outTerrainExists) const
+{
+    // Each normal needs the same four heights around its position as GetNormalSynchronous, so gather the heights
+    // for all the positions into a single batched height query.
+    const AZ::Vector2 range = (m_currentSettings.m_heightQueryResolution / 2.0f);
+    AZStd::vector<AZ::Vector3> samplePositions;
+    samplePositions.reserve(inPositions.size() * 4);
+    for (const AZ::Vector3& position : inPositions)
+    {
+        const float x = position.GetX();
+        const float y = position.GetY();
+        samplePositions.emplace_back(x, y - range.GetY(), 0.0f); // up
+        samplePositions.emplace_back(x - range.GetX(), y, 0.0f); // left
+        samplePositions.emplace_back(x + range.GetX(), y, 0.0f); // right
+        samplePositions.emplace_back(x, y + range.GetY(), 0.0f); // down
+    }
+
+    AZStd::vector<float> sampleHeights;
+    AZStd::vector<bool> sampleTerrainExists;
+    GetHeightsSynchronous(samplePositions, sampler, sampleHeights, sampleTerrainExists);
+
+    outNormals.resize(inPositions.size());
+    outTerrainExists.resize(inPositions.size());
+    for (size_t index = 0; index < inPositions.size(); index++)
+    {
+        const size_t sampleIndex = index * 4;
+        const AZ::Vector3 v1(samplePositions[sampleIndex + 0].GetX(), samplePositions[sampleIndex + 0].GetY(), sampleHeights[sampleIndex + 0]);
+        const AZ::Vector3 v2(samplePositions[sampleIndex + 1].GetX(), samplePositions[sampleIndex + 1].GetY(), sampleHeights[sampleIndex + 1]);
+        const AZ::Vector3 v3(samplePositions[sampleIndex + 2].GetX(), samplePositions[sampleIndex + 2].GetY(), sampleHeights[sampleIndex + 2]);
+        const AZ::Vector3 v4(samplePositions[sampleIndex + 3].GetX(), samplePositions[sampleIndex + 3].GetY(), sampleHeights[sampleIndex + 3]);
+
+        outNormals[index] = (v3 - v2).Cross(v4 - v1).GetNormalized();
+
+        // Match GetNormalSynchronous, which reports the existence of the last height sample.
+        outTerrainExists[index] = sampleTerrainExists[sampleIndex + 3];
+    }
+}
+
 AZ::Vector3 TerrainSystem::GetNormal(const AZ::Vector3& position, Sampler sampler, bool* terrainExistsPtr) const
 {
     return GetNormalSynchronous(position.GetX(), position.GetY(), sampler, terrainExistsPtr);
@@ -402,9 +635,7 @@ AZ::EntityId TerrainSystem::FindBestAreaEntityAtPosition(float x, float y, AZ::A
 {
     AZ::Vector3 inPosition = AZ::Vector3(x, y, 0);
 
-    // Find the highest priority layer that encompasses this position
-    AZStd::shared_lock<AZStd::shared_mutex> lock(m_areaMutex);
-
+    // Find the highest priority layer that encompasses this position.
     // The areas are sorted into priority order: the first area that contains inPosition is the most suitable.
     for (const auto& [areaId, areaData] : m_registeredAreas)
     {
@@ -426,14 +657,20 @@ void TerrainSystem::GetOrderedSurfaceWeights(
     AzFramework::SurfaceData::SurfaceTagWeightList& outSurfaceWeights,
     bool* terrainExistsPtr) const
 {
-    AZ::Aabb bounds;
-    AZ::EntityId bestAreaId = FindBestAreaEntityAtPosition(x, y, bounds);
-
     if (terrainExistsPtr)
     {
         GetHeightFromFloats(x, y, AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT, terrainExistsPtr);
     }
 
+    AZStd::shared_lock<AZStd::shared_mutex> lock(m_areaMutex);
+    GetAreaSurfaceWeights(x, y, outSurfaceWeights);
+}
+
+void TerrainSystem::GetAreaSurfaceWeights(float x, float y, AzFramework::SurfaceData::SurfaceTagWeightList& outSurfaceWeights) const
+{
+    AZ::Aabb bounds;
+    AZ::EntityId bestAreaId = FindBestAreaEntityAtPosition(x, y, bounds);
+
     outSurfaceWeights.clear();
 
     if (!bestAreaId.IsValid())
@@ -490,9 +727,33 @@ const char* TerrainSystem::GetMaxSurfaceName(
     return "";
 }
 
-/*
+void TerrainSystem::ProcessHeightsFromList(
+    const AZStd::vector<AZ::Vector3>& inPositions, SurfacePointListFillCallback perPositionCallback, Sampler sampleFilter) const
+{
+    // Don't bother processing if we don't have a callback
+    if (!perPositionCallback)
+    {
+        return;
+    }
+
+    AZStd::vector<float> heights;
+    AZStd::vector<bool> terrainExists;
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_areaMutex);
+        GetHeightsSynchronous(inPositions, sampleFilter, heights, terrainExists);
+    }
 
-void TerrainSystem::ProcessHeightsFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2 stepSize, Sampler sampleFilter, SurfacePointRegionFillCallback perPositionCallback, TerrainDataReadyCallback onComplete)
+    // The callbacks run outside of the lock, so they're free to make further terrain queries.
+    AzFramework::SurfaceData::SurfacePoint surfacePoint;
+    for (size_t index = 0; index < inPositions.size(); index++)
+    {
+        surfacePoint.m_position.Set(inPositions[index].GetX(), inPositions[index].GetY(), heights[index]);
+        perPositionCallback(surfacePoint, terrainExists[index]);
+    }
+}
+
+void TerrainSystem::ProcessNormalsFromList(
+    const AZStd::vector<AZ::Vector3>& inPositions, SurfacePointListFillCallback perPositionCallback, Sampler sampleFilter) const
 {
     // Don't bother processing if we don't have a callback
     if (!perPositionCallback)
@@ -500,30 +761,57 @@ void TerrainSystem::ProcessHeightsFromRegion(const AZ::Aabb& inRegion, const AZ:
         return;
     }
 
-    uint32_t numSamplesX = static_cast<uint32_t>((inRegion.GetMax().GetX() - inRegion.GetMin().GetX()) / stepSize.GetX());
-    uint32_t numSamplesY = static_cast<uint32_t>((inRegion.GetMax().GetY() - inRegion.GetMin().GetY()) / stepSize.GetY());
+    AZStd::vector<AZ::Vector3> normals;
+    AZStd::vector<bool> terrainExists;
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_areaMutex);
+        GetNormalsSynchronous(inPositions, sampleFilter, normals, terrainExists);
+    }
 
-    for (uint32_t y = 0; y < numSamplesY; y++)
+    AzFramework::SurfaceData::SurfacePoint surfacePoint;
+    for (size_t index = 0; index < inPositions.size(); index++)
     {
-        for (uint32_t x = 0; x < numSamplesX; x++)
-        {
-            float fx = (float)(inRegion.GetMin().GetX() + (x * stepSize.GetX()));
-            float fy = (float)(inRegion.GetMin().GetY() + (y * stepSize.GetY()));
+        surfacePoint.m_position = inPositions[index];
+        surfacePoint.m_normal = normals[index];
+        perPositionCallback(surfacePoint, terrainExists[index]);
+    }
+}
+
+void TerrainSystem::ProcessSurfaceWeightsFromList(
+    const AZStd::vector<AZ::Vector3>& inPositions,
+    SurfacePointListFillCallback perPositionCallback,
+    [[maybe_unused]] Sampler sampleFilter) const
+{
+    // Don't bother processing if we don't have a callback
+    if (!perPositionCallback)
+    {
+        return;
+    }
 
-            SurfaceData::SurfacePoint surfacePoint;
-            GetHeight(AZ::Vector3(fx, fy, 0.0f), sampleFilter, surfacePoint.m_position);
-            perPositionCallback(surfacePoint, x, y);
+    // Like GetSurfaceWeights, terrain existence comes from the exact height regardless of the sampler.
+    AZStd::vector<float> heights;
+    AZStd::vector<bool> terrainExists;
+    AZStd::vector<AzFramework::SurfaceData::SurfaceTagWeightList> surfaceWeights(inPositions.size());
+    {
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_areaMutex);
+        GetHeightsSynchronous(inPositions, AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT, heights, terrainExists);
+        for (size_t index = 0; index < inPositions.size(); index++)
+        {
+            GetAreaSurfaceWeights(inPositions[index].GetX(), inPositions[index].GetY(), surfaceWeights[index]);
         }
     }
 
-    if (onComplete)
+    AzFramework::SurfaceData::SurfacePoint surfacePoint;
+    for (size_t index = 0; index < inPositions.size(); index++)
     {
-        onComplete();
+        surfacePoint.m_position = inPositions[index];
+        surfacePoint.m_surfaceTags.swap(surfaceWeights[index]);
+        perPositionCallback(surfacePoint, terrainExists[index]);
     }
 }
 
-
-void TerrainSystem::ProcessSurfacePointsFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2 stepSize, Sampler sampleFilter, SurfacePointRegionFillCallback perPositionCallback, TerrainDataReadyCallback onComplete)
+void TerrainSystem::ProcessSurfacePointsFromList(
+    const AZStd::vector<AZ::Vector3>& inPositions, SurfacePointListFillCallback perPositionCallback, Sampler sampleFilter) const
 {
     // Don't bother processing if we don't have a callback
     if (!perPositionCallback)
@@ -531,28 +819,30 @@ void TerrainSystem::ProcessSurfacePointsFromRegion(const AZ::Aabb& inRegion, con
         return;
     }
 
-    uint32_t numSamplesX = static_cast<uint32_t>((inRegion.GetMax().GetX() - inRegion.GetMin().GetX()) / stepSize.GetX());
-    uint32_t numSamplesY = static_cast<uint32_t>((inRegion.GetMax().GetY() - inRegion.GetMin().GetY()) / stepSize.GetY());
-
-    for (uint32_t y = 0; y < numSamplesY; y++)
+    AZStd::vector<float> heights;
+    AZStd::vector<bool> terrainExists;
+    AZStd::vector<AZ::Vector3> normals;
+    AZStd::vector<bool> normalTerrainExists;
+    AZStd::vector<AzFramework::SurfaceData::SurfaceTagWeightList> surfaceWeights(inPositions.size());
     {
-        for (uint32_t x = 0; x < numSamplesX; x++)
+        AZStd::shared_lock<AZStd::shared_mutex> lock(m_areaMutex);
+        GetHeightsSynchronous(inPositions, sampleFilter, heights, terrainExists);
+        GetNormalsSynchronous(inPositions, sampleFilter, normals, normalTerrainExists);
+        for (size_t index = 0; index < inPositions.size(); index++)
         {
-            float fx = (float)(inRegion.GetMin().GetX() + (x * stepSize.GetX()));
-            float fy = (float)(inRegion.GetMin().GetY() + (y * stepSize.GetY()));
-
-            SurfaceData::SurfacePoint surfacePoint;
-            GetSurfacePoint(AZ::Vector3(fx, fy, inRegion.GetMin().GetZ()), sampleFilter, surfacePoint);
-            perPositionCallback(surfacePoint, x, y);
+            GetAreaSurfaceWeights(inPositions[index].GetX(), inPositions[index].GetY(), surfaceWeights[index]);
         }
     }
 
-    if (onComplete)
+    AzFramework::SurfaceData::SurfacePoint surfacePoint;
+    for (size_t index = 0; index < inPositions.size(); index++)
     {
-        onComplete();
+        surfacePoint.m_position.Set(inPositions[index].GetX(), inPositions[index].GetY(), heights[index]);
+        surfacePoint.m_normal = normals[index];
+        surfacePoint.m_surfaceTags.swap(surfaceWeights[index]);
+        perPositionCallback(surfacePoint, terrainExists[index]);
     }
 }
-*/
 
 void TerrainSystem::RegisterArea(AZ::EntityId areaId)
 {
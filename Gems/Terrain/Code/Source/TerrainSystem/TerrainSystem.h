@@ -135,11 +135,26 @@ namespace Terrain
             Sampler sampleFilter = Sampler::DEFAULT,
             bool* terrainExistsPtr = nullptr) const override;
 
+        void ProcessHeightsFromList(
+            const AZStd::vector<AZ::Vector3>& inPositions,
+            SurfacePointListFillCallback perPositionCallback,
+            Sampler sampleFilter = Sampler::DEFAULT) const override;
+        void ProcessNormalsFromList(
+            const AZStd::vector<AZ::Vector3>& inPositions,
+            SurfacePointListFillCallback perPositionCallback,
+            Sampler sampleFilter = Sampler::DEFAULT) const override;
+        void ProcessSurfaceWeightsFromList(
+            const AZStd::vector<AZ::Vector3>& inPositions,
+            SurfacePointListFillCallback perPositionCallback,
+            Sampler sampleFilter = Sampler::DEFAULT) const override;
+        void ProcessSurfacePointsFromList(
+            const AZStd::vector<AZ::Vector3>& inPositions,
+            SurfacePointListFillCallback perPositionCallback,
+            Sampler sampleFilter = Sampler::DEFAULT) const override;
 
     private:
         void ClampPosition(float x, float y, AZ::Vector2& outPosition, AZ::Vector2& normalizedDelta) const;
 
-        AZ::EntityId FindBestAreaEntityAtPosition(float x, float y, AZ::Aabb& bounds) const;
         void GetOrderedSurfaceWeights(
             const float x,
             const float y,
@@ -147,9 +162,28 @@ namespace Terrain
             AzFramework::SurfaceData::SurfaceTagWeightList& outSurfaceWeights,
             bool* terrainExistsPtr) const;
         float GetHeightSynchronous(float x, float y, Sampler sampler, bool* terrainExistsPtr) const;
-        float GetTerrainAreaHeight(float x, float y, bool& terrainExists) const;
         AZ::Vector3 GetNormalSynchronous(float x, float y, Sampler sampler, bool* terrainExistsPtr) const;
 
+        // The following functions expect m_areaMutex to already be locked by the caller, so that batched queries
+        // only need to lock it once.
+        AZ::EntityId FindBestAreaEntityAtPosition(float x, float y, AZ::Aabb& bounds) const;
+        void GetAreaSurfaceWeights(float x, float y, AzFramework::SurfaceData::SurfaceTagWeightList& outSurfaceWeights) const;
+        float GetTerrainAreaHeight(float x, float y, bool& terrainExists) const;
+        void GetTerrainAreaHeights(
+            const AZStd::vector<AZ::Vector3>& inPositions,
+            AZStd::vector<float>& outHeights,
+            AZStd::vector<bool>& outTerrainExists) const;
+        void GetHeightsSynchronous(
+            const AZStd::vector<AZ::Vector3>& inPositions,
+            Sampler sampler,
+            AZStd::vector<float>& outHeights,
+            AZStd::vector<bool>& outTerrainExists) const;
+        void GetNormalsSynchronous(
+            const AZStd::vector<AZ::Vector3>& inPositions,
+            Sampler sampler,
+            AZStd::vector<AZ::Vector3>& outNormals,
+            AZStd::vector<bool>& outTerrainExists) const;
+
         // AZ::TickBus::Handler overrides ...
         void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
 
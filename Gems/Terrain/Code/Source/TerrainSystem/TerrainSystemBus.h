@@ -10,6 +10,7 @@
 
 #include <AzCore/Math/Vector2.h>
 #include <AzCore/Math/Aabb.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/functional.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
 
@@ -67,6 +68,25 @@ namespace Terrain
 
         // Synchronous single input location.  The Vector3 input position versions are defined to ignore the input Z value.
         virtual void GetHeight(const AZ::Vector3& inPosition, AZ::Vector3& outPosition, bool& terrainExists) = 0;
+
+        // Synchronous batched input locations. The input Z values are ignored, and the output vectors are expected to
+        // already be sized to match the input. Providers that can sample many positions at once should override this.
+        virtual void GetHeights(
+            const AZStd::vector<AZ::Vector3>& inPositions, AZStd::vector<float>& outHeights, AZStd::vector<bool>& outTerrainExists)
+        {
+            AZ_Assert(
+                (outHeights.size() == inPositions.size()) && (outTerrainExists.size() == inPositions.size()),
+                "Output vectors need to be sized to match the input positions.");
+
+            for (size_t index = 0; index < inPositions.size(); index++)
+            {
+                AZ::Vector3 outPosition = inPositions[index];
+                bool terrainExists = false;
+                GetHeight(inPositions[index], outPosition, terrainExists);
+                outHeights[index] = outPosition.GetZ();
+                outTerrainExists[index] = terrainExists;
+            }
+        }
     };
 
     using TerrainAreaHeightRequestBus = AZ::EBus<TerrainAreaHeightRequests>;
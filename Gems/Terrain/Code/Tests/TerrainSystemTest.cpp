@@ -572,4 +572,130 @@ namespace UnitTest
         EXPECT_EQ(tagWeight.m_surfaceType, tagWeight1.m_surfaceType);
         EXPECT_NEAR(tagWeight.m_weight, tagWeight1.m_weight, 0.01f);
     }
+
+    TEST_F(TerrainSystemTest, ProcessHeightsFromListMatchesPerPositionQueries)
+    {
+        // The batched height query should give the same heights and existence results as the per-position query,
+        // for every sampler type.
+
+        // The spawner only covers part of the test positions, so some of them won't have terrain.
+        const AZ::Aabb spawnerBox = AZ::Aabb::CreateFromMinMaxValues(-5.0f, -5.0f, -10.0f, 5.0f, 5.0f, 10.0f);
+        auto entity = CreateAndActivateMockTerrainLayerSpawner(
+            spawnerBox,
+            [](AZ::Vector3& position, bool& terrainExists)
+            {
+                position.SetZ(sinf(position.GetX()) + cosf(position.GetY() * 0.5f));
+                terrainExists = true;
+            });
+
+        CreateAndActivateTerrainSystem(AZ::Vector2(0.5f));
+
+        // Use a position count that isn't a multiple of the SIMD width, to cover the padded interpolation.
+        AZStd::vector<AZ::Vector3> inPositions;
+        for (float y = -7.3f; y < 7.0f; y += 1.7f)
+        {
+            for (float x = -6.9f; x < 7.0f; x += 0.9f)
+            {
+                inPositions.emplace_back(x, y, 0.0f);
+            }
+        }
+        inPositions.emplace_back(0.0f, 0.0f, 0.0f);
+
+        const AzFramework::Terrain::TerrainDataRequests::Sampler samplers[] = {
+            AzFramework::Terrain::TerrainDataRequests::Sampler::BILINEAR,
+            AzFramework::Terrain::TerrainDataRequests::Sampler::CLAMP,
+            AzFramework::Terrain::TerrainDataRequests::Sampler::EXACT,
+        };
+
+        for (auto sampler : samplers)
+        {
+            size_t index = 0;
+            m_terrainSystem->ProcessHeightsFromList(
+                inPositions,
+                [this, &inPositions, &index, sampler](const AzFramework::SurfaceData::SurfacePoint& surfacePoint, bool terrainExists)
+                {
+                    ASSERT_LT(index, inPositions.size());
+
+                    bool expectedTerrainExists = false;
+                    const float expectedHeight = m_terrainSystem->GetHeight(inPositions[index], sampler, &expectedTerrainExists);
+
+                    EXPECT_EQ(surfacePoint.m_position.GetX(), inPositions[index].GetX());
+                    EXPECT_EQ(surfacePoint.m_position.GetY(), inPositions[index].GetY());
+                    EXPECT_NEAR(surfacePoint.m_position.GetZ(), expectedHeight, 0.0001f);
+                    EXPECT_EQ(terrainExists, expectedTerrainExists);
+                    index++;
+                },
+                sampler);
+
+            EXPECT_EQ(index, inPositions.size());
+        }
+    }
+
+    TEST_F(TerrainSystemTest, ProcessSurfacePointsFromRegionMatchesPerPositionQueries)
+    {
+        // The batched region query should visit every sample in the region once, and give the same surface points
+        // as the per-position query at the sample positions.
+
+        const AZ::Aabb spawnerBox = AZ::Aabb::CreateFromMinMaxValues(-4.0f, -4.0f, -10.0f, 4.0f, 4.0f, 10.0f);
+        auto entity = CreateAndActivateMockTerrainLayerSpawner(
+            spawnerBox,
+            [](AZ::Vector3& position, bool& terrainExists)
+            {
+                position.SetZ(position.GetX() * 0.5f + position.GetY() * position.GetY() * 0.1f);
+                terrainExists = true;
+            });
+
+        const AZ::Crc32 tag1("tag1");
+        const AZ::Crc32 tag2("tag2");
+        AzFramework::SurfaceData::SurfaceTagWeightList orderedSurfaceWeights{ { tag1, 0.3f }, { tag2, 0.6f } };
+
+        NiceMock<UnitTest::MockTerrainAreaSurfaceRequestBus> mockSurfaceRequests(entity->GetId());
+        ON_CALL(mockSurfaceRequests, GetSurfaceWeights).WillByDefault(SetArgReferee<1>(orderedSurfaceWeights));
+
+        CreateAndActivateTerrainSystem();
+
+        const AZ::Aabb region = AZ::Aabb::CreateFromMinMaxValues(-5.0f, -3.0f, 0.0f, 5.0f, 3.0f, 0.0f);
+        const AZ::Vector2 stepSize(0.75f, 0.5f);
+        const auto [numSamplesX, numSamplesY] =
+            AzFramework::Terrain::TerrainDataRequests::GetNumSamplesFromRegion(region, stepSize);
+        EXPECT_EQ(numSamplesX, 13u);
+        EXPECT_EQ(numSamplesY, 12u);
+
+        AZStd::vector<uint32_t> visitCounts(numSamplesX * numSamplesY, 0);
+        m_terrainSystem->ProcessSurfacePointsFromRegion(
+            region,
+            stepSize,
+            [this, &region, &stepSize, &visitCounts, numSamplesX = numSamplesX, numSamplesY = numSamplesY](
+                size_t xIndex, size_t yIndex, const AzFramework::SurfaceData::SurfacePoint& surfacePoint, bool terrainExists)
+            {
+                ASSERT_LT(xIndex, numSamplesX);
+                ASSERT_LT(yIndex, numSamplesY);
+                visitCounts[yIndex * numSamplesX + xIndex]++;
+
+                const AZ::Vector3 position(
+                    region.GetMin().GetX() + xIndex * stepSize.GetX(), region.GetMin().GetY() + yIndex * stepSize.GetY(), 0.0f);
+
+                AzFramework::SurfaceData::SurfacePoint expectedSurfacePoint;
+                bool expectedTerrainExists = false;
+                m_terrainSystem->GetSurfacePoint(
+                    position, expectedSurfacePoint, AzFramework::Terrain::TerrainDataRequests::Sampler::DEFAULT,
+                    &expectedTerrainExists);
+
+                EXPECT_TRUE(surfacePoint.m_position.IsClose(expectedSurfacePoint.m_position, 0.0001f));
+                EXPECT_TRUE(surfacePoint.m_normal.IsClose(expectedSurfacePoint.m_normal, 0.0001f));
+                EXPECT_EQ(terrainExists, expectedTerrainExists);
+
+                ASSERT_EQ(surfacePoint.m_surfaceTags.size(), expectedSurfacePoint.m_surfaceTags.size());
+                for (size_t tagIndex = 0; tagIndex < surfacePoint.m_surfaceTags.size(); tagIndex++)
+                {
+                    EXPECT_EQ(surfacePoint.m_surfaceTags[tagIndex].m_surfaceType, expectedSurfacePoint.m_surfaceTags[tagIndex].m_surfaceType);
+                    EXPECT_EQ(surfacePoint.m_surfaceTags[tagIndex].m_weight, expectedSurfacePoint.m_surfaceTags[tagIndex].m_weight);
+                }
+            });
+
+        for (uint32_t visitCount : visitCounts)
+        {
+            EXPECT_EQ(visitCount, 1u);
+        }
+    }
 } // namespace UnitTest
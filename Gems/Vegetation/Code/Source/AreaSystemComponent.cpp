@@ -1101,7 +1101,7 @@ namespace Vegetation
         // 0 = lower left corner, 0.5 = center
         const float texelOffset = (sectorPointSnapMode == SnapMode::Center) ? 0.5f : 0.0f;
 
-        SurfaceData::SurfacePointListPerPosition availablePointsPerPosition;
+        SurfaceData::SurfacePointBuffer availablePoints;
         AZ::Vector2 stepSize(vegStep, vegStep);
         AZ::Vector3 regionOffset(texelOffset * vegStep, texelOffset * vegStep, 0.0f);
         AZ::Aabb regionBounds = sectorInfo.m_bounds;
@@ -1116,29 +1116,27 @@ namespace Vegetation
             vegStep * (sectorDensity - 0.5f), 0.0f));
 
         SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
-            &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointsFromRegion,
+            &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointBufferFromRegion,
             regionBounds,
             stepSize,
             SurfaceData::SurfaceTagVector(),
-            availablePointsPerPosition);
+            availablePoints);
 
-        AZ_Assert(availablePointsPerPosition.size() == (sectorDensity * sectorDensity),
-            "Veg sector ended up with unexpected density (%d points created, %d expected)", availablePointsPerPosition.size(),
+        AZ_Assert(availablePoints.GetInputPositionCount() == (sectorDensity * sectorDensity),
+            "Veg sector ended up with unexpected density (%d points created, %d expected)", availablePoints.GetInputPositionCount(),
             (sectorDensity * sectorDensity));
 
+        // The surface points of every position are stored back to back, so they can be claimed in a single pass.
         uint claimIndex = 0;
-        for (auto& availablePoints : availablePointsPerPosition)
-        {
-            for (auto& surfacePoint : availablePoints.second)
-            {
-                sectorInfo.m_baseContext.m_availablePoints.push_back();
-                ClaimPoint& claimPoint = sectorInfo.m_baseContext.m_availablePoints.back();
-                claimPoint.m_handle = CreateClaimHandle(sectorInfo, ++claimIndex);
-                claimPoint.m_position = surfacePoint.m_position;
-                claimPoint.m_normal = surfacePoint.m_normal;
-                claimPoint.m_masks = surfacePoint.m_masks;
-                SurfaceData::AddMaxValueForMasks(sectorInfo.m_baseContext.m_masks, surfacePoint.m_masks);
-            }
+        for (size_t pointIndex = 0; pointIndex < availablePoints.GetTotalPointCount(); ++pointIndex)
+        {
+            sectorInfo.m_baseContext.m_availablePoints.push_back();
+            ClaimPoint& claimPoint = sectorInfo.m_baseContext.m_availablePoints.back();
+            claimPoint.m_handle = CreateClaimHandle(sectorInfo, ++claimIndex);
+            claimPoint.m_position = availablePoints.m_positions[pointIndex];
+            claimPoint.m_normal = availablePoints.m_normals[pointIndex];
+            claimPoint.m_masks = AZStd::move(availablePoints.m_masks[pointIndex]);
+            SurfaceData::AddMaxValueForMasks(sectorInfo.m_baseContext.m_masks, claimPoint.m_masks);
         }
     }
 